@@ -252,6 +252,27 @@ inline mgp_vertex *graph_get_vertex_by_id(mgp_graph *g, mgp_vertex_id id, mgp_me
   return MgInvoke<mgp_vertex *>(mgp_graph_get_vertex_by_id, g, id, memory);
 }
 
+inline size_t graph_vertex_ordinal_count(mgp_graph *graph) {
+  return MgInvoke<size_t>(mgp_graph_vertex_ordinal_count, graph);
+}
+
+inline mgp_vertex *graph_get_vertex_by_ordinal(mgp_graph *graph, size_t ordinal, mgp_memory *memory) {
+  return MgInvoke<mgp_vertex *>(mgp_graph_get_vertex_by_ordinal, graph, ordinal, memory);
+}
+
+inline size_t graph_parallel_worker_count(mgp_graph *graph) {
+  return MgInvoke<size_t>(mgp_graph_parallel_worker_count, graph);
+}
+
+inline void graph_parallel_for_vertices(mgp_graph *graph, size_t grain_size, mgp_vertex_range_cb cb, void *data) {
+  MgInvokeVoid(mgp_graph_parallel_for_vertices, graph, grain_size, cb, data);
+}
+
+inline void graph_parallel_for(mgp_graph *graph, size_t size, size_t grain_size, size_t max_workers, mgp_range_cb cb,
+                               void *data) {
+  MgInvokeVoid(mgp_graph_parallel_for, graph, size, grain_size, max_workers, cb, data);
+}
+
 inline mgp_vertices_iterator *graph_iter_vertices(mgp_graph *g, mgp_memory *memory) {
   return MgInvoke<mgp_vertices_iterator *>(mgp_graph_iter_vertices, g, memory);
 }
@@ -268,6 +289,60 @@ inline mgp_vertex *vertices_iterator_next(mgp_vertices_iterator *it) {
   return MgInvoke<mgp_vertex *>(mgp_vertices_iterator_next, it);
 }
 
+// mgp_graph_projection
+
+inline mgp_graph_projection *graph_get_projection(mgp_graph *graph, const char *name, mgp_memory *memory) {
+  return MgInvoke<mgp_graph_projection *>(mgp_graph_get_projection, graph, name, memory);
+}
+
+inline void graph_projection_destroy(mgp_graph_projection *projection) { mgp_graph_projection_destroy(projection); }
+
+inline size_t graph_projection_vertex_count(mgp_graph_projection *projection) {
+  return MgInvoke<size_t>(mgp_graph_projection_vertex_count, projection);
+}
+
+inline size_t graph_projection_edge_count(mgp_graph_projection *projection) {
+  return MgInvoke<size_t>(mgp_graph_projection_edge_count, projection);
+}
+
+inline bool graph_projection_has_weights(mgp_graph_projection *projection) {
+  return MgInvoke<int>(mgp_graph_projection_has_weights, projection);
+}
+
+inline mgp_vertex_id graph_projection_vertex_id(mgp_graph_projection *projection, size_t ordinal) {
+  return MgInvoke<mgp_vertex_id>(mgp_graph_projection_vertex_id, projection, ordinal);
+}
+
+inline size_t graph_projection_vertex_ordinal(mgp_graph_projection *projection, mgp_vertex_id id) {
+  return MgInvoke<size_t>(mgp_graph_projection_vertex_ordinal, projection, id);
+}
+
+inline const uint64_t *graph_projection_out_neighbors(mgp_graph_projection *projection, size_t ordinal,
+                                                      size_t *count) {
+  const uint64_t *neighbors{nullptr};
+  MgInvokeVoid(mgp_graph_projection_out_neighbors, projection, ordinal, &neighbors, count);
+  return neighbors;
+}
+
+inline const uint64_t *graph_projection_in_neighbors(mgp_graph_projection *projection, size_t ordinal,
+                                                     size_t *count) {
+  const uint64_t *neighbors{nullptr};
+  MgInvokeVoid(mgp_graph_projection_in_neighbors, projection, ordinal, &neighbors, count);
+  return neighbors;
+}
+
+inline const double *graph_projection_out_weights(mgp_graph_projection *projection, size_t ordinal) {
+  return MgInvoke<const double *>(mgp_graph_projection_out_weights, projection, ordinal);
+}
+
+inline const double *graph_projection_in_weights(mgp_graph_projection *projection, size_t ordinal) {
+  return MgInvoke<const double *>(mgp_graph_projection_in_weights, projection, ordinal);
+}
+
+inline const double *graph_projection_vertex_property(mgp_graph_projection *projection, const char *name) {
+  return MgInvoke<const double *>(mgp_graph_projection_vertex_property, projection, name);
+}
+
 // mgp_edges_iterator
 
 inline void edges_iterator_destroy(mgp_edges_iterator *it) { mgp_edges_iterator_destroy(it); }
@@ -352,6 +427,8 @@ inline mgp_map_item *map_items_iterator_next(mgp_map_items_iterator *it) {
 
 inline mgp_vertex_id vertex_get_id(mgp_vertex *v) { return MgInvoke<mgp_vertex_id>(mgp_vertex_get_id, v); }
 
+inline size_t vertex_get_ordinal(mgp_vertex *v) { return MgInvoke<size_t>(mgp_vertex_get_ordinal, v); }
+
 inline mgp_vertex *vertex_copy(mgp_vertex *v, mgp_memory *memory) {
   return MgInvoke<mgp_vertex *>(mgp_vertex_copy, v, memory);
 }
@@ -677,6 +754,16 @@ inline mgp_proc *module_add_write_procedure(mgp_module *module, const char *name
   return MgInvoke<mgp_proc *>(mgp_module_add_write_procedure, module, name, cb);
 }
 
+inline mgp_proc *module_add_batch_read_procedure(mgp_module *module, const char *name, mgp_proc_batch_init init,
+                                                 mgp_proc_batch_cb cb, mgp_proc_batch_cleanup cleanup) {
+  return MgInvoke<mgp_proc *>(mgp_module_add_batch_read_procedure, module, name, init, cb, cleanup);
+}
+
+inline mgp_proc *module_add_batch_write_procedure(mgp_module *module, const char *name, mgp_proc_batch_init init,
+                                                  mgp_proc_batch_cb cb, mgp_proc_batch_cleanup cleanup) {
+  return MgInvoke<mgp_proc *>(mgp_module_add_batch_write_procedure, module, name, init, cb, cleanup);
+}
+
 inline void proc_add_arg(mgp_proc *proc, const char *name, mgp_type *type) {
   MgInvokeVoid(mgp_proc_add_arg, proc, name, type);
 }
@@ -705,6 +792,8 @@ inline mgp_result_record *result_new_record(mgp_result *res) {
   return MgInvoke<mgp_result_record *>(mgp_result_new_record, res);
 }
 
+inline size_t result_batch_size(mgp_result *res) { return MgInvoke<size_t>(mgp_result_batch_size, res); }
+
 inline void result_record_insert(mgp_result_record *record, const char *field_name, mgp_value *val) {
   MgInvokeVoid(mgp_result_record_insert, record, field_name, val);
 }
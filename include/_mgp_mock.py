@@ -1,3 +1,4 @@
+import array
 import typing
 from enum import Enum
 
@@ -26,6 +27,10 @@ class ImmutableObjectError(Exception):
     pass
 
 
+class OutOfRangeError(Exception):
+    pass
+
+
 class LogicErrorError(Exception):
     pass
 
@@ -34,6 +39,10 @@ class DeletedObjectError(Exception):
     pass
 
 
+class ValueConversionError(Exception):
+    pass
+
+
 class EdgeConstants(Enum):
     I_START = 0
     I_END = 1
@@ -43,7 +52,7 @@ class EdgeConstants(Enum):
 class Graph:
     """Wrapper around a NetworkX MultiDiGraph instance."""
 
-    __slots__ = ("nx", "_highest_vertex_id", "_highest_edge_id", "_valid")
+    __slots__ = ("nx", "_highest_vertex_id", "_highest_edge_id", "_valid", "_ordinal_vertex_ids", "_vertex_ordinals")
 
     def __init__(self, graph: nx.MultiDiGraph) -> None:
         if not isinstance(graph, nx.MultiDiGraph):
@@ -53,6 +62,8 @@ class Graph:
         self._highest_vertex_id = None
         self._highest_edge_id = None
         self._valid = True
+        self._ordinal_vertex_ids = None
+        self._vertex_ordinals = None
 
     @property
     def vertex_ids(self):
@@ -78,6 +89,39 @@ class Graph:
     def get_vertex_by_id(self, vertex_id: int) -> "Vertex":
         return Vertex(vertex_id, self)
 
+    def _number_vertices(self):
+        if self._ordinal_vertex_ids is None:
+            self._ordinal_vertex_ids = list(self.nx.nodes)
+            self._vertex_ordinals = {vertex_id: i for i, vertex_id in enumerate(self._ordinal_vertex_ids)}
+
+    def vertex_ordinal_count(self) -> int:
+        self._number_vertices()
+        return len(self._ordinal_vertex_ids)
+
+    def get_vertex_by_ordinal(self, ordinal: int) -> "Vertex":
+        self._number_vertices()
+        if not 0 <= ordinal < len(self._ordinal_vertex_ids):
+            raise OutOfRangeError(f"Vertex ordinal {ordinal} is out of range.")
+        return Vertex(self._ordinal_vertex_ids[ordinal], self)
+
+    def vertex_property_column(self, property_name: str, typecode: str, default) -> memoryview:
+        self._number_vertices()
+        column = array.array(typecode)
+        for vertex_id in self._ordinal_vertex_ids:
+            value = self.nx.nodes[vertex_id].get(property_name)
+            if value is None:
+                value = default
+            elif isinstance(value, bool) or not isinstance(value, int if typecode == "q" else (int, float)):
+                raise ValueConversionError(f"Property '{property_name}' of vertex {vertex_id} isn't a number.")
+            column.append(value)
+        return memoryview(column)
+
+    def vertex_ordinal(self, vertex_id: int) -> int:
+        self._number_vertices()
+        if vertex_id not in self._vertex_ordinals:
+            raise OutOfRangeError(f"Vertex with ID {vertex_id} doesn't have an ordinal.")
+        return self._vertex_ordinals[vertex_id]
+
     def invalidate(self):
         self._valid = False
 
@@ -170,6 +214,10 @@ class Vertex:
     def underlying_graph(self) -> Graph:
         return self._graph
 
+    @property
+    def ordinal(self) -> int:
+        return self._graph.vertex_ordinal(self._id)
+
     def underlying_graph_is_mutable(self) -> bool:
         return not nx.is_frozen(self._graph.nx)
 
@@ -571,6 +571,12 @@ enum mgp_error mgp_result_set_error_msg(struct mgp_result *res, const char *erro
 /// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_result_record.
 enum mgp_error mgp_result_new_record(struct mgp_result *res, struct mgp_result_record **result);
 
+/// Get the number of records a call of a batched procedure should produce.
+/// Producing more is allowed, but it raises the memory needed to hold the
+/// batch. The size is 0 for procedures which aren't batched, as they produce
+/// all of their records in a single call.
+enum mgp_error mgp_result_batch_size(struct mgp_result *res, size_t *result);
+
 /// Assign a value to a field in the given record.
 /// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory to copy the mgp_value to
 /// mgp_result_record. Return mgp_error::MGP_ERROR_OUT_OF_RANGE if there is no field named `field_name`. Return
@@ -635,6 +641,12 @@ struct mgp_vertex_id {
 /// Get the ID of given vertex.
 enum mgp_error mgp_vertex_get_id(struct mgp_vertex *v, struct mgp_vertex_id *result);
 
+/// Get the ordinal of given vertex in the dense numbering of the vertices of
+/// its graph, see mgp_graph_vertex_ordinal_count.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if the vertex was created after the vertices were numbered.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the numbering.
+enum mgp_error mgp_vertex_get_ordinal(struct mgp_vertex *v, size_t *result);
+
 /// Result is non-zero if the vertex can be modified.
 /// The mutability of the vertex is the same as the graph which it is part of. If a vertex is immutable, then edges
 /// cannot be created or deleted, properties and labels cannot be set or removed and all of the returned edges will be
@@ -820,6 +832,75 @@ struct mgp_graph;
 enum mgp_error mgp_graph_get_vertex_by_id(struct mgp_graph *g, struct mgp_vertex_id id, struct mgp_memory *memory,
                                           struct mgp_vertex **result);
 
+/// Get the number of vertices in the dense numbering of the graph's vertices.
+/// The first time any of the vertex ordinal functions is called, the vertices
+/// visible in the graph are numbered from 0 to the count minus 1, so that a
+/// procedure can keep per-vertex state in flat arrays indexed by
+/// mgp_vertex_get_ordinal. Numbering the vertices takes a pass over the graph,
+/// after which all ordinal functions take constant time. Vertices created
+/// after the numbering don't have an ordinal.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the numbering.
+enum mgp_error mgp_graph_vertex_ordinal_count(struct mgp_graph *graph, size_t *result);
+
+/// Get the vertex with the given ordinal, see mgp_graph_vertex_ordinal_count.
+/// Resulting vertex must be freed using mgp_vertex_destroy.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `ordinal` isn't less than the vertex ordinal count.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the numbering or the vertex.
+enum mgp_error mgp_graph_get_vertex_by_ordinal(struct mgp_graph *graph, size_t ordinal, struct mgp_memory *memory,
+                                               struct mgp_vertex **result);
+
+/// Get the number of workers which mgp_graph_parallel_for_vertices runs on.
+/// The count is set with the `--query-procedure-parallel-workers` flag, and
+/// it's 1 when parallel execution is disabled or when `graph` was handed to a
+/// mgp_vertex_range_cb, as workers don't fan out any further.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_parallel_worker_count(struct mgp_graph *graph, size_t *result);
+
+/// Callback which processes the vertices with ordinals in [begin, end).
+/// `graph` is a read-only view of the graph which may be used concurrently with
+/// the views of the other workers, while the graph passed to
+/// mgp_graph_parallel_for_vertices mustn't be used until it returns. Vertices,
+/// edges and values obtained from `graph` belong to the worker and mustn't be
+/// shared with other workers. `memory` is the arena of the worker, which is
+/// freed when mgp_graph_parallel_for_vertices returns, so everything allocated
+/// in it has to be destroyed or copied out before that. The arena counts
+/// against the memory limit of the query. `worker` is the index
+/// of the worker calling the callback, less than mgp_graph_parallel_worker_count,
+/// and can be used to index per-worker state in `data`.
+/// Returning anything other than mgp_error::MGP_ERROR_NO_ERROR stops the
+/// processing of the remaining ranges.
+typedef enum mgp_error (*mgp_vertex_range_cb)(struct mgp_graph *graph, size_t worker, size_t begin, size_t end,
+                                              struct mgp_memory *memory, void *data);
+
+/// Call `cb` for consecutive ranges of at most `grain_size` vertex ordinals
+/// which together cover all vertices of the graph, see
+/// mgp_graph_vertex_ordinal_count. The ranges are handed out to the workers as
+/// they finish the previous ones, and the call returns once all ranges have
+/// been processed. Graphs which can be modified are processed read-only.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `grain_size` is 0.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the numbering.
+/// Return the first error returned by `cb`, if any.
+enum mgp_error mgp_graph_parallel_for_vertices(struct mgp_graph *graph, size_t grain_size, mgp_vertex_range_cb cb,
+                                               void *data);
+
+/// Callback which processes the indices in [begin, end). Unlike
+/// mgp_vertex_range_cb, it gets no graph and no memory, so it mustn't call the
+/// rest of the API; it's meant for procedures which work on their own arrays.
+/// `worker` is the index of the worker calling the callback, less than
+/// mgp_graph_parallel_worker_count.
+/// Returning anything other than mgp_error::MGP_ERROR_NO_ERROR stops the
+/// processing of the remaining ranges.
+typedef enum mgp_error (*mgp_range_cb)(size_t worker, size_t begin, size_t end, void *data);
+
+/// Call `cb` for consecutive ranges of at most `grain_size` indices which
+/// together cover [0, size), on the same workers as
+/// mgp_graph_parallel_for_vertices. At most `max_workers` workers are used, or
+/// all of them if it's 0. The call returns once all ranges have been processed.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `grain_size` is 0.
+/// Return the first error returned by `cb`, if any.
+enum mgp_error mgp_graph_parallel_for(struct mgp_graph *graph, size_t size, size_t grain_size, size_t max_workers,
+                                      mgp_range_cb cb, void *data);
+
 /// Result is non-zero if the graph can be modified.
 /// If a graph is immutable, then vertices cannot be created or deleted, and all of the returned vertices will be
 /// immutable also. The same applies for edges.
@@ -881,6 +962,81 @@ enum mgp_error mgp_vertices_iterator_underlying_graph_is_mutable(struct mgp_vert
 /// Result is NULL if the end of the iteration has been reached.
 enum mgp_error mgp_vertices_iterator_get(struct mgp_vertices_iterator *it, struct mgp_vertex **result);
 
+/// Read-only projection of the graph in compressed sparse row format.
+/// Projections are built with the `mg.project_graph` procedure at the snapshot of its transaction and are cached by
+/// name until they are replaced or dropped with `mg.drop_graph_projection`. The projected vertices are numbered from 0
+/// to the vertex count minus 1, and their neighbors are returned as arrays of ordinals which point directly into the
+/// projection. The arrays stay valid until the mgp_graph_projection is destroyed.
+struct mgp_graph_projection;
+
+/// Get the projection the user running the procedure cached under the given name from the same database.
+/// Result is NULL if there's no projection with the given name.
+/// Resulting projection must be freed using mgp_graph_projection_destroy.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_graph_projection.
+/// Return mgp_error::MGP_ERROR_AUTHORIZATION_ERROR if fine-grained access control applies to the user, as projections
+/// don't respect it.
+enum mgp_error mgp_graph_get_projection(struct mgp_graph *graph, const char *name, struct mgp_memory *memory,
+                                        struct mgp_graph_projection **result);
+
+/// Free the memory used by a mgp_graph_projection.
+/// The projection itself is freed once it's dropped and no procedure uses it.
+void mgp_graph_projection_destroy(struct mgp_graph_projection *projection);
+
+/// Get the number of projected vertices.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_vertex_count(struct mgp_graph_projection *projection, size_t *result);
+
+/// Get the number of projected edges.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_edge_count(struct mgp_graph_projection *projection, size_t *result);
+
+/// Result is non-zero if the edge weights were projected.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_has_weights(struct mgp_graph_projection *projection, int *result);
+
+/// Get the ID of the projected vertex with the given ordinal.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `ordinal` isn't less than the vertex count.
+enum mgp_error mgp_graph_projection_vertex_id(struct mgp_graph_projection *projection, size_t ordinal,
+                                              struct mgp_vertex_id *result);
+
+/// Get the ordinal of the vertex with the given ID.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if the vertex isn't projected.
+enum mgp_error mgp_graph_projection_vertex_ordinal(struct mgp_graph_projection *projection, struct mgp_vertex_id id,
+                                                   size_t *result);
+
+/// Get the ordinals of the targets of the outgoing edges of the vertex with the given ordinal.
+/// `neighbors` is set to an array of `count` ordinals, which isn't copied.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `ordinal` isn't less than the vertex count.
+enum mgp_error mgp_graph_projection_out_neighbors(struct mgp_graph_projection *projection, size_t ordinal,
+                                                  const uint64_t **neighbors, size_t *count);
+
+/// Get the ordinals of the sources of the incoming edges of the vertex with the given ordinal.
+/// `neighbors` is set to an array of `count` ordinals, which isn't copied.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `ordinal` isn't less than the vertex count.
+enum mgp_error mgp_graph_projection_in_neighbors(struct mgp_graph_projection *projection, size_t ordinal,
+                                                 const uint64_t **neighbors, size_t *count);
+
+/// Get the weights of the outgoing edges of the vertex with the given ordinal.
+/// Result is an array of weights in the order of mgp_graph_projection_out_neighbors, or NULL if the edge weights
+/// weren't projected.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `ordinal` isn't less than the vertex count.
+enum mgp_error mgp_graph_projection_out_weights(struct mgp_graph_projection *projection, size_t ordinal,
+                                                const double **result);
+
+/// Get the weights of the incoming edges of the vertex with the given ordinal.
+/// Result is an array of weights in the order of mgp_graph_projection_in_neighbors, or NULL if the edge weights
+/// weren't projected.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `ordinal` isn't less than the vertex count.
+enum mgp_error mgp_graph_projection_in_weights(struct mgp_graph_projection *projection, size_t ordinal,
+                                               const double **result);
+
+/// Get the values of the projected vertex property with the given name.
+/// Result is an array of values indexed by vertex ordinal, with NaN for the vertices which don't have the property, or
+/// NULL if the property wasn't projected.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_vertex_property(struct mgp_graph_projection *projection, const char *name,
+                                                    const double **result);
+
 /// @name Temporal Types
 ///
 ///@{
@@ -1342,6 +1498,65 @@ enum mgp_error mgp_module_add_read_procedure(struct mgp_module *module, const ch
 enum mgp_error mgp_module_add_write_procedure(struct mgp_module *module, const char *name, mgp_proc_cb cb,
                                               struct mgp_proc **result);
 
+/// Entry-point which starts a call of a batched query module procedure.
+///
+/// The callback receives the arguments of the call and returns the state of
+/// the call, which is passed to all other callbacks of the call. The passed in
+/// mgp_graph and mgp_memory stay valid until the call is cleaned up, so the
+/// state may be allocated with the mgp_memory and it may keep graph elements.
+/// The arguments don't outlive the callback. An error set on the mgp_result
+/// ends the call. The callback may not produce records.
+typedef void *(*mgp_proc_batch_init)(struct mgp_list *, struct mgp_graph *, struct mgp_result *,
+                                     struct mgp_memory *);
+
+/// Entry-point which produces the next batch of records of a call of a batched
+/// query module procedure.
+///
+/// The callback is invoked repeatedly with the state returned by the
+/// mgp_proc_batch_init callback, and should produce up to
+/// mgp_result_batch_size records on each invocation. The records are consumed
+/// before the callback is invoked again, so they don't all have to be kept in
+/// memory at once. The call ends once the callback produces no records or sets
+/// an error.
+typedef void (*mgp_proc_batch_cb)(void *, struct mgp_graph *, struct mgp_result *, struct mgp_memory *);
+
+/// Entry-point which cleans up the state of a call of a batched query module
+/// procedure.
+///
+/// The callback is invoked once for every successful mgp_proc_batch_init
+/// invocation, whether the call produced all of its records or not.
+typedef void (*mgp_proc_batch_cleanup)(void *, struct mgp_memory *);
+
+/// Register a read-only batched procedure to a module.
+///
+/// A batched procedure produces its records in batches, so that query
+/// execution can consume the records of a batch before the next one is
+/// produced. That bounds the memory needed for procedures which produce many
+/// records. See mgp_proc_batch_init, mgp_proc_batch_cb and
+/// mgp_proc_batch_cleanup.
+///
+/// The `name` must be a valid identifier, following the same rules as the
+/// procedure`name` in mgp_module_add_read_procedure.
+///
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for mgp_proc.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `name` is not a valid procedure name.
+/// RETURN mgp_error::MGP_ERROR_LOGIC_ERROR if a procedure with the same name was already registered.
+enum mgp_error mgp_module_add_batch_read_procedure(struct mgp_module *module, const char *name,
+                                                   mgp_proc_batch_init init, mgp_proc_batch_cb cb,
+                                                   mgp_proc_batch_cleanup cleanup, struct mgp_proc **result);
+
+/// Register a writeable batched procedure to a module.
+///
+/// The `name` must be a valid identifier, following the same rules as the
+/// procedure`name` in mgp_module_add_read_procedure.
+///
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for mgp_proc.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `name` is not a valid procedure name.
+/// RETURN mgp_error::MGP_ERROR_LOGIC_ERROR if a procedure with the same name was already registered.
+enum mgp_error mgp_module_add_batch_write_procedure(struct mgp_module *module, const char *name,
+                                                    mgp_proc_batch_init init, mgp_proc_batch_cb cb,
+                                                    mgp_proc_batch_cleanup cleanup, struct mgp_proc **result);
+
 /// Add a required argument to a procedure.
 ///
 /// The order of adding arguments will correspond to the order the procedure
@@ -1506,6 +1721,11 @@ enum mgp_error mgp_messages_size(struct mgp_messages *message, size_t *result);
 /// Get the message from a messages list at given index
 enum mgp_error mgp_messages_at(struct mgp_messages *message, size_t index, struct mgp_message **result);
 
+/// Get the configuration of the transformation given with TRANSFORM_CONFIG when the stream was created.
+/// Result is a map of strings, which is empty if no configuration was given. The map is valid as long as the messages.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_messages_transformation_config(struct mgp_messages *messages, struct mgp_map **result);
+
 /// Entry-point for a module transformation, invoked through a stream transformation.
 ///
 /// Passed in arguments will not live longer than the callback's execution.
@@ -12,10 +12,17 @@
 #pragma once
 
 #include <cstring>
+#include <exception>
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "_mgp.hpp"
@@ -58,6 +65,7 @@ class NotEnoughMemoryException : public std::exception {
 // Forward declarations
 class Nodes;
 using GraphNodes = Nodes;
+class GraphProjection;
 class GraphRelationships;
 class Relationships;
 class Node;
@@ -69,7 +77,9 @@ class Value;
 struct StealType {};
 inline constexpr StealType steal{};
 
-inline mgp_memory *memory{nullptr};
+// Thread-local, so that the workers of Graph::ParallelForNodes can allocate from
+// arenas of their own.
+inline thread_local mgp_memory *memory{nullptr};
 
 /* #region Graph (Id, Graph, Nodes, GraphRelationships, Relationships & Labels) */
 
@@ -119,6 +129,31 @@ class Graph {
   /// @brief Returns the graph node with the given ID.
   Node GetNodeById(const Id node_id) const;
 
+  /// @brief Returns the number of nodes in the dense numbering of the graph’s nodes. The nodes are numbered from 0 to
+  /// the count minus 1 on first use, so that per-node state can be kept in flat arrays indexed by Node::Ordinal().
+  size_t NodeOrdinalCount() const;
+  /// @brief Returns the graph node with the given ordinal.
+  Node GetNodeByOrdinal(size_t ordinal) const;
+
+  /// @brief Returns the number of workers ParallelForNodes() runs on.
+  size_t ParallelWorkerCount() const;
+  /// @brief Calls `func(graph, worker, begin, end)` for consecutive ranges of at most `grain_size` node ordinals,
+  /// which together cover all nodes of the graph, on multiple threads. `graph` is a read-only view of this graph,
+  /// which is the only one `func` may use, and `worker` is the index of the calling worker, less than
+  /// ParallelWorkerCount(). Each worker allocates from its own memory arena, so the values created in `func` mustn't
+  /// outlive the call of ParallelForNodes(). The first exception thrown by `func` is rethrown.
+  template <typename TFunc>
+  void ParallelForNodes(size_t grain_size, TFunc &&func) const;
+  /// @brief Calls `func(worker, begin, end)` for consecutive ranges of at most `grain_size` indices, which together
+  /// cover [0, size), on the workers of ParallelForNodes(), using at most `max_workers` of them, or all if it's 0.
+  /// `func` mustn't use the graph nor allocate from mgp::memory; it's meant for work on the procedure’s own arrays.
+  /// The first exception thrown by `func` is rethrown.
+  template <typename TFunc>
+  void ParallelFor(size_t size, size_t grain_size, size_t max_workers, TFunc &&func) const;
+
+  /// @brief Returns the graph projection cached under the given name, or std::nullopt if there’s none.
+  std::optional<GraphProjection> GetProjection(std::string_view name) const;
+
   /// @brief Returns whether the graph contains a node with the given ID.
   bool ContainsNode(const Id node_id) const;
   /// @brief Returns whether the graph contains the given node.
@@ -145,6 +180,45 @@ class Graph {
   mgp_graph *graph_;
 };
 
+/// @brief Read-only projection of the graph in compressed sparse row format, built with `mg.project_graph`; wrapper
+/// class for @ref mgp_graph_projection.
+/// The projected nodes are numbered from 0 to NodeCount() minus 1, and the neighbor spans point directly into the
+/// projection.
+class GraphProjection {
+ public:
+  explicit GraphProjection(mgp_graph_projection *projection);
+
+  /// @brief Returns the number of projected nodes.
+  size_t NodeCount() const;
+  /// @brief Returns the number of projected relationships.
+  size_t RelationshipCount() const;
+  /// @brief Returns whether the relationship weights were projected.
+  bool HasWeights() const;
+
+  /// @brief Returns the ID of the projected node with the given ordinal.
+  mgp::Id NodeId(size_t ordinal) const;
+  /// @brief Returns the ordinal of the projected node with the given ID.
+  size_t NodeOrdinal(mgp::Id node_id) const;
+
+  /// @brief Returns the ordinals of the targets of the node’s outgoing relationships.
+  std::span<const uint64_t> OutNeighbors(size_t ordinal) const;
+  /// @brief Returns the ordinals of the sources of the node’s incoming relationships.
+  std::span<const uint64_t> InNeighbors(size_t ordinal) const;
+  /// @brief Returns the weights of the node’s outgoing relationships in the order of OutNeighbors(), or an empty
+  /// span if the weights weren’t projected.
+  std::span<const double> OutWeights(size_t ordinal) const;
+  /// @brief Returns the weights of the node’s incoming relationships in the order of InNeighbors(), or an empty span
+  /// if the weights weren’t projected.
+  std::span<const double> InWeights(size_t ordinal) const;
+
+  /// @brief Returns the values of the projected node property indexed by ordinal, with NaN for the nodes which don’t
+  /// have it, or std::nullopt if the property wasn’t projected.
+  std::optional<std::span<const double>> NodeProperty(std::string_view name) const;
+
+ private:
+  std::shared_ptr<mgp_graph_projection> projection_;
+};
+
 /// @brief View of graph nodes; wrapper class for @ref mgp_vertices_iterator.
 class Nodes {
  public:
@@ -559,6 +633,9 @@ class Node {
   /// @brief Returns the node’s ID.
   mgp::Id Id() const;
 
+  /// @brief Returns the node’s ordinal in the dense numbering of its graph’s nodes, see Graph::NodeOrdinalCount().
+  size_t Ordinal() const;
+
   /// @brief Returns an iterable & indexable structure of the node’s labels.
   mgp::Labels Labels() const;
 
@@ -1178,6 +1255,10 @@ class RecordFactory {
 
   const Record NewRecord() const;
 
+  /// @brief Returns the number of records a call of a batched procedure should produce, or 0 if the procedure isn’t
+  /// batched.
+  size_t BatchSize() const;
+
   void SetErrorMessage(const std::string_view error_msg) const;
 
   void SetErrorMessage(const char *error_msg) const;
@@ -1305,6 +1386,21 @@ inline void AddProcedure(mgp_proc_cb callback, std::string_view name, ProcedureT
                          std::vector<Parameter> parameters, std::vector<Return> returns, mgp_module *module,
                          mgp_memory *memory);
 
+/// @brief Adds a batched procedure to the query module. The procedure produces its records in batches of about
+/// RecordFactory::BatchSize() records, so that they don’t all have to be kept in memory at once.
+/// @param init - callback which starts a call of the procedure and returns its state
+/// @param callback - callback which produces the next batch of records, the call ends once it produces none
+/// @param cleanup - callback which cleans up the state of a call
+/// @param name - procedure name
+/// @param proc_type - procedure type (read/write)
+/// @param parameters - procedure parameters
+/// @param returns - procedure return values
+/// @param module - the query module that the procedure is added to
+/// @param memory - access to memory
+inline void AddBatchProcedure(mgp_proc_batch_init init, mgp_proc_batch_cb callback, mgp_proc_batch_cleanup cleanup,
+                              std::string_view name, ProcedureType proc_type, std::vector<Parameter> parameters,
+                              std::vector<Return> returns, mgp_module *module, mgp_memory *memory);
+
 /// @brief Adds a function to the query module.
 /// @param callback - function callback
 /// @param name - function name
@@ -1609,6 +1705,71 @@ inline Node Graph::GetNodeById(const Id node_id) const {
   return node;
 }
 
+inline size_t Graph::NodeOrdinalCount() const { return mgp::graph_vertex_ordinal_count(graph_); }
+
+inline Node Graph::GetNodeByOrdinal(size_t ordinal) const {
+  auto mgp_node = mgp::graph_get_vertex_by_ordinal(graph_, ordinal, memory);
+  auto node = Node(mgp_node);
+  mgp::vertex_destroy(mgp_node);
+  return node;
+}
+
+inline size_t Graph::ParallelWorkerCount() const { return mgp::graph_parallel_worker_count(graph_); }
+
+template <typename TFunc>
+void Graph::ParallelForNodes(size_t grain_size, TFunc &&func) const {
+  struct ParallelForData {
+    std::remove_reference_t<TFunc> *func{nullptr};
+    std::mutex lock;
+    std::exception_ptr exception;
+  };
+  ParallelForData data;
+  data.func = &func;
+  auto callback = [](mgp_graph *graph, size_t worker, size_t begin, size_t end, mgp_memory *worker_memory,
+                     void *raw_data) {
+    auto &data = *static_cast<ParallelForData *>(raw_data);
+    auto *const previous_memory = std::exchange(mgp::memory, worker_memory);
+    auto error = mgp_error::MGP_ERROR_NO_ERROR;
+    try {
+      (*data.func)(Graph(graph), worker, begin, end);
+    } catch (...) {
+      const std::lock_guard guard(data.lock);
+      if (!data.exception) data.exception = std::current_exception();
+      error = mgp_error::MGP_ERROR_UNKNOWN_ERROR;
+    }
+    mgp::memory = previous_memory;
+    return error;
+  };
+  const auto error = mgp_graph_parallel_for_vertices(graph_, grain_size, callback, &data);
+  if (data.exception) std::rethrow_exception(data.exception);
+  MgExceptionHandle(error);
+}
+
+template <typename TFunc>
+void Graph::ParallelFor(size_t size, size_t grain_size, size_t max_workers, TFunc &&func) const {
+  struct ParallelForData {
+    std::remove_reference_t<TFunc> *func{nullptr};
+    std::mutex lock;
+    std::exception_ptr exception;
+  };
+  ParallelForData data;
+  data.func = &func;
+  auto callback = [](size_t worker, size_t begin, size_t end, void *raw_data) {
+    auto &data = *static_cast<ParallelForData *>(raw_data);
+    try {
+      (*data.func)(worker, begin, end);
+    } catch (...) {
+      const std::lock_guard guard(data.lock);
+      if (!data.exception) data.exception = std::current_exception();
+      return mgp_error::MGP_ERROR_UNKNOWN_ERROR;
+    }
+    return mgp_error::MGP_ERROR_NO_ERROR;
+  };
+  const auto error = mgp_graph_parallel_for(graph_, size, grain_size, max_workers, callback, &data);
+  if (data.exception) std::rethrow_exception(data.exception);
+  MgExceptionHandle(error);
+}
+
 inline bool Graph::ContainsNode(const Id node_id) const {
   auto mgp_node = mgp::graph_get_vertex_by_id(graph_, mgp_vertex_id{.as_int = node_id.AsInt()}, memory);
   if (mgp_node == nullptr) {
@@ -1667,6 +1828,71 @@ inline void Graph::DeleteRelationship(const Relationship &relationship) {
   mgp::graph_delete_edge(graph_, relationship.ptr_);
 }
 
+inline std::optional<GraphProjection> Graph::GetProjection(std::string_view name) const {
+  auto *projection = mgp::graph_get_projection(graph_, std::string(name).c_str(), memory);
+  if (projection == nullptr) {
+    return std::nullopt;
+  }
+  return GraphProjection(projection);
+}
+
+// GraphProjection:
+
+inline GraphProjection::GraphProjection(mgp_graph_projection *projection)
+    : projection_(projection, mgp::graph_projection_destroy) {}
+
+inline size_t GraphProjection::NodeCount() const { return mgp::graph_projection_vertex_count(projection_.get()); }
+
+inline size_t GraphProjection::RelationshipCount() const {
+  return mgp::graph_projection_edge_count(projection_.get());
+}
+
+inline bool GraphProjection::HasWeights() const { return mgp::graph_projection_has_weights(projection_.get()); }
+
+inline mgp::Id GraphProjection::NodeId(size_t ordinal) const {
+  return Id::FromInt(mgp::graph_projection_vertex_id(projection_.get(), ordinal).as_int);
+}
+
+inline size_t GraphProjection::NodeOrdinal(mgp::Id node_id) const {
+  return mgp::graph_projection_vertex_ordinal(projection_.get(), mgp_vertex_id{.as_int = node_id.AsInt()});
+}
+
+inline std::span<const uint64_t> GraphProjection::OutNeighbors(size_t ordinal) const {
+  size_t count{0};
+  const auto *neighbors = mgp::graph_projection_out_neighbors(projection_.get(), ordinal, &count);
+  return {neighbors, count};
+}
+
+inline std::span<const uint64_t> GraphProjection::InNeighbors(size_t ordinal) const {
+  size_t count{0};
+  const auto *neighbors = mgp::graph_projection_in_neighbors(projection_.get(), ordinal, &count);
+  return {neighbors, count};
+}
+
+inline std::span<const double> GraphProjection::OutWeights(size_t ordinal) const {
+  const auto *weights = mgp::graph_projection_out_weights(projection_.get(), ordinal);
+  if (weights == nullptr) {
+    return {};
+  }
+  return {weights, OutNeighbors(ordinal).size()};
+}
+
+inline std::span<const double> GraphProjection::InWeights(size_t ordinal) const {
+  const auto *weights = mgp::graph_projection_in_weights(projection_.get(), ordinal);
+  if (weights == nullptr) {
+    return {};
+  }
+  return {weights, InNeighbors(ordinal).size()};
+}
+
+inline std::optional<std::span<const double>> GraphProjection::NodeProperty(std::string_view name) const {
+  const auto *values = mgp::graph_projection_vertex_property(projection_.get(), std::string(name).c_str());
+  if (values == nullptr) {
+    return std::nullopt;
+  }
+  return std::span<const double>{values, NodeCount()};
+}
+
 // Nodes:
 
 inline Nodes::Nodes(mgp_vertices_iterator *nodes_iterator) : nodes_iterator_(nodes_iterator) {}
@@ -2302,6 +2528,8 @@ inline Node::~Node() {
 
 inline mgp::Id Node::Id() const { return Id::FromInt(mgp::vertex_get_id(ptr_).as_int); }
 
+inline size_t Node::Ordinal() const { return mgp::vertex_get_ordinal(ptr_); }
+
 inline mgp::Labels Node::Labels() const { return mgp::Labels(ptr_); }
 
 inline bool Node::HasLabel(std::string_view label) const {
@@ -3243,6 +3471,8 @@ inline const Record RecordFactory::NewRecord() const {
   return Record(record);
 }
 
+inline size_t RecordFactory::BatchSize() const { return mgp::result_batch_size(result_); }
+
 inline void RecordFactory::SetErrorMessage(const std::string_view error_msg) const {
   mgp::result_set_error_msg(result_, error_msg.data());
 }
@@ -3406,12 +3636,9 @@ inline mgp_type *Return::GetMGPType() const {
   return util::ToMGPType(type_);
 }
 
-void AddProcedure(mgp_proc_cb callback, std::string_view name, ProcedureType proc_type,
-                  std::vector<Parameter> parameters, std::vector<Return> returns, mgp_module *module,
-                  mgp_memory *memory) {
-  auto proc = (proc_type == ProcedureType::Read) ? mgp::module_add_read_procedure(module, name.data(), callback)
-                                                 : mgp::module_add_write_procedure(module, name.data(), callback);
-
+namespace util {
+inline void AddProcedureSignature(mgp_proc *proc, const std::vector<Parameter> &parameters,
+                                  const std::vector<Return> &returns) {
   for (const auto &parameter : parameters) {
     auto parameter_name = parameter.name.data();
     if (!parameter.optional) {
@@ -3427,6 +3654,24 @@ void AddProcedure(mgp_proc_cb callback, std::string_view name, ProcedureType pro
     mgp::proc_add_result(proc, return_name, return_.GetMGPType());
   }
 }
+}  // namespace util
+
+void AddProcedure(mgp_proc_cb callback, std::string_view name, ProcedureType proc_type,
+                  std::vector<Parameter> parameters, std::vector<Return> returns, mgp_module *module,
+                  mgp_memory *memory) {
+  auto proc = (proc_type == ProcedureType::Read) ? mgp::module_add_read_procedure(module, name.data(), callback)
+                                                 : mgp::module_add_write_procedure(module, name.data(), callback);
+  util::AddProcedureSignature(proc, parameters, returns);
+}
+
+inline void AddBatchProcedure(mgp_proc_batch_init init, mgp_proc_batch_cb callback, mgp_proc_batch_cleanup cleanup,
+                              std::string_view name, ProcedureType proc_type, std::vector<Parameter> parameters,
+                              std::vector<Return> returns, mgp_module *module, mgp_memory *memory) {
+  auto proc = (proc_type == ProcedureType::Read)
+                  ? mgp::module_add_batch_read_procedure(module, name.data(), init, callback, cleanup)
+                  : mgp::module_add_batch_write_procedure(module, name.data(), init, callback, cleanup);
+  util::AddProcedureSignature(proc, parameters, returns);
+}
 
 void AddFunction(mgp_func_cb callback, std::string_view name, std::vector<Parameter> parameters, mgp_module *module,
                  mgp_memory *memory) {
@@ -27,6 +27,7 @@ This module provides the API for usage in custom openCypher procedures.
 
 import datetime
 import inspect
+import math
 import sys
 import typing
 from collections import namedtuple
@@ -742,6 +743,27 @@ class Vertex:
             raise InvalidContextError()
         return self._vertex.get_id()
 
+    @property
+    def ordinal(self) -> int:
+        """
+        Get the ordinal of the Vertex in the dense numbering of the vertices
+        of its graph, see `Graph.vertex_ordinal_count`.
+
+        Returns:
+            `int` from 0 to the vertex ordinal count of the graph minus 1.
+
+        Raises:
+            InvalidContextError: If vertex is out of context.
+            OutOfRangeError: If the vertex was created after the vertices were numbered.
+            UnableToAllocateError: If unable to allocate the numbering.
+
+        Examples:
+            ```scores[vertex.ordinal]```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+        return self._vertex.get_ordinal()
+
     @property
     def labels(self) -> typing.Tuple[Label]:
         """
@@ -1128,6 +1150,114 @@ class Vertices:
         return self._len
 
 
+class GraphProjection:
+    """
+    Read-only projection of the graph in compressed sparse row format.
+
+    Projections are built with the `mg.project_graph` procedure and are cached
+    by name, separately for each user, until they are replaced or dropped with
+    `mg.drop_graph_projection`. They don't see changes of the graph made after
+    they were built. The projected vertices are numbered from 0 to
+    `vertex_count - 1`, and neighbors are returned as read-only memoryviews of
+    ordinals, which point directly into the projection. Unlike vertices and
+    edges, a projection and its memoryviews may be used after the procedure is
+    done.
+    """
+
+    __slots__ = ("_projection",)
+
+    def __init__(self, projection):
+        if not isinstance(projection, _mgp.GraphProjection):
+            raise TypeError("Expected '_mgp.GraphProjection', got '{}'".format(type(projection)))
+        self._projection = projection
+
+    @property
+    def vertex_count(self) -> int:
+        """Number of projected vertices."""
+        return self._projection.vertex_count()
+
+    @property
+    def edge_count(self) -> int:
+        """Number of projected edges."""
+        return self._projection.edge_count()
+
+    @property
+    def has_weights(self) -> bool:
+        """True if the edge weights were projected."""
+        return self._projection.has_weights()
+
+    def vertex_id(self, ordinal: int) -> VertexId:
+        """
+        Return the ID of the projected vertex with the given ordinal.
+
+        Raises:
+            OutOfRangeError: If the ordinal isn't less than the vertex count.
+        """
+        return self._projection.vertex_id(ordinal)
+
+    def vertex_ordinal(self, vertex_id: VertexId) -> int:
+        """
+        Return the ordinal of the vertex with the given ID.
+
+        Raises:
+            OutOfRangeError: If the vertex isn't projected.
+        """
+        return self._projection.vertex_ordinal(vertex_id)
+
+    def out_neighbors(self, ordinal: int) -> memoryview:
+        """
+        Return the ordinals of the targets of the outgoing edges of the vertex
+        with the given ordinal.
+
+        Raises:
+            OutOfRangeError: If the ordinal isn't less than the vertex count.
+
+        Examples:
+            ```for neighbor in projection.out_neighbors(ordinal):```
+        """
+        return self._projection.out_neighbors(ordinal)
+
+    def in_neighbors(self, ordinal: int) -> memoryview:
+        """
+        Return the ordinals of the sources of the incoming edges of the vertex
+        with the given ordinal.
+
+        Raises:
+            OutOfRangeError: If the ordinal isn't less than the vertex count.
+        """
+        return self._projection.in_neighbors(ordinal)
+
+    def out_weights(self, ordinal: int) -> typing.Optional[memoryview]:
+        """
+        Return the weights of the outgoing edges of the vertex with the given
+        ordinal in the order of `out_neighbors`, or None if the weights
+        weren't projected.
+
+        Raises:
+            OutOfRangeError: If the ordinal isn't less than the vertex count.
+        """
+        return self._projection.out_weights(ordinal)
+
+    def in_weights(self, ordinal: int) -> typing.Optional[memoryview]:
+        """
+        Return the weights of the incoming edges of the vertex with the given
+        ordinal in the order of `in_neighbors`, or None if the weights weren't
+        projected.
+
+        Raises:
+            OutOfRangeError: If the ordinal isn't less than the vertex count.
+        """
+        return self._projection.in_weights(ordinal)
+
+    def vertex_property(self, name: str) -> typing.Optional[memoryview]:
+        """
+        Return the values of the projected vertex property indexed by
+        ordinal, with NaN for the vertices which don't have it, or None if the
+        property wasn't projected.
+        """
+        return self._projection.vertex_property(name)
+
+
 class Graph:
     """State of the graph database in current ProcCtx."""
 
@@ -1185,6 +1315,110 @@ class Graph:
         vertex = self._graph.get_vertex_by_id(vertex_id)
         return Vertex(vertex)
 
+    def vertex_ordinal_count(self) -> int:
+        """
+        Return the number of vertices in the dense numbering of the graph's
+        vertices.
+
+        On first use, the vertices of the graph are numbered from 0 to the
+        count minus 1, so that per-vertex state can be kept in lists indexed
+        by `Vertex.ordinal` instead of dictionaries keyed by vertices.
+        Vertices created afterwards don't have an ordinal.
+
+        Returns:
+            Number of numbered vertices.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+            UnableToAllocateError: If unable to allocate the numbering.
+
+        Examples:
+            ```scores = [0.0] * graph.vertex_ordinal_count()```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+        return self._graph.vertex_ordinal_count()
+
+    def get_vertex_by_ordinal(self, ordinal: int) -> Vertex:
+        """
+        Return the Vertex with the given ordinal, see `vertex_ordinal_count`.
+
+        Args:
+            ordinal: Ordinal of the vertex.
+
+        Returns:
+            `Vertex` with the given ordinal.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+            OutOfRangeError: If the ordinal isn't less than the vertex ordinal count.
+
+        Examples:
+            ```graph.get_vertex_by_ordinal(0)```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+        return Vertex(self._graph.get_vertex_by_ordinal(ordinal))
+
+    def vertex_property_column(
+        self, property_name: str, dtype: typing.Union[typing.Type[float], typing.Type[int]] = float, default=None
+    ) -> memoryview:
+        """
+        Return the values of a numeric property of all vertices, indexed by
+        `Vertex.ordinal`, see `vertex_ordinal_count`.
+
+        The values are read into a single buffer without creating a Python
+        object for each vertex. The returned memoryview can be used as a
+        sequence of numbers, or wrapped by NumPy without copying, e.g. with
+        `numpy.asarray(column)`.
+
+        Args:
+            property_name: Name of the property.
+            dtype: `float` for a column of doubles or `int` for a column of
+                64-bit integers.
+            default: Value of vertices which don't have the property. By
+                default it's NaN for `float` and 0 for `int`.
+
+        Returns:
+            memoryview of format 'd' or 'q' with a value per vertex ordinal.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+            ValueConversionError: If a value of the property isn't a number
+                of the given `dtype`.
+            UnableToAllocateError: If unable to allocate the numbering.
+
+        Examples:
+            ```ranks = numpy.asarray(graph.vertex_property_column("rank"))```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+        if dtype is float:
+            return self._graph.vertex_property_column(property_name, "d", math.nan if default is None else default)
+        if dtype is int:
+            return self._graph.vertex_property_column(property_name, "q", 0 if default is None else default)
+        raise TypeError("Expected 'dtype' to be 'float' or 'int', got '{}'".format(dtype))
+
+    def get_projection(self, name: str) -> typing.Optional[GraphProjection]:
+        """
+        Return the graph projection cached under the given name, or None if
+        there's no such projection.
+
+        Args:
+            name: Name under which the projection was built with
+                `mg.project_graph`.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+
+        Examples:
+            ```projection = graph.get_projection("social")```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+        projection = self._graph.get_projection(name)
+        return None if projection is None else GraphProjection(projection)
+
     @property
     def vertices(self) -> Vertices:
         """
@@ -1526,7 +1760,7 @@ class Deprecated:
         self.field_type = type_
 
 
-def raise_if_does_not_meet_requirements(func: typing.Callable[..., Record]):
+def raise_if_does_not_meet_requirements(func: typing.Callable[..., Record], allow_generators: bool = False):
     if not callable(func):
         raise TypeError("Expected a callable object, got an instance of '{}'".format(type(func)))
     if inspect.iscoroutinefunction(func):
@@ -1534,13 +1768,18 @@ def raise_if_does_not_meet_requirements(func: typing.Callable[..., Record]):
     if sys.version_info >= (3, 6):
         if inspect.isasyncgenfunction(func):
             raise TypeError("Callable must not be 'async def' function")
-    if inspect.isgeneratorfunction(func):
+    if inspect.isgeneratorfunction(func) and not allow_generators:
         raise NotImplementedError("Generator functions are not supported")
 
 
 def _register_proc(func: typing.Callable[..., Record], is_write: bool):
-    raise_if_does_not_meet_requirements(func)
-    register_func = _mgp.Module.add_write_procedure if is_write else _mgp.Module.add_read_procedure
+    raise_if_does_not_meet_requirements(func, allow_generators=True)
+    if inspect.isgeneratorfunction(func):
+        # Records of generator functions are pulled in batches, as the query
+        # needs them, instead of being collected all at once.
+        register_func = _mgp.Module.add_batch_write_procedure if is_write else _mgp.Module.add_batch_read_procedure
+    else:
+        register_func = _mgp.Module.add_write_procedure if is_write else _mgp.Module.add_read_procedure
     sig = inspect.signature(func)
     params = tuple(sig.parameters.values())
     if params and params[0].annotation is ProcCtx:
@@ -1592,8 +1831,10 @@ def read_proc(func: typing.Callable[..., Record]):
     annotated with types. The return type must be `Record(field_name=type, ...)`
     and the procedure must produce either a complete Record or None. To mark a
     field as deprecated, use `Record(field_name=Deprecated(type), ...)`.
-    Multiple records can be produced by returning an iterable of them.
-    Registering generator functions is currently not supported.
+    Multiple records can be produced by returning an iterable of them or by
+    yielding them from a generator function. Records of a generator function
+    are produced in batches as the query consumes them, so they don't all have
+    to be kept in memory at once.
 
     Example usage.
 
@@ -1635,8 +1876,8 @@ def write_proc(func: typing.Callable[..., Record]):
     `Record(field_name=type, ...)` and the procedure must produce either a
     complete Record or None. To mark a field as deprecated, use
     `Record(field_name=Deprecated(type), ...)`. Multiple records can be produced
-    by returning an iterable of them. Registering generator functions is
-    currently not supported.
+    by returning an iterable of them or by yielding them from a generator
+    function, whose records are produced in batches as the query consumes them.
 
     Example usage.
 
@@ -1811,6 +2052,17 @@ class Messages:
             raise InvalidMessagesError()
         return self._messages.total_messages()
 
+    def transformation_config(self) -> typing.Dict[str, str]:
+        """
+        Return the TRANSFORM_CONFIG given when the stream was created, empty
+        if there was none.
+
+        Raise InvalidMessagesError if context is invalid.
+        """
+        if not self.is_valid():
+            raise InvalidMessagesError()
+        return self._messages.transformation_config()
+
 
 class TransCtx:
     """Context of a transformation being executed.
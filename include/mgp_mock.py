@@ -18,6 +18,7 @@ when they're implemented in full.
 
 import datetime
 import inspect
+import math
 import sys
 import typing
 from collections import namedtuple
@@ -43,6 +44,15 @@ class UnknownError(Exception):
     pass
 
 
+class OutOfRangeError(Exception):
+    """
+    Signals that an index-like parameter has a value that is outside its
+    possible values.
+    """
+
+    pass
+
+
 class LogicErrorError(Exception):
     """
     Signals faulty logic within the program such as violating logical
@@ -688,6 +698,27 @@ class Vertex:
 
         return self._vertex.id
 
+    @property
+    def ordinal(self) -> int:
+        """
+        Get the ordinal of the vertex in the dense numbering of the vertices
+        of its graph, see `Graph.vertex_ordinal_count`.
+
+        Returns:
+            `int` from 0 to the vertex ordinal count of the graph minus 1.
+
+        Raises:
+            InvalidContextError: If vertex is out of context.
+            OutOfRangeError: If the vertex was created after the vertices were numbered.
+
+        Examples:
+            ```scores[vertex.ordinal]```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+
+        return self._vertex.ordinal
+
     @property
     def labels(self) -> typing.Tuple[Label]:
         """
@@ -1137,6 +1168,86 @@ class Graph:
 
         return Vertex(self._graph.get_vertex_by_id(vertex_id))
 
+    def vertex_ordinal_count(self) -> int:
+        """
+        Return the number of vertices in the dense numbering of the graph's
+        vertices.
+
+        On first use, the vertices of the graph are numbered from 0 to the
+        count minus 1, so that per-vertex state can be kept in lists indexed
+        by `Vertex.ordinal` instead of dictionaries keyed by vertices.
+        Vertices created afterwards don't have an ordinal.
+
+        Returns:
+            Number of numbered vertices.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+
+        Examples:
+            ```scores = [0.0] * graph.vertex_ordinal_count()```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+
+        return self._graph.vertex_ordinal_count()
+
+    def get_vertex_by_ordinal(self, ordinal: int) -> Vertex:
+        """
+        Return the vertex with the given ordinal, see `vertex_ordinal_count`.
+
+        Args:
+            ordinal: Ordinal of the vertex.
+
+        Returns:
+            The `Vertex` with the given ordinal.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+            OutOfRangeError: If the ordinal isn't less than the vertex ordinal count.
+
+        Examples:
+            ```graph.get_vertex_by_ordinal(0)```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+
+        return Vertex(self._graph.get_vertex_by_ordinal(ordinal))
+
+    def vertex_property_column(
+        self, property_name: str, dtype: typing.Union[typing.Type[float], typing.Type[int]] = float, default=None
+    ) -> memoryview:
+        """
+        Return the values of a numeric property of all vertices, indexed by
+        `Vertex.ordinal`, see `vertex_ordinal_count`.
+
+        Args:
+            property_name: Name of the property.
+            dtype: `float` for a column of doubles or `int` for a column of
+                64-bit integers.
+            default: Value of vertices which don't have the property. By
+                default it's NaN for `float` and 0 for `int`.
+
+        Returns:
+            memoryview of format 'd' or 'q' with a value per vertex ordinal.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+            ValueConversionError: If a value of the property isn't a number
+                of the given `dtype`.
+
+        Examples:
+            ```ranks = numpy.asarray(graph.vertex_property_column("rank"))```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+
+        if dtype is float:
+            return self._graph.vertex_property_column(property_name, "d", math.nan if default is None else default)
+        if dtype is int:
+            return self._graph.vertex_property_column(property_name, "q", 0 if default is None else default)
+        raise TypeError(f"Expected 'dtype' to be 'float' or 'int', got '{dtype}'")
+
     @property
     def vertices(self) -> Vertices:
         """
@@ -1615,8 +1726,12 @@ def _wrap_exceptions():
                 return func(*args, **kwargs)
             except _mgp_mock.LogicErrorError as e:
                 raise LogicErrorError(e)
+            except _mgp_mock.OutOfRangeError as e:
+                raise OutOfRangeError(e)
             except _mgp_mock.ImmutableObjectError as e:
                 raise ImmutableObjectError(e)
+            except _mgp_mock.ValueConversionError as e:
+                raise ValueConversionError(e)
 
         return wrapped_func
 
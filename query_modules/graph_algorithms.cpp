@@ -0,0 +1,895 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Native graph algorithms which run on the engine's procedure worker threads.
+//
+// Every procedure reads the topology of the graph into flat arrays indexed by
+// node ordinal, runs the algorithm on those arrays and only then produces the
+// results. The graph is read either directly (see mgp::Graph::NodeOrdinalCount)
+// or from a projection cached with `mg.project_graph`, whose arrays are used
+// without copying. The mgp API isn't thread-safe, so the worker threads never
+// call it; they only touch the flat arrays.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <mgp.hpp>
+
+namespace {
+
+constexpr uint64_t kNone = std::numeric_limits<uint64_t>::max();
+
+/// Allocates from the memory of the procedure, so the arrays count against the
+/// procedure memory limit. The memory isn't thread-safe, so the containers
+/// using it are sized on the procedure thread before the workers get them,
+/// and the workers never grow them.
+template <class T>
+class ProcedureAllocator {
+ public:
+  using value_type = T;
+
+  ProcedureAllocator() : memory_(mgp::memory) {}
+  template <class U>
+  ProcedureAllocator(const ProcedureAllocator<U> &other) : memory_(other.memory_) {}  // NOLINT(hicpp-explicit-conversions)
+
+  T *allocate(size_t count) {
+    if (count == 0) return nullptr;
+    void *ptr = nullptr;
+    if (mgp_aligned_alloc(memory_, count * sizeof(T), alignof(T), &ptr) != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(ptr);
+  }
+
+  void deallocate(T *ptr, size_t /*count*/) { mgp_free(memory_, ptr); }
+
+  template <class U>
+  bool operator==(const ProcedureAllocator<U> &other) const {
+    return memory_ == other.memory_;
+  }
+
+ private:
+  template <class U>
+  friend class ProcedureAllocator;
+
+  mgp_memory *memory_;
+};
+
+template <class T>
+using ProcedureVector = std::vector<T, ProcedureAllocator<T>>;
+
+/// Workers of the engine's procedure worker pool, which the algorithms run
+/// on. Worker threads are shared by all procedures and sized with the
+/// `--query-procedure-parallel-workers` flag, so no threads are started here.
+class Workers {
+ public:
+  /// Uses at most `count` workers.
+  Workers(const mgp::Graph &graph, unsigned count)
+      : graph_(graph), count_(std::clamp<size_t>(count, 1, graph.ParallelWorkerCount())) {}
+
+  unsigned Count() const { return static_cast<unsigned>(count_); }
+
+  /// Calls `func(begin, end, worker)` on ranges of `grain` indices of
+  /// `[0, size)`, which are handed out to the workers dynamically, so skewed
+  /// workloads are balanced. `worker` is less than `Count()`. The first
+  /// exception thrown by `func` is rethrown after all workers are done.
+  template <class TFunc>
+  void ParallelFor(uint64_t size, uint64_t grain, const TFunc &func) const {
+    if (size == 0) return;
+    graph_.ParallelFor(size, std::max<uint64_t>(grain, 1), count_, [&func](size_t worker, size_t begin, size_t end) {
+      func(uint64_t{begin}, uint64_t{end}, static_cast<unsigned>(worker));
+    });
+  }
+
+ private:
+  const mgp::Graph &graph_;
+  size_t count_;
+};
+
+template <class TFunc>
+void ParallelFor(uint64_t size, const Workers &workers, uint64_t grain, const TFunc &func) {
+  workers.ParallelFor(size, grain, func);
+}
+
+/// Topology of the graph in compressed sparse row format. Nodes are numbered
+/// from 0 to `Size() - 1`, either by their ordinals in the graph or by their
+/// ordinals in a graph projection.
+class Topology {
+ public:
+  Topology(const Topology &) = delete;
+  Topology &operator=(const Topology &) = delete;
+  // Moving keeps the owned arrays in place, so the pointers stay valid.
+  Topology(Topology &&) = default;
+  Topology &operator=(Topology &&) = default;
+  ~Topology() = default;
+
+  /// Reads the relationships of all nodes of the graph. Relationships aren't
+  /// weighted.
+  static Topology FromGraph(const mgp::Graph &graph) {
+    Topology topology;
+    const auto size = graph.NodeOrdinalCount();
+    topology.out_offsets_.reserve(size + 1);
+    for (uint64_t ordinal = 0; ordinal < size; ++ordinal) {
+      for (const auto relationship : graph.GetNodeByOrdinal(ordinal).OutRelationships()) {
+        topology.owned_out_.push_back(relationship.To().Ordinal());
+      }
+      topology.out_offsets_.push_back(topology.owned_out_.size());
+    }
+
+    // Incoming relationships are the outgoing ones sorted by their targets.
+    topology.in_offsets_.assign(size + 1, 0);
+    for (const auto to : topology.owned_out_) ++topology.in_offsets_[to + 1];
+    std::partial_sum(topology.in_offsets_.begin(), topology.in_offsets_.end(), topology.in_offsets_.begin());
+    topology.owned_in_.resize(topology.owned_out_.size());
+    std::vector<uint64_t> positions(topology.in_offsets_.begin(), topology.in_offsets_.end() - 1);
+    for (uint64_t from = 0; from < size; ++from) {
+      for (auto i = topology.out_offsets_[from]; i < topology.out_offsets_[from + 1]; ++i) {
+        topology.owned_in_[positions[topology.owned_out_[i]]++] = from;
+      }
+    }
+    topology.out_ = topology.owned_out_.data();
+    topology.in_ = topology.owned_in_.data();
+    return topology;
+  }
+
+  /// Uses the arrays of the projection, which are contiguous, so only the
+  /// offsets are computed.
+  static Topology FromProjection(mgp::GraphProjection projection) {
+    Topology topology;
+    const auto size = projection.NodeCount();
+    if (size > 0) {
+      topology.out_ = projection.OutNeighbors(0).data();
+      topology.in_ = projection.InNeighbors(0).data();
+      if (projection.HasWeights()) {
+        topology.out_weights_ = projection.OutWeights(0).data();
+        topology.in_weights_ = projection.InWeights(0).data();
+      }
+    }
+    topology.out_offsets_.reserve(size + 1);
+    topology.in_offsets_.reserve(size + 1);
+    for (uint64_t ordinal = 0; ordinal < size; ++ordinal) {
+      const auto out = projection.OutNeighbors(ordinal);
+      const auto in = projection.InNeighbors(ordinal);
+      topology.out_offsets_.push_back(out.data() + out.size() - topology.out_);
+      topology.in_offsets_.push_back(in.data() + in.size() - topology.in_);
+    }
+    topology.projection_.emplace(std::move(projection));
+    return topology;
+  }
+
+  uint64_t Size() const { return out_offsets_.size() - 1; }
+  bool HasWeights() const { return out_weights_ != nullptr; }
+
+  std::span<const uint64_t> OutNeighbors(uint64_t node) const {
+    return {out_ + out_offsets_[node], out_ + out_offsets_[node + 1]};
+  }
+  std::span<const uint64_t> InNeighbors(uint64_t node) const {
+    return {in_ + in_offsets_[node], in_ + in_offsets_[node + 1]};
+  }
+  /// Empty if the relationships aren't weighted.
+  std::span<const double> OutWeights(uint64_t node) const {
+    if (!HasWeights()) return {};
+    return {out_weights_ + out_offsets_[node], out_weights_ + out_offsets_[node + 1]};
+  }
+  /// Empty if the relationships aren't weighted.
+  std::span<const double> InWeights(uint64_t node) const {
+    if (!HasWeights()) return {};
+    return {in_weights_ + in_offsets_[node], in_weights_ + in_offsets_[node + 1]};
+  }
+
+  /// Returns the graph node with the given number, or std::nullopt if the node
+  /// was projected but isn't in the graph anymore.
+  std::optional<mgp::Node> Node(const mgp::Graph &graph, uint64_t node) const {
+    if (!projection_) return graph.GetNodeByOrdinal(node);
+    try {
+      return graph.GetNodeById(projection_->NodeId(node));
+    } catch (const mgp::NotFoundException &) {
+      return std::nullopt;
+    }
+  }
+
+ private:
+  Topology() = default;
+
+  std::optional<mgp::GraphProjection> projection_;
+  std::vector<uint64_t> owned_out_;
+  std::vector<uint64_t> owned_in_;
+  std::vector<uint64_t> out_offsets_{0};
+  std::vector<uint64_t> in_offsets_{0};
+  const uint64_t *out_{nullptr};
+  const uint64_t *in_{nullptr};
+  const double *out_weights_{nullptr};
+  const double *in_weights_{nullptr};
+};
+
+/// Renumbers the labels from 0 in the order of their first occurrence.
+std::vector<uint64_t> DenseLabels(const std::vector<uint64_t> &labels) {
+  std::vector<uint64_t> dense(labels.size(), kNone);
+  std::vector<uint64_t> result(labels.size());
+  uint64_t next = 0;
+  for (uint64_t node = 0; node < labels.size(); ++node) {
+    auto &label = dense[labels[node]];
+    if (label == kNone) label = next++;
+    result[node] = label;
+  }
+  return result;
+}
+
+/// PageRank of the nodes following the outgoing relationships, weighted if the
+/// topology is weighted. The rank of nodes without outgoing relationships is
+/// spread evenly over all nodes. Iterates until the L1 norm of the change of
+/// the ranks drops below `Size() * tolerance`, as networkx does.
+std::vector<double> PageRank(const Topology &topology, double damping_factor, int64_t max_iterations,
+                             double tolerance, const Workers &workers) {
+  const auto size = topology.Size();
+  if (size == 0) return {};
+  constexpr uint64_t kGrain = 1024;
+
+  std::vector<double> out_weight(size);
+  ParallelFor(size, workers, kGrain, [&](uint64_t begin, uint64_t end, unsigned /*thread*/) {
+    for (auto node = begin; node < end; ++node) {
+      const auto weights = topology.OutWeights(node);
+      out_weight[node] = topology.HasWeights() ? std::accumulate(weights.begin(), weights.end(), 0.0)
+                                               : static_cast<double>(topology.OutNeighbors(node).size());
+    }
+  });
+
+  std::vector<double> rank(size, 1.0 / static_cast<double>(size));
+  std::vector<double> next(size);
+  std::vector<double> contribution(size);
+  std::vector<double> thread_sums(workers.Count());
+  for (int64_t iteration = 0; iteration < max_iterations; ++iteration) {
+    std::fill(thread_sums.begin(), thread_sums.end(), 0.0);
+    ParallelFor(size, workers, kGrain, [&](uint64_t begin, uint64_t end, unsigned thread) {
+      double dangling = 0.0;
+      for (auto node = begin; node < end; ++node) {
+        if (out_weight[node] == 0.0) {
+          dangling += rank[node];
+          contribution[node] = 0.0;
+        } else {
+          contribution[node] = rank[node] / out_weight[node];
+        }
+      }
+      thread_sums[thread] += dangling;
+    });
+    const auto dangling = std::accumulate(thread_sums.begin(), thread_sums.end(), 0.0);
+    const auto base = (1.0 - damping_factor + damping_factor * dangling) / static_cast<double>(size);
+
+    std::fill(thread_sums.begin(), thread_sums.end(), 0.0);
+    ParallelFor(size, workers, kGrain, [&](uint64_t begin, uint64_t end, unsigned thread) {
+      double change = 0.0;
+      for (auto node = begin; node < end; ++node) {
+        const auto sources = topology.InNeighbors(node);
+        const auto weights = topology.InWeights(node);
+        double sum = 0.0;
+        for (uint64_t i = 0; i < sources.size(); ++i) {
+          sum += contribution[sources[i]] * (weights.empty() ? 1.0 : weights[i]);
+        }
+        next[node] = base + damping_factor * sum;
+        change += std::abs(next[node] - rank[node]);
+      }
+      thread_sums[thread] += change;
+    });
+    rank.swap(next);
+    if (std::accumulate(thread_sums.begin(), thread_sums.end(), 0.0) < static_cast<double>(size) * tolerance) break;
+  }
+  return rank;
+}
+
+/// Weakly connected components, found with a lock-free union-find over the
+/// relationships. Components are numbered from 0.
+std::vector<uint64_t> WeaklyConnectedComponents(const Topology &topology, const Workers &workers) {
+  const auto size = topology.Size();
+  constexpr uint64_t kGrain = 1024;
+  std::vector<std::atomic<uint64_t>> parent(size);
+  for (uint64_t node = 0; node < size; ++node) parent[node].store(node, std::memory_order_relaxed);
+
+  auto find = [&parent](uint64_t node) {
+    while (true) {
+      auto up = parent[node].load(std::memory_order_relaxed);
+      if (up == node) return node;
+      // Path halving, which is safe to race because it only ever points a
+      // node at one of its ancestors.
+      const auto grand = parent[up].load(std::memory_order_relaxed);
+      parent[node].compare_exchange_weak(up, grand, std::memory_order_relaxed);
+      node = grand;
+    }
+  };
+
+  ParallelFor(size, workers, kGrain, [&](uint64_t begin, uint64_t end, unsigned /*thread*/) {
+    for (auto node = begin; node < end; ++node) {
+      for (const auto neighbor : topology.OutNeighbors(node)) {
+        auto a = node;
+        auto b = neighbor;
+        while (true) {
+          a = find(a);
+          b = find(b);
+          if (a == b) break;
+          // Roots are always linked to smaller roots, so there are no cycles.
+          if (a < b) std::swap(a, b);
+          auto expected = a;
+          if (parent[a].compare_exchange_strong(expected, b, std::memory_order_relaxed)) break;
+        }
+      }
+    }
+  });
+
+  std::vector<uint64_t> roots(size);
+  ParallelFor(size, workers, kGrain, [&](uint64_t begin, uint64_t end, unsigned /*thread*/) {
+    for (auto node = begin; node < end; ++node) roots[node] = find(node);
+  });
+  return DenseLabels(roots);
+}
+
+/// Strongly connected components, found with an iterative Tarjan's algorithm.
+/// The algorithm is inherently sequential, but it's a single pass over the
+/// flat arrays. Components are numbered from 0.
+std::vector<uint64_t> StronglyConnectedComponents(const Topology &topology) {
+  const auto size = topology.Size();
+  std::vector<uint64_t> index(size, kNone);
+  std::vector<uint64_t> low_link(size);
+  std::vector<uint64_t> component(size, kNone);
+  std::vector<uint64_t> stack;
+  // Nodes being visited together with the position of the next neighbor.
+  std::vector<std::pair<uint64_t, uint64_t>> call_stack;
+  uint64_t next_index = 0;
+  uint64_t next_component = 0;
+
+  for (uint64_t root = 0; root < size; ++root) {
+    if (index[root] != kNone) continue;
+    call_stack.emplace_back(root, 0);
+    index[root] = low_link[root] = next_index++;
+    stack.push_back(root);
+    while (!call_stack.empty()) {
+      auto &[node, position] = call_stack.back();
+      const auto neighbors = topology.OutNeighbors(node);
+      if (position < neighbors.size()) {
+        const auto neighbor = neighbors[position++];
+        if (index[neighbor] == kNone) {
+          index[neighbor] = low_link[neighbor] = next_index++;
+          stack.push_back(neighbor);
+          call_stack.emplace_back(neighbor, 0);
+        } else if (component[neighbor] == kNone) {
+          low_link[node] = std::min(low_link[node], index[neighbor]);
+        }
+        continue;
+      }
+      const auto finished = node;
+      call_stack.pop_back();
+      if (!call_stack.empty()) {
+        const auto caller = call_stack.back().first;
+        low_link[caller] = std::min(low_link[caller], low_link[finished]);
+      }
+      if (low_link[finished] != index[finished]) continue;
+      while (true) {
+        const auto member = stack.back();
+        stack.pop_back();
+        component[member] = next_component;
+        if (member == finished) break;
+      }
+      ++next_component;
+    }
+  }
+  return component;
+}
+
+/// Undirected weighted graph used by the levels of Louvain. Every relationship
+/// is stored at both of its endpoints, so a self-loop adds twice its weight to
+/// the degree of its node.
+struct WeightedGraph {
+  std::vector<uint64_t> offsets{0};
+  std::vector<uint64_t> neighbors;
+  std::vector<double> weights;
+
+  uint64_t Size() const { return offsets.size() - 1; }
+};
+
+WeightedGraph ToUndirected(const Topology &topology) {
+  WeightedGraph graph;
+  const auto size = topology.Size();
+  graph.offsets.resize(size + 1);
+  for (uint64_t node = 0; node < size; ++node) {
+    graph.offsets[node + 1] =
+        graph.offsets[node] + topology.OutNeighbors(node).size() + topology.InNeighbors(node).size();
+  }
+  graph.neighbors.resize(graph.offsets.back());
+  graph.weights.resize(graph.offsets.back());
+  for (uint64_t node = 0; node < size; ++node) {
+    auto position = graph.offsets[node];
+    for (const auto &[neighbors, weights] : {std::pair{topology.OutNeighbors(node), topology.OutWeights(node)},
+                                             std::pair{topology.InNeighbors(node), topology.InWeights(node)}}) {
+      for (uint64_t i = 0; i < neighbors.size(); ++i, ++position) {
+        graph.neighbors[position] = neighbors[i];
+        graph.weights[position] = weights.empty() ? 1.0 : weights[i];
+      }
+    }
+  }
+  return graph;
+}
+
+/// Modularity of the division of the graph into the communities.
+double Modularity(const WeightedGraph &graph, const std::vector<uint64_t> &community,
+                  const std::vector<double> &community_degree, double total_weight, const Workers &workers) {
+  std::vector<double> thread_sums(workers.Count(), 0.0);
+  ParallelFor(graph.Size(), workers, 1024, [&](uint64_t begin, uint64_t end, unsigned thread) {
+    double inside = 0.0;
+    for (auto node = begin; node < end; ++node) {
+      for (auto i = graph.offsets[node]; i < graph.offsets[node + 1]; ++i) {
+        if (community[graph.neighbors[i]] == community[node]) inside += graph.weights[i];
+      }
+    }
+    thread_sums[thread] += inside;
+  });
+  auto modularity = std::accumulate(thread_sums.begin(), thread_sums.end(), 0.0) / total_weight;
+  for (const auto degree : community_degree) modularity -= (degree / total_weight) * (degree / total_weight);
+  return modularity;
+}
+
+/// Moves the nodes between communities while the modularity grows by at least
+/// `min_gain`, and returns the community of every node. In every round, the
+/// best moves of all nodes are found in parallel against the communities of
+/// the previous round. Only the nodes which would move are then revisited
+/// sequentially, and moved if that still increases the modularity, so that
+/// concurrent moves can't lower it.
+std::vector<uint64_t> LouvainLocalMoves(const WeightedGraph &graph, double total_weight, double min_gain,
+                                        int64_t max_rounds, const Workers &workers) {
+  const auto size = graph.Size();
+  std::vector<uint64_t> community(size);
+  std::iota(community.begin(), community.end(), 0);
+  std::vector<double> degree(size);
+  for (uint64_t node = 0; node < size; ++node) {
+    degree[node] = std::accumulate(graph.weights.begin() + static_cast<int64_t>(graph.offsets[node]),
+                                   graph.weights.begin() + static_cast<int64_t>(graph.offsets[node + 1]), 0.0);
+  }
+  std::vector<double> community_degree(degree);
+
+  // Weights of the relationships from a node to the neighboring communities,
+  // kept separately for every thread. The touched communities are usually few,
+  // so the threads grow those lists on their own.
+  ProcedureVector<ProcedureVector<double>> thread_weights(workers.Count(), ProcedureVector<double>(size, 0.0));
+  std::vector<std::vector<uint64_t>> thread_touched(workers.Count());
+  auto best_community = [&](uint64_t node, unsigned thread) {
+    auto &weights = thread_weights[thread];
+    auto &touched = thread_touched[thread];
+    const auto current = community[node];
+    touched.clear();
+    touched.push_back(current);
+    for (auto i = graph.offsets[node]; i < graph.offsets[node + 1]; ++i) {
+      const auto neighbor = graph.neighbors[i];
+      if (neighbor == node) continue;
+      if (weights[community[neighbor]] == 0.0) touched.push_back(community[neighbor]);
+      weights[community[neighbor]] += graph.weights[i];
+    }
+    // Gain of moving the node, taken out of its community, into the given
+    // community, scaled by the total weight.
+    auto gain = [&](uint64_t target) {
+      const auto target_degree = community_degree[target] - (target == current ? degree[node] : 0.0);
+      return weights[target] - target_degree * degree[node] / total_weight;
+    };
+    auto best = current;
+    auto best_gain = gain(current);
+    for (const auto target : touched) {
+      const auto target_gain = gain(target);
+      if (target_gain > best_gain || (target_gain == best_gain && target < best)) {
+        best = target;
+        best_gain = target_gain;
+      }
+    }
+    for (const auto target : touched) weights[target] = 0.0;
+    return best;
+  };
+
+  std::vector<uint64_t> best(size);
+  auto modularity = Modularity(graph, community, community_degree, total_weight, workers);
+  for (int64_t round = 0; round < max_rounds; ++round) {
+    ParallelFor(size, workers, 256, [&](uint64_t begin, uint64_t end, unsigned thread) {
+      for (auto node = begin; node < end; ++node) best[node] = best_community(node, thread);
+    });
+
+    bool moved = false;
+    for (uint64_t node = 0; node < size; ++node) {
+      if (best[node] == community[node]) continue;
+      const auto target = best_community(node, 0);
+      if (target == community[node]) continue;
+      moved = true;
+      community_degree[community[node]] -= degree[node];
+      community[node] = target;
+      community_degree[target] += degree[node];
+    }
+    if (!moved) break;
+    const auto new_modularity = Modularity(graph, community, community_degree, total_weight, workers);
+    const auto gain = new_modularity - modularity;
+    modularity = new_modularity;
+    if (gain < min_gain) break;
+  }
+  return DenseLabels(community);
+}
+
+/// Graph whose nodes are the communities of the given graph.
+WeightedGraph Aggregate(const WeightedGraph &graph, const std::vector<uint64_t> &community, uint64_t community_count,
+                        const Workers &workers) {
+  // Nodes grouped by community with a counting sort.
+  std::vector<uint64_t> member_offsets(community_count + 1, 0);
+  for (const auto c : community) ++member_offsets[c + 1];
+  std::partial_sum(member_offsets.begin(), member_offsets.end(), member_offsets.begin());
+  std::vector<uint64_t> members(community.size());
+  std::vector<uint64_t> positions(member_offsets.begin(), member_offsets.end() - 1);
+  for (uint64_t node = 0; node < community.size(); ++node) members[positions[community[node]]++] = node;
+
+  std::vector<std::vector<std::pair<uint64_t, double>>> edges(community_count);
+  ProcedureVector<ProcedureVector<double>> thread_weights(workers.Count(),
+                                                          ProcedureVector<double>(community_count, 0.0));
+  std::vector<std::vector<uint64_t>> thread_touched(workers.Count());
+  ParallelFor(community_count, workers, 64, [&](uint64_t begin, uint64_t end, unsigned thread) {
+    auto &weights = thread_weights[thread];
+    auto &touched = thread_touched[thread];
+    for (auto c = begin; c < end; ++c) {
+      touched.clear();
+      for (auto m = member_offsets[c]; m < member_offsets[c + 1]; ++m) {
+        const auto node = members[m];
+        for (auto i = graph.offsets[node]; i < graph.offsets[node + 1]; ++i) {
+          const auto target = community[graph.neighbors[i]];
+          if (weights[target] == 0.0) touched.push_back(target);
+          weights[target] += graph.weights[i];
+        }
+      }
+      std::sort(touched.begin(), touched.end());
+      touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+      edges[c].reserve(touched.size());
+      for (const auto target : touched) {
+        edges[c].emplace_back(target, weights[target]);
+        weights[target] = 0.0;
+      }
+    }
+  });
+
+  WeightedGraph aggregated;
+  aggregated.offsets.reserve(community_count + 1);
+  for (const auto &community_edges : edges) {
+    for (const auto &[target, weight] : community_edges) {
+      aggregated.neighbors.push_back(target);
+      aggregated.weights.push_back(weight);
+    }
+    aggregated.offsets.push_back(aggregated.neighbors.size());
+  }
+  return aggregated;
+}
+
+/// Communities found with the Louvain method, treating relationships as
+/// undirected. Communities are numbered from 0.
+std::vector<uint64_t> Louvain(const Topology &topology, double min_gain, int64_t max_rounds, int64_t max_levels,
+                              const Workers &workers) {
+  auto graph = ToUndirected(topology);
+  std::vector<uint64_t> community(topology.Size());
+  std::iota(community.begin(), community.end(), 0);
+  const auto total_weight = std::accumulate(graph.weights.begin(), graph.weights.end(), 0.0);
+  if (total_weight <= 0.0) return community;
+
+  for (int64_t level = 0; level < max_levels; ++level) {
+    const auto level_community = LouvainLocalMoves(graph, total_weight, min_gain, max_rounds, workers);
+    const auto community_count =
+        level_community.empty() ? 0 : *std::max_element(level_community.begin(), level_community.end()) + 1;
+    for (auto &c : community) c = level_community[c];
+    if (community_count == graph.Size()) break;
+    graph = Aggregate(graph, level_community, community_count, workers);
+  }
+  return community;
+}
+
+/// Betweenness centrality following the outgoing relationships, computed with
+/// Brandes' algorithm from every node in parallel. Relationship weights are
+/// ignored. Normalized like networkx does for directed graphs.
+std::vector<double> BetweennessCentrality(const Topology &topology, bool normalized, const Workers &workers) {
+  const auto size = topology.Size();
+  // Every thread keeps its own state of the traversal and its own sums. The
+  // order never holds more than all nodes, so it doesn't grow on the threads.
+  struct ThreadState {
+    explicit ThreadState(uint64_t size)
+        : distance(size, kNone), paths(size, 0.0), dependency(size, 0.0), centrality(size, 0.0) {
+      order.reserve(size);
+    }
+    ProcedureVector<uint64_t> distance;
+    ProcedureVector<double> paths;
+    ProcedureVector<double> dependency;
+    ProcedureVector<uint64_t> order;
+    ProcedureVector<double> centrality;
+  };
+  ProcedureVector<ThreadState> states;
+  states.reserve(workers.Count());
+  for (unsigned thread = 0; thread < workers.Count(); ++thread) states.emplace_back(size);
+
+  ParallelFor(size, workers, 16, [&](uint64_t begin, uint64_t end, unsigned thread) {
+    auto &state = states[thread];
+    for (auto source = begin; source < end; ++source) {
+      // The nodes are visited in breadth-first order, so the order vector
+      // doubles as the queue.
+      state.order.clear();
+      state.order.push_back(source);
+      state.distance[source] = 0;
+      state.paths[source] = 1.0;
+      for (uint64_t head = 0; head < state.order.size(); ++head) {
+        const auto node = state.order[head];
+        for (const auto neighbor : topology.OutNeighbors(node)) {
+          if (state.distance[neighbor] == kNone) {
+            state.distance[neighbor] = state.distance[node] + 1;
+            state.order.push_back(neighbor);
+          }
+          if (state.distance[neighbor] == state.distance[node] + 1) state.paths[neighbor] += state.paths[node];
+        }
+      }
+      for (auto it = state.order.rbegin(); it != state.order.rend(); ++it) {
+        const auto node = *it;
+        for (const auto neighbor : topology.OutNeighbors(node)) {
+          if (state.distance[neighbor] == state.distance[node] + 1) {
+            state.dependency[node] += state.paths[node] / state.paths[neighbor] * (1.0 + state.dependency[neighbor]);
+          }
+        }
+        if (node != source) state.centrality[node] += state.dependency[node];
+      }
+      for (const auto node : state.order) {
+        state.distance[node] = kNone;
+        state.paths[node] = 0.0;
+        state.dependency[node] = 0.0;
+      }
+    }
+  });
+
+  std::vector<double> centrality(size, 0.0);
+  const auto scale = normalized && size > 2 ? 1.0 / static_cast<double>((size - 1) * (size - 2)) : 1.0;
+  ParallelFor(size, workers, 1024, [&](uint64_t begin, uint64_t end, unsigned /*thread*/) {
+    for (auto node = begin; node < end; ++node) {
+      for (const auto &state : states) centrality[node] += state.centrality[node];
+      centrality[node] *= scale;
+    }
+  });
+  return centrality;
+}
+
+/// Number of triangles every node is part of, treating relationships as
+/// undirected and ignoring self-loops and parallel relationships.
+std::vector<uint64_t> TriangleCount(const Topology &topology, const Workers &workers) {
+  const auto size = topology.Size();
+  constexpr uint64_t kGrain = 256;
+
+  // Distinct neighbors of every node, sorted.
+  std::vector<uint64_t> offsets(size + 1, 0);
+  for (uint64_t node = 0; node < size; ++node) {
+    offsets[node + 1] = offsets[node] + topology.OutNeighbors(node).size() + topology.InNeighbors(node).size();
+  }
+  std::vector<uint64_t> neighbors(offsets.back());
+  std::vector<uint64_t> degree(size);
+  ParallelFor(size, workers, kGrain, [&](uint64_t begin, uint64_t end, unsigned /*thread*/) {
+    for (auto node = begin; node < end; ++node) {
+      const auto first = neighbors.begin() + static_cast<int64_t>(offsets[node]);
+      auto last = std::copy(topology.OutNeighbors(node).begin(), topology.OutNeighbors(node).end(), first);
+      last = std::copy(topology.InNeighbors(node).begin(), topology.InNeighbors(node).end(), last);
+      last = std::remove(first, last, node);
+      std::sort(first, last);
+      degree[node] = std::unique(first, last) - first;
+    }
+  });
+
+  // Every triangle is found once, from its lowest node in the order of degree,
+  // by only following neighbors which are higher in that order.
+  auto lower = [&degree](uint64_t a, uint64_t b) { return degree[a] < degree[b] || (degree[a] == degree[b] && a < b); };
+  std::vector<uint64_t> higher_count(size);
+  ParallelFor(size, workers, kGrain, [&](uint64_t begin, uint64_t end, unsigned /*thread*/) {
+    for (auto node = begin; node < end; ++node) {
+      const auto first = neighbors.begin() + static_cast<int64_t>(offsets[node]);
+      const auto last = std::remove_if(first, first + static_cast<int64_t>(degree[node]),
+                                       [&](uint64_t neighbor) { return !lower(node, neighbor); });
+      higher_count[node] = last - first;
+    }
+  });
+
+  std::vector<std::atomic<uint64_t>> triangles(size);
+  ParallelFor(size, workers, kGrain, [&](uint64_t begin, uint64_t end, unsigned /*thread*/) {
+    for (auto node = begin; node < end; ++node) {
+      const auto node_first = neighbors.begin() + static_cast<int64_t>(offsets[node]);
+      const auto node_last = node_first + static_cast<int64_t>(higher_count[node]);
+      for (auto it = node_first; it != node_last; ++it) {
+        const auto neighbor = *it;
+        auto a = node_first;
+        auto b = neighbors.begin() + static_cast<int64_t>(offsets[neighbor]);
+        const auto b_last = b + static_cast<int64_t>(higher_count[neighbor]);
+        while (a != node_last && b != b_last) {
+          if (*a < *b) {
+            ++a;
+          } else if (*b < *a) {
+            ++b;
+          } else {
+            triangles[node].fetch_add(1, std::memory_order_relaxed);
+            triangles[neighbor].fetch_add(1, std::memory_order_relaxed);
+            triangles[*a].fetch_add(1, std::memory_order_relaxed);
+            ++a;
+            ++b;
+          }
+        }
+      }
+    }
+  });
+
+  std::vector<uint64_t> result(size);
+  for (uint64_t node = 0; node < size; ++node) result[node] = triangles[node].load(std::memory_order_relaxed);
+  return result;
+}
+
+// Procedures
+
+constexpr std::string_view kArgumentProjection = "projection";
+constexpr std::string_view kArgumentThreads = "threads";
+constexpr const char *kFieldNode = "node";
+
+std::vector<mgp::Value> Arguments(mgp_list *args) {
+  std::vector<mgp::Value> arguments;
+  for (size_t i = 0; i < mgp::list_size(args); i++) {
+    arguments.emplace_back(mgp::list_at(args, i));
+  }
+  return arguments;
+}
+
+/// Reads the topology from the projection with the given name, or from the
+/// graph if the name is empty.
+Topology ReadTopology(const mgp::Graph &graph, std::string_view projection_name) {
+  if (projection_name.empty()) return Topology::FromGraph(graph);
+  auto projection = graph.GetProjection(projection_name);
+  if (!projection) {
+    throw std::invalid_argument("There's no graph projection named '" + std::string(projection_name) + "'.");
+  }
+  return Topology::FromProjection(std::move(*projection));
+}
+
+/// Number of workers to use, at most the number of hardware threads, all of
+/// them if not positive.
+unsigned Threads(const mgp::Value &threads) {
+  const auto hardware_threads = std::max(std::thread::hardware_concurrency(), 1U);
+  if (threads.ValueInt() > 0) return static_cast<unsigned>(std::min<int64_t>(threads.ValueInt(), hardware_threads));
+  return hardware_threads;
+}
+
+/// Produces a record with the node and the value for every node which is in
+/// the graph.
+template <class TValue, class TConvert>
+void InsertResults(const mgp::Graph &graph, const Topology &topology, const mgp::RecordFactory &record_factory,
+                   const char *field, const std::vector<TValue> &values, const TConvert &convert) {
+  for (uint64_t node = 0; node < values.size(); ++node) {
+    auto graph_node = topology.Node(graph, node);
+    if (!graph_node) continue;
+    auto record = record_factory.NewRecord();
+    record.Insert(kFieldNode, *graph_node);
+    record.Insert(field, convert(values[node]));
+  }
+}
+
+auto AsInt(uint64_t value) { return static_cast<int64_t>(value); }
+auto AsDouble(double value) { return value; }
+
+/// Wraps the procedure so that it sets up the memory and reports exceptions as
+/// errors. The last two arguments of every procedure are the projection name
+/// and the number of threads.
+template <void (*TProcedure)(const std::vector<mgp::Value> &, const mgp::Graph &, const Topology &, const Workers &,
+                             const mgp::RecordFactory &)>
+void Procedure(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  try {
+    mgp::memory = memory;
+    const auto arguments = Arguments(args);
+    const auto graph = mgp::Graph(memgraph_graph);
+    const auto topology = ReadTopology(graph, arguments[arguments.size() - 2].ValueString());
+    TProcedure(arguments, graph, topology, Workers(graph, Threads(arguments.back())), mgp::RecordFactory(result));
+  } catch (const std::exception &e) {
+    mgp::result_set_error_msg(result, e.what());
+    return;
+  }
+}
+
+void PageRankProc(const std::vector<mgp::Value> &arguments, const mgp::Graph &graph, const Topology &topology,
+                  const Workers &workers, const mgp::RecordFactory &record_factory) {
+  const auto ranks = PageRank(topology, arguments[0].ValueDouble(), arguments[1].ValueInt(),
+                              arguments[2].ValueDouble(), workers);
+  InsertResults(graph, topology, record_factory, "rank", ranks, AsDouble);
+}
+
+void WeaklyConnectedComponentsProc(const std::vector<mgp::Value> & /*arguments*/, const mgp::Graph &graph,
+                                   const Topology &topology, const Workers &workers,
+                                   const mgp::RecordFactory &record_factory) {
+  InsertResults(graph, topology, record_factory, "component_id", WeaklyConnectedComponents(topology, workers), AsInt);
+}
+
+void StronglyConnectedComponentsProc(const std::vector<mgp::Value> & /*arguments*/, const mgp::Graph &graph,
+                                     const Topology &topology, const Workers & /*workers*/,
+                                     const mgp::RecordFactory &record_factory) {
+  InsertResults(graph, topology, record_factory, "component_id", StronglyConnectedComponents(topology), AsInt);
+}
+
+void LouvainProc(const std::vector<mgp::Value> &arguments, const mgp::Graph &graph, const Topology &topology,
+                 const Workers &workers, const mgp::RecordFactory &record_factory) {
+  const auto communities =
+      Louvain(topology, arguments[0].ValueDouble(), arguments[1].ValueInt(), arguments[2].ValueInt(), workers);
+  InsertResults(graph, topology, record_factory, "community_id", communities, AsInt);
+}
+
+void BetweennessCentralityProc(const std::vector<mgp::Value> &arguments, const mgp::Graph &graph,
+                               const Topology &topology, const Workers &workers, const mgp::RecordFactory &record_factory) {
+  const auto centrality = BetweennessCentrality(topology, arguments[0].ValueBool(), workers);
+  InsertResults(graph, topology, record_factory, "betweenness", centrality, AsDouble);
+}
+
+void TriangleCountProc(const std::vector<mgp::Value> & /*arguments*/, const mgp::Graph &graph,
+                       const Topology &topology, const Workers &workers, const mgp::RecordFactory &record_factory) {
+  InsertResults(graph, topology, record_factory, "triangles", TriangleCount(topology, workers), AsInt);
+}
+
+/// Parameters shared by all procedures.
+std::vector<mgp::Parameter> WithCommonParameters(std::vector<mgp::Parameter> parameters) {
+  parameters.emplace_back(kArgumentProjection, mgp::Type::String, "");
+  parameters.emplace_back(kArgumentThreads, mgp::Type::Int, int64_t{0});
+  return parameters;
+}
+
+}  // namespace
+
+extern "C" int mgp_init_module(struct mgp_module *module, struct mgp_memory *memory) {
+  try {
+    mgp::memory = memory;
+
+    mgp::AddProcedure(Procedure<PageRankProc>, "pagerank", mgp::ProcedureType::Read,
+                      WithCommonParameters({mgp::Parameter("damping_factor", mgp::Type::Double, 0.85),
+                                            mgp::Parameter("max_iterations", mgp::Type::Int, int64_t{100}),
+                                            mgp::Parameter("tolerance", mgp::Type::Double, 1e-6)}),
+                      {mgp::Return(kFieldNode, mgp::Type::Node), mgp::Return("rank", mgp::Type::Double)}, module,
+                      memory);
+
+    mgp::AddProcedure(Procedure<WeaklyConnectedComponentsProc>, "weakly_connected_components",
+                      mgp::ProcedureType::Read, WithCommonParameters({}),
+                      {mgp::Return(kFieldNode, mgp::Type::Node), mgp::Return("component_id", mgp::Type::Int)}, module,
+                      memory);
+
+    mgp::AddProcedure(Procedure<StronglyConnectedComponentsProc>, "strongly_connected_components",
+                      mgp::ProcedureType::Read, WithCommonParameters({}),
+                      {mgp::Return(kFieldNode, mgp::Type::Node), mgp::Return("component_id", mgp::Type::Int)}, module,
+                      memory);
+
+    mgp::AddProcedure(Procedure<LouvainProc>, "louvain", mgp::ProcedureType::Read,
+                      WithCommonParameters({mgp::Parameter("min_gain", mgp::Type::Double, 1e-7),
+                                            mgp::Parameter("max_rounds", mgp::Type::Int, int64_t{100}),
+                                            mgp::Parameter("max_levels", mgp::Type::Int, int64_t{10})}),
+                      {mgp::Return(kFieldNode, mgp::Type::Node), mgp::Return("community_id", mgp::Type::Int)}, module,
+                      memory);
+
+    mgp::AddProcedure(Procedure<BetweennessCentralityProc>, "betweenness_centrality", mgp::ProcedureType::Read,
+                      WithCommonParameters({mgp::Parameter("normalized", mgp::Type::Bool, true)}),
+                      {mgp::Return(kFieldNode, mgp::Type::Node), mgp::Return("betweenness", mgp::Type::Double)},
+                      module, memory);
+
+    mgp::AddProcedure(Procedure<TriangleCountProc>, "triangle_count", mgp::ProcedureType::Read,
+                      WithCommonParameters({}),
+                      {mgp::Return(kFieldNode, mgp::Type::Node), mgp::Return("triangles", mgp::Type::Int)}, module,
+                      memory);
+  } catch (const std::exception &e) {
+    return 1;
+  }
+
+  return 0;
+}
+
+extern "C" int mgp_shutdown_module() { return 0; }
@@ -0,0 +1,266 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Native stream transformations which map JSON messages to nodes.
+//
+// The payload of every message is either a JSON object or an array of JSON
+// objects, and every object is mapped to a node:
+// - the label of the node is the value of the `$label` field of the object if
+//   it is present, otherwise it is the name of the topic of the message;
+// - the rest of the fields are the properties of the node, nested objects are
+//   mapped to maps and arrays are mapped to lists.
+//
+// The fields are mapped with the TRANSFORM_CONFIG of the stream:
+// - `label_field` is the field which holds the label instead of `$label`;
+// - `id_field` is the field by which the merged nodes are matched instead of
+//   `id`;
+// - `property.<field>` is the name of the property the field is stored as,
+//   the name of the field itself by default.
+//
+// The nodes of a batch are grouped by their labels and every group is written
+// by a single query, which unwinds the properties of the nodes passed as a
+// parameter. As the query strings depend only on the labels, they repeat from
+// batch to batch and their plans are taken from the plan cache.
+
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <json/json.hpp>
+#include <mgp.hpp>
+
+namespace {
+
+constexpr std::string_view kLabelField{"$label"};
+constexpr std::string_view kMergeKey{"id"};
+
+constexpr std::string_view kLabelFieldConfig{"label_field"};
+constexpr std::string_view kIdFieldConfig{"id_field"};
+constexpr std::string_view kPropertyConfigPrefix{"property."};
+
+constexpr const char *kQueryField{"query"};
+constexpr const char *kParametersField{"parameters"};
+constexpr std::string_view kNodesParameter{"nodes"};
+
+class TransformationException : public std::exception {
+ public:
+  explicit TransformationException(std::string message) : message_{std::move(message)} {}
+  const char *what() const noexcept override { return message_.c_str(); }
+
+ private:
+  std::string message_;
+};
+
+mgp::Value ToValue(const nlohmann::json &json) {
+  switch (json.type()) {
+    case nlohmann::json::value_t::null:
+    case nlohmann::json::value_t::discarded:
+      return mgp::Value();
+    case nlohmann::json::value_t::boolean:
+      return mgp::Value(json.get<bool>());
+    case nlohmann::json::value_t::number_integer:
+      return mgp::Value(json.get<int64_t>());
+    case nlohmann::json::value_t::number_unsigned: {
+      const auto value = json.get<uint64_t>();
+      if (value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+        return mgp::Value(static_cast<double>(value));
+      }
+      return mgp::Value(static_cast<int64_t>(value));
+    }
+    case nlohmann::json::value_t::number_float:
+      return mgp::Value(json.get<double>());
+    case nlohmann::json::value_t::string:
+      return mgp::Value(std::string_view{json.get_ref<const std::string &>()});
+    case nlohmann::json::value_t::binary:
+      throw TransformationException("Binary JSON values are not supported");
+    case nlohmann::json::value_t::array: {
+      mgp::List list;
+      for (const auto &element : json) {
+        list.AppendExtend(ToValue(element));
+      }
+      return mgp::Value(std::move(list));
+    }
+    case nlohmann::json::value_t::object: {
+      mgp::Map map;
+      for (const auto &[key, value] : json.items()) {
+        map.Insert(key, ToValue(value));
+      }
+      return mgp::Value(std::move(map));
+    }
+  }
+  throw TransformationException("Unknown JSON value type");
+}
+
+/// Mapping of the fields of the JSON objects to the labels and properties of
+/// the nodes.
+struct FieldMapping {
+  std::string label_field{kLabelField};
+  std::string id_field{kMergeKey};
+  // Property names of the renamed fields.
+  std::map<std::string, std::string, std::less<>> properties;
+
+  std::string_view PropertyName(const std::string_view field) const {
+    const auto found = properties.find(field);
+    if (found == properties.end()) return field;
+    return found->second;
+  }
+};
+
+FieldMapping ParseFieldMapping(mgp_messages *messages) {
+  FieldMapping mapping;
+  const mgp::Map config(mgp::MgInvoke<mgp_map *>(mgp_messages_transformation_config, messages));
+  for (const auto &item : config) {
+    const std::string_view key{item.key};
+    const std::string value{item.value.ValueString()};
+    if (value.empty()) {
+      throw TransformationException("The value of the transformation config '" + std::string{key} +
+                                    "' cannot be empty");
+    }
+    if (key == kLabelFieldConfig) {
+      mapping.label_field = value;
+    } else if (key == kIdFieldConfig) {
+      mapping.id_field = value;
+    } else if (key.starts_with(kPropertyConfigPrefix)) {
+      mapping.properties.emplace(key.substr(kPropertyConfigPrefix.size()), value);
+    } else {
+      throw TransformationException("Unknown transformation config '" + std::string{key} + "'");
+    }
+  }
+  return mapping;
+}
+
+/// Quotes the name with backticks, so any label or property can be used in
+/// the query.
+std::string QuoteName(const std::string_view name) {
+  std::string quoted;
+  quoted.reserve(name.size() + 2);
+  quoted.push_back('`');
+  for (const auto character : name) {
+    if (character == '`') quoted.push_back('`');
+    quoted.push_back(character);
+  }
+  quoted.push_back('`');
+  return quoted;
+}
+
+enum class WriteMode : uint8_t { CREATE, MERGE };
+
+std::string MakeQuery(const WriteMode mode, const FieldMapping &mapping, const std::string_view label) {
+  const auto quoted_label = QuoteName(label);
+  std::string query{"UNWIND $"};
+  query.append(kNodesParameter).append(" AS properties ");
+  switch (mode) {
+    case WriteMode::CREATE:
+      query.append("CREATE (n:").append(quoted_label).append(")");
+      break;
+    case WriteMode::MERGE: {
+      const auto merge_key = QuoteName(mapping.PropertyName(mapping.id_field));
+      query.append("MERGE (n:").append(quoted_label).append(" {");
+      query.append(merge_key).append(": properties.").append(merge_key).append("})");
+      break;
+    }
+  }
+  query.append(" SET n += properties");
+  return query;
+}
+
+/// Properties of the nodes of a batch grouped by their labels.
+using NodesByLabel = std::map<std::string, mgp::List, std::less<>>;
+
+void AddNode(const WriteMode mode, const FieldMapping &mapping, const nlohmann::json &object,
+             const std::string_view topic_name, NodesByLabel &nodes_by_label) {
+  if (!object.is_object()) {
+    throw TransformationException("Every node must be represented by a JSON object");
+  }
+  std::string_view label{topic_name};
+  mgp::Map properties;
+  for (const auto &[key, value] : object.items()) {
+    if (key == mapping.label_field) {
+      if (!value.is_string()) {
+        throw TransformationException("The label of a node must be a string");
+      }
+      label = value.get_ref<const std::string &>();
+      continue;
+    }
+    properties.Insert(mapping.PropertyName(key), ToValue(value));
+  }
+  if (mode == WriteMode::MERGE && !object.contains(mapping.id_field)) {
+    throw TransformationException("Every merged node must have the id field '" + mapping.id_field + "'");
+  }
+  if (label.empty()) {
+    throw TransformationException("The label of a node cannot be empty");
+  }
+
+  auto it = nodes_by_label.find(label);
+  if (it == nodes_by_label.end()) {
+    it = nodes_by_label.emplace(std::string{label}, mgp::List()).first;
+  }
+  it->second.AppendExtend(mgp::Value(std::move(properties)));
+}
+
+template <WriteMode mode>
+void Transform(mgp_messages *messages, mgp_graph * /*graph*/, mgp_result *result, mgp_memory *memory) {
+  mgp::memory = memory;
+  const mgp::RecordFactory record_factory(result);
+  try {
+    const auto mapping = ParseFieldMapping(messages);
+    NodesByLabel nodes_by_label;
+    const auto message_count = mgp::MgInvoke<size_t>(mgp_messages_size, messages);
+    for (size_t i = 0; i < message_count; ++i) {
+      auto *message = mgp::MgInvoke<mgp_message *>(mgp_messages_at, messages, i);
+      const auto *payload = mgp::MgInvoke<const char *>(mgp_message_payload, message);
+      const auto payload_size = mgp::MgInvoke<size_t>(mgp_message_payload_size, message);
+      const std::string_view topic_name{mgp::MgInvoke<const char *>(mgp_message_topic_name, message)};
+
+      const auto json = nlohmann::json::parse(payload, payload + payload_size);
+      if (json.is_array()) {
+        for (const auto &object : json) {
+          AddNode(mode, mapping, object, topic_name, nodes_by_label);
+        }
+      } else {
+        AddNode(mode, mapping, json, topic_name, nodes_by_label);
+      }
+    }
+
+    for (auto &[label, nodes] : nodes_by_label) {
+      mgp::Map parameters;
+      parameters.Insert(kNodesParameter, mgp::Value(std::move(nodes)));
+      auto record = record_factory.NewRecord();
+      record.Insert(kQueryField, MakeQuery(mode, mapping, label));
+      record.Insert(kParametersField, parameters);
+    }
+  } catch (const nlohmann::json::exception &e) {
+    record_factory.SetErrorMessage(std::string{"Invalid JSON message: "} + e.what());
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+}  // namespace
+
+extern "C" int mgp_init_module(struct mgp_module *module, struct mgp_memory * /*memory*/) {
+  if (mgp_module_add_transformation(module, "create_nodes", Transform<WriteMode::CREATE>) !=
+      mgp_error::MGP_ERROR_NO_ERROR) {
+    return 1;
+  }
+  if (mgp_module_add_transformation(module, "merge_nodes", Transform<WriteMode::MERGE>) !=
+      mgp_error::MGP_ERROR_NO_ERROR) {
+    return 1;
+  }
+  return 0;
+}
+
+extern "C" int mgp_shutdown_module() { return 0; }
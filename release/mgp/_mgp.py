@@ -250,6 +250,14 @@ class _MODULE:
     def add_write_procedure(wrapper):
         pass
 
+    @staticmethod
+    def add_batch_read_procedure(wrapper):
+        pass
+
+    @staticmethod
+    def add_batch_write_procedure(wrapper):
+        pass
+
     @staticmethod
     def add_transformation(wrapper):
         pass
@@ -21,6 +21,8 @@ inline constexpr int64_t kMinimumStartBatchLimit{1};
 inline constexpr std::chrono::milliseconds kDefaultCheckTimeout{30000};
 inline constexpr std::chrono::milliseconds kMinimumInterval{1};
 inline constexpr int64_t kMinimumSize{1};
+inline constexpr int64_t kDefaultParallelism{1};
+inline constexpr int64_t kDefaultPipelineDepth{0};
 const std::string kReducted{"<REDUCTED>"};
 
 }  // namespace memgraph::integrations
@@ -13,9 +13,15 @@
 
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
+#include <utility>
 
 #include <librdkafka/rdkafkacpp.h>
 #include <spdlog/spdlog.h>
@@ -87,8 +93,8 @@ void CheckAndDestroyLastAssignmentIfNeeded(RdKafka::KafkaConsumer &consumer, con
 }
 
 void TryToConsumeBatch(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info,
-                       const ConsumerFunction &consumer_function, const std::vector<Message> &batch) {
-  consumer_function(batch);
+                       const PipelinedConsumerFunction &consumer_function, const std::vector<Message> &batch) {
+  consumer_function(batch)();
   std::vector<RdKafka::TopicPartition *> partitions;
   utils::OnScopeExit clear_partitions([&]() { RdKafka::TopicPartition::destroy(partitions); });
 
@@ -104,6 +110,195 @@ void TryToConsumeBatch(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &inf
     throw ConsumerCommitFailedException(info.consumer_name, RdKafka::err2str(err));
   }
 }
+
+using TopicPartitionKey = std::pair<std::string_view, int32_t>;
+using TopicPartitionOffsets = std::map<TopicPartitionKey, int64_t>;
+
+void CollectNextOffsets(const std::vector<Message> &messages, TopicPartitionOffsets &next_offsets) {
+  for (const auto &message : messages) {
+    next_offsets[{message.TopicName(), message.Partition()}] = message.Offset() + 1;
+  }
+}
+
+void CollectFirstOffsets(const std::vector<Message> &messages, TopicPartitionOffsets &first_offsets) {
+  for (const auto &message : messages) {
+    first_offsets.emplace(TopicPartitionKey{message.TopicName(), message.Partition()}, message.Offset());
+  }
+}
+
+// Moves the position of the consumer to the given offsets, so the messages from there are fetched again.
+void SeekToOffsets(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info, const TopicPartitionOffsets &offsets) {
+  static constexpr int kSeekTimeoutMs{1000};
+  for (const auto &[topic_partition, offset] : offsets) {
+    std::unique_ptr<RdKafka::TopicPartition> partition{
+        RdKafka::TopicPartition::create(std::string{topic_partition.first}, topic_partition.second, offset)};
+    if (const auto err = consumer.seek(*partition, kSeekTimeoutMs); err != RdKafka::ERR_NO_ERROR) {
+      spdlog::warn("Kafka consumer {} couldn't rewind partition {} of topic {} to offset {}: {}", info.consumer_name,
+                   topic_partition.second, topic_partition.first, offset, RdKafka::err2str(err));
+    }
+  }
+}
+
+void CommitOffsets(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info,
+                   const TopicPartitionOffsets &next_offsets) {
+  std::vector<RdKafka::TopicPartition *> offsets;
+  utils::OnScopeExit clear_offsets([&]() { RdKafka::TopicPartition::destroy(offsets); });
+  offsets.reserve(next_offsets.size());
+  for (const auto &[topic_partition, offset] : next_offsets) {
+    offsets.push_back(
+        RdKafka::TopicPartition::create(std::string{topic_partition.first}, topic_partition.second, offset));
+  }
+  if (offsets.empty()) {
+    return;
+  }
+  if (const auto err = consumer.commitSync(offsets); err != RdKafka::ERR_NO_ERROR) {
+    throw ConsumerCommitFailedException(info.consumer_name, RdKafka::err2str(err));
+  }
+}
+
+void TryToConsumeBatchInParallel(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info,
+                                 const PipelinedConsumerFunction &consumer_function, utils::ThreadPool &worker_pool,
+                                 std::vector<Message> &&batch) {
+  // The partitions are distributed among the parts of the batch in a round-robin manner. As all messages of a
+  // partition end up in the same part in their original order, and the next batch is consumed only after all parts
+  // are processed, the messages of each partition are processed in order.
+  std::vector<std::vector<Message>> parts(static_cast<size_t>(info.parallelism));
+  std::map<TopicPartitionKey, size_t> part_of_partition;
+  for (auto &message : batch) {
+    auto it = part_of_partition.find({message.TopicName(), message.Partition()});
+    if (it == part_of_partition.end()) {
+      const auto part = part_of_partition.size() % parts.size();
+      it = part_of_partition.emplace(TopicPartitionKey{message.TopicName(), message.Partition()}, part).first;
+    }
+    parts[it->second].push_back(std::move(message));
+  }
+  std::erase_if(parts, [](const auto &part) { return part.empty(); });
+
+  std::vector<std::exception_ptr> part_errors(parts.size());
+  utils::ParallelFor(&worker_pool, parts.size(), [&](const size_t part) {
+    try {
+      consumer_function(parts[part])();
+    } catch (...) {
+      part_errors[part] = std::current_exception();
+    }
+  });
+
+  // Every part is processed and committed to the database in its own transaction, so a batch can be committed only
+  // partially: the parts that succeeded stay in the database even if another part of the same batch fails. Therefore
+  // only the offsets of the successfully processed parts are committed, so the offset of a partition never gets ahead
+  // of the data which was committed to the database, and the consumer is rewound to the first message of each failed
+  // part, so only those messages are consumed again when the consumer is restarted.
+  TopicPartitionOffsets next_offsets;
+  TopicPartitionOffsets failed_offsets;
+  for (size_t part = 0; part < parts.size(); ++part) {
+    if (part_errors[part]) {
+      CollectFirstOffsets(parts[part], failed_offsets);
+      continue;
+    }
+    CollectNextOffsets(parts[part], next_offsets);
+  }
+  CommitOffsets(consumer, info, next_offsets);
+  SeekToOffsets(consumer, info, failed_offsets);
+
+  for (const auto &error : part_errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+void ConsumeBatch(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info,
+                  const PipelinedConsumerFunction &consumer_function, utils::ThreadPool *worker_pool,
+                  std::vector<Message> &&batch) {
+  if (worker_pool == nullptr) {
+    TryToConsumeBatch(consumer, info, consumer_function, batch);
+    return;
+  }
+  TryToConsumeBatchInParallel(consumer, info, consumer_function, *worker_pool, std::move(batch));
+}
+
+/// A fetched batch whose first stage is already done.
+struct PreparedBatch {
+  std::vector<Message> messages;
+  std::function<void()> process;
+};
+
+/// Bounded queue between the fetching and the processing thread of a pipelined consumer. The fetching thread is
+/// blocked while the queue is full, so the number of fetched, but not yet processed batches is limited.
+class BatchPipeline {
+ public:
+  explicit BatchPipeline(const size_t capacity) : capacity_{capacity} {}
+
+  /// Returns false if the pipeline is closed. The batch is kept even in that case, so it is returned by Drain.
+  bool Push(PreparedBatch &&batch) {
+    std::unique_lock guard{mutex_};
+    space_available_.wait(guard, [this] { return closed_ || batches_.size() < capacity_; });
+    batches_.push_back(std::move(batch));
+    batch_available_.notify_one();
+    return !closed_;
+  }
+
+  /// Returns std::nullopt if the pipeline is closed and all of the batches are popped.
+  std::optional<PreparedBatch> Pop() {
+    std::unique_lock guard{mutex_};
+    batch_available_.wait(guard, [this] { return closed_ || !batches_.empty(); });
+    if (batches_.empty()) {
+      return std::nullopt;
+    }
+    auto batch = std::move(batches_.front());
+    batches_.pop_front();
+    space_available_.notify_one();
+    return batch;
+  }
+
+  void Close(std::exception_ptr error = nullptr) {
+    std::lock_guard guard{mutex_};
+    closed_ = true;
+    if (!error_) {
+      error_ = std::move(error);
+    }
+    space_available_.notify_all();
+    batch_available_.notify_all();
+  }
+
+  std::exception_ptr Error() const {
+    std::lock_guard guard{mutex_};
+    return error_;
+  }
+
+  std::deque<PreparedBatch> Drain() {
+    std::lock_guard guard{mutex_};
+    return std::exchange(batches_, {});
+  }
+
+ private:
+  const size_t capacity_;
+  mutable std::mutex mutex_;
+  std::condition_variable space_available_;
+  std::condition_variable batch_available_;
+  std::deque<PreparedBatch> batches_;
+  bool closed_{false};
+  std::exception_ptr error_;
+};
+
+// Moves the position of the consumer back to the first message of the dropped batches, so they are fetched again when
+// the consumer is started next time.
+void RewindDroppedBatches(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info,
+                          const std::deque<PreparedBatch> &dropped_batches) {
+  TopicPartitionOffsets first_offsets;
+  for (const auto &batch : dropped_batches) {
+    CollectFirstOffsets(batch.messages, first_offsets);
+  }
+  SeekToOffsets(consumer, info, first_offsets);
+}
+
+PipelinedConsumerFunction ToPipelinedConsumerFunction(ConsumerFunction consumer_function) {
+  if (!consumer_function) {
+    return {};
+  }
+  return [consumer_function = std::move(consumer_function)](const std::vector<Message> &messages) {
+    consumer_function(messages);
+    return std::function<void()>{[] {}};
+  };
+}
 }  // namespace
 
 Message::Message(std::unique_ptr<RdKafka::Message> &&message) : message_{std::move(message)} {
@@ -138,7 +333,15 @@ int64_t Message::Offset() const {
   return c_message->offset;
 }
 
+int32_t Message::Partition() const {
+  const auto *c_message = message_->c_ptr();
+  return c_message->partition;
+}
+
 Consumer::Consumer(ConsumerInfo info, ConsumerFunction consumer_function)
+    : Consumer(std::move(info), ToPipelinedConsumerFunction(std::move(consumer_function))) {}
+
+Consumer::Consumer(ConsumerInfo info, PipelinedConsumerFunction consumer_function)
     : info_{std::move(info)}, consumer_function_(std::move(consumer_function)), cb_(info_.consumer_name) {
   MG_ASSERT(consumer_function_, "Empty consumer function for Kafka consumer");
   // NOLINTNEXTLINE (modernize-use-nullptr)
@@ -148,6 +351,16 @@ Consumer::Consumer(ConsumerInfo info, ConsumerFunction consumer_function)
   if (info_.batch_size < kMinimumSize) {
     throw ConsumerFailedToInitializeException(info_.consumer_name, "Batch size has to be positive!");
   }
+  if (info_.parallelism < kMinimumSize) {
+    throw ConsumerFailedToInitializeException(info_.consumer_name, "Parallelism has to be positive!");
+  }
+  if (info_.pipeline_depth < 0) {
+    throw ConsumerFailedToInitializeException(info_.consumer_name, "Pipeline depth cannot be negative!");
+  }
+  if (info_.pipeline_depth > 0 && info_.parallelism > 1) {
+    throw ConsumerFailedToInitializeException(info_.consumer_name,
+                                              "Pipelining cannot be combined with parallel consumption!");
+  }
 
   std::unique_ptr<RdKafka::Conf> conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
   if (conf == nullptr) {
@@ -235,6 +448,11 @@ Consumer::Consumer(ConsumerInfo info, ConsumerFunction consumer_function)
   if (const auto err = consumer_->subscribe(info_.topics); err != RdKafka::ERR_NO_ERROR) {
     throw ConsumerFailedToInitializeException(info_.consumer_name, RdKafka::err2str(err));
   }
+
+  if (info_.parallelism > 1) {
+    // The consuming thread processes one part of each batch itself.
+    worker_pool_ = std::make_unique<utils::ThreadPool>(static_cast<size_t>(info_.parallelism - 1));
+  }
 }
 
 Consumer::~Consumer() {
@@ -393,12 +611,18 @@ void Consumer::StartConsuming() {
 
     utils::ThreadSetName(full_thread_name.substr(0, kMaxThreadNameSize));
 
+    if (info_.pipeline_depth > 0) {
+      ConsumePipelined();
+      is_running_.store(false);
+      return;
+    }
+
     while (is_running_) {
       auto maybe_batch = GetBatch(*consumer_, info_, is_running_);
       if (maybe_batch.HasError()) {
         throw ConsumerReadMessagesFailedException(info_.consumer_name, maybe_batch.GetError());
       }
-      const auto &batch = maybe_batch.GetValue();
+      auto &batch = maybe_batch.GetValue();
 
       if (batch.empty()) {
         continue;
@@ -407,7 +631,7 @@ void Consumer::StartConsuming() {
       spdlog::info("Kafka consumer {} is processing a batch", info_.consumer_name);
 
       try {
-        TryToConsumeBatch(*consumer_, info_, consumer_function_, batch);
+        ConsumeBatch(*consumer_, info_, consumer_function_, worker_pool_.get(), std::move(batch));
       } catch (const std::exception &e) {
         spdlog::warn("Error happened in consumer {} while processing a batch: {}!", info_.consumer_name, e.what());
         break;
@@ -418,6 +642,82 @@ void Consumer::StartConsuming() {
   });
 }
 
+void Consumer::ConsumePipelined() {
+  BatchPipeline pipeline{static_cast<size_t>(info_.pipeline_depth)};
+
+  std::thread fetching_thread([this, &pipeline] {
+    static constexpr auto kMaxThreadNameSize = utils::GetMaxThreadNameSize();
+    const auto full_thread_name = "Fetch#" + info_.consumer_name;
+
+    utils::ThreadSetName(full_thread_name.substr(0, kMaxThreadNameSize));
+
+    try {
+      while (is_running_) {
+        auto maybe_batch = GetBatch(*consumer_, info_, is_running_);
+        if (maybe_batch.HasError()) {
+          throw ConsumerReadMessagesFailedException(info_.consumer_name, maybe_batch.GetError());
+        }
+        auto &batch = maybe_batch.GetValue();
+
+        if (batch.empty()) {
+          continue;
+        }
+
+        auto process = consumer_function_(batch);
+        if (!pipeline.Push({std::move(batch), std::move(process)})) {
+          break;
+        }
+      }
+      pipeline.Close();
+    } catch (...) {
+      pipeline.Close(std::current_exception());
+    }
+  });
+
+  // The batch whose second stage failed is already popped, but it has to be rewound together with the queued ones.
+  std::deque<PreparedBatch> dropped_batches;
+  while (auto batch = pipeline.Pop()) {
+    spdlog::info("Kafka consumer {} is processing a batch", info_.consumer_name);
+
+    try {
+      batch->process();
+    } catch (const std::exception &e) {
+      spdlog::warn("Error happened in consumer {} while processing a batch: {}!", info_.consumer_name, e.what());
+      dropped_batches.push_back(std::move(*batch));
+      is_running_.store(false);
+      break;
+    }
+    try {
+      TopicPartitionOffsets next_offsets;
+      CollectNextOffsets(batch->messages, next_offsets);
+      CommitOffsets(*consumer_, info_, next_offsets);
+    } catch (const std::exception &e) {
+      spdlog::warn("Error happened in consumer {} while processing a batch: {}!", info_.consumer_name, e.what());
+      is_running_.store(false);
+      break;
+    }
+    spdlog::info("Kafka consumer {} finished processing", info_.consumer_name);
+    if (!is_running_) {
+      break;
+    }
+  }
+
+  pipeline.Close();
+  fetching_thread.join();
+
+  if (const auto error = pipeline.Error(); error) {
+    try {
+      std::rethrow_exception(error);
+    } catch (const std::exception &e) {
+      spdlog::warn("Error happened in consumer {} while preparing a batch: {}!", info_.consumer_name, e.what());
+    }
+  }
+
+  // The already fetched batches must not be lost, they are processed when the consumer is started again.
+  std::ranges::move(pipeline.Drain(), std::back_inserter(dropped_batches));
+  RewindDroppedBatches(*consumer_, info_, dropped_batches);
+}
+
 void Consumer::StartConsumingWithLimit(uint64_t limit_batches, std::optional<std::chrono::milliseconds> timeout) const {
   MG_ASSERT(!is_running_, "Cannot start already running consumer!");
 
@@ -437,11 +737,11 @@ void Consumer::StartConsumingWithLimit(uint64_t limit_batches, std::optional<std
       throw ConsumerStartFailedException(info_.consumer_name, "Timeout reached");
     }
 
-    const auto maybe_batch = GetBatch(*consumer_, info_, is_running_);
+    auto maybe_batch = GetBatch(*consumer_, info_, is_running_);
     if (maybe_batch.HasError()) {
       throw ConsumerReadMessagesFailedException(info_.consumer_name, maybe_batch.GetError());
     }
-    const auto &batch = maybe_batch.GetValue();
+    auto &batch = maybe_batch.GetValue();
 
     if (batch.empty()) {
       continue;
@@ -450,7 +750,7 @@ void Consumer::StartConsumingWithLimit(uint64_t limit_batches, std::optional<std
 
     spdlog::info("Kafka consumer {} is processing a batch", info_.consumer_name);
 
-    TryToConsumeBatch(*consumer_, info_, consumer_function_, batch);
+    ConsumeBatch(*consumer_, info_, consumer_function_, worker_pool_.get(), std::move(batch));
 
     spdlog::info("Kafka consumer {} finished processing", info_.consumer_name);
   }
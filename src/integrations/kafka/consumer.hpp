@@ -24,7 +24,9 @@
 
 #include <librdkafka/rdkafka.h>
 #include <librdkafka/rdkafkacpp.h>
+#include "integrations/constants.hpp"
 #include "utils/result.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::integrations::kafka {
 
@@ -72,12 +74,21 @@ class Message final {
   /// Returns the offset of the message
   int64_t Offset() const;
 
+  /// Returns the partition of the topic the message belongs to.
+  int32_t Partition() const;
+
  private:
   std::unique_ptr<RdKafka::Message> message_;
 };
 
 using ConsumerFunction = std::function<void(const std::vector<Message> &)>;
 
+/// Consumer function which processes a batch in two stages. The function itself is the first stage, the function
+/// returned by it is the second one. When the consumer is pipelined, the first stage of a batch might run while the
+/// second stage of the previous batches is still in progress, but the second stages are always run one by one in the
+/// order of the batches and the offsets of a batch are committed only after its second stage is finished.
+using PipelinedConsumerFunction = std::function<std::function<void()>(const std::vector<Message> &)>;
+
 /// ConsumerInfo holds all the information necessary to create a Consumer.
 struct ConsumerInfo {
   std::string consumer_name;
@@ -86,6 +97,14 @@ struct ConsumerInfo {
   std::string bootstrap_servers;
   std::chrono::milliseconds batch_interval;
   int64_t batch_size;
+  /// Number of batch parts processed concurrently. The messages of a batch are split by their partitions, so the
+  /// messages of a partition are always processed in order by a single call of the consumer function. As the parts
+  /// are processed independently, a batch can be committed partially: if a part fails, the offsets of the other parts
+  /// are still committed and only the partitions of the failed part are consumed again after a restart.
+  int64_t parallelism{kDefaultParallelism};
+  /// Maximum number of fetched batches waiting for their second stage while an earlier batch is in its second stage.
+  /// Zero disables pipelining, so the next batch is fetched only after the previous one is fully processed.
+  int64_t pipeline_depth{kDefaultPipelineDepth};
   std::unordered_map<std::string, std::string> public_configs;
   std::unordered_map<std::string, std::string> private_configs;
 };
@@ -98,9 +117,18 @@ class Consumer final : public RdKafka::EventCb {
  public:
   /// Creates a new consumer with the given parameters.
   ///
+  /// If the parallelism is greater than one, the consumer function is called concurrently with the messages of
+  /// different partitions, so it has to be thread-safe.
+  ///
   /// @throws ConsumerFailedToInitializeException if the consumer can't connect
   ///         to the Kafka endpoint.
   Consumer(ConsumerInfo info, ConsumerFunction consumer_function);
+
+  /// Creates a new consumer with a consumer function which processes the batches in two stages.
+  ///
+  /// @throws ConsumerFailedToInitializeException if the consumer can't connect
+  ///         to the Kafka endpoint.
+  Consumer(ConsumerInfo info, PipelinedConsumerFunction consumer_function);
   ~Consumer() override;
 
   Consumer(const Consumer &other) = delete;
@@ -110,7 +138,8 @@ class Consumer final : public RdKafka::EventCb {
 
   /// Starts consuming messages.
   ///
-  /// This method will start a new thread which will poll all the topics for messages.
+  /// This method will start a new thread which will poll all the topics for messages. If the consumer is pipelined, a
+  /// second thread is started to fetch the batches and run their first stage.
   ///
   /// @throws ConsumerRunningException if the consumer is already running
   /// @throws ConsumerStartFailedException if the commited offsets cannot be restored
@@ -118,7 +147,8 @@ class Consumer final : public RdKafka::EventCb {
 
   /// Starts consuming messages.
   ///
-  /// This method will start a new thread which will poll all the topics for messages.
+  /// This method will start a new thread which will poll all the topics for messages. The batches are never pipelined,
+  /// so no batch is fetched over the limit.
   ///
   /// @param limit_batches the consumer will only consume the given number of batches.
   /// @param timeout the maximum duration during which the command should run.
@@ -165,6 +195,7 @@ class Consumer final : public RdKafka::EventCb {
   void event_cb(RdKafka::Event &event) override;
 
   void StartConsuming();
+  void ConsumePipelined();
   void StartConsumingWithLimit(uint64_t limit_batches, std::optional<std::chrono::milliseconds> timeout) const;
 
   void StopConsuming();
@@ -184,10 +215,13 @@ class Consumer final : public RdKafka::EventCb {
   };
 
   ConsumerInfo info_;
-  ConsumerFunction consumer_function_;
+  PipelinedConsumerFunction consumer_function_;
   mutable std::atomic<bool> is_running_{false};
   mutable std::vector<RdKafka::TopicPartition *> last_assignment_;  // Protected by is_running_
   std::unique_ptr<RdKafka::KafkaConsumer, std::function<void(RdKafka::KafkaConsumer *)>> consumer_;
+  // Runs the parts of the batches besides the one processed by the consuming thread, only present if the parallelism
+  // is greater than one.
+  std::unique_ptr<utils::ThreadPool> worker_pool_;
   std::thread thread_;
   ConsumerRebalanceCb cb_;
 };
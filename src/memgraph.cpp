@@ -50,6 +50,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/interpreter.hpp"
 #include "query/plan/operator.hpp"
+#include "query/procedure/graph_projection.hpp"
 #include "query/procedure/module.hpp"
 #include "query/procedure/py_module.hpp"
 #include "requests/requests.hpp"
@@ -196,6 +197,16 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24 * 3600));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_gc_max_deltas_per_step, memgraph::storage::Config::Gc().max_deltas_per_step,
+              "Maximum number of deltas the storage garbage collector unlinks, or index entries it checks, while "
+              "holding the storage lock. Larger collections are done in several steps. Set to 0 to do each collection "
+              "in a single step.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_gc_parallel_workers, memgraph::storage::Config::Gc().parallel_workers,
+                        "Number of threads the storage garbage collector uses to clean up indices and free memory. "
+                        "Indices are built on the same threads.",
+                        FLAG_IN_RANGE(1, 256));
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
 // `mg_import_csv`. If you change it, make sure to change it there as well.
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -226,6 +237,25 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(storage_dictionary_properties, "",
+              "Comma-separated list of properties whose string values are dictionary encoded. Each distinct string is "
+              "stored once and shared by all vertices and edges with it.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_string(storage_property_columns, "",
+                        "Comma-separated list of Label.property pairs whose values are also kept in dense columns. "
+                        "Aggregations over all vertices with the label read the values from the column.",
+                        {
+                          if (value.empty()) return true;
+                          for (const auto &column : memgraph::utils::Split(value, ",")) {
+                            if (memgraph::utils::Split(memgraph::utils::Trim(column), ".").size() != 2) {
+                              std::cout << "Expected --" << flagname << " to be a list of Label.property pairs."
+                                        << std::endl;
+                              return false;
+                            }
+                          }
+                          return true;
+                        });
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(telemetry_enabled, false,
@@ -234,6 +264,28 @@ DEFINE_bool(telemetry_enabled, false,
             "the database runtime (vertex and edge counts and resource usage) "
             "to allow for easier improvement of the product.");
 
+// Trigger flags
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(after_commit_trigger_threads, 1,
+                        "Number of threads executing AFTER COMMIT triggers. Each trigger is always executed by the same "
+                        "thread, so its executions keep the commit order.",
+                        FLAG_IN_RANGE(1, 256));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(after_commit_trigger_max_coalesced_transactions, 1,
+                        "Maximum number of committed transactions whose events are handled by a single execution of "
+                        "an AFTER COMMIT trigger. Transactions waiting for the same trigger thread are coalesced, which "
+                        "keeps the trigger backlog short under heavy write load.",
+                        FLAG_IN_RANGE(1, std::numeric_limits<uint32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(after_commit_trigger_queue_size, 1024,
+                        "Maximum number of groups of coalesced transactions waiting for an AFTER COMMIT trigger thread. "
+                        "Committing transactions wait for the triggers to catch up once it is reached.",
+                        FLAG_IN_RANGE(1, std::numeric_limits<uint32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(trigger_context_max_objects, 0,
+              "Maximum number of created, deleted and updated objects a single transaction registers for the "
+              "triggers. The changes over the limit are not visible to the triggers. Set to 0 to disable the limit.");
+
 // Streams flags
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint32(
@@ -275,6 +327,32 @@ DEFINE_uint64(replication_replica_check_frequency_sec, 1,
               "The time duration between two replica checks/pings. If < 1, replicas will NOT be checked at all. NOTE: "
               "The MAIN instance allocates a new thread for each REPLICA.");
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_bfs_parallel_workers, 0U,
+                        "Number of worker threads used by single source breadth-first expansions without a filter "
+                        "lambda. Such expansions are then done one level at a time, with large levels split across "
+                        "the workers. 0 or 1 keeps the sequential expansion.",
+                        FLAG_IN_RANGE(0, 1024));
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_aggregation_parallel_workers, 0U,
+                        "Number of worker threads used by aggregations with grouping keys. Input rows are split by "
+                        "the hash of their grouping key and each part is aggregated by a single worker. 0 or 1 "
+                        "aggregates all rows on the query thread.",
+                        FLAG_IN_RANGE(0, 1024));
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_procedure_parallel_workers, std::max(std::thread::hardware_concurrency(), 1U),
+                        "Number of worker threads on which query procedures can process vertices in parallel, see "
+                        "mgp_graph_parallel_for_vertices. By default, this will be the number of processing units "
+                        "available on the machine. 0 or 1 processes the vertices on the query thread.",
+                        FLAG_IN_RANGE(0, 1024));
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_graph_projection_memory_limit, 1024,
+              "Memory limit in MiB of all graph projections cached with mg.project_graph. The least recently used "
+              "projections are evicted to make room for new ones. Set to 0 for no limit.");
+
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(
     memory_limit, 0,
@@ -872,7 +950,9 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .max_deltas_per_step = FLAGS_storage_gc_max_deltas_per_step,
+             .parallel_workers = FLAGS_storage_gc_parallel_workers},
       .items = {.properties_on_edges = FLAGS_storage_properties_on_edges},
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_storage_recover_on_startup,
@@ -900,7 +980,17 @@ int main(int argc, char **argv) {
     }
     db_config.durability.snapshot_interval = std::chrono::seconds(FLAGS_storage_snapshot_interval_sec);
   }
+  for (const auto &property : memgraph::utils::Split(FLAGS_storage_dictionary_properties, ",")) {
+    auto name = memgraph::utils::Trim(property);
+    if (!name.empty()) db_config.dictionary.properties.emplace_back(name);
+  }
   memgraph::storage::Storage db(db_config);
+  if (!FLAGS_storage_property_columns.empty()) {
+    for (const auto &column : memgraph::utils::Split(FLAGS_storage_property_columns, ",")) {
+      const auto label_property = memgraph::utils::Split(memgraph::utils::Trim(column), ".");
+      db.CreatePropertyColumn(db.NameToLabel(label_property[0]), db.NameToProperty(label_property[1]));
+    }
+  }
 
   memgraph::query::InterpreterContext interpreter_context{
       &db,
@@ -910,8 +1000,17 @@ int main(int argc, char **argv) {
        .default_kafka_bootstrap_servers = FLAGS_kafka_bootstrap_servers,
        .default_pulsar_service_url = FLAGS_pulsar_service_url,
        .stream_transaction_conflict_retries = FLAGS_stream_transaction_conflict_retries,
-       .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval)},
+       .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval),
+       .after_commit_trigger_threads = FLAGS_after_commit_trigger_threads,
+       .after_commit_trigger_max_coalesced_transactions = FLAGS_after_commit_trigger_max_coalesced_transactions,
+       .after_commit_trigger_queue_size = FLAGS_after_commit_trigger_queue_size,
+       .trigger_context_max_objects = FLAGS_trigger_context_max_objects,
+       .bfs_parallel_workers = FLAGS_query_bfs_parallel_workers,
+       .aggregation_parallel_workers = FLAGS_query_aggregation_parallel_workers,
+       .procedure_parallel_workers = FLAGS_query_procedure_parallel_workers},
       FLAGS_data_directory};
+  // No query is running yet, so the spill files are left over from a crash.
+  memgraph::utils::DeleteDir(interpreter_context.spill_directory);
 #ifdef MG_ENTERPRISE
   SessionData session_data{&db, &interpreter_context, &auth, &audit_log};
 #else
@@ -920,6 +1019,8 @@ int main(int argc, char **argv) {
 
   memgraph::query::procedure::gModuleRegistry.SetModulesDirectory(query_modules_directories, FLAGS_data_directory);
   memgraph::query::procedure::gModuleRegistry.UnloadAndLoadModulesFromDirectories();
+  memgraph::query::procedure::gGraphProjections.SetMemoryLimit(FLAGS_query_graph_projection_memory_limit * 1024 *
+                                                               1024);
 
   memgraph::glue::AuthQueryHandler auth_handler(&auth, FLAGS_auth_user_or_role_name_regex);
   memgraph::glue::AuthChecker auth_checker{&auth};
@@ -28,5 +28,22 @@ struct InterpreterConfig {
   std::string default_pulsar_service_url;
   uint32_t stream_transaction_conflict_retries;
   std::chrono::milliseconds stream_transaction_retry_interval;
+
+  // Number of threads executing the after commit triggers.
+  size_t after_commit_trigger_threads{1};
+  // Maximum number of committed transactions handled by a single after commit trigger execution.
+  size_t after_commit_trigger_max_coalesced_transactions{1};
+  // Maximum number of coalesced transactions waiting for an after commit trigger thread, committing transactions
+  // wait once it is reached.
+  size_t after_commit_trigger_queue_size{1024};
+  // Maximum number of objects and changes registered for the triggers by a single transaction, 0 for no limit.
+  size_t trigger_context_max_objects{0};
+
+  // Number of worker threads of each parallel query operation. The pools are
+  // shared by all queries and aren't created for 0 or 1 workers, in which case
+  // the work is done on the query thread.
+  size_t bfs_parallel_workers{0};
+  size_t aggregation_parallel_workers{0};
+  size_t procedure_parallel_workers{0};
 };
 }  // namespace memgraph::query
@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include <filesystem>
 #include <memory>
+#include <optional>
+#include <string>
 #include <type_traits>
 
 #include "query/common.hpp"
@@ -21,6 +24,8 @@
 #include "query/plan/profile.hpp"
 #include "query/trigger.hpp"
 #include "utils/async_timer.hpp"
+#include "utils/memory.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::query {
 
@@ -73,6 +78,20 @@ struct ExecutionContext {
   ExecutionStats execution_stats;
   TriggerContextCollector *trigger_context_collector{nullptr};
   utils::AsyncTimer timer;
+  // Query memory limit, which the memory of each pull and of the workers of
+  // the query is counted against. Operators which materialize their whole
+  // input (OrderBy, Aggregate and Distinct) spill it to temporary files in
+  // `spill_directory` once it doesn't fit in the limit next to that memory.
+  // Not set if the query has no memory limit.
+  utils::MemoryLimit *memory_limit{nullptr};
+  std::filesystem::path spill_directory;
+  // Worker threads shared by all queries, to which the parallel operations
+  // hand out work. The work is done on the query thread if the pool isn't set.
+  utils::ThreadPool *bfs_worker_pool{nullptr};
+  utils::ThreadPool *aggregation_worker_pool{nullptr};
+  utils::ThreadPool *procedure_worker_pool{nullptr};
+  // User who runs the query, not set if authentication is disabled.
+  std::optional<std::string> username;
 #ifdef MG_ENTERPRISE
   std::unique_ptr<FineGrainedAuthChecker> auth_checker{nullptr};
 #endif
@@ -20,14 +20,8 @@ DEFINE_VALIDATED_int32(query_plan_cache_ttl, 60, "Time to live for cached query
 namespace memgraph::query {
 CachedPlan::CachedPlan(std::unique_ptr<LogicalPlan> plan) : plan_(std::move(plan)) {}
 
-ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::string, storage::PropertyValue> &params,
-                       utils::SkipList<QueryCacheEntry> *cache, const InterpreterConfig::Query &query_config) {
-  // Strip the query for caching purposes. The process of stripping a query
-  // "normalizes" it by replacing any literals with new parameters. This
-  // results in just the *structure* of the query being taken into account for
-  // caching.
-  frontend::StrippedQuery stripped_query{query_string};
-
+Parameters MakeParameters(const frontend::StrippedQuery &stripped_query,
+                          const std::map<std::string, storage::PropertyValue> &params) {
   // Copy over the parameters that were introduced during stripping.
   Parameters parameters{stripped_query.literals()};
 
@@ -41,6 +35,18 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
 
     parameters.Add(param_pair.first, it->second);
   }
+  return parameters;
+}
+
+ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::string, storage::PropertyValue> &params,
+                       utils::SkipList<QueryCacheEntry> *cache, const InterpreterConfig::Query &query_config) {
+  // Strip the query for caching purposes. The process of stripping a query
+  // "normalizes" it by replacing any literals with new parameters. This
+  // results in just the *structure* of the query being taken into account for
+  // caching.
+  frontend::StrippedQuery stripped_query{query_string};
+
+  auto parameters = MakeParameters(stripped_query, params);
 
   // Cache the query's AST if it isn't already.
   auto hash = stripped_query.hash();
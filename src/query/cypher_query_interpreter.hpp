@@ -110,6 +110,14 @@ struct ParsedQuery {
   bool is_cacheable{true};
 };
 
+/**
+ * Return the parameters with which the stripped query is executed, i.e. the
+ * literals introduced during stripping and the user-specified parameters.
+ * @throw query::UnprovidedParameterError if a user-specified parameter is missing.
+ */
+Parameters MakeParameters(const frontend::StrippedQuery &stripped_query,
+                          const std::map<std::string, storage::PropertyValue> &params);
+
 ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::string, storage::PropertyValue> &params,
                        utils::SkipList<QueryCacheEntry> *cache, const InterpreterConfig::Query &query_config);
 
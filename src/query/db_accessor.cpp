@@ -107,6 +107,13 @@ std::optional<VertexAccessor> SubgraphDbAccessor::FindVertex(storage::Gid gid, s
   return std::nullopt;
 }
 
+storage::VertexOrdinals SubgraphDbAccessor::GetVertexOrdinals(storage::View view,
+                                                              [[maybe_unused]] utils::ThreadPool *pool) {
+  auto vertices = Vertices(view);
+  return storage::VertexOrdinals::Build(iter::imap([](const VertexAccessor &vertex) { return vertex.impl_; }, vertices),
+                                        db_accessor_.VertexGidUpperBound());
+}
+
 query::Graph *SubgraphDbAccessor::getGraph() { return graph_; }
 
 VertexAccessor SubgraphVertexAccessor::GetVertexAccessor() const { return impl_; }
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <optional>
+#include <span>
 
 #include <cppitertools/filter.hpp>
 #include <cppitertools/imap.hpp>
@@ -41,6 +42,7 @@
 #undef TRUE
 ///////////////////////////////////////////////////////////
 
+#include "storage/v2/vertex_ordinals.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/bound.hpp"
 #include "utils/exceptions.hpp"
@@ -67,6 +69,11 @@ class EdgeAccessor final {
     return impl_.GetProperty(key, view);
   }
 
+  storage::Result<std::vector<storage::PropertyValue>> GetProperties(storage::View view,
+                                                                     std::span<const storage::PropertyId> keys) const {
+    return impl_.GetProperties(keys, view);
+  }
+
   storage::Result<storage::PropertyValue> SetProperty(storage::PropertyId key, const storage::PropertyValue &value) {
     return impl_.SetProperty(key, value);
   }
@@ -125,6 +132,16 @@ class VertexAccessor final {
     return impl_.GetProperty(key, view);
   }
 
+  storage::Result<std::vector<storage::PropertyValue>> GetProperties(storage::View view,
+                                                                     std::span<const storage::PropertyId> keys) const {
+    return impl_.GetProperties(keys, view);
+  }
+
+  storage::Result<std::optional<bool>> IsPropertyEqual(storage::View view, storage::PropertyId key,
+                                                       const storage::PropertyValue &value) const {
+    return impl_.IsPropertyEqual(key, value, view);
+  }
+
   storage::Result<storage::PropertyValue> SetProperty(storage::PropertyId key, const storage::PropertyValue &value) {
     return impl_.SetProperty(key, value);
   }
@@ -322,6 +339,13 @@ class DbAccessor final {
     return std::nullopt;
   }
 
+  std::optional<EdgeAccessor> FindEdge(storage::Gid gid, storage::EdgeTypeId edge_type, const VertexAccessor &from,
+                                       const VertexAccessor &to, storage::View view) {
+    auto maybe_edge = accessor_->FindEdge(gid, edge_type, from.impl_, to.impl_, view);
+    if (maybe_edge) return EdgeAccessor(*maybe_edge);
+    return std::nullopt;
+  }
+
   void FinalizeTransaction() { accessor_->FinalizeTransaction(); }
 
   VerticesIterable Vertices(storage::View view) { return VerticesIterable(accessor_->Vertices(view)); }
@@ -430,8 +454,26 @@ class DbAccessor final {
     return accessor_->LabelPropertyIndexExists(label, prop);
   }
 
+  std::optional<storage::PropertyColumnSummary> SummarizePropertyColumn(storage::View view, storage::LabelId label,
+                                                                        storage::PropertyId property) {
+    return accessor_->SummarizePropertyColumn(label, property, view);
+  }
+
   int64_t VerticesCount() const { return accessor_->ApproximateVertexCount(); }
 
+  uint64_t VertexGidUpperBound() const { return accessor_->VertexGidUpperBound(); }
+
+  const std::string &StorageUuid() const { return accessor_->StorageUuid(); }
+
+  /// Numbers the vertices visible in the given view densely, so that they can
+  /// be used as indices into flat arrays. The numbering may be shared with
+  /// other transactions, see `storage::Storage::Accessor::GetVertexOrdinals`.
+  /// A new numbering is built on the workers of the pool if it's set.
+  /// @throw std::bad_alloc
+  storage::VertexOrdinals GetVertexOrdinals(storage::View view, utils::ThreadPool *pool = nullptr) {
+    return accessor_->GetVertexOrdinals(view, pool);
+  }
+
   int64_t VerticesCount(storage::LabelId label) const { return accessor_->ApproximateVertexCount(label); }
 
   int64_t VerticesCount(storage::LabelId label, storage::PropertyId property) const {
@@ -491,6 +533,14 @@ class SubgraphDbAccessor final {
 
   std::optional<VertexAccessor> FindVertex(storage::Gid gid, storage::View view);
 
+  /// Numbers the vertices of the subgraph densely, see
+  /// `DbAccessor::GetVertexOrdinals`. The subgraph is numbered on the calling
+  /// thread, the pool is ignored.
+  /// @throw std::bad_alloc
+  storage::VertexOrdinals GetVertexOrdinals(storage::View view, utils::ThreadPool *pool = nullptr);
+
+  const std::string &StorageUuid() const { return db_accessor_.StorageUuid(); }
+
   Graph *getGraph();
 };
 
@@ -385,36 +385,40 @@ antlrcpp::Any CypherMainVisitor::visitCreateTrigger(MemgraphCypher::CreateTrigge
   antlr4::misc::Interval interval{statement->start->getStartIndex(), statement->stop->getStopIndex()};
   trigger_query->statement_ = ctx->start->getInputStream()->getText(interval);
 
-  trigger_query->event_type_ = [ctx] {
+  // A scoped event without an explicit object type is an event on vertices, the scope name being a label
+  const bool is_vertex_event = ctx->emptyVertex() || (ctx->triggerScope() && !ctx->emptyEdge());
+  const bool is_edge_event = ctx->emptyEdge();
+
+  trigger_query->event_type_ = [ctx, is_vertex_event, is_edge_event] {
     if (!ctx->ON()) {
       return TriggerQuery::EventType::ANY;
     }
 
     if (ctx->CREATE(1)) {
-      if (ctx->emptyVertex()) {
+      if (is_vertex_event) {
         return TriggerQuery::EventType::VERTEX_CREATE;
       }
-      if (ctx->emptyEdge()) {
+      if (is_edge_event) {
         return TriggerQuery::EventType::EDGE_CREATE;
       }
       return TriggerQuery::EventType::CREATE;
     }
 
     if (ctx->DELETE()) {
-      if (ctx->emptyVertex()) {
+      if (is_vertex_event) {
         return TriggerQuery::EventType::VERTEX_DELETE;
       }
-      if (ctx->emptyEdge()) {
+      if (is_edge_event) {
         return TriggerQuery::EventType::EDGE_DELETE;
       }
       return TriggerQuery::EventType::DELETE;
     }
 
     if (ctx->UPDATE()) {
-      if (ctx->emptyVertex()) {
+      if (is_vertex_event) {
         return TriggerQuery::EventType::VERTEX_UPDATE;
       }
-      if (ctx->emptyEdge()) {
+      if (is_edge_event) {
         return TriggerQuery::EventType::EDGE_UPDATE;
       }
       return TriggerQuery::EventType::UPDATE;
@@ -423,6 +427,17 @@ antlrcpp::Any CypherMainVisitor::visitCreateTrigger(MemgraphCypher::CreateTrigge
     LOG_FATAL("Invalid token allowed for the query");
   }();
 
+  if (auto *scope = ctx->triggerScope()) {
+    trigger_query->scope_name_ = std::any_cast<std::string>(scope->labelName()->symbolicName()->accept(this));
+    for (auto *property_key_name : scope->propertyKeyName()) {
+      trigger_query->scope_properties_.push_back(
+          std::any_cast<std::string>(property_key_name->symbolicName()->accept(this)));
+    }
+    if (!trigger_query->scope_properties_.empty() && !ctx->UPDATE()) {
+      throw SemanticException("Only the UPDATE events of a trigger can be restricted to properties.");
+    }
+  }
+
   trigger_query->before_commit_ = ctx->BEFORE();
 
   return trigger_query;
@@ -548,7 +563,8 @@ std::string_view ToString(const CommonStreamConfigKey key) {
     __VA_ARGS__                                                      \
   };
 
-GENERATE_STREAM_CONFIG_KEY_ENUM(Kafka, TOPICS, CONSUMER_GROUP, BOOTSTRAP_SERVERS, CONFIGS, CREDENTIALS);
+GENERATE_STREAM_CONFIG_KEY_ENUM(Kafka, TOPICS, CONSUMER_GROUP, BOOTSTRAP_SERVERS, CONFIGS, CREDENTIALS, PARALLELISM,
+                                PIPELINE_DEPTH, TRANSFORM_CONFIG);
 
 std::string_view ToString(const KafkaConfigKey key) {
   switch (key) {
@@ -562,6 +578,12 @@ std::string_view ToString(const KafkaConfigKey key) {
       return "CONFIGS";
     case KafkaConfigKey::CREDENTIALS:
       return "CREDENTIALS";
+    case KafkaConfigKey::PARALLELISM:
+      return "PARALLELISM";
+    case KafkaConfigKey::PIPELINE_DEPTH:
+      return "PIPELINE_DEPTH";
+    case KafkaConfigKey::TRANSFORM_CONFIG:
+      return "TRANSFORM_CONFIG";
   }
 }
 
@@ -605,6 +627,10 @@ antlrcpp::Any CypherMainVisitor::visitKafkaCreateStream(MemgraphCypher::KafkaCre
                                                                    stream_query->configs_);
   MapConfig<false, std::unordered_map<Expression *, Expression *>>(memory_, KafkaConfigKey::CREDENTIALS,
                                                                    stream_query->credentials_);
+  MapConfig<false, Expression *>(memory_, KafkaConfigKey::PARALLELISM, stream_query->parallelism_);
+  MapConfig<false, Expression *>(memory_, KafkaConfigKey::PIPELINE_DEPTH, stream_query->pipeline_depth_);
+  MapConfig<false, std::unordered_map<Expression *, Expression *>>(memory_, KafkaConfigKey::TRANSFORM_CONFIG,
+                                                                   stream_query->transform_config_);
 
   MapCommonStreamConfigs(memory_, *stream_query);
 
@@ -668,6 +694,34 @@ antlrcpp::Any CypherMainVisitor::visitKafkaCreateStreamConfig(MemgraphCypher::Ka
     return {};
   }
 
+  if (ctx->PARALLELISM()) {
+    ThrowIfExists(memory_, KafkaConfigKey::PARALLELISM);
+    if (!ctx->parallelism->numberLiteral() || !ctx->parallelism->numberLiteral()->integerLiteral()) {
+      throw SemanticException("Parallelism must be an integer literal!");
+    }
+    static constexpr auto parallelism_key = static_cast<uint8_t>(KafkaConfigKey::PARALLELISM);
+    memory_[parallelism_key] = std::any_cast<Expression *>(ctx->parallelism->accept(this));
+    return {};
+  }
+
+  if (ctx->PIPELINE_DEPTH()) {
+    ThrowIfExists(memory_, KafkaConfigKey::PIPELINE_DEPTH);
+    if (!ctx->pipelineDepth->numberLiteral() || !ctx->pipelineDepth->numberLiteral()->integerLiteral()) {
+      throw SemanticException("Pipeline depth must be an integer literal!");
+    }
+    static constexpr auto pipeline_depth_key = static_cast<uint8_t>(KafkaConfigKey::PIPELINE_DEPTH);
+    memory_[pipeline_depth_key] = std::any_cast<Expression *>(ctx->pipelineDepth->accept(this));
+    return {};
+  }
+
+  if (ctx->TRANSFORM_CONFIG()) {
+    ThrowIfExists(memory_, KafkaConfigKey::TRANSFORM_CONFIG);
+    static constexpr auto transform_config_key = static_cast<uint8_t>(KafkaConfigKey::TRANSFORM_CONFIG);
+    memory_.emplace(transform_config_key, std::any_cast<std::unordered_map<Expression *, Expression *>>(
+                                              ctx->transformConfigMap->accept(this)));
+    return {};
+  }
+
   MG_ASSERT(ctx->BOOTSTRAP_SERVERS());
   ThrowIfExists(memory_, KafkaConfigKey::BOOTSTRAP_SERVERS);
   if (!ctx->bootstrapServers->StringLiteral()) {
@@ -67,7 +67,9 @@ memgraphCypherKeyword : cypherKeyword
                       | NEXT
                       | NO
                       | NOTHING
+                      | PARALLELISM
                       | PASSWORD
+                      | PIPELINE_DEPTH
                       | PULSAR
                       | PORT
                       | PRIVILEGES
@@ -94,6 +96,7 @@ memgraphCypherKeyword : cypherKeyword
                       | TOPICS
                       | TRANSACTION
                       | TRANSFORM
+                      | TRANSFORM_CONFIG
                       | TRIGGER
                       | TRIGGERS
                       | UNCOMMITTED
@@ -321,7 +324,9 @@ emptyVertex : '(' ')' ;
 
 emptyEdge : dash dash rightArrowHead ;
 
-createTrigger : CREATE TRIGGER triggerName ( ON ( emptyVertex | emptyEdge ) ? ( CREATE | UPDATE | DELETE ) ) ?
+triggerScope : ':' labelName ( '(' propertyKeyName ( ',' propertyKeyName )* ')' ) ? ;
+
+createTrigger : CREATE TRIGGER triggerName ( ON ( emptyVertex | emptyEdge ) ? ( CREATE | UPDATE | DELETE ) triggerScope ? ) ?
               ( AFTER | BEFORE ) COMMIT EXECUTE triggerStatement ;
 
 dropTrigger : DROP TRIGGER triggerName ;
@@ -362,6 +367,9 @@ kafkaCreateStreamConfig : TOPICS topicNames
                         | BOOTSTRAP_SERVERS bootstrapServers=literal
                         | CONFIGS configsMap=configMap
                         | CREDENTIALS credentialsMap=configMap
+                        | PARALLELISM parallelism=literal
+                        | PIPELINE_DEPTH pipelineDepth=literal
+                        | TRANSFORM_CONFIG transformConfigMap=configMap
                         | commonCreateStreamConfig
                         ;
 
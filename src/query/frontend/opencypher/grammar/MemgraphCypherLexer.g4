@@ -78,7 +78,9 @@ MODULE_WRITE        : M O D U L E UNDERSCORE W R I T E ;
 NEXT                : N E X T ;
 NO                  : N O ;
 NOTHING             : N O T H I N G ;
+PARALLELISM         : P A R A L L E L I S M ;
 PASSWORD            : P A S S W O R D ;
+PIPELINE_DEPTH      : P I P E L I N E UNDERSCORE D E P T H ;
 PORT                : P O R T ;
 PRIVILEGES          : P R I V I L E G E S ;
 PULSAR              : P U L S A R ;
@@ -108,6 +110,7 @@ TO                  : T O ;
 TOPICS              : T O P I C S;
 TRANSACTION         : T R A N S A C T I O N ;
 TRANSFORM           : T R A N S F O R M ;
+TRANSFORM_CONFIG    : T R A N S F O R M UNDERSCORE C O N F I G ;
 TRIGGER             : T R I G G E R ;
 TRIGGERS            : T R I G G E R S ;
 UNCOMMITTED         : U N C O M M I T T E D ;
@@ -26,6 +26,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/interpret/frame.hpp"
+#include "query/interpret/property_prefetch.hpp"
 #include "query/typed_value.hpp"
 #include "utils/exceptions.hpp"
 
@@ -107,6 +108,10 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
 
   utils::MemoryResource *GetMemoryResource() const { return ctx_->memory; }
 
+  /// Makes property lookups on identifiers use the values fetched by
+  /// `property_prefetch`, which has to outlive the evaluator.
+  void SetPropertyPrefetch(const PropertyPrefetch *property_prefetch) { property_prefetch_ = property_prefetch; }
+
   TypedValue Visit(NamedExpression &named_expression) override {
     const auto &symbol = symbol_table_->at(named_expression);
     auto value = named_expression.expression_->Accept(*this);
@@ -147,7 +152,6 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
   BINARY_OPERATOR_VISITOR(DivisionOperator, /, /);
   BINARY_OPERATOR_VISITOR(ModOperator, %, %);
   BINARY_OPERATOR_VISITOR(NotEqualOperator, !=, <>);
-  BINARY_OPERATOR_VISITOR(EqualOperator, ==, =);
   BINARY_OPERATOR_VISITOR(LessOperator, <, <);
   BINARY_OPERATOR_VISITOR(GreaterOperator, >, >);
   BINARY_OPERATOR_VISITOR(LessEqualOperator, <=, <=);
@@ -160,6 +164,25 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
 #undef BINARY_OPERATOR_VISITOR
 #undef UNARY_OPERATOR_VISITOR
 
+  TypedValue Visit(EqualOperator &op) override {
+    // A vertex property compared with a string is compared by the storage, so dictionary encoded strings are compared
+    // by their ids instead of being decoded. Looking up a property of a bound vertex has no side effects, so it can be
+    // evaluated after the other operand.
+    if (auto *lookup = utils::Downcast<PropertyLookup>(op.expression1_); lookup && LookedUpVertex(*lookup)) {
+      auto val2 = op.expression2_->Accept(*this);
+      const auto *vertex = LookedUpVertex(*lookup);
+      if (vertex && val2.IsString()) return IsPropertyEqual(*vertex, lookup->property_, val2);
+      return Equal(op.expression1_->Accept(*this), val2);
+    }
+    if (auto *lookup = utils::Downcast<PropertyLookup>(op.expression2_)) {
+      auto val1 = op.expression1_->Accept(*this);
+      const auto *vertex = LookedUpVertex(*lookup);
+      if (vertex && val1.IsString()) return IsPropertyEqual(*vertex, lookup->property_, val1);
+      return Equal(val1, op.expression2_->Accept(*this));
+    }
+    return Equal(op.expression1_->Accept(*this), op.expression2_->Accept(*this));
+  }
+
   TypedValue Visit(AndOperator &op) override {
     auto value1 = op.expression1_->Accept(*this);
     if (value1.IsBool() && !value1.ValueBool()) {
@@ -336,6 +359,13 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
       expression_result = property_lookup.expression_->Accept(*this);
       expression_result_ptr = &expression_result;
     }
+    if (property_prefetch_ && (expression_result_ptr->IsVertex() || expression_result_ptr->IsEdge())) {
+      if (auto *ident = utils::Downcast<Identifier>(property_lookup.expression_)) {
+        const auto *value =
+            property_prefetch_->Find(symbol_table_->at(*ident), *expression_result_ptr, property_lookup.property_);
+        if (value) return TypedValue(*value, ctx_->memory);
+      }
+    }
     auto maybe_date = [this](const auto &date, const auto &prop_name) -> std::optional<TypedValue> {
       if (prop_name == "year") {
         return TypedValue(date.year, ctx_->memory);
@@ -844,6 +874,49 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
     return *maybe_prop;
   }
 
+  static TypedValue Equal(const TypedValue &val1, const TypedValue &val2) {
+    try {
+      return val1 == val2;
+    } catch (const TypedValueException &) {
+      throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", val1.type(), val2.type(), "=");
+    }
+  }
+
+  /// Returns the vertex whose property is looked up if the lookup is on a
+  /// symbol bound to a vertex and the property isn't prefetched.
+  const VertexAccessor *LookedUpVertex(const PropertyLookup &property_lookup) {
+    auto *ident = utils::Downcast<Identifier>(property_lookup.expression_);
+    if (!ident) return nullptr;
+    const auto &symbol = symbol_table_->at(*ident);
+    const auto &value = frame_->at(symbol);
+    if (!value.IsVertex()) return nullptr;
+    if (property_prefetch_ && property_prefetch_->Find(symbol, value, property_lookup.property_)) return nullptr;
+    return &value.ValueVertex();
+  }
+
+  TypedValue IsPropertyEqual(const VertexAccessor &vertex, PropertyIx prop, const TypedValue &value) {
+    const storage::PropertyValue property_value(value);
+    auto maybe_equal = vertex.IsPropertyEqual(view_, ctx_->properties[prop.ix], property_value);
+    if (maybe_equal.HasError() && maybe_equal.GetError() == storage::Error::NONEXISTENT_OBJECT) {
+      // The same hack for MERGE as in GetProperty.
+      maybe_equal = vertex.IsPropertyEqual(storage::View::NEW, ctx_->properties[prop.ix], property_value);
+    }
+    if (maybe_equal.HasError()) {
+      switch (maybe_equal.GetError()) {
+        case storage::Error::DELETED_OBJECT:
+          throw QueryRuntimeException("Trying to get a property from a deleted object.");
+        case storage::Error::NONEXISTENT_OBJECT:
+          throw query::QueryRuntimeException("Trying to get a property from an object that doesn't exist.");
+        case storage::Error::SERIALIZATION_ERROR:
+        case storage::Error::VERTEX_HAS_EDGES:
+        case storage::Error::PROPERTIES_DISABLED:
+          throw QueryRuntimeException("Unexpected error when getting a property.");
+      }
+    }
+    if (!*maybe_equal) return TypedValue(ctx_->memory);
+    return TypedValue(**maybe_equal, ctx_->memory);
+  }
+
   storage::LabelId GetLabel(LabelIx label) { return ctx_->labels[label.ix]; }
 
   Frame *frame_;
@@ -852,6 +925,7 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
   DbAccessor *dba_;
   // which switching approach should be used when evaluating
   storage::View view_;
+  const PropertyPrefetch *property_prefetch_{nullptr};
 };
 
 /// A helper function for evaluating an expression that's an int.
@@ -0,0 +1,118 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/property_prefetch.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "query/context.hpp"
+#include "query/interpret/frame.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+class PropertyLookupCollector : public HierarchicalTreeVisitor {
+ public:
+  PropertyLookupCollector(const SymbolTable &symbol_table, std::vector<std::pair<Symbol, PropertyIx>> *lookups)
+      : symbol_table_(symbol_table), lookups_(lookups) {}
+
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool PreVisit(PropertyLookup &property_lookup) override {
+    if (auto *ident = utils::Downcast<Identifier>(property_lookup.expression_)) {
+      lookups_->emplace_back(symbol_table_.at(*ident), property_lookup.property_);
+    }
+    return true;
+  }
+
+  bool Visit(Identifier &) override { return true; }
+  bool Visit(PrimitiveLiteral &) override { return true; }
+  bool Visit(ParameterLookup &) override { return true; }
+
+ private:
+  const SymbolTable &symbol_table_;
+  std::vector<std::pair<Symbol, PropertyIx>> *lookups_;
+};
+
+}  // namespace
+
+PropertyPrefetch::PropertyPrefetch(const std::vector<Expression *> &expressions, const SymbolTable &symbol_table) {
+  std::vector<std::pair<Symbol, PropertyIx>> lookups;
+  PropertyLookupCollector collector(symbol_table, &lookups);
+  for (auto *expression : expressions) {
+    if (expression) expression->Accept(collector);
+  }
+  for (const auto &[symbol, property] : lookups) {
+    auto found = std::find_if(symbols_.begin(), symbols_.end(), [&symbol = symbol](const auto &symbol_properties) {
+      return symbol_properties.symbol == symbol;
+    });
+    if (found == symbols_.end()) {
+      found = symbols_.insert(symbols_.end(), SymbolProperties{.symbol = symbol});
+    }
+    if (std::find(found->properties.begin(), found->properties.end(), property) == found->properties.end()) {
+      found->properties.push_back(property);
+    }
+  }
+  std::erase_if(symbols_, [](const auto &symbol_properties) { return symbol_properties.properties.size() < 2; });
+}
+
+void PropertyPrefetch::Fetch(const Frame &frame, const EvaluationContext &ctx, storage::View view) {
+  for (auto &symbol_properties : symbols_) {
+    const auto &properties = symbol_properties.properties;
+    auto &positions = symbol_properties.positions;
+    auto &ids = symbol_properties.ids;
+    if (ids.empty()) {
+      positions.resize(properties.size());
+      std::iota(positions.begin(), positions.end(), 0);
+      std::sort(positions.begin(), positions.end(), [&](auto lhs, auto rhs) {
+        return ctx.properties[properties[lhs].ix] < ctx.properties[properties[rhs].ix];
+      });
+      for (auto position : positions) ids.push_back(ctx.properties[properties[position].ix]);
+    }
+
+    symbol_properties.record = TypedValue();
+    const auto &value = frame[symbol_properties.symbol];
+    if (!value.IsVertex() && !value.IsEdge()) continue;
+    auto fetched =
+        value.IsVertex() ? value.ValueVertex().GetProperties(view, ids) : value.ValueEdge().GetProperties(view, ids);
+    if (fetched.HasError()) continue;
+
+    symbol_properties.values.resize(properties.size());
+    for (size_t i = 0; i < positions.size(); ++i) symbol_properties.values[positions[i]] = std::move((*fetched)[i]);
+    symbol_properties.record = value;
+  }
+}
+
+const storage::PropertyValue *PropertyPrefetch::Find(const Symbol &symbol, const TypedValue &record,
+                                                     const PropertyIx &property) const {
+  for (const auto &symbol_properties : symbols_) {
+    if (symbol_properties.symbol != symbol) continue;
+    const auto &fetched_record = symbol_properties.record;
+    // The value of the symbol may have changed since the fetch, e.g. when it's
+    // bound by a list comprehension.
+    if (fetched_record.type() != record.type()) return nullptr;
+    if (record.IsVertex() && !(record.ValueVertex() == fetched_record.ValueVertex())) return nullptr;
+    if (record.IsEdge() && !(record.ValueEdge() == fetched_record.ValueEdge())) return nullptr;
+    if (!record.IsVertex() && !record.IsEdge()) return nullptr;
+    const auto &properties = symbol_properties.properties;
+    auto found = std::find(properties.begin(), properties.end(), property);
+    if (found == properties.end()) return nullptr;
+    return &symbol_properties.values[found - properties.begin()];
+  }
+  return nullptr;
+}
+
+}  // namespace memgraph::query
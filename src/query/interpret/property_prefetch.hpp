@@ -0,0 +1,70 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <vector>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/view.hpp"
+
+namespace memgraph::query {
+
+class Frame;
+struct EvaluationContext;
+
+/// Properties which a set of expressions looks up on the same vertex or edge
+/// symbol. They are fetched from the record on the frame with a single pass
+/// over its property store before the expressions are evaluated, so that
+/// `RETURN n.a, n.b, n.c` doesn't decode the properties of `n` three times.
+/// ExpressionEvaluator uses the fetched values when it's given the
+/// PropertyPrefetch.
+class PropertyPrefetch {
+ public:
+  PropertyPrefetch() = default;
+
+  /// Collects the properties looked up directly on identifiers in the
+  /// expressions. Only symbols with at least two distinct properties are
+  /// prefetched, a single lookup is just as fast on its own.
+  PropertyPrefetch(const std::vector<Expression *> &expressions, const SymbolTable &symbol_table);
+
+  bool empty() const { return symbols_.empty(); }
+
+  /// Fetches the collected properties of the vertices and edges currently on
+  /// the frame. Values of records whose properties can't be read are left
+  /// for the evaluator to look up, so it can report the error.
+  void Fetch(const Frame &frame, const EvaluationContext &ctx, storage::View view);
+
+  /// Returns the fetched value of the property of `record`, which is the
+  /// value of `symbol` on the frame, or nullptr if it wasn't fetched.
+  const storage::PropertyValue *Find(const Symbol &symbol, const TypedValue &record, const PropertyIx &property) const;
+
+ private:
+  struct SymbolProperties {
+    Symbol symbol;
+    std::vector<PropertyIx> properties;
+    // Properties sorted by their ids, in the order the store is read, along
+    // with the position of each in `properties`. Resolved on the first Fetch.
+    std::vector<storage::PropertyId> ids;
+    std::vector<size_t> positions;
+    // Record whose properties were fetched, Null if none were.
+    TypedValue record;
+    std::vector<storage::PropertyValue> values;
+  };
+
+  std::vector<SymbolProperties> symbols_;
+};
+
+}  // namespace memgraph::query
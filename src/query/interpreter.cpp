@@ -43,7 +43,9 @@
 #include "query/metadata.hpp"
 #include "query/plan/planner.hpp"
 #include "query/plan/profile.hpp"
+#include "query/plan/spill.hpp"
 #include "query/plan/vertex_count_cache.hpp"
+#include "query/procedure/graph_projection.hpp"
 #include "query/stream/common.hpp"
 #include "query/trigger.hpp"
 #include "query/typed_value.hpp"
@@ -54,6 +56,7 @@
 #include "utils/csv_parsing.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/exceptions.hpp"
+#include "utils/file.hpp"
 #include "utils/flag_validation.hpp"
 #include "utils/likely.hpp"
 #include "utils/logging.hpp"
@@ -63,6 +66,7 @@
 #include "utils/settings.hpp"
 #include "utils/string.hpp"
 #include "utils/tsc.hpp"
+#include "utils/uuid.hpp"
 #include "utils/variant_helpers.hpp"
 
 namespace EventCounter {
@@ -642,6 +646,10 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
     throw SemanticException("Bootstrap servers must not be an empty string!");
   }
   auto common_stream_info = GetCommonStreamInfo(stream_query, evaluator);
+  const auto parallelism =
+      GetOptionalValue<int64_t>(stream_query->parallelism_, evaluator).value_or(integrations::kDefaultParallelism);
+  const auto pipeline_depth = GetOptionalValue<int64_t>(stream_query->pipeline_depth_, evaluator)
+                                  .value_or(integrations::kDefaultPipelineDepth);
 
   const auto get_config_map = [&evaluator](std::unordered_map<Expression *, Expression *> map,
                                            std::string_view map_name) -> std::unordered_map<std::string, std::string> {
@@ -662,7 +670,9 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
           consumer_group = std::move(consumer_group), common_stream_info = std::move(common_stream_info),
           bootstrap_servers = std::move(bootstrap), owner = StringPointerToOptional(username),
           configs = get_config_map(stream_query->configs_, "Configs"),
-          credentials = get_config_map(stream_query->credentials_, "Credentials")]() mutable {
+          credentials = get_config_map(stream_query->credentials_, "Credentials"),
+          transform_config = get_config_map(stream_query->transform_config_, "Transform config"), parallelism,
+          pipeline_depth]() mutable {
     std::string bootstrap = bootstrap_servers
                                 ? std::move(*bootstrap_servers)
                                 : std::string{interpreter_context->config.default_kafka_bootstrap_servers};
@@ -672,7 +682,10 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
                                                                      .consumer_group = std::move(consumer_group),
                                                                      .bootstrap_servers = std::move(bootstrap),
                                                                      .configs = std::move(configs),
-                                                                     .credentials = std::move(credentials)},
+                                                                     .credentials = std::move(credentials),
+                                                                     .parallelism = parallelism,
+                                                                     .pipeline_depth = pipeline_depth,
+                                                                     .transform_config = std::move(transform_config)},
                                                                     std::move(owner));
 
     return std::vector<std::vector<TypedValue>>{};
@@ -788,7 +801,8 @@ Callback HandleStreamQuery(StreamQuery *stream_query, const Parameters &paramete
       return callback;
     }
     case StreamQuery::Action::SHOW_STREAMS: {
-      callback.header = {"name", "type", "batch_interval", "batch_size", "transformation_name", "owner", "is running"};
+      callback.header = {"name",  "type",       "batch_interval",         "batch_size",       "transformation_name",
+                         "owner", "is running", "transformation_latency", "execution_latency"};
       callback.fn = [interpreter_context]() {
         auto streams_status = interpreter_context->streams.GetStreamInfo();
         std::vector<std::vector<TypedValue>> results;
@@ -799,9 +813,17 @@ Callback HandleStreamQuery(StreamQuery *stream_query, const Parameters &paramete
           typed_status.emplace_back(stream_info.transformation_name);
         };
 
+        // Latencies of the last processed batch in milliseconds, null if no batch was processed yet.
+        auto latency_as_typed_value = [](const std::optional<std::chrono::microseconds> &latency) {
+          if (!latency) {
+            return TypedValue{};
+          }
+          return TypedValue{std::chrono::duration<double, std::milli>(*latency).count()};
+        };
+
         for (const auto &status : streams_status) {
           std::vector<TypedValue> typed_status;
-          typed_status.reserve(7);
+          typed_status.reserve(9);
           typed_status.emplace_back(status.name);
           typed_status.emplace_back(StreamSourceTypeToString(status.type));
           stream_info_as_typed_stream_info_emplace_in(typed_status, status.info);
@@ -811,6 +833,8 @@ Callback HandleStreamQuery(StreamQuery *stream_query, const Parameters &paramete
             typed_status.emplace_back();
           }
           typed_status.emplace_back(status.is_running);
+          typed_status.push_back(latency_as_typed_value(status.latencies.transformation));
+          typed_status.push_back(latency_as_typed_value(status.latencies.execution));
           results.push_back(std::move(typed_status));
         }
 
@@ -981,12 +1005,21 @@ struct PullPlan {
                                                         const std::vector<Symbol> &output_symbols,
                                                         std::map<std::string, TypedValue> *summary);
 
+  // Resets the cursors and binds the given parameters, so the plan can be
+  // pulled again without building a new cursor tree. The execution stats and
+  // time start from zero.
+  void Reset(const Parameters &parameters);
+
  private:
   std::shared_ptr<CachedPlan> plan_ = nullptr;
+  // Declared before the cursor, which owns the spill files in it.
+  plan::SpillDirectory spill_directory_;
+  // Declared before the cursor, whose state may be counted against it across
+  // pulls.
+  std::optional<utils::MemoryLimit> memory_limit_;
   plan::UniqueCursorPtr cursor_ = nullptr;
   Frame frame_;
   ExecutionContext ctx_;
-  std::optional<size_t> memory_limit_;
 
   // As it's possible to query execution using multiple pulls
   // we need the keep track of the total execution time across
@@ -1007,15 +1040,17 @@ PullPlan::PullPlan(const std::shared_ptr<CachedPlan> plan, const Parameters &par
                    std::optional<std::string> username, TriggerContextCollector *trigger_context_collector,
                    const std::optional<size_t> memory_limit)
     : plan_(plan),
+      spill_directory_(interpreter_context->spill_directory / utils::GenerateUUID()),
+      memory_limit_(memory_limit),
       cursor_(plan->plan().MakeCursor(execution_memory)),
-      frame_(plan->symbol_table().max_position(), execution_memory),
-      memory_limit_(memory_limit) {
+      frame_(plan->symbol_table().max_position(), execution_memory) {
   ctx_.db_accessor = dba;
   ctx_.symbol_table = plan->symbol_table();
   ctx_.evaluation_context.timestamp = QueryTimestamp();
   ctx_.evaluation_context.parameters = parameters;
   ctx_.evaluation_context.properties = NamesToProperties(plan->ast_storage().properties_, dba);
   ctx_.evaluation_context.labels = NamesToLabels(plan->ast_storage().labels_, dba);
+  ctx_.username = username;
 #ifdef MG_ENTERPRISE
   if (license::global_license_checker.IsEnterpriseValidFast() && username.has_value() && dba) {
     ctx_.auth_checker = interpreter_context->auth_checker->GetFineGrainedAuthChecker(*username, dba);
@@ -1027,6 +1062,19 @@ PullPlan::PullPlan(const std::shared_ptr<CachedPlan> plan, const Parameters &par
   ctx_.is_shutting_down = &interpreter_context->is_shutting_down;
   ctx_.is_profile_query = is_profile_query;
   ctx_.trigger_context_collector = trigger_context_collector;
+  ctx_.spill_directory = spill_directory_.path();
+  if (memory_limit_) ctx_.memory_limit = &*memory_limit_;
+  ctx_.bfs_worker_pool = interpreter_context->bfs_worker_pool.get();
+  ctx_.aggregation_worker_pool = interpreter_context->aggregation_worker_pool.get();
+  ctx_.procedure_worker_pool = interpreter_context->procedure_worker_pool.get();
+}
+
+void PullPlan::Reset(const Parameters &parameters) {
+  cursor_->Reset();
+  ctx_.evaluation_context.parameters = parameters;
+  ctx_.execution_stats = {};
+  execution_time_ = std::chrono::duration<double>{0};
+  has_unsent_results_ = false;
 }
 
 std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
@@ -1048,7 +1096,9 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   std::optional<utils::LimitedMemoryResource> maybe_limited_resource;
 
   if (memory_limit_) {
-    maybe_limited_resource.emplace(&pool_memory, *memory_limit_);
+    // The memory of the pull is released as a whole once the pull is done,
+    // while the limit is shared with the workers of the query for all pulls.
+    maybe_limited_resource.emplace(&pool_memory, &*memory_limit_);
     ctx_.evaluation_context.memory = &*maybe_limited_resource;
   } else {
     ctx_.evaluation_context.memory = &pool_memory;
@@ -1118,12 +1168,127 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   return GetStatsWithTotalTime(ctx_);
 }
 
+// Struct for pulling the same plan once for each of the given parameter sets,
+// as if the plan was unwound over the parameter sets. A single cursor tree is
+// built and reset between the parameter sets. The command is advanced between
+// the parameter sets, so each pull sees the changes of the previous ones, just
+// like separately prepared queries of an explicit transaction.
+struct PullPlanBatch {
+  explicit PullPlanBatch(std::shared_ptr<CachedPlan> plan, std::vector<Parameters> parameters_batch, DbAccessor *dba,
+                         InterpreterContext *interpreter_context, utils::MemoryResource *execution_memory,
+                         std::optional<std::string> username, TriggerContextCollector *trigger_context_collector,
+                         std::optional<size_t> memory_limit)
+      : plan_(std::move(plan)),
+        parameters_batch_(std::move(parameters_batch)),
+        dba_(dba),
+        interpreter_context_(interpreter_context),
+        execution_memory_(execution_memory),
+        username_(std::move(username)),
+        trigger_context_collector_(trigger_context_collector),
+        memory_limit_(memory_limit) {}
+
+  // A partial pull streams the results of at most one parameter set.
+  // @return true if the plan was pulled for all of the parameter sets,
+  // false otherwise.
+  bool Pull(AnyStream *stream, std::optional<int> n, const std::vector<Symbol> &output_symbols,
+            std::map<std::string, TypedValue> *summary);
+
+ private:
+  void AccumulateSummary(std::map<std::string, TypedValue> *summary);
+
+  std::shared_ptr<CachedPlan> plan_;
+  std::vector<Parameters> parameters_batch_;
+  DbAccessor *dba_;
+  InterpreterContext *interpreter_context_;
+  utils::MemoryResource *execution_memory_;
+  std::optional<std::string> username_;
+  TriggerContextCollector *trigger_context_collector_;
+  std::optional<size_t> memory_limit_;
+
+  size_t next_parameters_{0};
+  std::optional<PullPlan> pull_plan_;
+  // Whether the current parameter set was partially pulled.
+  bool pulling_{false};
+  double execution_time_{0};
+  std::map<std::string, TypedValue> stats_;
+};
+
+bool PullPlanBatch::Pull(AnyStream *stream, std::optional<int> n, const std::vector<Symbol> &output_symbols,
+                         std::map<std::string, TypedValue> *summary) {
+  while (next_parameters_ < parameters_batch_.size()) {
+    if (!pull_plan_) {
+      pull_plan_.emplace(plan_, parameters_batch_[next_parameters_], false, dba_, interpreter_context_,
+                         execution_memory_, username_, trigger_context_collector_, memory_limit_);
+    } else if (!pulling_) {
+      dba_->AdvanceCommand();
+      pull_plan_->Reset(parameters_batch_[next_parameters_]);
+    }
+    pulling_ = true;
+    if (!pull_plan_->Pull(stream, n, output_symbols, summary)) {
+      return false;
+    }
+    pulling_ = false;
+    AccumulateSummary(summary);
+    ++next_parameters_;
+    if (n) {
+      break;
+    }
+  }
+
+  if (next_parameters_ < parameters_batch_.size()) {
+    return false;
+  }
+  summary->insert_or_assign("plan_execution_time", execution_time_);
+  if (!stats_.empty()) {
+    summary->insert_or_assign("stats", std::move(stats_));
+  }
+  return true;
+}
+
+void PullPlanBatch::AccumulateSummary(std::map<std::string, TypedValue> *summary) {
+  execution_time_ += summary->at("plan_execution_time").ValueDouble();
+  auto stats = summary->find("stats");
+  if (stats == summary->end()) {
+    return;
+  }
+  for (const auto &[key, value] : stats->second.ValueMap()) {
+    auto [stat, inserted] = stats_.try_emplace(std::string{key}, value);
+    if (!inserted) {
+      stat->second = TypedValue(stat->second.ValueInt() + value.ValueInt());
+    }
+  }
+  // Erase the stats so they aren't accumulated again if the next parameter set
+  // doesn't change anything.
+  summary->erase(stats);
+}
+
 using RWType = plan::ReadWriteTypeChecker::RWType;
+
+std::unique_ptr<utils::ThreadPool> MakeWorkerPool(const size_t workers) {
+  if (workers <= 1) return nullptr;
+  return std::make_unique<utils::ThreadPool>(workers);
+}
 }  // namespace
 
 InterpreterContext::InterpreterContext(storage::Storage *db, const InterpreterConfig config,
                                        const std::filesystem::path &data_directory)
-    : db(db), trigger_store(data_directory / "triggers"), config(config), streams{this, data_directory / "streams"} {}
+    : db(db),
+      trigger_store(data_directory / "triggers"),
+      after_commit_trigger_pool(this, config.after_commit_trigger_threads,
+                                config.after_commit_trigger_max_coalesced_transactions,
+                                config.after_commit_trigger_queue_size),
+      config(config),
+      bfs_worker_pool(MakeWorkerPool(config.bfs_parallel_workers)),
+      aggregation_worker_pool(MakeWorkerPool(config.aggregation_parallel_workers)),
+      procedure_worker_pool(MakeWorkerPool(config.procedure_parallel_workers)),
+      streams{this, data_directory / "streams"},
+      spill_directory(data_directory / "spill") {}
+
+InterpreterContext::~InterpreterContext() {
+  // Graph projections are cached globally by storage UUID, so they would
+  // outlive the storage.
+  procedure::gGraphProjections.DropStorage(db->Access().StorageUuid());
+}
 
 Interpreter::Interpreter(InterpreterContext *interpreter_context) : interpreter_context_(interpreter_context) {
   MG_ASSERT(interpreter_context_, "Interpreter context must not be NULL");
@@ -1145,7 +1310,8 @@ PreparedQuery Interpreter::PrepareTransactionQuery(std::string_view query_upper)
       execution_db_accessor_.emplace(db_accessor_.get());
 
       if (interpreter_context_->trigger_store.HasTriggers()) {
-        trigger_context_collector_.emplace(interpreter_context_->trigger_store.GetEventTypes());
+        trigger_context_collector_.emplace(interpreter_context_->trigger_store.GetScopedEvents(),
+                                           interpreter_context_->config.trigger_context_max_objects);
       }
     };
   } else if (query_upper == "COMMIT") {
@@ -1195,7 +1361,8 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
                                  InterpreterContext *interpreter_context, DbAccessor *dba,
                                  utils::MemoryResource *execution_memory, std::vector<Notification> *notifications,
                                  const std::string *username,
-                                 TriggerContextCollector *trigger_context_collector = nullptr) {
+                                 TriggerContextCollector *trigger_context_collector = nullptr,
+                                 std::vector<Parameters> parameters_batch = {}) {
   auto *cypher_query = utils::Downcast<CypherQuery>(parsed_query.query);
 
   Frame frame(0);
@@ -1239,6 +1406,21 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
     header.push_back(
         utils::FindOr(parsed_query.stripped_query.named_expressions(), symbol.token_position(), symbol.name()).first);
   }
+  if (!parameters_batch.empty()) {
+    auto pull_plan = std::make_shared<PullPlanBatch>(plan, std::move(parameters_batch), dba, interpreter_context,
+                                                     execution_memory, StringPointerToOptional(username),
+                                                     trigger_context_collector, memory_limit);
+    return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
+                         [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary](
+                             AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
+                           if (pull_plan->Pull(stream, n, output_symbols, summary)) {
+                             return QueryHandlerResult::COMMIT;
+                           }
+                           return std::nullopt;
+                         },
+                         rw_type_checker.type};
+  }
+
   auto pull_plan =
       std::make_shared<PullPlan>(plan, parsed_query.parameters, false, dba, interpreter_context, execution_memory,
                                  StringPointerToOptional(username), trigger_context_collector, memory_limit);
@@ -1691,15 +1873,22 @@ TriggerEventType ToTriggerEventType(const TriggerQuery::EventType event_type) {
 Callback CreateTrigger(TriggerQuery *trigger_query,
                        const std::map<std::string, storage::PropertyValue> &user_parameters,
                        InterpreterContext *interpreter_context, DbAccessor *dba, std::optional<std::string> owner) {
+  std::optional<TriggerScopeInfo> scope_info;
+  if (!trigger_query->scope_name_.empty()) {
+    scope_info.emplace(
+        TriggerScopeInfo{std::move(trigger_query->scope_name_), std::move(trigger_query->scope_properties_)});
+  }
   return {
       {},
       [trigger_name = std::move(trigger_query->trigger_name_), trigger_statement = std::move(trigger_query->statement_),
        event_type = trigger_query->event_type_, before_commit = trigger_query->before_commit_, interpreter_context, dba,
-       user_parameters, owner = std::move(owner)]() mutable -> std::vector<std::vector<TypedValue>> {
+       user_parameters, owner = std::move(owner),
+       scope_info = std::move(scope_info)]() mutable -> std::vector<std::vector<TypedValue>> {
         interpreter_context->trigger_store.AddTrigger(
             std::move(trigger_name), trigger_statement, user_parameters, ToTriggerEventType(event_type),
             before_commit ? TriggerPhase::BEFORE_COMMIT : TriggerPhase::AFTER_COMMIT, &interpreter_context->ast_cache,
-            dba, interpreter_context->config.query, std::move(owner), interpreter_context->auth_checker);
+            dba, interpreter_context->config.query, std::move(owner), interpreter_context->auth_checker,
+            std::move(scope_info));
         return {};
       }};
 }
@@ -1723,7 +1912,12 @@ Callback ShowTriggers(InterpreterContext *interpreter_context) {
               typed_trigger_info.reserve(4);
               typed_trigger_info.emplace_back(std::move(trigger_info.name));
               typed_trigger_info.emplace_back(std::move(trigger_info.statement));
-              typed_trigger_info.emplace_back(TriggerEventTypeToString(trigger_info.event_type));
+              if (trigger_info.scope_info) {
+                typed_trigger_info.emplace_back(fmt::format("{} {}", TriggerEventTypeToString(trigger_info.event_type),
+                                                            TriggerScopeInfoToString(*trigger_info.scope_info)));
+              } else {
+                typed_trigger_info.emplace_back(TriggerEventTypeToString(trigger_info.event_type));
+              }
               typed_trigger_info.emplace_back(trigger_info.phase == TriggerPhase::BEFORE_COMMIT ? "BEFORE COMMIT"
                                                                                                 : "AFTER COMMIT");
               typed_trigger_info.emplace_back(trigger_info.owner.has_value() ? TypedValue{*trigger_info.owner}
@@ -1943,6 +2137,7 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
       header = {"storage info", "value"};
       handler = [db] {
         auto info = db->GetInfo();
+        auto gc_info = db->GetGcInfo();
         std::vector<std::vector<TypedValue>> results{
             {TypedValue("vertex_count"), TypedValue(static_cast<int64_t>(info.vertex_count))},
             {TypedValue("edge_count"), TypedValue(static_cast<int64_t>(info.edge_count))},
@@ -1951,7 +2146,16 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
             {TypedValue("disk_usage"), TypedValue(static_cast<int64_t>(info.disk_usage))},
             {TypedValue("memory_allocated"), TypedValue(static_cast<int64_t>(utils::total_memory_tracker.Amount()))},
             {TypedValue("allocation_limit"),
-             TypedValue(static_cast<int64_t>(utils::total_memory_tracker.HardLimit()))}};
+             TypedValue(static_cast<int64_t>(utils::total_memory_tracker.HardLimit()))},
+            {TypedValue("gc_runs"), TypedValue(static_cast<int64_t>(gc_info.runs))},
+            {TypedValue("gc_steps"), TypedValue(static_cast<int64_t>(gc_info.steps))},
+            {TypedValue("gc_unlinked_deltas"), TypedValue(static_cast<int64_t>(gc_info.unlinked_deltas))},
+            {TypedValue("gc_last_steps"), TypedValue(static_cast<int64_t>(gc_info.last_steps))},
+            {TypedValue("gc_last_unlink_us"), TypedValue(static_cast<int64_t>(gc_info.last_unlink.count()))},
+            {TypedValue("gc_last_index_cleanup_us"),
+             TypedValue(static_cast<int64_t>(gc_info.last_index_cleanup.count()))},
+            {TypedValue("gc_last_free_us"), TypedValue(static_cast<int64_t>(gc_info.last_free.count()))},
+            {TypedValue("gc_max_step_us"), TypedValue(static_cast<int64_t>(gc_info.max_step.count()))}};
         return std::pair{results, QueryHandlerResult::COMMIT};
       };
       break;
@@ -2333,7 +2537,8 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
       execution_db_accessor_.emplace(db_accessor_.get());
 
       if (utils::Downcast<CypherQuery>(parsed_query.query) && interpreter_context_->trigger_store.HasTriggers()) {
-        trigger_context_collector_.emplace(interpreter_context_->trigger_store.GetEventTypes());
+        trigger_context_collector_.emplace(interpreter_context_->trigger_store.GetScopedEvents(),
+                                           interpreter_context_->config.trigger_context_max_objects);
       }
     }
 
@@ -2425,6 +2630,67 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
   }
 }
 
+Interpreter::PrepareResult Interpreter::PrepareBatch(
+    const std::string &query_string, const std::vector<std::map<std::string, storage::PropertyValue>> &params_batch,
+    const std::string *username) {
+  if (!in_explicit_transaction_) {
+    throw ExplicitTransactionUsageException("A batch of queries can be prepared only in an explicit transaction.");
+  }
+  if (params_batch.empty()) {
+    throw QueryException("A batch of queries needs at least one set of parameters.");
+  }
+
+  query_executions_.emplace_back(std::make_unique<QueryExecution>());
+  auto &query_execution = query_executions_.back();
+  const auto qid = static_cast<int>(query_executions_.size() - 1);
+
+  AdvanceCommand();
+
+  try {
+    query_execution->summary["cost_estimate"] = 0.0;
+
+    utils::Timer parsing_timer;
+    ParsedQuery parsed_query = ParseQuery(query_string, params_batch.front(), &interpreter_context_->ast_cache,
+                                          interpreter_context_->config.query);
+    if (!utils::Downcast<CypherQuery>(parsed_query.query)) {
+      throw QueryException("Only Cypher queries can be executed in a batch.");
+    }
+    // The query is stripped and parsed only once, only the parameters differ between the executions.
+    std::vector<Parameters> parameters_batch;
+    parameters_batch.reserve(params_batch.size());
+    parameters_batch.push_back(parsed_query.parameters);
+    for (auto params = std::next(params_batch.begin()); params != params_batch.end(); ++params) {
+      parameters_batch.push_back(MakeParameters(parsed_query.stripped_query, *params));
+    }
+    query_execution->summary["parsing_time"] = parsing_timer.Elapsed().count();
+
+    utils::Timer planning_timer;
+    PreparedQuery prepared_query = PrepareCypherQuery(
+        std::move(parsed_query), &query_execution->summary, interpreter_context_, &*execution_db_accessor_,
+        &query_execution->execution_memory, &query_execution->notifications, username,
+        trigger_context_collector_ ? &*trigger_context_collector_ : nullptr, std::move(parameters_batch));
+    query_execution->summary["planning_time"] = planning_timer.Elapsed().count();
+    query_execution->prepared_query.emplace(std::move(prepared_query));
+
+    const auto rw_type = query_execution->prepared_query->rw_type;
+    query_execution->summary["type"] = plan::ReadWriteTypeChecker::TypeToString(rw_type);
+
+    UpdateTypeCount(rw_type);
+
+    if (interpreter_context_->db->GetReplicationRole() == storage::ReplicationRole::REPLICA &&
+        (rw_type == RWType::W || rw_type == RWType::RW)) {
+      query_execution = nullptr;
+      throw QueryException("Write query forbidden on the replica!");
+    }
+
+    return {query_execution->prepared_query->header, query_execution->prepared_query->privileges, qid};
+  } catch (const utils::BasicException &) {
+    EventCounter::IncrementCounter(EventCounter::FailedQuery);
+    AbortCommand(&query_execution);
+    throw;
+  }
+}
+
 void Interpreter::Abort() {
   expect_rollback_ = false;
   in_explicit_transaction_ = false;
@@ -2436,10 +2702,14 @@ void Interpreter::Abort() {
 }
 
 namespace {
+template <typename TFilter>
 void RunTriggersIndividually(const utils::SkipList<Trigger> &triggers, InterpreterContext *interpreter_context,
-                             TriggerContext trigger_context) {
+                             TriggerContext trigger_context, const TFilter &should_run) {
   // Run the triggers
   for (const auto &trigger : triggers.access()) {
+    if (!should_run(trigger)) {
+      continue;
+    }
     utils::MonotonicBufferResource execution_memory{kExecutionMemoryBlockSize};
 
     // create a new transaction for each trigger
@@ -2496,6 +2766,103 @@ void RunTriggersIndividually(const utils::SkipList<Trigger> &triggers, Interpret
 }
 }  // namespace
 
+AfterCommitTriggerPool::AfterCommitTriggerPool(InterpreterContext *interpreter_context, const size_t pool_size,
+                                               const size_t max_coalesced_transactions,
+                                               const size_t max_queued_groups)
+    : interpreter_context_(interpreter_context),
+      max_coalesced_transactions_(std::max<size_t>(max_coalesced_transactions, 1)),
+      max_queued_groups_(std::max<size_t>(max_queued_groups, 1)) {
+  workers_.reserve(std::max<size_t>(pool_size, 1));
+  for (size_t i = 0; i < workers_.capacity(); ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+}
+
+size_t AfterCommitTriggerPool::WorkerIndex(const Trigger &trigger) const {
+  return std::hash<std::string>{}(trigger.Name()) % workers_.size();
+}
+
+void AfterCommitTriggerPool::AddTask(TriggerContext trigger_context,
+                                     std::unique_ptr<storage::Storage::Accessor> transaction) {
+  std::vector<bool> has_triggers(workers_.size(), false);
+  for (const auto &trigger : interpreter_context_->trigger_store.AfterCommitTriggers().access()) {
+    has_triggers[WorkerIndex(trigger)] = true;
+  }
+
+  std::vector<size_t> workers_to_schedule;
+  {
+    std::unique_lock guard{lock_};
+    // The open group is the last one in the queues of all of its workers, so
+    // merging into it keeps the order of the transactions.
+    if (open_group_ && !open_group_->is_sealed && open_group_->workers == has_triggers &&
+        open_group_->transactions.size() < max_coalesced_transactions_) {
+      open_group_->trigger_context.Merge(std::move(trigger_context));
+      open_group_->transactions.push_back(std::move(transaction));
+      return;
+    }
+
+    const auto is_queue_full = [&] {
+      for (size_t i = 0; i < workers_.size(); ++i) {
+        if (has_triggers[i] && workers_[i]->groups.size() >= max_queued_groups_) {
+          return true;
+        }
+      }
+      return false;
+    };
+    // The threads stop draining their queues once the database is shutting
+    // down, in which case the transaction is dropped instead of waiting.
+    while (is_queue_full()) {
+      if (interpreter_context_->is_shutting_down.load(std::memory_order_acquire)) {
+        return;
+      }
+      queue_not_full_.wait_for(guard, std::chrono::milliseconds(100));
+    }
+
+    open_group_ = std::make_shared<TransactionGroup>();
+    open_group_->trigger_context = std::move(trigger_context);
+    open_group_->transactions.push_back(std::move(transaction));
+    open_group_->workers = std::move(has_triggers);
+    for (size_t i = 0; i < workers_.size(); ++i) {
+      if (!open_group_->workers[i]) {
+        continue;
+      }
+      auto &worker = *workers_[i];
+      worker.groups.push_back(open_group_);
+      if (!std::exchange(worker.is_scheduled, true)) {
+        workers_to_schedule.push_back(i);
+      }
+    }
+  }
+  for (const auto i : workers_to_schedule) {
+    workers_[i]->thread.AddTask([this, i] { Drain(i); });
+  }
+}
+
+void AfterCommitTriggerPool::Drain(const size_t worker_index) {
+  auto &worker = *workers_[worker_index];
+  while (!interpreter_context_->is_shutting_down.load(std::memory_order_acquire)) {
+    std::shared_ptr<const TransactionGroup> group;
+    {
+      std::lock_guard guard{lock_};
+      if (worker.groups.empty()) {
+        worker.is_scheduled = false;
+        return;
+      }
+      worker.groups.front()->is_sealed = true;
+      group = std::move(worker.groups.front());
+      worker.groups.pop_front();
+    }
+    queue_not_full_.notify_all();
+
+    // The merged trigger context is shared by the workers, each of them adapts
+    // its own copy to the transactions of its triggers.
+    RunTriggersIndividually(interpreter_context_->trigger_store.AfterCommitTriggers(), interpreter_context_,
+                            group->trigger_context,
+                            [&](const Trigger &trigger) { return WorkerIndex(trigger) == worker_index; });
+    SPDLOG_DEBUG("Finished executing after commit triggers of {} transaction(s)", group->transactions.size());
+  }
+}
+
 void Interpreter::Commit() {
   // It's possible that some queries did not finish because the user did
   // not pull all of the results from the query.
@@ -2578,14 +2945,7 @@ void Interpreter::Commit() {
   // waiting for commiting or one of them just started commiting its changes.
   // This means the ordered execution of after commit triggers are not guaranteed.
   if (trigger_context && interpreter_context_->trigger_store.AfterCommitTriggers().size() > 0) {
-    interpreter_context_->after_commit_trigger_pool.AddTask(
-        [trigger_context = std::move(*trigger_context), interpreter_context = this->interpreter_context_,
-         user_transaction = std::shared_ptr(std::move(db_accessor_))]() mutable {
-          RunTriggersIndividually(interpreter_context->trigger_store.AfterCommitTriggers(), interpreter_context,
-                                  std::move(trigger_context));
-          user_transaction->FinalizeTransaction();
-          SPDLOG_DEBUG("Finished executing after commit triggers");  // NOLINT(bugprone-lambda-function-name)
-        });
+    interpreter_context_->after_commit_trigger_pool.AddTask(std::move(*trigger_context), std::move(db_accessor_));
   }
 
   SPDLOG_DEBUG("Finished committing the transaction");
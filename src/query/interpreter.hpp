@@ -13,6 +13,10 @@
 
 #include <gflags/gflags.h>
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
 #include "query/auth_checker.hpp"
 #include "query/config.hpp"
 #include "query/context.hpp"
@@ -179,6 +183,73 @@ struct PreparedQuery {
   plan::ReadWriteTypeChecker::RWType rw_type;
 };
 
+struct InterpreterContext;
+
+/**
+ * Executes the AFTER COMMIT triggers of committed transactions in the
+ * background.
+ *
+ * Every trigger is always executed by the same thread of the pool, so the
+ * executions of a trigger keep the order in which the transactions were
+ * scheduled, while different triggers are executed in parallel. The trigger
+ * contexts of up to `max_coalesced_transactions` transactions committed before
+ * any of the threads started on them are merged once, and the merged context is
+ * handled by a single execution of each trigger. At most `max_queued_groups`
+ * such groups wait for a thread, committing transactions wait for the threads
+ * to catch up once the limit is reached.
+ */
+class AfterCommitTriggerPool final {
+ public:
+  AfterCommitTriggerPool(InterpreterContext *interpreter_context, size_t pool_size,
+                         size_t max_coalesced_transactions, size_t max_queued_groups);
+
+  AfterCommitTriggerPool(const AfterCommitTriggerPool &) = delete;
+  AfterCommitTriggerPool(AfterCommitTriggerPool &&) = delete;
+  AfterCommitTriggerPool &operator=(const AfterCommitTriggerPool &) = delete;
+  AfterCommitTriggerPool &operator=(AfterCommitTriggerPool &&) = delete;
+  ~AfterCommitTriggerPool() = default;
+
+  /// The transaction is finalized once all of the after commit triggers are
+  /// executed for it. Blocks while the queue of any of the threads executing
+  /// the triggers is full.
+  void AddTask(TriggerContext trigger_context, std::unique_ptr<storage::Storage::Accessor> transaction);
+
+ private:
+  // Committed transactions whose trigger contexts are merged into one.
+  struct TransactionGroup {
+    TriggerContext trigger_context;
+    // Kept alive until every thread is done with the group, because the
+    // deleted objects of the trigger context still reference them.
+    std::vector<std::unique_ptr<storage::Storage::Accessor>> transactions;
+    // The threads which execute the triggers for the group.
+    std::vector<bool> workers;
+    // Set once a thread starts on the group, after which it isn't changed.
+    bool is_sealed{false};
+  };
+
+  struct Worker {
+    std::deque<std::shared_ptr<TransactionGroup>> groups;
+    bool is_scheduled{false};
+    // Declared last so the thread is joined before the queue is destroyed.
+    utils::ThreadPool thread{1};
+  };
+
+  size_t WorkerIndex(const Trigger &trigger) const;
+  void Drain(size_t worker_index);
+
+  InterpreterContext *interpreter_context_;
+  size_t max_coalesced_transactions_;
+  size_t max_queued_groups_;
+
+  // Protects the queues of the workers and the groups which aren't sealed.
+  std::mutex lock_;
+  std::condition_variable queue_not_full_;
+  // The last added group, to which the next transaction is added if no thread
+  // started on it yet.
+  std::shared_ptr<TransactionGroup> open_group_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+};
+
 /**
  * Holds data shared between multiple `Interpreter` instances (which might be
  * running concurrently).
@@ -189,6 +260,11 @@ struct PreparedQuery {
 struct InterpreterContext {
   explicit InterpreterContext(storage::Storage *db, InterpreterConfig config,
                               const std::filesystem::path &data_directory);
+  InterpreterContext(const InterpreterContext &) = delete;
+  InterpreterContext &operator=(const InterpreterContext &) = delete;
+  InterpreterContext(InterpreterContext &&) = delete;
+  InterpreterContext &operator=(InterpreterContext &&) = delete;
+  ~InterpreterContext();
 
   storage::Storage *db;
 
@@ -209,11 +285,23 @@ struct InterpreterContext {
   utils::SkipList<PlanCacheEntry> plan_cache;
 
   TriggerStore trigger_store;
-  utils::ThreadPool after_commit_trigger_pool{1};
+  AfterCommitTriggerPool after_commit_trigger_pool;
 
   const InterpreterConfig config;
 
+  // Worker threads of the parallel query operations, not created if the
+  // config has at most one worker.
+  std::unique_ptr<utils::ThreadPool> bfs_worker_pool;
+  std::unique_ptr<utils::ThreadPool> aggregation_worker_pool;
+  std::unique_ptr<utils::ThreadPool> procedure_worker_pool;
+
   query::stream::Streams streams;
+
+  // Temporary files of queries whose results don't fit in their memory limit,
+  // in a subdirectory for each query which is removed once the query is done.
+  // Contexts sharing the data directory share it, so anything left over by a
+  // crashed instance has to be removed by the owner of the data directory.
+  const std::filesystem::path spill_directory;
 };
 
 /// Function that is used to tell all active interpreters that they should stop
@@ -246,6 +334,22 @@ class Interpreter final {
   PrepareResult Prepare(const std::string &query, const std::map<std::string, storage::PropertyValue> &params,
                         const std::string *username);
 
+  /**
+   * Prepare a Cypher query once for executing it with each of the given sets
+   * of parameters, as if the query was prepared and executed separately for
+   * every set in order.
+   *
+   * The query is parsed and planned only once and the same plan is executed
+   * for all of the parameter sets, so the results of all the executions are
+   * streamed by the following calls to `Pull`. A batch can be prepared only
+   * in an explicit transaction.
+   *
+   * @throw query::QueryException
+   */
+  PrepareResult PrepareBatch(const std::string &query,
+                             const std::vector<std::map<std::string, storage::PropertyValue>> &params_batch,
+                             const std::string *username);
+
   /**
    * Execute the last prepared query and stream *all* of the results into the
    * given stream.
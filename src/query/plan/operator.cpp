@@ -12,10 +12,17 @@
 #include "query/plan/operator.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cstdint>
+#include <iterator>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <queue>
 #include <random>
+#include <span>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -39,6 +46,7 @@
 #include "query/interpret/eval.hpp"
 #include "query/path.hpp"
 #include "query/plan/scoped_profile.hpp"
+#include "query/plan/spill.hpp"
 #include "query/procedure/cypher_types.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
@@ -49,6 +57,7 @@
 #include "utils/csv_parsing.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/exceptions.hpp"
+#include "utils/flag_validation.hpp"
 #include "utils/fnv.hpp"
 #include "utils/likely.hpp"
 #include "utils/logging.hpp"
@@ -60,6 +69,13 @@
 #include "utils/readable_size.hpp"
 #include "utils/string.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread_pool.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_procedure_batch_size, 1000U,
+                        "Number of records batched query procedures are asked to produce at once. Larger batches "
+                        "need more memory, while smaller ones call the procedure more often.",
+                        FLAG_IN_RANGE(1, 1000000));
 
 // macro for the default implementation of LogicalOperator::Accept
 // that accepts the visitor and visits it's input_ operator
@@ -1386,6 +1402,273 @@ class STShortestPathCursor : public query::plan::Cursor {
   }
 };
 
+namespace {
+
+// Levels with more vertices than this are split into chunks of this size,
+// which are expanded on the BFS worker pool.
+constexpr size_t kBfsChunkSize = 1024;
+// Switching thresholds of the direction-optimizing BFS (Beamer et al.). The
+// frontier size stands in for the number of edges incident to the frontier.
+constexpr size_t kBfsBottomUpFactor = 14;
+constexpr size_t kBfsTopDownFactor = 24;
+
+/// Level-synchronous breadth-first search from a single source. Visited
+/// vertices are marked in a dense atomic bitmap indexed by the vertex
+/// ordinals, so the vertices of a level can be expanded concurrently. A level
+/// is expanded either top-down, from the frontier over its edges, or
+/// bottom-up, by looking for a frontier neighbour of each unvisited vertex,
+/// whichever is expected to touch fewer edges.
+///
+/// The vertices are numbered in the old view, in which the edges are
+/// expanded, so every reached vertex has an ordinal. Only the source may not
+/// have one, if the query created it, in which case no edge leads back to it.
+///
+/// The search doesn't evaluate filter lambdas nor check fine-grained
+/// privileges, since neither can be done off the query thread.
+class LevelSynchronousBfs {
+ public:
+  struct Entry {
+    // The edge the vertex was reached over, std::nullopt for the source.
+    std::optional<EdgeAccessor> edge;
+    VertexAccessor vertex;
+    // Position of the previous vertex on the path in the previous level.
+    size_t parent;
+  };
+
+  LevelSynchronousBfs(EdgeAtom::Direction direction, const std::vector<storage::EdgeTypeId> &edge_types)
+      : direction_(direction), edge_types_(edge_types) {}
+
+  /// Starts the search from `source`. Levels are expanded on `pool`, or on
+  /// the calling thread if it's nullptr. The state of the search is counted
+  /// against `memory_limit`, which must stay the same between the calls.
+  void Start(const VertexAccessor &source, DbAccessor *dba, utils::ThreadPool *pool,
+             utils::MemoryLimit *memory_limit) {
+    Clear();
+    pool_ = pool;
+    if (!ordinals_) {
+      // The workers allocate the levels concurrently, which the resource
+      // allows as it only counts the bytes.
+      memory_.emplace(utils::NewDeleteResource(), memory_limit);
+      // The numbering may be shared with other queries, so it is only counted
+      // against the limit.
+      ordinals_.emplace(dba->GetVertexOrdinals(storage::View::OLD, pool));
+      ordinals_charge_.emplace(memory_limit, ordinals_->numbering().GetAllocatedBytes());
+      visited_.emplace((ordinals_->size() + 63) / 64, 0, &*memory_);
+    }
+    vertex_count_ = std::max<size_t>(ordinals_->size(), 1);
+    TryVisit(source);
+    levels_.emplace_back(&*memory_).push_back(Entry{std::nullopt, source, 0});
+    visited_count_ = 1;
+  }
+
+  /// Appends the next level to the search. Returns false if it is empty,
+  /// in which case nothing is appended.
+  bool ExpandLevel() {
+    const auto frontier_size = levels_.back().size();
+    if (bottom_up_) {
+      bottom_up_ = frontier_size * kBfsTopDownFactor >= vertex_count_;
+    } else {
+      bottom_up_ = frontier_size * kBfsBottomUpFactor > vertex_count_ - std::min(visited_count_, vertex_count_);
+    }
+    // Vertices are marked as visited before they are stored in a level, so
+    // the bitmap can't be cleared level by level if the expansion throws.
+    expanding_ = true;
+    auto next = bottom_up_ ? ExpandBottomUp() : ExpandTopDown();
+    expanding_ = false;
+    if (next.empty()) return false;
+    visited_count_ += next.size();
+    levels_.push_back(std::move(next));
+    return true;
+  }
+
+  /// Number of edges on the paths to the vertices of the deepest level.
+  size_t Depth() const { return levels_.size() - 1; }
+
+  const utils::pmr::vector<Entry> &DeepestLevel() const { return levels_.back(); }
+
+  /// Appends the edges on the path to the vertex at `index` in the deepest
+  /// level to `edges`, starting from the last edge.
+  void PathTo(size_t index, utils::pmr::vector<TypedValue> *edges) const {
+    for (auto level = levels_.size() - 1; level > 0; --level) {
+      const auto &entry = levels_[level][index];
+      edges->emplace_back(*entry.edge);
+      index = entry.parent;
+    }
+  }
+
+  void Clear() {
+    if (expanding_) {
+      if (visited_) std::fill(visited_->begin(), visited_->end(), 0);
+      if (frontier_positions_) std::fill(frontier_positions_->begin(), frontier_positions_->end(), kNoPosition);
+    } else {
+      for (const auto &level : levels_) {
+        for (const auto &entry : level) {
+          if (const auto ordinal = Ordinal(entry.vertex)) (*visited_)[*ordinal / 64] = 0;
+        }
+      }
+    }
+    levels_.clear();
+    if (unvisited_) unvisited_->clear();
+    unvisited_collected_ = false;
+    visited_count_ = 0;
+    bottom_up_ = false;
+    expanding_ = false;
+  }
+
+ private:
+  static constexpr uint64_t kNoPosition = std::numeric_limits<uint64_t>::max();
+
+  utils::pmr::vector<Entry> ExpandTopDown() {
+    const auto &frontier = levels_.back();
+    const auto num_chunks = (frontier.size() + kBfsChunkSize - 1) / kBfsChunkSize;
+    auto chunks = MakeChunks(num_chunks);
+    utils::ParallelFor(pool_, num_chunks, [&](size_t chunk) {
+      auto &out = chunks[chunk];
+      const auto end = std::min(frontier.size(), (chunk + 1) * kBfsChunkSize);
+      for (auto i = chunk * kBfsChunkSize; i < end; ++i) {
+        const auto &vertex = frontier[i].vertex;
+        if (direction_ != EdgeAtom::Direction::IN) {
+          for (const auto &edge : UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, edge_types_))) {
+            if (TryVisit(edge.To())) out.push_back(Entry{edge, edge.To(), i});
+          }
+        }
+        if (direction_ != EdgeAtom::Direction::OUT) {
+          for (const auto &edge : UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, edge_types_))) {
+            if (TryVisit(edge.From())) out.push_back(Entry{edge, edge.From(), i});
+          }
+        }
+      }
+    });
+    return Concatenate(std::move(chunks));
+  }
+
+  utils::pmr::vector<Entry> ExpandBottomUp() {
+    const auto &frontier = levels_.back();
+    if (!frontier_positions_) frontier_positions_.emplace(ordinals_->size(), kNoPosition, &*memory_);
+    auto &frontier_positions = *frontier_positions_;
+    for (size_t i = 0; i < frontier.size(); ++i) {
+      if (const auto ordinal = Ordinal(frontier[i].vertex)) frontier_positions[*ordinal] = i;
+    }
+    const auto &unvisited = CollectUnvisited();
+
+    const auto num_chunks = (unvisited.size() + kBfsChunkSize - 1) / kBfsChunkSize;
+    auto chunks = MakeChunks(num_chunks);
+    utils::ParallelFor(pool_, num_chunks, [&](size_t chunk) {
+      auto &out = chunks[chunk];
+      auto position = [&](const VertexAccessor &vertex) {
+        const auto ordinal = Ordinal(vertex);
+        return ordinal ? frontier_positions[*ordinal] : kNoPosition;
+      };
+      // The vertex is reached over the first edge which connects it to the
+      // frontier in the expansion direction.
+      auto find_parent = [&](const VertexAccessor &vertex) {
+        if (direction_ != EdgeAtom::Direction::IN) {
+          for (const auto &edge : UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, edge_types_))) {
+            if (const auto parent = position(edge.From()); parent != kNoPosition) {
+              out.push_back(Entry{edge, vertex, parent});
+              return;
+            }
+          }
+        }
+        if (direction_ != EdgeAtom::Direction::OUT) {
+          for (const auto &edge : UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, edge_types_))) {
+            if (const auto parent = position(edge.To()); parent != kNoPosition) {
+              out.push_back(Entry{edge, vertex, parent});
+              return;
+            }
+          }
+        }
+      };
+      const auto end = std::min(unvisited.size(), (chunk + 1) * kBfsChunkSize);
+      for (auto i = chunk * kBfsChunkSize; i < end; ++i) find_parent(VertexAccessor(ordinals_->Vertex(unvisited[i])));
+    });
+    auto next = Concatenate(std::move(chunks));
+    for (const auto &entry : frontier) {
+      if (const auto ordinal = Ordinal(entry.vertex)) frontier_positions[*ordinal] = kNoPosition;
+    }
+    for (const auto &entry : next) TryVisit(entry.vertex);
+    return next;
+  }
+
+  // Returns the ordinals of the vertices that weren't visited yet. They are
+  // collected from the bitmap at the first bottom-up level of a search and
+  // filtered at each following one, so the list shrinks as the search
+  // advances.
+  const utils::pmr::vector<uint64_t> &CollectUnvisited() {
+    if (!unvisited_) unvisited_.emplace(&*memory_);
+    auto &unvisited = *unvisited_;
+    if (unvisited_collected_) {
+      std::erase_if(unvisited, [this](auto ordinal) { return IsVisited(ordinal); });
+      return unvisited;
+    }
+    unvisited.reserve(vertex_count_ - std::min(visited_count_, vertex_count_));
+    for (uint64_t ordinal = 0; ordinal < ordinals_->size(); ++ordinal) {
+      if (!IsVisited(ordinal)) unvisited.push_back(ordinal);
+    }
+    unvisited_collected_ = true;
+    return unvisited;
+  }
+
+  // Each chunk of a level is filled by a single worker. The copies of a
+  // utils::pmr::vector don't keep its memory, so they are made one by one.
+  std::vector<utils::pmr::vector<Entry>> MakeChunks(size_t num_chunks) {
+    std::vector<utils::pmr::vector<Entry>> chunks;
+    chunks.reserve(num_chunks);
+    for (size_t i = 0; i < num_chunks; ++i) chunks.emplace_back(&*memory_);
+    return chunks;
+  }
+
+  utils::pmr::vector<Entry> Concatenate(std::vector<utils::pmr::vector<Entry>> chunks) {
+    if (chunks.size() == 1) return std::move(chunks.front());
+    size_t size = 0;
+    for (const auto &chunk : chunks) size += chunk.size();
+    utils::pmr::vector<Entry> result(&*memory_);
+    result.reserve(size);
+    for (auto &chunk : chunks) std::move(chunk.begin(), chunk.end(), std::back_inserter(result));
+    return result;
+  }
+
+  std::optional<uint64_t> Ordinal(const VertexAccessor &vertex) const { return ordinals_->Ordinal(vertex.Gid()); }
+
+  // Marks the vertex as visited. Returns false if it was already visited.
+  bool TryVisit(const VertexAccessor &vertex) {
+    const auto ordinal = Ordinal(vertex);
+    if (!ordinal) return true;
+    std::atomic_ref word((*visited_)[*ordinal / 64]);
+    const uint64_t mask = uint64_t{1} << (*ordinal % 64);
+    if (word.load(std::memory_order_relaxed) & mask) return false;
+    return !(word.fetch_or(mask, std::memory_order_relaxed) & mask);
+  }
+
+  bool IsVisited(uint64_t ordinal) {
+    return std::atomic_ref((*visited_)[ordinal / 64]).load(std::memory_order_relaxed) & (uint64_t{1} << (ordinal % 64));
+  }
+
+  EdgeAtom::Direction direction_;
+  const std::vector<storage::EdgeTypeId> &edge_types_;
+
+  utils::ThreadPool *pool_{nullptr};
+  // Declared before the state of the search, which is allocated from it.
+  std::optional<utils::LimitedMemoryResource> memory_;
+  std::optional<storage::VertexOrdinals> ordinals_;
+  std::optional<utils::MemoryLimitCharge> ordinals_charge_;
+  // Visited bits of the vertices, indexed by their ordinals.
+  std::optional<utils::pmr::vector<uint64_t>> visited_;
+  // Positions of the frontier vertices in their level, indexed by their
+  // ordinals and set only during a bottom-up expansion.
+  std::optional<utils::pmr::vector<uint64_t>> frontier_positions_;
+  std::optional<utils::pmr::vector<uint64_t>> unvisited_;
+  bool unvisited_collected_{false};
+  // Vertices reached at each depth, the source being the only one at depth 0.
+  std::vector<utils::pmr::vector<Entry>> levels_;
+  size_t visited_count_{0};
+  size_t vertex_count_{1};
+  bool bottom_up_{false};
+  bool expanding_{false};
+};
+
+}  // namespace
+
 class SingleSourceShortestPathCursor : public query::plan::Cursor {
  public:
   SingleSourceShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
@@ -1407,6 +1690,8 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                   storage::View::OLD);
 
+    if (UseLevelSynchronousBfs(context)) return PullLevelSynchronous(frame, context, evaluator);
+
     // for the given (edge, vertex) pair checks if they satisfy the
     // "where" condition. if so, places them in the to_visit_ structure.
     auto expand_pair = [this, &evaluator, &frame, &context](EdgeAccessor edge, VertexAccessor vertex) {
@@ -1530,9 +1815,66 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     processed_.clear();
     to_visit_next_.clear();
     to_visit_current_.clear();
+    bfs_.Clear();
+    bfs_active_ = false;
   }
 
  private:
+  bool UseLevelSynchronousBfs(const ExecutionContext &context) const {
+    if (!context.bfs_worker_pool || self_.filter_lambda_.expression) return false;
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return false;
+#endif
+    return true;
+  }
+
+  // Yields the vertices one level at a time. The next level is expanded only
+  // once all vertices of the current one have been pulled.
+  bool PullLevelSynchronous(Frame &frame, ExecutionContext &context, ExpressionEvaluator &evaluator) {
+    while (true) {
+      if (MustAbort(context)) throw HintedAbortError();
+
+      if (!bfs_active_) {
+        if (!input_cursor_->Pull(frame, context)) return false;
+
+        const auto &vertex_value = frame[self_.input_symbol_];
+        // it is possible that the vertex is Null due to optional matching
+        if (vertex_value.IsNull()) continue;
+        lower_bound_ = self_.lower_bound_
+                           ? EvaluateInt(&evaluator, self_.lower_bound_, "Min depth in breadth-first expansion")
+                           : 1;
+        upper_bound_ = self_.upper_bound_
+                           ? EvaluateInt(&evaluator, self_.upper_bound_, "Max depth in breadth-first expansion")
+                           : std::numeric_limits<int64_t>::max();
+
+        if (upper_bound_ < 1 || lower_bound_ > upper_bound_) continue;
+
+        bfs_.Start(vertex_value.ValueVertex(), context.db_accessor, context.bfs_worker_pool, context.memory_limit);
+        bfs_active_ = true;
+        // the source itself is never yielded
+        next_entry_ = bfs_.DeepestLevel().size();
+      }
+
+      if (next_entry_ == bfs_.DeepestLevel().size()) {
+        if (static_cast<int64_t>(bfs_.Depth()) >= upper_bound_ || !bfs_.ExpandLevel()) {
+          bfs_active_ = false;
+          continue;
+        }
+        next_entry_ = static_cast<int64_t>(bfs_.Depth()) < lower_bound_ ? bfs_.DeepestLevel().size() : 0;
+        continue;
+      }
+
+      const auto index = next_entry_++;
+      utils::pmr::vector<TypedValue> edge_list(context.evaluation_context.memory);
+      edge_list.reserve(bfs_.Depth());
+      bfs_.PathTo(index, &edge_list);
+      frame[self_.common_.node_symbol] = bfs_.DeepestLevel()[index].vertex;
+      std::reverse(edge_list.begin(), edge_list.end());
+      frame[self_.common_.edge_symbol] = std::move(edge_list);
+      return true;
+    }
+  }
+
   const ExpandVariable &self_;
   const UniqueCursorPtr input_cursor_;
 
@@ -1548,6 +1890,13 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   // edge/vertex pairs we have yet to visit, for current and next depth
   utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> to_visit_current_;
   utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> to_visit_next_;
+
+  // State of the level-synchronous expansion, used instead of the above when
+  // UseLevelSynchronousBfs holds.
+  LevelSynchronousBfs bfs_{self_.common_.direction, self_.common_.edge_types};
+  bool bfs_active_{false};
+  // Position of the next vertex to yield in the deepest level.
+  size_t next_entry_{0};
 };
 
 namespace {
@@ -1570,6 +1919,387 @@ void CheckWeightType(TypedValue current_weight, utils::MemoryResource *memory) {
   }
 }
 
+void ValidateWeightTypes(const TypedValue &lhs, const TypedValue &rhs) {
+  if (!((lhs.IsNumeric() && rhs.IsNumeric()) || (lhs.IsDuration() && rhs.IsDuration()))) {
+    throw QueryRuntimeException(utils::MessageWithLink(
+        "All weights should be of the same type, either numeric or a Duration. Please update the weight "
+        "expression or the filter expression.",
+        "https://memgr.ph/wsp"));
+  }
+}
+
+// Null is the weight of an empty path and it is less than any other weight.
+bool IsWeightLess(const TypedValue &lhs, const TypedValue &rhs) {
+  if (rhs.IsNull()) return false;
+  if (lhs.IsNull()) return true;
+  ValidateWeightTypes(lhs, rhs);
+  return (lhs < rhs).ValueBool();
+}
+
+TypedValue AddWeights(const TypedValue &lhs, const TypedValue &rhs, utils::MemoryResource *memory) {
+  if (lhs.IsNull()) return TypedValue(rhs, memory);
+  if (rhs.IsNull()) return TypedValue(lhs, memory);
+  ValidateWeightTypes(lhs, rhs);
+  return TypedValue(lhs, memory) + rhs;
+}
+
+// Weighted search between two bound vertices which expands from both the
+// source and the sink until the two searches meet. Only vertices with a
+// distance up to roughly half of the shortest path are visited from each
+// side, which is much less than a single sided Dijkstra visits on graphs whose
+// frontier grows exponentially.
+//
+// Visited vertices are keyed by their Gid instead of a VertexAccessor, which
+// keeps the visited and frontier maps compact.
+//
+// When all shortest paths are requested, every edge lying on some shortest path
+// is remembered, so the paths can be enumerated lazily afterwards.
+class BidirectionalWeightedSearch {
+ public:
+  BidirectionalWeightedSearch(const ExpandVariable &self, bool all_paths, utils::MemoryResource *mem)
+      : self_(self), all_paths_(all_paths), source_side_(mem), sink_side_(mem), crossings_(mem), seen_crossings_(mem) {}
+
+  // Finds the shortest paths from `source` to `sink`. Returns false if there
+  // are none, otherwise paths can be retrieved with `NextPath`.
+  bool Search(const VertexAccessor &source, const VertexAccessor &sink, Frame &frame, ExpressionEvaluator &evaluator,
+              const ExecutionContext &context) {
+    Clear();
+    if (source == sink) return false;
+    source_gid_ = source.Gid();
+    sink_gid_ = sink.Gid();
+    source_side_.distance.emplace(source_gid_, TypedValue());
+    source_side_.queue.emplace(TypedValue(), source);
+    sink_side_.distance.emplace(sink_gid_, TypedValue());
+    sink_side_.queue.emplace(TypedValue(), sink);
+
+    while (true) {
+      if (MustAbort(context)) throw HintedAbortError();
+      PruneSettled(&source_side_);
+      PruneSettled(&sink_side_);
+      if (source_side_.queue.empty() || sink_side_.queue.empty()) break;
+      if (shortest_ && ShouldStop(evaluator.GetMemoryResource())) break;
+      // Expand the side with the smaller frontier.
+      const bool from_source = source_side_.queue.size() <= sink_side_.queue.size();
+      SettleNext(from_source, frame, evaluator, context);
+    }
+    if (!shortest_) return false;
+
+    if (!all_paths_) {
+      // The cheapest crossing, with final distances of its endpoints, lies on
+      // a shortest path.
+      std::optional<size_t> best;
+      for (size_t i = 0; i < crossings_.size(); ++i) {
+        if (!best ||
+            IsWeightLess(CrossingWeight(crossings_[i], evaluator), CrossingWeight(crossings_[*best], evaluator))) {
+          best = i;
+        }
+      }
+      std::swap(crossings_[0], crossings_[*best]);
+      crossings_.erase(crossings_.begin() + 1, crossings_.end());
+      shortest_ = CrossingWeight(crossings_[0], evaluator);
+      return true;
+    }
+
+    // Settle vertices tied with the furthest settled ones, so that each side
+    // contains all vertices up to some distance.
+    for (auto *side : {&source_side_, &sink_side_}) {
+      while (true) {
+        PruneSettled(side);
+        if (side->queue.empty() || IsWeightLess(side->max_settled, side->queue.top().first)) break;
+        SettleNext(side == &source_side_, frame, evaluator, context);
+      }
+    }
+    // Each shortest path either lies completely on the source side or it has
+    // exactly one edge leaving the source side for the last time. Such edges
+    // must lead into the sink side, which makes them unique per path.
+    const auto is_shortest = [&](const TypedValue &weight) {
+      return !IsWeightLess(*shortest_, weight) && !IsWeightLess(weight, *shortest_);
+    };
+    if (source_side_.settled.contains(sink_gid_) && is_shortest(source_side_.distance.at(sink_gid_))) {
+      direct_.emplace(&source_side_, sink_gid_, source_gid_);
+    }
+    std::erase_if(crossings_, [&](const auto &crossing) {
+      return !source_side_.settled.contains(crossing.source_vertex) ||
+             source_side_.settled.contains(crossing.sink_vertex) ||
+             !sink_side_.settled.contains(crossing.sink_vertex) || !is_shortest(CrossingWeight(crossing, evaluator));
+    });
+    return true;
+  }
+
+  // Weight of the paths found by `Search`.
+  const TypedValue &Weight() const { return *shortest_; }
+
+  // Places the edges of the next shortest path into `edges`, ordered from the
+  // source to the sink. Returns false when there are no more paths.
+  bool NextPath(utils::pmr::vector<TypedValue> *edges) {
+    if (direct_) {
+      if (direct_->Next()) {
+        for (auto it = direct_->Path().rbegin(); it != direct_->Path().rend(); ++it) edges->emplace_back((*it)->edge);
+        return true;
+      }
+      direct_.reset();
+    }
+    while (crossing_index_ < crossings_.size()) {
+      const auto &crossing = crossings_[crossing_index_];
+      if (!prefix_) {
+        prefix_.emplace(&source_side_, crossing.source_vertex, source_gid_);
+        if (!prefix_->Next()) {
+          prefix_.reset();
+          ++crossing_index_;
+          continue;
+        }
+      }
+      if (!suffix_) suffix_.emplace(&sink_side_, crossing.sink_vertex, sink_gid_);
+      if (suffix_->Next()) {
+        for (auto it = prefix_->Path().rbegin(); it != prefix_->Path().rend(); ++it) edges->emplace_back((*it)->edge);
+        edges->emplace_back(crossing.edge);
+        for (const auto *step : suffix_->Path()) edges->emplace_back(step->edge);
+        return true;
+      }
+      suffix_.reset();
+      if (!prefix_->Next()) {
+        prefix_.reset();
+        ++crossing_index_;
+      }
+    }
+    return false;
+  }
+
+  void Clear() {
+    source_side_.Clear();
+    sink_side_.Clear();
+    crossings_.clear();
+    seen_crossings_.clear();
+    shortest_.reset();
+    direct_.reset();
+    prefix_.reset();
+    suffix_.reset();
+    crossing_index_ = 0;
+  }
+
+ private:
+  // Edge through which a vertex was reached, pointing back towards the vertex
+  // from which the side started.
+  struct Step {
+    EdgeAccessor edge;
+    storage::Gid previous;
+  };
+
+  // Edge connecting a vertex reached from the source to a vertex reached from
+  // the sink.
+  struct Crossing {
+    storage::Gid source_vertex;
+    EdgeAccessor edge;
+    storage::Gid sink_vertex;
+    TypedValue weight;
+  };
+
+  using QueueEntry = std::pair<TypedValue, VertexAccessor>;
+
+  // Keep the lowest weight on top of the queue.
+  struct QueueComparator {
+    bool operator()(const QueueEntry &lhs, const QueueEntry &rhs) const { return IsWeightLess(rhs.first, lhs.first); }
+  };
+
+  struct Side {
+    explicit Side(utils::MemoryResource *mem) : distance(mem), settled(mem), steps(mem), queue(mem), max_settled(mem) {}
+
+    void Clear() {
+      distance.clear();
+      settled.clear();
+      steps.clear();
+      while (!queue.empty()) queue.pop();
+      max_settled = TypedValue();
+    }
+
+    // Tentative distances, which are final for settled vertices.
+    utils::pmr::unordered_map<storage::Gid, TypedValue> distance;
+    utils::pmr::unordered_set<storage::Gid> settled;
+    // Edges on shortest paths from the side's origin to each vertex. Steps
+    // only point to vertices settled earlier, so they never form a cycle.
+    utils::pmr::unordered_map<storage::Gid, utils::pmr::vector<Step>> steps;
+    std::priority_queue<QueueEntry, utils::pmr::vector<QueueEntry>, QueueComparator> queue;
+    TypedValue max_settled;
+  };
+
+  // Lazily enumerates paths of steps from a vertex back to the side's origin.
+  class PathEnumerator {
+   public:
+    PathEnumerator(const Side *side, storage::Gid from, storage::Gid origin)
+        : side_(side), from_(from), origin_(origin) {}
+
+    bool Next() {
+      if (!started_) {
+        started_ = true;
+        stack_.emplace_back(from_, 0);
+        if (from_ == origin_) return true;
+      } else {
+        if (stack_.empty()) return false;
+        PopVertex();
+      }
+      while (!stack_.empty()) {
+        auto &[gid, next_step] = stack_.back();
+        auto steps_it = side_->steps.find(gid);
+        if (steps_it == side_->steps.end() || next_step >= steps_it->second.size()) {
+          PopVertex();
+          continue;
+        }
+        const auto &step = steps_it->second[next_step++];
+        path_.push_back(&step);
+        stack_.emplace_back(step.previous, 0);
+        if (step.previous == origin_) return true;
+      }
+      return false;
+    }
+
+    // Steps of the current path, ordered from `from` to the origin.
+    const std::vector<const Step *> &Path() const { return path_; }
+
+   private:
+    void PopVertex() {
+      stack_.pop_back();
+      if (!path_.empty()) path_.pop_back();
+    }
+
+    const Side *side_;
+    storage::Gid from_;
+    storage::Gid origin_;
+    bool started_{false};
+    // Vertices on the current path with the index of the next step to try.
+    std::vector<std::pair<storage::Gid, size_t>> stack_;
+    std::vector<const Step *> path_;
+  };
+
+  struct CrossingKeyHash {
+    size_t operator()(const std::pair<storage::Gid, storage::Gid> &key) const {
+      return utils::HashCombine<storage::Gid, storage::Gid>{}(key.first, key.second);
+    }
+  };
+
+  TypedValue CrossingWeight(const Crossing &crossing, ExpressionEvaluator &evaluator) const {
+    auto *memory = evaluator.GetMemoryResource();
+    return AddWeights(AddWeights(source_side_.distance.at(crossing.source_vertex), crossing.weight, memory),
+                      sink_side_.distance.at(crossing.sink_vertex), memory);
+  }
+
+  static void PruneSettled(Side *side) {
+    while (!side->queue.empty() && side->settled.contains(side->queue.top().second.Gid())) side->queue.pop();
+  }
+
+  bool ShouldStop(utils::MemoryResource *memory) const {
+    const auto &source_top = source_side_.queue.top().first;
+    const auto &sink_top = sink_side_.queue.top().first;
+    // A single path can be returned as soon as no unsettled vertex can
+    // improve it. For all paths, both sides need to contain all vertices
+    // up to a distance covering the shortest path, so every edge on it is
+    // known.
+    const auto &source_bound = all_paths_ ? source_side_.max_settled : source_top;
+    const auto &sink_bound = all_paths_ ? sink_side_.max_settled : sink_top;
+    return !IsWeightLess(AddWeights(source_bound, sink_bound, memory), *shortest_);
+  }
+
+  void SettleNext(bool from_source, Frame &frame, ExpressionEvaluator &evaluator, const ExecutionContext &context) {
+    auto &side = from_source ? source_side_ : sink_side_;
+    auto [weight, vertex] = side.queue.top();
+    side.queue.pop();
+    if (!side.settled.insert(vertex.Gid()).second) return;
+    side.max_settled = weight;
+
+    // Expanding from the sink traverses edges in reverse, so the directions
+    // are flipped and the lambdas are evaluated on the vertex the edge leads
+    // to in the direction of the path.
+    const bool expand_out = from_source ? self_.common_.direction != EdgeAtom::Direction::IN
+                                        : self_.common_.direction != EdgeAtom::Direction::OUT;
+    const bool expand_in = from_source ? self_.common_.direction != EdgeAtom::Direction::OUT
+                                       : self_.common_.direction != EdgeAtom::Direction::IN;
+    if (expand_out) {
+      auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types));
+      for (const auto &edge : out_edges) {
+        Relax(from_source, vertex, weight, edge, edge.To(), frame, evaluator, context);
+      }
+    }
+    if (expand_in) {
+      auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types));
+      for (const auto &edge : in_edges) {
+        Relax(from_source, vertex, weight, edge, edge.From(), frame, evaluator, context);
+      }
+    }
+  }
+
+  void Relax(bool from_source, const VertexAccessor &vertex, const TypedValue &weight, const EdgeAccessor &edge,
+             const VertexAccessor &next_vertex, Frame &frame, ExpressionEvaluator &evaluator,
+             const ExecutionContext &context) {
+    auto *memory = evaluator.GetMemoryResource();
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+        !(context.auth_checker->Has(next_vertex, storage::View::OLD,
+                                    memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+          context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+      return;
+    }
+#endif
+    const auto &path_vertex = from_source ? next_vertex : vertex;
+    if (self_.filter_lambda_.expression) {
+      frame[self_.filter_lambda_.inner_edge_symbol] = edge;
+      frame[self_.filter_lambda_.inner_node_symbol] = path_vertex;
+
+      if (!EvaluateFilter(evaluator, self_.filter_lambda_.expression)) return;
+    }
+
+    frame[self_.weight_lambda_->inner_edge_symbol] = edge;
+    frame[self_.weight_lambda_->inner_node_symbol] = path_vertex;
+
+    TypedValue edge_weight = self_.weight_lambda_->expression->Accept(evaluator);
+
+    CheckWeightType(edge_weight, memory);
+
+    auto next_weight = AddWeights(weight, edge_weight, memory);
+    const auto gid = vertex.Gid();
+    const auto next_gid = next_vertex.Gid();
+
+    auto &side = from_source ? source_side_ : sink_side_;
+    const auto &other_side = from_source ? sink_side_ : source_side_;
+    if (auto other_it = other_side.distance.find(next_gid); other_it != other_side.distance.end()) {
+      const auto source_vertex = from_source ? gid : next_gid;
+      const auto sink_vertex = from_source ? next_gid : gid;
+      if (seen_crossings_.emplace(edge.Gid(), source_vertex).second) {
+        crossings_.push_back(Crossing{source_vertex, edge, sink_vertex, edge_weight});
+      }
+      auto path_weight = AddWeights(next_weight, other_it->second, memory);
+      if (!shortest_ || IsWeightLess(path_weight, *shortest_)) shortest_.emplace(std::move(path_weight));
+    }
+
+    if (side.settled.contains(next_gid)) return;
+    auto [distance_it, inserted] = side.distance.try_emplace(next_gid, next_weight);
+    if (inserted || IsWeightLess(next_weight, distance_it->second)) {
+      distance_it->second = next_weight;
+      auto &steps = side.steps[next_gid];
+      steps.clear();
+      steps.push_back(Step{edge, gid});
+      side.queue.emplace(std::move(next_weight), next_vertex);
+    } else if (all_paths_ && !IsWeightLess(distance_it->second, next_weight)) {
+      side.steps[next_gid].push_back(Step{edge, gid});
+    }
+  }
+
+  const ExpandVariable &self_;
+  const bool all_paths_;
+  storage::Gid source_gid_;
+  storage::Gid sink_gid_;
+  Side source_side_;
+  Side sink_side_;
+  utils::pmr::vector<Crossing> crossings_;
+  utils::pmr::unordered_set<std::pair<storage::Gid, storage::Gid>, CrossingKeyHash> seen_crossings_;
+  // Weight of the shortest path found so far.
+  std::optional<TypedValue> shortest_;
+
+  // State of path enumeration.
+  std::optional<PathEnumerator> direct_;
+  size_t crossing_index_{0};
+  std::optional<PathEnumerator> prefix_;
+  std::optional<PathEnumerator> suffix_;
+};
+
 }  // namespace
 
 class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
@@ -1788,15 +2518,6 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
   // Keeps track of vertices for which we yielded a path already.
   utils::pmr::unordered_set<VertexAccessor> yielded_vertices_;
 
-  static void ValidateWeightTypes(const TypedValue &lhs, const TypedValue &rhs) {
-    if (!((lhs.IsNumeric() && lhs.IsNumeric()) || (rhs.IsDuration() && rhs.IsDuration()))) {
-      throw QueryRuntimeException(utils::MessageWithLink(
-          "All weights should be of the same type, either numeric or a Duration. Please update the weight "
-          "expression or the filter expression.",
-          "https://memgr.ph/wsp"));
-    }
-  }
-
   // Priority queue comparator. Keep lowest weight on top of the queue.
   class PriorityQueueComparator {
    public:
@@ -2101,15 +2822,6 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
   // Stack indicating the traversal level.
   utils::pmr::list<utils::pmr::list<DirectedEdge>> traversal_stack_;
 
-  static void ValidateWeightTypes(const TypedValue &lhs, const TypedValue &rhs) {
-    if (!((lhs.IsNumeric() && lhs.IsNumeric()) || (rhs.IsDuration() && rhs.IsDuration()))) {
-      throw QueryRuntimeException(utils::MessageWithLink(
-          "All weights should be of the same type, either numeric or a Duration. Please update the weight "
-          "expression or the filter expression.",
-          "https://memgr.ph/wsp"));
-    }
-  }
-
   // Priority queue comparator. Keep lowest weight on top of the queue.
   class PriorityQueueComparator {
    public:
@@ -2143,44 +2855,163 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
   }
 };
 
-UniqueCursorPtr ExpandVariable::MakeCursor(utils::MemoryResource *mem) const {
-  EventCounter::IncrementCounter(EventCounter::ExpandVariableOperator);
-
-  switch (type_) {
-    case EdgeAtom::Type::BREADTH_FIRST:
-      if (common_.existing_node) {
-        return MakeUniqueCursorPtr<STShortestPathCursor>(mem, *this, mem);
-      } else {
-        return MakeUniqueCursorPtr<SingleSourceShortestPathCursor>(mem, *this, mem);
-      }
-    case EdgeAtom::Type::DEPTH_FIRST:
-      return MakeUniqueCursorPtr<ExpandVariableCursor>(mem, *this, mem);
-    case EdgeAtom::Type::WEIGHTED_SHORTEST_PATH:
-      return MakeUniqueCursorPtr<ExpandWeightedShortestPathCursor>(mem, *this, mem);
-    case EdgeAtom::Type::ALL_SHORTEST_PATHS:
-      return MakeUniqueCursorPtr<ExpandAllShortestPathsCursor>(mem, *this, mem);
-    case EdgeAtom::Type::SINGLE:
-      LOG_FATAL("ExpandVariable should not be planned for a single expansion!");
-  }
-}
-
-class ConstructNamedPathCursor : public Cursor {
+class STWeightedShortestPathCursor : public query::plan::Cursor {
  public:
-  ConstructNamedPathCursor(const ConstructNamedPath &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input()->MakeCursor(mem)) {}
+  STWeightedShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), search_(self_, false, mem) {
+    MG_ASSERT(self_.common_.existing_node && !self_.upper_bound_,
+              "s-t weighted shortest path algorithm should only be used when `existing_node` flag is set and there "
+              "is no upper bound!");
+  }
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
-    SCOPED_PROFILE_OP("ConstructNamedPath");
+    SCOPED_PROFILE_OP("STWeightedShortestPath");
 
-    if (!input_cursor_->Pull(frame, context)) return false;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    while (input_cursor_->Pull(frame, context)) {
+      const auto &source_tv = frame[self_.input_symbol_];
+      const auto &sink_tv = frame[self_.common_.node_symbol];
 
-    auto symbol_it = self_.path_elements_.begin();
-    DMG_ASSERT(symbol_it != self_.path_elements_.end(), "Named path must contain at least one node");
+      // It is possible that source or sink vertex is Null due to optional
+      // matching.
+      if (source_tv.IsNull() || sink_tv.IsNull()) continue;
 
-    const auto &start_vertex = frame[*symbol_it++];
-    auto *pull_memory = context.evaluation_context.memory;
-    // In an OPTIONAL MATCH everything could be Null.
-    if (start_vertex.IsNull()) {
+      const auto source = source_tv.ValueVertex();
+      const auto sink = sink_tv.ValueVertex();
+      if (!search_.Search(source, sink, frame, evaluator, context)) continue;
+
+      utils::pmr::vector<TypedValue> edge_list(context.evaluation_context.memory);
+      search_.NextPath(&edge_list);
+      if (self_.is_reverse_) {
+        std::reverse(edge_list.begin(), edge_list.end());
+      }
+      frame[self_.common_.edge_symbol] = std::move(edge_list);
+      frame[self_.total_weight_.value()] = search_.Weight();
+      return true;
+    }
+    return false;
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    search_.Clear();
+  }
+
+ private:
+  const ExpandVariable &self_;
+  const UniqueCursorPtr input_cursor_;
+  BidirectionalWeightedSearch search_;
+};
+
+class STAllShortestPathsCursor : public query::plan::Cursor {
+ public:
+  STAllShortestPathsCursor(const ExpandVariable &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), search_(self_, true, mem) {
+    MG_ASSERT(self_.common_.existing_node && !self_.upper_bound_,
+              "s-t all shortest paths algorithm should only be used when `existing_node` flag is set and there is "
+              "no upper bound!");
+  }
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP("STAllShortestPaths");
+
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    while (true) {
+      if (MustAbort(context)) throw HintedAbortError();
+
+      if (has_paths_) {
+        utils::pmr::vector<TypedValue> edge_list(context.evaluation_context.memory);
+        if (search_.NextPath(&edge_list)) {
+          if (self_.is_reverse_) {
+            std::reverse(edge_list.begin(), edge_list.end());
+          }
+          frame[self_.common_.edge_symbol] = std::move(edge_list);
+          frame[self_.total_weight_.value()] = search_.Weight();
+          return true;
+        }
+        has_paths_ = false;
+      }
+
+      if (!input_cursor_->Pull(frame, context)) return false;
+      const auto &source_tv = frame[self_.input_symbol_];
+      const auto &sink_tv = frame[self_.common_.node_symbol];
+
+      // It is possible that source or sink vertex is Null due to optional
+      // matching.
+      if (source_tv.IsNull() || sink_tv.IsNull()) continue;
+
+      const auto source = source_tv.ValueVertex();
+      const auto sink = sink_tv.ValueVertex();
+      has_paths_ = search_.Search(source, sink, frame, evaluator, context);
+    }
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    search_.Clear();
+    has_paths_ = false;
+  }
+
+ private:
+  const ExpandVariable &self_;
+  const UniqueCursorPtr input_cursor_;
+  BidirectionalWeightedSearch search_;
+  // True while paths found for the current input are being yielded.
+  bool has_paths_{false};
+};
+
+UniqueCursorPtr ExpandVariable::MakeCursor(utils::MemoryResource *mem) const {
+  EventCounter::IncrementCounter(EventCounter::ExpandVariableOperator);
+
+  switch (type_) {
+    case EdgeAtom::Type::BREADTH_FIRST:
+      if (common_.existing_node) {
+        return MakeUniqueCursorPtr<STShortestPathCursor>(mem, *this, mem);
+      } else {
+        return MakeUniqueCursorPtr<SingleSourceShortestPathCursor>(mem, *this, mem);
+      }
+    case EdgeAtom::Type::DEPTH_FIRST:
+      return MakeUniqueCursorPtr<ExpandVariableCursor>(mem, *this, mem);
+    case EdgeAtom::Type::WEIGHTED_SHORTEST_PATH:
+      // Bidirectional search doesn't track the depth of paths, so it can be
+      // used only without an upper bound.
+      if (common_.existing_node && !upper_bound_) {
+        return MakeUniqueCursorPtr<STWeightedShortestPathCursor>(mem, *this, mem);
+      }
+      return MakeUniqueCursorPtr<ExpandWeightedShortestPathCursor>(mem, *this, mem);
+    case EdgeAtom::Type::ALL_SHORTEST_PATHS:
+      if (common_.existing_node && !upper_bound_) {
+        return MakeUniqueCursorPtr<STAllShortestPathsCursor>(mem, *this, mem);
+      }
+      return MakeUniqueCursorPtr<ExpandAllShortestPathsCursor>(mem, *this, mem);
+    case EdgeAtom::Type::SINGLE:
+      LOG_FATAL("ExpandVariable should not be planned for a single expansion!");
+  }
+}
+
+class ConstructNamedPathCursor : public Cursor {
+ public:
+  ConstructNamedPathCursor(const ConstructNamedPath &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self_.input()->MakeCursor(mem)) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP("ConstructNamedPath");
+
+    if (!input_cursor_->Pull(frame, context)) return false;
+
+    auto symbol_it = self_.path_elements_.begin();
+    DMG_ASSERT(symbol_it != self_.path_elements_.end(), "Named path must contain at least one node");
+
+    const auto &start_vertex = frame[*symbol_it++];
+    auto *pull_memory = context.evaluation_context.memory;
+    // In an OPTIONAL MATCH everything could be Null.
+    if (start_vertex.IsNull()) {
       frame[self_.path_symbol_] = TypedValue(pull_memory);
       return true;
     }
@@ -2306,11 +3137,16 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   // nodes and edges.
   ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                 storage::View::OLD);
+  if (!property_prefetch_) property_prefetch_.emplace(std::vector<Expression *>{self_.expression_}, context.symbol_table);
+  if (!property_prefetch_->empty()) evaluator.SetPropertyPrefetch(&*property_prefetch_);
   while (input_cursor_->Pull(frame, context)) {
     for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
       pattern_filter_cursor->Pull(frame, context);
     }
 
+    if (!property_prefetch_->empty()) {
+      property_prefetch_->Fetch(frame, context.evaluation_context, storage::View::OLD);
+    }
     if (EvaluateFilter(evaluator, self_.expression_)) return true;
   }
   return false;
@@ -2381,9 +3217,18 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP("Produce");
 
   if (input_cursor_->Pull(frame, context)) {
+    if (!property_prefetch_) {
+      property_prefetch_.emplace(
+          std::vector<Expression *>(self_.named_expressions_.begin(), self_.named_expressions_.end()),
+          context.symbol_table);
+    }
     // Produce should always yield the latest results.
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                   storage::View::NEW);
+    if (!property_prefetch_->empty()) {
+      property_prefetch_->Fetch(frame, context.evaluation_context, storage::View::NEW);
+      evaluator.SetPropertyPrefetch(&*property_prefetch_);
+    }
     for (auto named_expr : self_.named_expressions_) named_expr->Accept(evaluator);
 
     return true;
@@ -3270,22 +4115,60 @@ TypedValue DefaultAggregationOpValue(const Aggregate::Element &element, utils::M
       return TypedValue(query::Graph(memory));
   }
 }
+
+// Rows are aggregated in batches of this size when aggregation workers are
+// enabled.
+constexpr size_t kAggregationBatchSize = 16384;
+// Groups are split into partitions by the hash of their key, this many per
+// aggregation worker, rounded up to a power of two, so that workers which are
+// done early can take over the partitions of the others. A partition is only
+// ever aggregated by a single worker at a time.
+constexpr size_t kAggregationPartitionsPerWorker = 4;
+
+size_t HashGroupBy(std::span<const TypedValue> group_by) {
+  if (group_by.size() == 1) return TypedValue::Hash{}(group_by.front());
+  return utils::FnvCollection<std::span<const TypedValue>, TypedValue, TypedValue::Hash>{}(group_by);
+}
+
+// Returns one of the 2^partition_bits partitions, partition_bits being at
+// least 1.
+size_t AggregationPartition(size_t hash, size_t partition_bits) {
+  // Fibonacci hashing spreads keys with poor high bits, such as vertex Gids.
+  return (static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> (64 - partition_bits);
+}
+
+// The rows of groups which don't fit in memory are spilled to
+// 2^kAggregationSpillPartitionBits files. Each file is aggregated on its own
+// once the input is exhausted.
+constexpr size_t kAggregationSpillPartitionBits = 4;
+constexpr size_t kAggregationSpillPartitions = size_t{1} << kAggregationSpillPartitionBits;
 }  // namespace
 
 class AggregateCursor : public Cursor {
  public:
   AggregateCursor(const Aggregate &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), aggregation_(mem) {}
+      : self_(self),
+        input_cursor_(self_.input_->MakeCursor(mem)),
+        aggregation_memory_(mem, std::numeric_limits<size_t>::max()),
+        aggregation_(self_.group_by_.size() == 1, &aggregation_memory_),
+        group_by_(mem),
+        results_(mem),
+        spill_memory_(kSpillMemoryBlockSize) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("Aggregate");
 
     if (!pulled_all_input_) {
+      if (AggregateFromPropertyColumns(&frame, &context)) {
+        pulled_all_input_ = true;
+        results_it_ = 0;
+        return true;
+      }
       ProcessAll(&frame, &context);
       pulled_all_input_ = true;
-      aggregation_it_ = aggregation_.begin();
+      results_it_ = 0;
 
-      if (aggregation_.empty()) {
+      if (results_.empty() && spilled_partitions_.empty()) {
         auto *pull_memory = context.evaluation_context.memory;
         // place default aggregation values on the frame
         for (const auto &elem : self_.aggregations_)
@@ -3296,18 +4179,20 @@ class AggregateCursor : public Cursor {
       }
     }
 
-    if (aggregation_it_ == aggregation_.end()) return false;
+    while (results_it_ == results_.size()) {
+      if (!LoadSpilledPartition(context)) return false;
+    }
+    const auto &agg_value = *results_[results_it_++];
 
     // place aggregation values on the frame
-    auto aggregation_values_it = aggregation_it_->second.values_.begin();
+    auto aggregation_values_it = agg_value.values_.begin();
     for (const auto &aggregation_elem : self_.aggregations_)
       frame[aggregation_elem.output_sym] = *aggregation_values_it++;
 
     // place remember values on the frame
-    auto remember_values_it = aggregation_it_->second.remember_.begin();
+    auto remember_values_it = agg_value.remember_.begin();
     for (const Symbol &remember_sym : self_.remember_) frame[remember_sym] = *remember_values_it++;
 
-    aggregation_it_++;
     return true;
   }
 
@@ -3315,9 +4200,15 @@ class AggregateCursor : public Cursor {
 
   void Reset() override {
     input_cursor_->Reset();
-    aggregation_.clear();
-    aggregation_it_ = aggregation_.begin();
+    aggregation_.Clear();
+    partitions_.clear();
+    results_.clear();
+    results_it_ = 0;
     pulled_all_input_ = false;
+    spilled_partitions_.clear();
+    next_spilled_partition_ = 0;
+    spilled_groups_.reset();
+    spill_memory_.Release();
   }
 
  private:
@@ -3346,23 +4237,230 @@ class AggregateCursor : public Cursor {
     utils::pmr::vector<TSet> unique_values_;
   };
 
+  // Groups and their aggregation values. Groups keyed by a single integer,
+  // string, vertex or null value are kept in an open addressing table, which
+  // avoids allocating a vector for each key and hashing it element by
+  // element. The first key of any other type moves all the groups to the map
+  // keyed by the vector of group-by values.
+  class GroupTable {
+   public:
+    GroupTable(bool single_key, utils::MemoryResource *mem)
+        : single_key_(single_key), use_slots_(single_key), keys_(mem), values_(mem), slots_(mem), map_(mem) {}
+
+    // Returns the aggregation value of the group with the given group-by
+    // values, inserting an uninitialized one if there is none. The group-by
+    // values are moved from on insertion.
+    AggregationValue &Emplace(std::span<TypedValue> group_by) {
+      if (use_slots_) {
+        if (IsSlotKey(group_by.front())) return EmplaceSlot(group_by.front());
+        MoveToMap();
+      }
+      auto *mem = map_.get_allocator().GetMemoryResource();
+      utils::pmr::vector<TypedValue> key(mem);
+      key.reserve(group_by.size());
+      for (auto &value : group_by) key.emplace_back(std::move(value));
+      return map_.try_emplace(std::move(key), mem).first->second;
+    }
+
+    // Returns the aggregation value of the group with the given group-by
+    // values or nullptr if there is none.
+    AggregationValue *Find(std::span<const TypedValue> group_by) {
+      if (use_slots_) {
+        const auto &key = group_by.front();
+        // A key such as 2.0 may still match a group in the table, so the
+        // lookup has to be done in the map.
+        if (!IsSlotKey(key)) {
+          MoveToMap();
+        } else {
+          if (slots_.empty()) return nullptr;
+          const auto hash = TypedValue::Hash{}(key);
+          const auto mask = slots_.size() - 1;
+          for (auto pos = hash & mask;; pos = (pos + 1) & mask) {
+            const auto &slot = slots_[pos];
+            if (slot.index == 0) return nullptr;
+            if (slot.hash == hash && SameSlotKey(keys_[slot.index - 1], key)) return &values_[slot.index - 1];
+          }
+        }
+      }
+      const utils::pmr::vector<TypedValue> key(group_by.begin(), group_by.end(), utils::NewDeleteResource());
+      auto found = map_.find(key);
+      return found == map_.end() ? nullptr : &found->second;
+    }
+
+    template <typename TFunc>
+    void ForEach(const TFunc &func) {
+      for (auto &value : values_) func(value);
+      for (auto &kv : map_) func(kv.second);
+    }
+
+    void Clear() {
+      keys_.clear();
+      values_.clear();
+      slots_.clear();
+      map_.clear();
+      use_slots_ = single_key_;
+    }
+
+   private:
+    struct Slot {
+      size_t hash{0};
+      // Position of the group in keys_ and values_ increased by one, 0 for
+      // empty slots.
+      size_t index{0};
+    };
+
+    static bool IsSlotKey(const TypedValue &value) {
+      switch (value.type()) {
+        case TypedValue::Type::Null:
+        case TypedValue::Type::Int:
+        case TypedValue::Type::String:
+        case TypedValue::Type::Vertex:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    static bool SameSlotKey(const TypedValue &lhs, const TypedValue &rhs) {
+      if (lhs.type() != rhs.type()) return false;
+      switch (lhs.type()) {
+        case TypedValue::Type::Null:
+          return true;
+        case TypedValue::Type::Int:
+          return lhs.ValueInt() == rhs.ValueInt();
+        case TypedValue::Type::String:
+          return lhs.ValueString() == rhs.ValueString();
+        case TypedValue::Type::Vertex:
+          return lhs.ValueVertex() == rhs.ValueVertex();
+        default:
+          return false;
+      }
+    }
+
+    AggregationValue &EmplaceSlot(TypedValue &key) {
+      if ((values_.size() + 1) * 2 > slots_.size()) Grow();
+      const auto hash = TypedValue::Hash{}(key);
+      const auto mask = slots_.size() - 1;
+      for (auto pos = hash & mask;; pos = (pos + 1) & mask) {
+        auto &slot = slots_[pos];
+        if (slot.index == 0) {
+          slot = Slot{hash, values_.size() + 1};
+          keys_.emplace_back(std::move(key));
+          return values_.emplace_back(values_.get_allocator().GetMemoryResource());
+        }
+        if (slot.hash == hash && SameSlotKey(keys_[slot.index - 1], key)) return values_[slot.index - 1];
+      }
+    }
+
+    void Grow() {
+      utils::pmr::vector<Slot> slots(std::max<size_t>(16, slots_.size() * 2), Slot{}, slots_.get_allocator());
+      const auto mask = slots.size() - 1;
+      for (const auto &slot : slots_) {
+        if (slot.index == 0) continue;
+        auto pos = slot.hash & mask;
+        while (slots[pos].index != 0) pos = (pos + 1) & mask;
+        slots[pos] = slot;
+      }
+      slots_ = std::move(slots);
+    }
+
+    void MoveToMap() {
+      auto *mem = map_.get_allocator().GetMemoryResource();
+      for (size_t i = 0; i < values_.size(); ++i) {
+        utils::pmr::vector<TypedValue> key(mem);
+        key.emplace_back(std::move(keys_[i]));
+        map_.try_emplace(std::move(key), std::move(values_[i]));
+      }
+      keys_.clear();
+      values_.clear();
+      slots_.clear();
+      use_slots_ = false;
+    }
+
+    const bool single_key_;
+    bool use_slots_;
+    // open addressing table, groups are stored in insertion order
+    utils::pmr::vector<TypedValue> keys_;
+    utils::pmr::vector<AggregationValue> values_;
+    utils::pmr::vector<Slot> slots_;
+    // map key is the vector of group-by values
+    utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
+                              // use FNV collection hashing specialized for a
+                              // vector of TypedValues
+                              utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
+                              // custom equality
+                              TypedValueVectorEqual>
+        map_;
+  };
+
+  // Groups aggregated by a single worker in the parallel aggregation. Each
+  // partition allocates from its own memory, since the query memory can't be
+  // shared between threads. A worker can't spill in the middle of a batch, so
+  // the memory is only counted while the batch is aggregated and charged to
+  // the query memory limit by the query thread afterwards.
+  struct Partition {
+    Partition(bool single_key, utils::MemoryLimit *memory_limit)
+        : memory_limit(memory_limit), groups(single_key, &memory) {}
+
+    Partition(const Partition &) = delete;
+    Partition &operator=(const Partition &) = delete;
+    Partition(Partition &&) = delete;
+    Partition &operator=(Partition &&) = delete;
+
+    ~Partition() {
+      if (charged_bytes > 0) memory_limit->Give(charged_bytes);
+    }
+
+    // Charges the bytes allocated since the last call to the limit. Returns
+    // false if the limit doesn't have enough bytes left, in which case all
+    // that is left is taken.
+    bool Charge() {
+      const auto bytes = limited_memory.GetOwnAllocatedBytes();
+      if (!memory_limit || bytes <= charged_bytes) return true;
+      charged_bytes += memory_limit->TakeUpTo(bytes - charged_bytes);
+      return charged_bytes == bytes;
+    }
+
+    utils::MemoryLimit *memory_limit;
+    size_t charged_bytes{0};
+    // Only counts the allocated bytes.
+    utils::LimitedMemoryResource limited_memory{utils::NewDeleteResource(), nullptr};
+    utils::MonotonicBufferResource memory{8192, &limited_memory};
+    GroupTable groups;
+  };
+
+  static constexpr size_t kSpillMemoryBlockSize = 8192;
+
   const Aggregate &self_;
   const UniqueCursorPtr input_cursor_;
-  // storage for aggregated data
-  // map key is the vector of group-by values
-  // map value is an AggregationValue struct
-  utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
-                            // use FNV collection hashing specialized for a
-                            // vector of TypedValues
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
-                            // custom equality
-                            TypedValueVectorEqual>
-      aggregation_;
-  // iterator over the accumulated cache
-  decltype(aggregation_.begin()) aggregation_it_ = aggregation_.begin();
+  // counts the memory held by aggregation_ the same way as the query memory
+  // limit, it isn't limited itself
+  utils::LimitedMemoryResource aggregation_memory_;
+  // storage for aggregated data when aggregating on the query thread
+  GroupTable aggregation_;
+  // group-by values of the row being aggregated
+  utils::pmr::vector<TypedValue> group_by_;
+  // storage for aggregated data when aggregating on the workers
+  std::vector<std::unique_ptr<Partition>> partitions_;
+  // partitions_ has 2^partition_bits_ elements if it isn't empty
+  size_t partition_bits_{0};
+  // all the groups, gathered once the input is exhausted
+  utils::pmr::vector<AggregationValue *> results_;
+  // position of the next group to yield in results_
+  size_t results_it_{0};
   // this LogicalOp pulls all from the input on it's first pull
   // this switch tracks if this has been performed
   bool pulled_all_input_{false};
+  // Once aggregation_ or partitions_ outgrow the spill memory limit, rows of
+  // groups which aren't in them are written to these files, split by the hash
+  // of their group-by values. Empty if nothing is spilled.
+  std::vector<std::unique_ptr<SpillFile>> spilled_partitions_;
+  size_t next_spilled_partition_{0};
+  // row being spilled
+  std::vector<TypedValue> spill_row_;
+  // groups of the spilled partition being yielded
+  utils::MonotonicBufferResource spill_memory_;
+  std::optional<GroupTable> spilled_groups_;
 
   /**
    * Pulls from the input operator until exhausted and aggregates the
@@ -3376,19 +4474,39 @@ class AggregateCursor : public Cursor {
   void ProcessAll(Frame *frame, ExecutionContext *context) {
     ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
                                   storage::View::NEW);
-    while (input_cursor_->Pull(*frame, *context)) {
-      ProcessOne(*frame, &evaluator);
+    auto *pool = context->aggregation_worker_pool;
+    if (pool && !self_.group_by_.empty()) {
+      ProcessAllPartitioned(frame, context, &evaluator, pool);
+    } else {
+      while (input_cursor_->Pull(*frame, *context)) {
+        if (!spilled_partitions_.empty()) {
+          ProcessOneSpilling(*frame, &evaluator, *context);
+          continue;
+        }
+        ProcessOne(*frame, &evaluator);
+        // Without grouping there's a single group, which can't be spilled.
+        if (!self_.group_by_.empty() && MustSpill(*context, aggregation_memory_.GetAllocatedBytes())) {
+          spilled_partitions_.resize(kAggregationSpillPartitions);
+        }
+      }
     }
 
-    // calculate AVG aggregations (so far they have only been summed)
+    results_.clear();
+    auto collect = [this](AggregationValue &agg_value) { results_.push_back(&agg_value); };
+    aggregation_.ForEach(collect);
+    for (auto &partition : partitions_) partition->groups.ForEach(collect);
+    FinishAverages(context->evaluation_context.memory);
+  }
+
+  // calculate AVG aggregations in results_ (so far they have only been
+  // summed)
+  void FinishAverages(utils::MemoryResource *pull_memory) {
     for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
       if (self_.aggregations_[pos].op != Aggregation::Op::AVG) continue;
-      for (auto &kv : aggregation_) {
-        AggregationValue &agg_value = kv.second;
-        auto count = agg_value.counts_[pos];
-        auto *pull_memory = context->evaluation_context.memory;
+      for (auto *agg_value : results_) {
+        auto count = agg_value->counts_[pos];
         if (count > 0) {
-          agg_value.values_[pos] = agg_value.values_[pos] / TypedValue(static_cast<double>(count), pull_memory);
+          agg_value->values_[pos] = agg_value->values_[pos] / TypedValue(static_cast<double>(count), pull_memory);
         }
       }
     }
@@ -3398,22 +4516,312 @@ class AggregateCursor : public Cursor {
    * Performs a single accumulation.
    */
   void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator) {
-    auto *mem = aggregation_.get_allocator().GetMemoryResource();
-    utils::pmr::vector<TypedValue> group_by(mem);
-    group_by.reserve(self_.group_by_.size());
+    group_by_.clear();
+    for (Expression *expression : self_.group_by_) {
+      group_by_.emplace_back(expression->Accept(*evaluator));
+    }
+    auto &agg_value = aggregation_.Emplace(group_by_);
+    EnsureInitialized(&agg_value, [&](size_t pos) -> const TypedValue & { return frame[self_.remember_[pos]]; });
+    Update(
+        &agg_value, [&](size_t pos) { return self_.aggregations_[pos].value->Accept(*evaluator); },
+        [&](size_t pos) { return self_.aggregations_[pos].key->Accept(*evaluator); });
+  }
+
+  /**
+   * Performs a single accumulation once the groups don't fit in memory.
+   * Rows of groups in aggregation_ or partitions_ are still aggregated there,
+   * the others are written to one of the spilled partitions, which keeps each
+   * group either entirely in memory or entirely on disk.
+   */
+  void ProcessOneSpilling(const Frame &frame, ExpressionEvaluator *evaluator, const ExecutionContext &context) {
+    spill_row_.clear();
+    AppendRow(frame, evaluator, &spill_row_);
+    const std::span<TypedValue> group_by(spill_row_.data(), self_.group_by_.size());
+    const auto hash = HashGroupBy(group_by);
+    auto *partition = partitions_.empty() ? nullptr : partitions_[AggregationPartition(hash, partition_bits_)].get();
+    auto &groups = partition ? partition->groups : aggregation_;
+    if (auto *agg_value = groups.Find(group_by)) {
+      UpdateFromRow(agg_value, spill_row_.data() + group_by.size());
+      // The limit is already exceeded, so the rest of the input is spilled
+      // regardless.
+      if (partition) partition->Charge();
+      return;
+    }
+    auto &file = spilled_partitions_[AggregationPartition(hash, kAggregationSpillPartitionBits)];
+    if (!file) file = std::make_unique<SpillFile>(context.spill_directory);
+    file->Write(spill_row_);
+  }
+
+  struct LabelScan {
+    Symbol symbol;
+    storage::LabelId label;
+    storage::View view;
+  };
+
+  // Returns the scan which is the input of the aggregation, if the input is a
+  // scan of all vertices with a single label, either through the label index
+  // or by filtering all vertices.
+  std::optional<LabelScan> LabelScanInput(const ExecutionContext &context) const {
+    const auto *input = self_.input_.get();
+    if (input->GetTypeInfo() == ScanAllByLabel::kType) {
+      const auto *scan = static_cast<const ScanAllByLabel *>(input);
+      if (scan->input_->GetTypeInfo() != Once::kType) return std::nullopt;
+      return LabelScan{scan->output_symbol_, scan->label_, scan->view_};
+    }
+    if (input->GetTypeInfo() != Filter::kType) return std::nullopt;
+    const auto *filter = static_cast<const Filter *>(input);
+    const auto *labels_test = utils::Downcast<LabelsTest>(filter->expression_);
+    if (!filter->pattern_filters_.empty() || !labels_test || labels_test->labels_.size() != 1) return std::nullopt;
+    if (filter->input_->GetTypeInfo() != ScanAll::kType) return std::nullopt;
+    const auto *scan = static_cast<const ScanAll *>(filter->input_.get());
+    const auto *identifier = utils::Downcast<Identifier>(labels_test->expression_);
+    if (scan->input_->GetTypeInfo() != Once::kType || !identifier ||
+        context.symbol_table.at(*identifier) != scan->output_symbol_) {
+      return std::nullopt;
+    }
+    return LabelScan{scan->output_symbol_, context.evaluation_context.labels[labels_test->labels_[0].ix],
+                     scan->view_};
+  }
+
+  /**
+   * Aggregations without grouping over all vertices with a label, whose values
+   * are properties of the scanned vertex kept in property columns, are
+   * computed from the columns without pulling the input. Places the results on
+   * the frame and returns true if it did so.
+   */
+  bool AggregateFromPropertyColumns(Frame *frame, ExecutionContext *context) {
+    if (!self_.group_by_.empty() || !self_.remember_.empty() || self_.aggregations_.empty()) return false;
+#ifdef MG_ENTERPRISE
+    // Fine-grained access control may hide some of the scanned vertices.
+    if (license::global_license_checker.IsEnterpriseValidFast() && context->auth_checker) return false;
+#endif
+    auto scan = LabelScanInput(*context);
+    if (!scan) return false;
+
+    std::vector<storage::PropertyId> properties;
+    for (const auto &aggregation : self_.aggregations_) {
+      if (aggregation.distinct || aggregation.key) return false;
+      if (!aggregation.value) {
+        // Only COUNT(*) has no value.
+        if (aggregation.op != Aggregation::Op::COUNT) return false;
+        continue;
+      }
+      switch (aggregation.op) {
+        case Aggregation::Op::COUNT:
+        case Aggregation::Op::SUM:
+        case Aggregation::Op::AVG:
+        case Aggregation::Op::MIN:
+        case Aggregation::Op::MAX:
+          break;
+        case Aggregation::Op::COLLECT_LIST:
+        case Aggregation::Op::COLLECT_MAP:
+        case Aggregation::Op::PROJECT:
+          return false;
+      }
+      const auto *lookup = utils::Downcast<PropertyLookup>(aggregation.value);
+      const auto *identifier = lookup ? utils::Downcast<Identifier>(lookup->expression_) : nullptr;
+      if (!identifier || context->symbol_table.at(*identifier) != scan->symbol) return false;
+      properties.push_back(context->evaluation_context.properties[lookup->property_.ix]);
+    }
+    if (properties.empty()) return false;
+
+    std::map<storage::PropertyId, storage::PropertyColumnSummary> summaries;
+    for (auto property : properties) {
+      if (summaries.contains(property)) continue;
+      auto summary = context->db_accessor->SummarizePropertyColumn(scan->view, scan->label, property);
+      if (!summary) return false;
+      summaries.emplace(property, *summary);
+    }
+
+    auto *memory = context->evaluation_context.memory;
+    auto properties_it = properties.begin();
+    for (const auto &aggregation : self_.aggregations_) {
+      auto &output = (*frame)[aggregation.output_sym];
+      if (!aggregation.value) {
+        // Every column holds all the vertices with the label, whether they
+        // have the property or not.
+        output = TypedValue(summaries.begin()->second.vertex_count, memory);
+        continue;
+      }
+      const auto &summary = summaries.at(*properties_it++);
+      switch (aggregation.op) {
+        case Aggregation::Op::COUNT:
+          output = TypedValue(summary.value_count, memory);
+          break;
+        case Aggregation::Op::SUM:
+          if (summary.double_count == 0) {
+            output = TypedValue(summary.int_sum, memory);
+          } else {
+            output = TypedValue(static_cast<double>(summary.int_sum) + summary.double_sum, memory);
+          }
+          break;
+        case Aggregation::Op::AVG:
+          if (summary.value_count == 0) {
+            output = TypedValue(memory);
+          } else {
+            output = TypedValue((static_cast<double>(summary.int_sum) + summary.double_sum) /
+                                    static_cast<double>(summary.value_count),
+                                memory);
+          }
+          break;
+        case Aggregation::Op::MIN:
+          if (summary.int_min && (!summary.double_min || static_cast<double>(*summary.int_min) <= *summary.double_min)) {
+            output = TypedValue(*summary.int_min, memory);
+          } else if (summary.double_min) {
+            output = TypedValue(*summary.double_min, memory);
+          } else {
+            output = TypedValue(memory);
+          }
+          break;
+        case Aggregation::Op::MAX:
+          if (summary.int_max && (!summary.double_max || static_cast<double>(*summary.int_max) >= *summary.double_max)) {
+            output = TypedValue(*summary.int_max, memory);
+          } else if (summary.double_max) {
+            output = TypedValue(*summary.double_max, memory);
+          } else {
+            output = TypedValue(memory);
+          }
+          break;
+        case Aggregation::Op::COLLECT_LIST:
+        case Aggregation::Op::COLLECT_MAP:
+        case Aggregation::Op::PROJECT:
+          LOG_FATAL("Unexpected aggregation over a property column");
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Aggregates the next non-empty spilled partition into results_. Returns
+   * false if there are no more partitions.
+   */
+  bool LoadSpilledPartition(ExecutionContext &context) {
+    results_.clear();
+    results_it_ = 0;
+    spilled_groups_.reset();
+    spill_memory_.Release();
+    while (next_spilled_partition_ < spilled_partitions_.size()) {
+      auto file = std::move(spilled_partitions_[next_spilled_partition_++]);
+      if (!file) continue;
+      if (MustAbort(context)) throw HintedAbortError();
+
+      auto &groups = spilled_groups_.emplace(self_.group_by_.size() == 1, &spill_memory_);
+      utils::pmr::vector<TypedValue> row(utils::NewDeleteResource());
+      file->StartReading();
+      while (file->Read(&row, context.db_accessor)) AggregateRow(&groups, row.data());
+
+      groups.ForEach([this](AggregationValue &agg_value) { results_.push_back(&agg_value); });
+      FinishAverages(context.evaluation_context.memory);
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * Appends the group-by values, the input value and the map key of each
+   * aggregation and the remember values of the current input row to `row`.
+   * Aggregating the row later with AggregateRow doesn't need the frame.
+   */
+  void AppendRow(const Frame &frame, ExpressionEvaluator *evaluator, std::vector<TypedValue> *row) const {
     for (Expression *expression : self_.group_by_) {
-      group_by.emplace_back(expression->Accept(*evaluator));
+      row->emplace_back(expression->Accept(*evaluator));
     }
-    auto &agg_value = aggregation_.try_emplace(std::move(group_by), mem).first->second;
-    EnsureInitialized(frame, &agg_value);
-    Update(evaluator, &agg_value);
+    for (const auto &agg_elem : self_.aggregations_) {
+      // COUNT(*) has no input expression and only COLLECT_MAP has a key
+      const bool has_input =
+          !row->emplace_back(agg_elem.value ? agg_elem.value->Accept(*evaluator) : TypedValue()).IsNull();
+      row->emplace_back(agg_elem.key && has_input ? agg_elem.key->Accept(*evaluator) : TypedValue());
+    }
+    for (const Symbol &remember_sym : self_.remember_) row->emplace_back(frame[remember_sym]);
+  }
+
+  size_t RowSize() const { return self_.group_by_.size() + 2 * self_.aggregations_.size() + self_.remember_.size(); }
+
+  /** Aggregates a row made by AppendRow. The group-by values are moved from. */
+  void AggregateRow(GroupTable *groups, TypedValue *row) const {
+    const auto num_group_by = self_.group_by_.size();
+    auto &agg_value = groups->Emplace(std::span(row, num_group_by));
+    UpdateFromRow(&agg_value, row + num_group_by);
+  }
+
+  void UpdateFromRow(AggregationValue *agg_value, const TypedValue *inputs) const {
+    const auto num_aggregations = self_.aggregations_.size();
+    EnsureInitialized(agg_value,
+                      [&](size_t pos) -> const TypedValue & { return inputs[2 * num_aggregations + pos]; });
+    Update(
+        agg_value, [&](size_t pos) -> const TypedValue & { return inputs[2 * pos]; },
+        [&](size_t pos) -> const TypedValue & { return inputs[2 * pos + 1]; });
+  }
+
+  /**
+   * Evaluates the input rows on the query thread and hands them in batches
+   * to the aggregation workers. Rows are split into partitions by the hash of
+   * their group-by values, so each group is aggregated by a single worker
+   * and no merging of the partial results is needed.
+   *
+   * The partitions are charged to the query memory limit after each batch.
+   * Once they take as much memory as is left in the limit, or the limit can't
+   * hold them at all, the groups that aren't in them yet are spilled like
+   * when aggregating on the query thread, which leaves room for aggregating a
+   * spilled partition later.
+   */
+  void ProcessAllPartitioned(Frame *frame, ExecutionContext *context, ExpressionEvaluator *evaluator,
+                             utils::ThreadPool *pool) {
+    const auto num_group_by = self_.group_by_.size();
+    const auto row_size = RowSize();
+
+    const auto num_partitions = std::bit_ceil(std::max<size_t>(pool->Size() * kAggregationPartitionsPerWorker, 2));
+    partition_bits_ = std::countr_zero(num_partitions);
+    partitions_.clear();
+    for (size_t i = 0; i < num_partitions; ++i) {
+      partitions_.push_back(std::make_unique<Partition>(num_group_by == 1, context->memory_limit));
+    }
+    std::vector<TypedValue> batch;
+    batch.reserve(kAggregationBatchSize * row_size);
+    std::vector<std::vector<size_t>> partition_rows(num_partitions);
+
+    auto aggregate_batch = [&] {
+      utils::ParallelFor(pool, num_partitions, [&](size_t partition) {
+        auto &groups = partitions_[partition]->groups;
+        for (auto row : partition_rows[partition]) AggregateRow(&groups, &batch[row * row_size]);
+      });
+      batch.clear();
+      for (auto &rows : partition_rows) rows.clear();
+      bool charged = true;
+      for (auto &partition : partitions_) charged &= partition->Charge();
+      if (!charged || MustSpill(*context, PartitionsAllocatedBytes())) {
+        spilled_partitions_.resize(kAggregationSpillPartitions);
+      }
+    };
+
+    while (input_cursor_->Pull(*frame, *context)) {
+      if (!spilled_partitions_.empty()) {
+        ProcessOneSpilling(*frame, evaluator, *context);
+        continue;
+      }
+      const auto row = batch.size() / row_size;
+      AppendRow(*frame, evaluator, &batch);
+
+      const auto hash = HashGroupBy(std::span<const TypedValue>(&batch[row * row_size], num_group_by));
+      partition_rows[AggregationPartition(hash, partition_bits_)].push_back(row);
+      if (row + 1 == kAggregationBatchSize) aggregate_batch();
+    }
+    if (!batch.empty()) aggregate_batch();
+  }
+
+  size_t PartitionsAllocatedBytes() const {
+    size_t bytes = 0;
+    for (const auto &partition : partitions_) bytes += partition->limited_memory.GetOwnAllocatedBytes();
+    return bytes;
   }
 
   /** Ensures the new AggregationValue has been initialized. This means
    * that the value vectors are filled with an appropriate number of Nulls,
    * counts are set to 0 and remember values are remembered.
+   * `remember_at(pos)` returns the value of the remember symbol at `pos`.
    */
-  void EnsureInitialized(const Frame &frame, AggregateCursor::AggregationValue *agg_value) const {
+  template <typename TRemember>
+  void EnsureInitialized(AggregateCursor::AggregationValue *agg_value, const TRemember &remember_at) const {
     if (!agg_value->values_.empty()) return;
 
     for (const auto &agg_elem : self_.aggregations_) {
@@ -3423,12 +4831,15 @@ class AggregateCursor : public Cursor {
     }
     agg_value->counts_.resize(self_.aggregations_.size(), 0);
 
-    for (const Symbol &remember_sym : self_.remember_) agg_value->remember_.push_back(frame[remember_sym]);
+    for (size_t pos = 0; pos < self_.remember_.size(); ++pos) agg_value->remember_.push_back(remember_at(pos));
   }
 
   /** Updates the given AggregationValue with new data. Assumes that
-   * the AggregationValue has been initialized */
-  void Update(ExpressionEvaluator *evaluator, AggregateCursor::AggregationValue *agg_value) {
+   * the AggregationValue has been initialized. `input_at(pos)` and
+   * `key_at(pos)` return the input value and the map key of the aggregation
+   * at `pos`. */
+  template <typename TInput, typename TKey>
+  void Update(AggregateCursor::AggregationValue *agg_value, const TInput &input_at, const TKey &key_at) const {
     DMG_ASSERT(self_.aggregations_.size() == agg_value->values_.size(),
                "Expected as much AggregationValue.values_ as there are "
                "aggregations.");
@@ -3450,7 +4861,8 @@ class AggregateCursor : public Cursor {
         continue;
       }
 
-      TypedValue input_value = input_expr_ptr->Accept(*evaluator);
+      const auto pos = agg_elem_it - self_.aggregations_.begin();
+      const TypedValue &input_value = input_at(pos);
 
       // Aggregations skip Null input values.
       if (input_value.IsNull()) continue;
@@ -3487,7 +4899,7 @@ class AggregateCursor : public Cursor {
             break;
           }
           case Aggregation::Op::COLLECT_MAP:
-            auto key = agg_elem_it->key->Accept(*evaluator);
+            const TypedValue &key = key_at(pos);
             if (key.type() != TypedValue::Type::String) throw QueryRuntimeException("Map key must be a string.");
             value_it->ValueMap().emplace(key.ValueString(), input_value);
             break;
@@ -3540,7 +4952,7 @@ class AggregateCursor : public Cursor {
           break;
         }
         case Aggregation::Op::COLLECT_MAP:
-          auto key = agg_elem_it->key->Accept(*evaluator);
+          const TypedValue &key = key_at(pos);
           if (key.type() != TypedValue::Type::String) throw QueryRuntimeException("Map key must be a string.");
           value_it->ValueMap().emplace(key.ValueString(), input_value);
           break;
@@ -3729,7 +5141,11 @@ std::vector<Symbol> OrderBy::ModifiedSymbols(const SymbolTable &table) const { r
 class OrderByCursor : public Cursor {
  public:
   OrderByCursor(const OrderBy &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), cache_(mem) {}
+      : self_(self),
+        input_cursor_(self_.input_->MakeCursor(mem)),
+        cache_(mem),
+        run_memory_(kRunMemoryBlockSize),
+        run_memory_counter_(&run_memory_, std::numeric_limits<size_t>::max()) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("OrderBy");
@@ -3737,7 +5153,10 @@ class OrderByCursor : public Cursor {
     if (!did_pull_all_) {
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                     storage::View::OLD);
-      auto *mem = cache_.get_allocator().GetMemoryResource();
+      // When the cache may be spilled, its rows are allocated separately so
+      // the memory can be released once they are written to disk.
+      const auto may_spill = MaySpill(context);
+      auto *mem = may_spill ? &run_memory_counter_ : cache_.get_allocator().GetMemoryResource();
       while (input_cursor_->Pull(frame, context)) {
         // collect the order_by elements
         utils::pmr::vector<TypedValue> order_by(mem);
@@ -3752,16 +5171,23 @@ class OrderByCursor : public Cursor {
         for (const Symbol &output_sym : self_.output_symbols_) output.emplace_back(frame[output_sym]);
 
         cache_.push_back(Element{std::move(order_by), std::move(output)});
+
+        if (may_spill) {
+          const auto cache_memory = run_memory_counter_.GetAllocatedBytes() + cache_.capacity() * sizeof(Element);
+          if (MustSpill(context, cache_memory)) SpillRun(context);
+        }
       }
 
-      std::sort(cache_.begin(), cache_.end(), [this](const auto &pair1, const auto &pair2) {
-        return self_.compare_(pair1.order_by, pair2.order_by);
-      });
+      SortCache();
 
       did_pull_all_ = true;
       cache_it_ = cache_.begin();
+
+      if (!runs_.empty()) StartMerge(context);
     }
 
+    if (!runs_.empty()) return PullMerged(frame, context);
+
     if (cache_it_ == cache_.end()) return false;
 
     if (MustAbort(context)) throw HintedAbortError();
@@ -3783,14 +5209,96 @@ class OrderByCursor : public Cursor {
     did_pull_all_ = false;
     cache_.clear();
     cache_it_ = cache_.begin();
+    runs_.clear();
+    merge_heap_.clear();
+    run_memory_.Release();
   }
 
  private:
+  static constexpr size_t kRunMemoryBlockSize = 8192;
+
   struct Element {
     utils::pmr::vector<TypedValue> order_by;
     utils::pmr::vector<TypedValue> remember;
   };
 
+  // Sorted run of elements written to disk, along with the element of the
+  // run which is next in the merge.
+  struct SpilledRun {
+    explicit SpilledRun(std::unique_ptr<SpillFile> file)
+        : file(std::move(file)),
+          current{utils::pmr::vector<TypedValue>(utils::NewDeleteResource()),
+                  utils::pmr::vector<TypedValue>(utils::NewDeleteResource())} {}
+
+    bool Advance(DbAccessor *dba) { return file->Read(&current.order_by, dba) && file->Read(&current.remember, dba); }
+
+    std::unique_ptr<SpillFile> file;
+    Element current;
+  };
+
+  void SortCache() {
+    std::sort(cache_.begin(), cache_.end(), [this](const auto &pair1, const auto &pair2) {
+      return self_.compare_(pair1.order_by, pair2.order_by);
+    });
+  }
+
+  // Sorts the cached elements and writes them to a new run on disk.
+  void SpillRun(const ExecutionContext &context) {
+    SortCache();
+    auto file = std::make_unique<SpillFile>(context.spill_directory);
+    for (const auto &element : cache_) {
+      file->Write(element.order_by);
+      file->Write(element.remember);
+    }
+    runs_.emplace_back(std::move(file));
+    cache_.clear();
+    run_memory_.Release();
+  }
+
+  // The runs on disk and the cache, which holds the rest of the elements,
+  // are merged with a heap of positions in runs_. The position runs_.size()
+  // stands for the cache.
+  const Element &MergeHead(size_t source) const {
+    return source == runs_.size() ? *cache_it_ : runs_[source].current;
+  }
+
+  auto MergeHeapCompare() const {
+    // std heap functions keep the largest element on top, so the comparison
+    // is reversed.
+    return [this](size_t lhs, size_t rhs) { return self_.compare_(MergeHead(rhs).order_by, MergeHead(lhs).order_by); };
+  }
+
+  void StartMerge(const ExecutionContext &context) {
+    merge_heap_.clear();
+    for (size_t i = 0; i < runs_.size(); ++i) {
+      runs_[i].file->StartReading();
+      if (runs_[i].Advance(context.db_accessor)) merge_heap_.push_back(i);
+    }
+    if (cache_it_ != cache_.end()) merge_heap_.push_back(runs_.size());
+    std::make_heap(merge_heap_.begin(), merge_heap_.end(), MergeHeapCompare());
+  }
+
+  bool PullMerged(Frame &frame, ExecutionContext &context) {
+    if (merge_heap_.empty()) return false;
+
+    if (MustAbort(context)) throw HintedAbortError();
+
+    std::pop_heap(merge_heap_.begin(), merge_heap_.end(), MergeHeapCompare());
+    const auto source = merge_heap_.back();
+    merge_heap_.pop_back();
+
+    auto output_sym_it = self_.output_symbols_.begin();
+    for (const TypedValue &output : MergeHead(source).remember) frame[*output_sym_it++] = output;
+
+    const bool has_next =
+        source == runs_.size() ? ++cache_it_ != cache_.end() : runs_[source].Advance(context.db_accessor);
+    if (has_next) {
+      merge_heap_.push_back(source);
+      std::push_heap(merge_heap_.begin(), merge_heap_.end(), MergeHeapCompare());
+    }
+    return true;
+  }
+
   const OrderBy &self_;
   const UniqueCursorPtr input_cursor_;
   bool did_pull_all_{false};
@@ -3799,6 +5307,14 @@ class OrderByCursor : public Cursor {
   utils::pmr::vector<Element> cache_;
   // iterator over the cache_, maintains state between Pulls
   decltype(cache_.begin()) cache_it_ = cache_.begin();
+  // memory of the cached elements when they may be spilled
+  utils::MonotonicBufferResource run_memory_;
+  // counts the memory of the cached elements the same way as the query memory
+  // limit, it isn't limited itself
+  utils::LimitedMemoryResource run_memory_counter_;
+  // sorted runs spilled to disk
+  std::vector<SpilledRun> runs_;
+  std::vector<size_t> merge_heap_;
 };
 
 UniqueCursorPtr OrderBy::MakeCursor(utils::MemoryResource *mem) const {
@@ -4035,18 +5551,56 @@ UniqueCursorPtr Unwind::MakeCursor(utils::MemoryResource *mem) const {
 class DistinctCursor : public Cursor {
  public:
   DistinctCursor(const Distinct &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), seen_rows_(mem) {}
+      : self_(self),
+        input_cursor_(self.input_->MakeCursor(mem)),
+        seen_rows_memory_(mem, std::numeric_limits<size_t>::max()),
+        seen_rows_(&seen_rows_memory_),
+        spill_memory_(kSpillMemoryBlockSize) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("Distinct");
 
-    while (true) {
-      if (!input_cursor_->Pull(frame, context)) return false;
+    while (!pulled_all_input_) {
+      if (!input_cursor_->Pull(frame, context)) {
+        pulled_all_input_ = true;
+        break;
+      }
+
+      if (!spilled_partitions_.empty()) {
+        SpillRow(frame, context);
+        continue;
+      }
 
       utils::pmr::vector<TypedValue> row(seen_rows_.get_allocator().GetMemoryResource());
       row.reserve(self_.value_symbols_.size());
       for (const auto &symbol : self_.value_symbols_) row.emplace_back(frame[symbol]);
-      if (seen_rows_.insert(std::move(row)).second) return true;
+      if (seen_rows_.insert(std::move(row)).second) {
+        if (MustSpill(context, seen_rows_memory_.GetAllocatedBytes())) {
+          spilled_partitions_.resize(kDistinctSpillPartitions);
+        }
+        return true;
+      }
+    }
+
+    // Yield the rows which were spilled, one partition at a time.
+    utils::pmr::vector<TypedValue> row(utils::NewDeleteResource());
+    while (true) {
+      if (current_partition_ && current_partition_->Read(&row, context.db_accessor)) {
+        utils::pmr::vector<TypedValue> partition_row(row.begin(), row.end(), &spill_memory_);
+        if (!partition_rows_->insert(std::move(partition_row)).second) continue;
+        for (size_t i = 0; i < self_.value_symbols_.size(); ++i) frame[self_.value_symbols_[i]] = std::move(row[i]);
+        return true;
+      }
+      current_partition_.reset();
+      partition_rows_.reset();
+      spill_memory_.Release();
+      while (!current_partition_ && next_spilled_partition_ < spilled_partitions_.size()) {
+        current_partition_ = std::move(spilled_partitions_[next_spilled_partition_++]);
+      }
+      if (!current_partition_) return false;
+      if (MustAbort(context)) throw HintedAbortError();
+      current_partition_->StartReading();
+      partition_rows_.emplace(&spill_memory_);
     }
   }
 
@@ -4055,18 +5609,56 @@ class DistinctCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     seen_rows_.clear();
+    pulled_all_input_ = false;
+    spilled_partitions_.clear();
+    next_spilled_partition_ = 0;
+    current_partition_.reset();
+    partition_rows_.reset();
+    spill_memory_.Release();
   }
 
  private:
+  // use FNV collection hashing specialized for a vector of TypedValue
+  using RowHash = utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>;
+  using RowSet = utils::pmr::unordered_set<utils::pmr::vector<TypedValue>, RowHash, TypedValueVectorEqual>;
+
+  static constexpr size_t kDistinctSpillPartitions = 16;
+  static constexpr size_t kSpillMemoryBlockSize = 8192;
+
+  /**
+   * Handles the current row once seen_rows_ doesn't fit in memory. Rows
+   * which weren't seen yet are spilled to be deduplicated and yielded after
+   * the input is exhausted.
+   */
+  void SpillRow(const Frame &frame, const ExecutionContext &context) {
+    utils::pmr::vector<TypedValue> row(utils::NewDeleteResource());
+    row.reserve(self_.value_symbols_.size());
+    for (const auto &symbol : self_.value_symbols_) row.emplace_back(frame[symbol]);
+    if (seen_rows_.contains(row)) return;
+    // Equal rows always end up in the same partition, so each partition can
+    // be deduplicated on its own.
+    auto &file = spilled_partitions_[RowHash{}(row) % kDistinctSpillPartitions];
+    if (!file) file = std::make_unique<SpillFile>(context.spill_directory);
+    file->Write(row);
+  }
+
   const Distinct &self_;
   const UniqueCursorPtr input_cursor_;
+  // counts the memory held by seen_rows_ the same way as the query memory
+  // limit, it isn't limited itself
+  utils::LimitedMemoryResource seen_rows_memory_;
   // a set of already seen rows
-  utils::pmr::unordered_set<utils::pmr::vector<TypedValue>,
-                            // use FNV collection hashing specialized for a
-                            // vector of TypedValue
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
-                            TypedValueVectorEqual>
-      seen_rows_;
+  RowSet seen_rows_;
+  bool pulled_all_input_{false};
+  // Once seen_rows_ outgrows the spill memory limit, rows which aren't in it
+  // are written to these files, split by their hash, and yielded after the
+  // input is exhausted. Empty if nothing is spilled.
+  std::vector<std::unique_ptr<SpillFile>> spilled_partitions_;
+  size_t next_spilled_partition_{0};
+  std::unique_ptr<SpillFile> current_partition_;
+  // rows of the current spilled partition yielded so far
+  utils::MonotonicBufferResource spill_memory_;
+  std::optional<RowSet> partition_rows_;
 };
 
 Distinct::Distinct(const std::shared_ptr<LogicalOperator> &input, const std::vector<Symbol> &value_symbols)
@@ -4384,36 +5976,53 @@ std::unordered_map<std::string, int64_t> CallProcedure::GetAndResetCounters() {
 
 namespace {
 
-void CallCustomProcedure(const std::string_view fully_qualified_procedure_name, const mgp_proc &proc,
-                         const std::vector<Expression *> &args, mgp_graph &graph, ExpressionEvaluator *evaluator,
-                         utils::MemoryResource *memory, std::optional<size_t> memory_limit, mgp_result *result) {
+/// Evaluates the arguments of the procedure. If the first argument is a graph,
+/// `graph` is switched to that subgraph, which is kept in `subgraph` and
+/// `subgraph_accessor`, so they have to outlive the use of `graph`. The
+/// subgraph is allocated with `subgraph_memory`.
+void EvaluateProcedureArguments(const std::string_view fully_qualified_procedure_name, const mgp_proc &proc,
+                                const std::vector<Expression *> &args, mgp_graph &graph,
+                                ExpressionEvaluator *evaluator, utils::MemoryResource *subgraph_memory,
+                                std::optional<query::Graph> &subgraph,
+                                std::optional<query::SubgraphDbAccessor> &subgraph_accessor, mgp_list &proc_args) {
   static_assert(std::uses_allocator_v<mgp_value, utils::Allocator<mgp_value>>,
                 "Expected mgp_value to use custom allocator and makes STL "
                 "containers aware of that");
   // Build and type check procedure arguments.
-  mgp_list proc_args(memory);
   std::vector<TypedValue> args_list;
   args_list.reserve(args.size());
   for (auto *expression : args) {
     args_list.emplace_back(expression->Accept(*evaluator));
   }
-  std::optional<query::Graph> subgraph;
-  std::optional<query::SubgraphDbAccessor> db_acc;
 
   if (!args_list.empty() && args_list.front().type() == TypedValue::Type::Graph) {
     auto subgraph_value = args_list.front().ValueGraph();
-    subgraph = query::Graph(std::move(subgraph_value), subgraph_value.GetMemoryResource());
+    subgraph.emplace(std::move(subgraph_value), subgraph_memory);
     args_list.erase(args_list.begin());
 
-    db_acc = query::SubgraphDbAccessor(*std::get<query::DbAccessor *>(graph.impl), &*subgraph);
-    graph.impl = &*db_acc;
+    subgraph_accessor = query::SubgraphDbAccessor(*std::get<query::DbAccessor *>(graph.impl), &*subgraph);
+    graph.impl = &*subgraph_accessor;
   }
 
   procedure::ConstructArguments(args_list, proc, fully_qualified_procedure_name, proc_args, graph);
+}
+
+void CallCustomProcedure(const std::string_view fully_qualified_procedure_name, const mgp_proc &proc,
+                         const std::vector<Expression *> &args, mgp_graph &graph, ExpressionEvaluator *evaluator,
+                         utils::MemoryResource *memory, std::optional<size_t> memory_limit, mgp_result *result) {
+  mgp_list proc_args(memory);
+  std::optional<query::Graph> subgraph;
+  std::optional<query::SubgraphDbAccessor> db_acc;
+  EvaluateProcedureArguments(fully_qualified_procedure_name, proc, args, graph, evaluator, memory, subgraph, db_acc,
+                             proc_args);
   if (memory_limit) {
     SPDLOG_INFO("Running '{}' with memory limit of {}", fully_qualified_procedure_name,
                 utils::GetReadableSize(*memory_limit));
-    utils::LimitedMemoryResource limited_mem(memory, *memory_limit);
+    // The limit is shared with the arenas of the parallel workers of the
+    // procedure.
+    utils::MemoryLimit procedure_memory_limit(*memory_limit);
+    utils::LimitedMemoryResource limited_mem(memory, &procedure_memory_limit);
+    graph.procedure_memory_limit = &procedure_memory_limit;
     mgp_memory proc_memory{&limited_mem};
     MG_ASSERT(result->signature == &proc.results);
     // TODO: What about cross library boundary exceptions? OMG C++?!
@@ -4432,14 +6041,55 @@ void CallCustomProcedure(const std::string_view fully_qualified_procedure_name,
   }
 }
 
+/// Call of a batched procedure, which spans multiple pulls. Everything the
+/// procedure may keep in its state lives here until the call is cleaned up.
+struct BatchedProcedureCall {
+  BatchedProcedureCall(const mgp_proc *proc, mgp_graph graph, std::optional<size_t> memory_limit,
+                       utils::MemoryLimit *query_memory_limit)
+      : query_memory(utils::NewDeleteResource(), query_memory_limit),
+        pool_memory(128, 1024, &query_memory, &query_memory),
+        graph(graph),
+        proc(proc) {
+    if (memory_limit) {
+      procedure_memory_limit.emplace(*memory_limit);
+      limited_memory.emplace(&pool_memory, &*procedure_memory_limit);
+      this->graph.procedure_memory_limit = &*procedure_memory_limit;
+    }
+    memory.impl = limited_memory ? static_cast<utils::MemoryResource *>(&*limited_memory) : &pool_memory;
+  }
+
+  // The memory of the call is counted against the memory limit of the query,
+  // just like the memory of the pulls.
+  utils::LimitedMemoryResource query_memory;
+  utils::PoolResource pool_memory;
+  // Shared with the arenas of the parallel workers of the procedure.
+  std::optional<utils::MemoryLimit> procedure_memory_limit;
+  std::optional<utils::LimitedMemoryResource> limited_memory;
+  mgp_memory memory{nullptr};
+  std::optional<query::Graph> subgraph;
+  std::optional<query::SubgraphDbAccessor> subgraph_accessor;
+  mgp_graph graph;
+  const mgp_proc *proc;
+  void *state{nullptr};
+  // Guards the state against the clean up done by the module when it's closed
+  // while the call is still running.
+  std::mutex lock;
+  bool cleaned_up{false};
+};
+
 }  // namespace
 
 class CallProcedureCursor : public Cursor {
   const CallProcedure *self_;
   UniqueCursorPtr input_cursor_;
+  // Records are released once they're pulled, and a pool reuses their memory
+  // for the following records. That keeps the memory of batched procedures
+  // bounded by the size of a batch.
+  utils::PoolResource result_memory_;
   mgp_result result_;
   decltype(result_.rows.end()) result_row_it_{result_.rows.end()};
   size_t result_signature_size_{0};
+  std::shared_ptr<BatchedProcedureCall> batched_call_;
 
  public:
   CallProcedureCursor(const CallProcedure *self, utils::MemoryResource *mem)
@@ -4448,10 +6098,18 @@ class CallProcedureCursor : public Cursor {
         // result_ needs to live throughout multiple Pull evaluations, until all
         // rows are produced. Therefore, we use the memory dedicated for the
         // whole execution.
-        result_(nullptr, mem) {
+        result_memory_(128, 1024, mem, utils::NewDeleteResource()),
+        result_(nullptr, &result_memory_) {
     MG_ASSERT(self_->result_fields_.size() == self_->result_symbols_.size(), "Incorrectly constructed CallProcedure");
   }
 
+  CallProcedureCursor(const CallProcedureCursor &) = delete;
+  CallProcedureCursor &operator=(const CallProcedureCursor &) = delete;
+  CallProcedureCursor(CallProcedureCursor &&) = delete;
+  CallProcedureCursor &operator=(CallProcedureCursor &&) = delete;
+
+  ~CallProcedureCursor() override { AbortBatchedCall(); }
+
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("CallProcedure");
 
@@ -4463,10 +6121,14 @@ class CallProcedureCursor : public Cursor {
     // have procedures registering what they return.
     // This `while` loop will skip over empty results.
     while (result_row_it_ == result_.rows.end()) {
+      // A call of a batched procedure produces its next batch before the next
+      // input row is pulled.
+      if (batched_call_) {
+        PullBatch(context);
+        continue;
+      }
       if (!input_cursor_->Pull(frame, context)) return false;
-      result_.signature = nullptr;
-      result_.rows.clear();
-      result_.error_msg.reset();
+      ClearResult();
       // It might be a good idea to resolve the procedure name once, at the
       // start. Unfortunately, this could deadlock if we tried to invoke a
       // procedure from a module (read lock) and reload a module (write lock)
@@ -4492,12 +6154,15 @@ class CallProcedureCursor : public Cursor {
 
       result_.signature = &proc->results;
       // Use evaluation memory, as invoking a procedure is akin to a simple
-      // evaluation of an expression.
-      // TODO: This will probably need to be changed when we add support for
-      // generator like procedures which yield a new result on each invocation.
+      // evaluation of an expression. Batched procedures, which yield their
+      // results over multiple pulls, get memory of their own.
       auto *memory = context.evaluation_context.memory;
       auto memory_limit = EvaluateMemoryLimit(&evaluator, self_->memory_limit_, self_->memory_scale_);
       auto graph = mgp_graph::WritableGraph(*context.db_accessor, graph_view, context);
+      if (proc->batch) {
+        StartBatchedCall(*module, *proc, graph, &evaluator, memory_limit, context.memory_limit);
+        continue;
+      }
       CallCustomProcedure(self_->procedure_name_, *proc, self_->arguments_, graph, &evaluator, memory, memory_limit,
                           &result_);
 
@@ -4538,12 +6203,109 @@ class CallProcedureCursor : public Cursor {
   }
 
   void Reset() override {
+    AbortBatchedCall();
+    ClearResult();
+    input_cursor_->Reset();
+  }
+
+  void Shutdown() override { AbortBatchedCall(); }
+
+ private:
+  void ClearResult() {
+    result_.signature = nullptr;
     result_.rows.clear();
     result_.error_msg.reset();
-    input_cursor_->Reset();
+    result_.batch_size = 0;
+    result_row_it_ = result_.rows.end();
   }
 
-  void Shutdown() override {}
+  void StartBatchedCall(const procedure::Module &module, const mgp_proc &proc, const mgp_graph &graph,
+                        ExpressionEvaluator *evaluator, std::optional<size_t> memory_limit,
+                        utils::MemoryLimit *query_memory_limit) {
+    if (memory_limit) {
+      SPDLOG_INFO("Running '{}' with memory limit of {}", self_->procedure_name_,
+                  utils::GetReadableSize(*memory_limit));
+    }
+    auto call = std::make_shared<BatchedProcedureCall>(&proc, graph, memory_limit, query_memory_limit);
+    // Evaluation memory is reset between the pulls of a query, so the
+    // subgraph and the arguments, which the procedure may refer to from its
+    // state, are kept in the memory of the call.
+    mgp_list proc_args(&call->pool_memory);
+    EvaluateProcedureArguments(self_->procedure_name_, proc, self_->arguments_, call->graph, evaluator,
+                               &call->pool_memory, call->subgraph, call->subgraph_accessor, proc_args);
+    MG_ASSERT(result_.signature == &proc.results);
+    result_.batch_size = FLAGS_query_procedure_batch_size;
+    call->state = proc.batch->init(&proc_args, &call->graph, &result_, &call->memory);
+    result_.signature = nullptr;
+    if (result_.error_msg) {
+      throw QueryRuntimeException("{}: {}", self_->procedure_name_, *result_.error_msg);
+    }
+    // Records are only produced by the batches.
+    result_.rows.clear();
+    // If the module is reloaded before the call finishes, the module cleans up
+    // the call while its code is still loaded.
+    module.AddBatchedCallCleanUp(call, [call = std::weak_ptr<BatchedProcedureCall>(call)] {
+      if (auto alive = call.lock()) CleanUpBatchedCall(*alive);
+    });
+    batched_call_ = std::move(call);
+  }
+
+  void PullBatch(ExecutionContext &context) {
+    ClearResult();
+    // Holding the module keeps it from being reloaded while the batch is
+    // produced.
+    const auto &maybe_found = procedure::FindProcedure(procedure::gModuleRegistry, self_->procedure_name_,
+                                                       context.evaluation_context.memory);
+    auto &call = *batched_call_;
+    std::unique_lock<std::mutex> guard(call.lock);
+    if (!maybe_found || call.cleaned_up) {
+      // The module already cleaned up the call when it was closed.
+      guard.unlock();
+      batched_call_.reset();
+      throw QueryRuntimeException("The procedure named '{}' was reloaded while it was running.",
+                                  self_->procedure_name_);
+    }
+    const auto &proc = *call.proc;
+    result_.signature = &proc.results;
+    result_.batch_size = FLAGS_query_procedure_batch_size;
+    proc.batch->next(call.state, &call.graph, &result_, &call.memory);
+    result_signature_size_ = result_.signature->size();
+    result_.signature = nullptr;
+    guard.unlock();
+    if (result_.error_msg || result_.rows.empty()) {
+      AbortBatchedCall();
+    }
+    if (result_.error_msg) {
+      throw QueryRuntimeException("{}: {}", self_->procedure_name_, *result_.error_msg);
+    }
+    result_row_it_ = result_.rows.begin();
+  }
+
+  /// Invokes the clean up of the procedure, unless it was already done.
+  static void CleanUpBatchedCall(BatchedProcedureCall &call) {
+    std::lock_guard<std::mutex> guard(call.lock);
+    if (call.cleaned_up) return;
+    call.cleaned_up = true;
+    call.proc->batch->cleanup(call.state, &call.memory);
+    if (call.limited_memory && call.limited_memory->GetAllocatedBytes() > 0U) {
+      spdlog::warn("Query procedure '{}' leaked {} *tracked* bytes", call.proc->name,
+                   call.limited_memory->GetAllocatedBytes());
+    }
+    // The module may keep the call alive past the query, so the memory is
+    // given back to the limit of the query here and not when the call is
+    // destroyed.
+    call.subgraph_accessor.reset();
+    call.subgraph.reset();
+    call.pool_memory.Release();
+  }
+
+  /// Cleans up the call of a batched procedure, also when it didn't produce
+  /// all of its records.
+  void AbortBatchedCall() {
+    if (!batched_call_) return;
+    auto call = std::move(batched_call_);
+    CleanUpBatchedCall(*call);
+  }
 };
 
 UniqueCursorPtr CallProcedure::MakeCursor(utils::MemoryResource *mem) const {
@@ -0,0 +1,321 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/spill.hpp"
+
+#include <cstring>
+
+#include "query/exceptions.hpp"
+#include "query/graph.hpp"
+#include "utils/logging.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/uuid.hpp"
+
+namespace memgraph::query::plan {
+
+namespace {
+
+enum class SpillMarker : uint8_t {
+  NULL_VALUE,
+  BOOL_FALSE,
+  BOOL_TRUE,
+  INT,
+  DOUBLE,
+  STRING,
+  LIST,
+  MAP,
+  VERTEX,
+  EDGE,
+  PATH,
+  DATE,
+  LOCAL_TIME,
+  LOCAL_DATE_TIME,
+  DURATION,
+  GRAPH,
+};
+
+std::optional<VertexAccessor> FindSpilledVertex(DbAccessor *dba, storage::Gid gid) {
+  // The vertex may have been deleted after it was spilled.
+  if (auto vertex = dba->FindVertex(gid, storage::View::NEW)) return vertex;
+  return dba->FindVertex(gid, storage::View::OLD);
+}
+
+}  // namespace
+
+bool MaySpill(const ExecutionContext &context) {
+  return context.memory_limit || utils::total_memory_tracker.HardLimit() > 0;
+}
+
+bool MustSpill(const ExecutionContext &context, size_t materialized_bytes) {
+  if (const auto *limit = context.memory_limit;
+      limit && materialized_bytes > limit->GetMaxAllocatedBytes() - limit->GetAllocatedBytes()) {
+    return true;
+  }
+  const auto hard_limit = utils::total_memory_tracker.HardLimit();
+  if (hard_limit <= 0) return false;
+  const auto available = hard_limit - utils::total_memory_tracker.Amount();
+  return available <= 0 || materialized_bytes > static_cast<uint64_t>(available);
+}
+
+SpillFile::SpillFile(const std::filesystem::path &directory) {
+  if (!utils::EnsureDir(directory)) {
+    throw QueryRuntimeException("Couldn't create the directory for spilling query results '{}'.", directory.string());
+  }
+  path_ = directory / utils::GenerateUUID();
+  output_.Open(path_, utils::OutputFile::Mode::OVERWRITE_EXISTING);
+}
+
+SpillFile::~SpillFile() {
+  if (output_.IsOpen()) output_.Close();
+  if (input_.IsOpen()) input_.Close();
+  std::error_code error_code;
+  std::filesystem::remove(path_, error_code);
+  if (error_code) spdlog::warn("Couldn't remove the spill file {}: {}", path_.string(), error_code.message());
+}
+
+void SpillFile::Write(std::span<const TypedValue> row) {
+  MG_ASSERT(output_.IsOpen(), "Writing to a spill file which is being read");
+  WriteUint(row.size());
+  for (const auto &value : row) WriteValue(value);
+  ++rows_;
+}
+
+void SpillFile::StartReading() {
+  if (output_.IsOpen()) output_.Close();
+  if (input_.IsOpen()) input_.Close();
+  if (!input_.Open(path_)) throw QueryRuntimeException("Couldn't open the spill file '{}'.", path_.string());
+  read_rows_ = 0;
+}
+
+bool SpillFile::Read(utils::pmr::vector<TypedValue> *row, DbAccessor *dba) {
+  MG_ASSERT(input_.IsOpen(), "Reading from a spill file which is being written");
+  if (read_rows_ == rows_) return false;
+  row->clear();
+  const auto size = ReadUint();
+  row->reserve(size);
+  for (uint64_t i = 0; i < size; ++i) row->emplace_back(ReadValue(dba, row->get_allocator().GetMemoryResource()));
+  ++read_rows_;
+  return true;
+}
+
+void SpillFile::WriteUint(uint64_t value) { output_.Write(reinterpret_cast<const uint8_t *>(&value), sizeof(value)); }
+
+void SpillFile::ReadBytes(void *data, size_t size) {
+  if (!input_.Read(static_cast<uint8_t *>(data), size)) {
+    throw QueryRuntimeException("Couldn't read from the spill file '{}'.", path_.string());
+  }
+}
+
+uint64_t SpillFile::ReadUint() {
+  uint64_t value{0};
+  ReadBytes(&value, sizeof(value));
+  return value;
+}
+
+void SpillFile::WriteValue(const TypedValue &value) {
+  auto write_marker = [this](SpillMarker marker) {
+    const auto byte = static_cast<uint8_t>(marker);
+    output_.Write(&byte, 1);
+  };
+  auto write_string = [this](std::string_view string) {
+    WriteUint(string.size());
+    output_.Write(string);
+  };
+  auto write_edge = [&](const EdgeAccessor &edge) {
+    write_marker(SpillMarker::EDGE);
+    WriteUint(edge.Gid().AsUint());
+    WriteUint(edge.From().Gid().AsUint());
+    WriteUint(edge.To().Gid().AsUint());
+    WriteUint(edge.EdgeType().AsUint());
+  };
+
+  switch (value.type()) {
+    case TypedValue::Type::Null:
+      write_marker(SpillMarker::NULL_VALUE);
+      return;
+    case TypedValue::Type::Bool:
+      write_marker(value.ValueBool() ? SpillMarker::BOOL_TRUE : SpillMarker::BOOL_FALSE);
+      return;
+    case TypedValue::Type::Int:
+      write_marker(SpillMarker::INT);
+      WriteInt(value.ValueInt());
+      return;
+    case TypedValue::Type::Double: {
+      write_marker(SpillMarker::DOUBLE);
+      uint64_t bits{0};
+      const auto double_value = value.ValueDouble();
+      std::memcpy(&bits, &double_value, sizeof(bits));
+      WriteUint(bits);
+      return;
+    }
+    case TypedValue::Type::String:
+      write_marker(SpillMarker::STRING);
+      write_string(value.ValueString());
+      return;
+    case TypedValue::Type::List:
+      write_marker(SpillMarker::LIST);
+      WriteUint(value.ValueList().size());
+      for (const auto &element : value.ValueList()) WriteValue(element);
+      return;
+    case TypedValue::Type::Map:
+      write_marker(SpillMarker::MAP);
+      WriteUint(value.ValueMap().size());
+      for (const auto &[key, element] : value.ValueMap()) {
+        write_string(key);
+        WriteValue(element);
+      }
+      return;
+    case TypedValue::Type::Vertex:
+      write_marker(SpillMarker::VERTEX);
+      WriteUint(value.ValueVertex().Gid().AsUint());
+      return;
+    case TypedValue::Type::Edge:
+      write_edge(value.ValueEdge());
+      return;
+    case TypedValue::Type::Path: {
+      const auto &path = value.ValuePath();
+      write_marker(SpillMarker::PATH);
+      WriteUint(path.edges().size());
+      WriteUint(path.vertices().front().Gid().AsUint());
+      for (const auto &edge : path.edges()) write_edge(edge);
+      // The path direction can't be deduced from the edges alone.
+      for (size_t i = 1; i < path.vertices().size(); ++i) WriteUint(path.vertices()[i].Gid().AsUint());
+      return;
+    }
+    case TypedValue::Type::Date:
+      write_marker(SpillMarker::DATE);
+      WriteInt(value.ValueDate().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::LocalTime:
+      write_marker(SpillMarker::LOCAL_TIME);
+      WriteInt(value.ValueLocalTime().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::LocalDateTime:
+      write_marker(SpillMarker::LOCAL_DATE_TIME);
+      WriteInt(value.ValueLocalDateTime().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::Duration:
+      write_marker(SpillMarker::DURATION);
+      WriteInt(value.ValueDuration().microseconds);
+      return;
+    case TypedValue::Type::Graph: {
+      const auto &graph = value.ValueGraph();
+      write_marker(SpillMarker::GRAPH);
+      WriteUint(graph.vertices().size());
+      for (const auto &vertex : graph.vertices()) WriteUint(vertex.Gid().AsUint());
+      WriteUint(graph.edges().size());
+      for (const auto &edge : graph.edges()) write_edge(edge);
+      return;
+    }
+  }
+}
+
+TypedValue SpillFile::ReadValue(DbAccessor *dba, utils::MemoryResource *memory) {
+  auto read_string = [&] {
+    TypedValue::TString string(ReadUint(), '\0', memory);
+    ReadBytes(string.data(), string.size());
+    return string;
+  };
+  auto read_vertex = [&](uint64_t gid) {
+    auto vertex = FindSpilledVertex(dba, storage::Gid::FromUint(gid));
+    if (!vertex) throw QueryRuntimeException("Node spilled to disk doesn't exist anymore.");
+    return *vertex;
+  };
+  auto read_edge = [&]() -> EdgeAccessor {
+    const auto gid = storage::Gid::FromUint(ReadUint());
+    const auto from = read_vertex(ReadUint());
+    const auto to = read_vertex(ReadUint());
+    const auto edge_type = storage::EdgeTypeId::FromUint(ReadUint());
+    // The edge may have been deleted after it was spilled.
+    for (auto view : {storage::View::NEW, storage::View::OLD}) {
+      if (auto edge = dba->FindEdge(gid, edge_type, from, to, view)) return *edge;
+    }
+    throw QueryRuntimeException("Relationship spilled to disk doesn't exist anymore.");
+  };
+  auto read_edge_value = [&] {
+    uint8_t marker{0};
+    ReadBytes(&marker, 1);
+    MG_ASSERT(static_cast<SpillMarker>(marker) == SpillMarker::EDGE, "Corrupted spill file");
+    return read_edge();
+  };
+
+  uint8_t byte{0};
+  ReadBytes(&byte, 1);
+  switch (static_cast<SpillMarker>(byte)) {
+    case SpillMarker::NULL_VALUE:
+      return TypedValue(memory);
+    case SpillMarker::BOOL_FALSE:
+      return TypedValue(false, memory);
+    case SpillMarker::BOOL_TRUE:
+      return TypedValue(true, memory);
+    case SpillMarker::INT:
+      return TypedValue(ReadInt(), memory);
+    case SpillMarker::DOUBLE: {
+      const auto bits = ReadUint();
+      double value{0};
+      std::memcpy(&value, &bits, sizeof(value));
+      return TypedValue(value, memory);
+    }
+    case SpillMarker::STRING:
+      return TypedValue(read_string(), memory);
+    case SpillMarker::LIST: {
+      TypedValue::TVector list(memory);
+      const auto size = ReadUint();
+      list.reserve(size);
+      for (uint64_t i = 0; i < size; ++i) list.emplace_back(ReadValue(dba, memory));
+      return TypedValue(std::move(list), memory);
+    }
+    case SpillMarker::MAP: {
+      TypedValue::TMap map(memory);
+      const auto size = ReadUint();
+      for (uint64_t i = 0; i < size; ++i) {
+        auto key = read_string();
+        map.emplace(std::move(key), ReadValue(dba, memory));
+      }
+      return TypedValue(std::move(map), memory);
+    }
+    case SpillMarker::VERTEX:
+      return TypedValue(read_vertex(ReadUint()), memory);
+    case SpillMarker::EDGE:
+      return TypedValue(read_edge(), memory);
+    case SpillMarker::PATH: {
+      const auto size = ReadUint();
+      Path path(read_vertex(ReadUint()), memory);
+      std::vector<EdgeAccessor> edges;
+      edges.reserve(size);
+      for (uint64_t i = 0; i < size; ++i) edges.push_back(read_edge_value());
+      for (const auto &edge : edges) {
+        path.Expand(edge);
+        path.Expand(read_vertex(ReadUint()));
+      }
+      return TypedValue(std::move(path), memory);
+    }
+    case SpillMarker::DATE:
+      return TypedValue(utils::Date(ReadInt()), memory);
+    case SpillMarker::LOCAL_TIME:
+      return TypedValue(utils::LocalTime(ReadInt()), memory);
+    case SpillMarker::LOCAL_DATE_TIME:
+      return TypedValue(utils::LocalDateTime(ReadInt()), memory);
+    case SpillMarker::DURATION:
+      return TypedValue(utils::Duration(ReadInt()), memory);
+    case SpillMarker::GRAPH: {
+      Graph graph(memory);
+      const auto num_vertices = ReadUint();
+      for (uint64_t i = 0; i < num_vertices; ++i) graph.InsertVertex(read_vertex(ReadUint()));
+      const auto num_edges = ReadUint();
+      for (uint64_t i = 0; i < num_edges; ++i) graph.InsertEdge(read_edge_value());
+      return TypedValue(std::move(graph), memory);
+    }
+  }
+  LOG_FATAL("Corrupted spill file");
+}
+
+}  // namespace memgraph::query::plan
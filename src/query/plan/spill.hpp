@@ -0,0 +1,103 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+#include "query/context.hpp"
+#include "query/db_accessor.hpp"
+#include "query/typed_value.hpp"
+#include "utils/file.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::query::plan {
+
+/// Returns true if an operator which materializes its input may have to
+/// spill it to disk, which is the case if either the query or the whole
+/// process has a memory limit.
+bool MaySpill(const ExecutionContext &context);
+
+/// Returns true if an operator which materializes its input has to spill it
+/// to disk. That is the case once the memory the operator holds, counted by a
+/// LimitedMemoryResource the same way as the query memory, doesn't fit in the
+/// query memory limit together with the memory that is allocated under it,
+/// or in the memory limit of the process together with all of its memory.
+/// Nothing is spilled without a memory limit.
+bool MustSpill(const ExecutionContext &context, size_t materialized_bytes);
+
+/// Directory of the spill files of a single query. It is created by the first
+/// SpillFile and removed, along with anything left in it, when the
+/// SpillDirectory is destroyed, so it must outlive the files.
+class SpillDirectory {
+ public:
+  explicit SpillDirectory(std::filesystem::path path) : path_(std::move(path)) {}
+  ~SpillDirectory() { utils::DeleteDir(path_); }
+
+  SpillDirectory(const SpillDirectory &) = delete;
+  SpillDirectory &operator=(const SpillDirectory &) = delete;
+  SpillDirectory(SpillDirectory &&) = delete;
+  SpillDirectory &operator=(SpillDirectory &&) = delete;
+
+  const std::filesystem::path &path() const { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+/// Temporary file holding rows of TypedValues, used by operators which
+/// materialize their input once it doesn't fit in the query memory limit.
+/// The file is first written, then read sequentially from the beginning.
+/// Vertices and edges, also those of paths and graphs, are stored by their
+/// Gids and looked up again when read, so they have to outlive the file. The file is removed when the
+/// SpillFile is destroyed.
+class SpillFile {
+ public:
+  explicit SpillFile(const std::filesystem::path &directory);
+  ~SpillFile();
+
+  SpillFile(const SpillFile &) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  SpillFile(SpillFile &&) = delete;
+  SpillFile &operator=(SpillFile &&) = delete;
+
+  /// Appends the row to the file.
+  void Write(std::span<const TypedValue> row);
+
+  /// Finishes writing and prepares the file for reading from the beginning.
+  void StartReading();
+
+  /// Reads the next row into `row`, replacing its previous contents. Returns
+  /// false when all rows have been read.
+  bool Read(utils::pmr::vector<TypedValue> *row, DbAccessor *dba);
+
+  size_t size() const { return rows_; }
+
+ private:
+  void WriteValue(const TypedValue &value);
+  TypedValue ReadValue(DbAccessor *dba, utils::MemoryResource *memory);
+  void ReadBytes(void *data, size_t size);
+  uint64_t ReadUint();
+  int64_t ReadInt() { return static_cast<int64_t>(ReadUint()); }
+  void WriteUint(uint64_t value);
+  void WriteInt(int64_t value) { WriteUint(static_cast<uint64_t>(value)); }
+
+  std::filesystem::path path_;
+  utils::OutputFile output_;
+  utils::InputFile input_;
+  size_t rows_{0};
+  size_t read_rows_{0};
+};
+
+}  // namespace memgraph::query::plan
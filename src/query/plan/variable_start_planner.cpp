@@ -11,16 +11,31 @@
 
 #include "query/plan/variable_start_planner.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <limits>
 #include <queue>
 
 #include "utils/flag_validation.hpp"
 #include "utils/logging.hpp"
+#include "utils/timer.hpp"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(query_max_plans, 1000U, "Maximum number of generated plans for a query.",
                         FLAG_IN_RANGE(1, std::numeric_limits<std::uint64_t>::max()));
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_plan_join_order_min_expansions, 6U,
+                        "Minimum number of expansions in a pattern for which the expansion order is chosen by cost "
+                        "based enumeration instead of chaining expansions in the order they appear in the pattern.",
+                        FLAG_IN_RANGE(1, std::numeric_limits<std::uint64_t>::max()));
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_plan_join_order_budget_ms, 20U,
+                        "Maximum time in milliseconds spent on dynamic programming over expansion orders for a single "
+                        "starting node. When exceeded, the greedy expansion ordering is used instead.",
+                        FLAG_IN_RANGE(0, std::numeric_limits<std::uint64_t>::max()));
+
 namespace memgraph::query::plan::impl {
 
 namespace {
@@ -95,12 +110,266 @@ void AddNextExpansions(const Symbol &node_symbol, const Matching &matching, cons
   }
 }
 
+// Cardinality factors used when ordering expansions. They mirror
+// `CostEstimator::CardParam`, so the order deemed cheapest here is also the
+// one preferred by the estimator when all generated plans are compared.
+constexpr double kExpandCardinality{3.0};
+constexpr double kExpandVariableCardinality{9.0};
+constexpr double kFilterCardinality{0.25};
+
+// Dynamic programming is done over subsets of expansions, so the state space
+// grows as 2^n. Larger patterns are always ordered greedily.
+constexpr size_t kMaxDpExpansions{16U};
+
+// Enumerates orders of expansions reachable from a starting node and picks the
+// one with the smallest sum of estimated intermediate cardinalities.
+//
+// The estimated cardinality of a set of expansions does not depend on the
+// order in which they are performed: each edge multiplies the cardinality,
+// each filter whose symbols are all bound reduces it and each expansion which
+// closes a cycle (a join point, where both nodes are already bound) acts as an
+// additional filter. This makes it possible to do dynamic programming over
+// subsets of expansions. If there are too many expansions, or the planning
+// time budget is exhausted, the greedy operator ordering (GOO) is used, which
+// always picks the expansion resulting in the smallest cardinality.
+class ExpansionOrderer {
+ public:
+  ExpansionOrderer(const Symbol &start_symbol, const Matching &matching, const SymbolTable &symbol_table)
+      : matching_(matching), symbol_table_(symbol_table) {
+    CollectComponent(start_symbol);
+  }
+
+  // Returns std::nullopt if the expansions cannot be reordered, in which case
+  // the regular chaining of expansions should be used.
+  std::optional<std::vector<Expansion>> Order() {
+    if (!can_reorder_) return std::nullopt;
+    std::optional<std::vector<size_t>> order;
+    if (expansion_ids_.size() <= kMaxDpExpansions) {
+      order = OrderDp();
+    }
+    if (!order) {
+      order = OrderGreedy();
+    }
+    return MakeExpansions(*order);
+  }
+
+ private:
+  using Mask = uint64_t;
+
+  struct PatternEdge {
+    int node1{-1};
+    // -1 if the expansion only contains a single node.
+    int node2{-1};
+    double cardinality{1.0};
+  };
+
+  struct PatternFilter {
+    Mask nodes{0};
+    Mask edges{0};
+  };
+
+  static constexpr Mask kStartNode{1U};
+
+  // Collects all expansions reachable from the start symbol and all filters
+  // which refer to their symbols.
+  void CollectComponent(const Symbol &start_symbol) {
+    std::unordered_map<Symbol, int> edge_symbols;
+    std::vector<Symbol> frontier{start_symbol};
+    node_ids_.emplace(start_symbol, 0);
+    std::unordered_set<size_t> seen;
+    while (!frontier.empty()) {
+      auto symbol = frontier.back();
+      frontier.pop_back();
+      auto it = matching_.node_symbol_to_expansions.find(symbol);
+      if (it == matching_.node_symbol_to_expansions.end()) continue;
+      for (auto expansion_id : it->second) {
+        if (!seen.insert(expansion_id).second) continue;
+        const auto &expansion = matching_.expansions[expansion_id];
+        PatternEdge edge;
+        edge.node1 = NodeId(symbol_table_.at(*expansion.node1->identifier_), frontier);
+        if (expansion.edge) {
+          edge.node2 = NodeId(symbol_table_.at(*expansion.node2->identifier_), frontier);
+          edge.cardinality =
+              expansion.edge->type_ == EdgeAtom::Type::SINGLE ? kExpandCardinality : kExpandVariableCardinality;
+          edge_symbols.emplace(symbol_table_.at(*expansion.edge->identifier_), edges_.size());
+        }
+        for (const auto &range_symbol : expansion.symbols_in_range) {
+          if (matching_.expansion_symbols.find(range_symbol) != matching_.expansion_symbols.end()) {
+            // Range expressions depending on other expansions impose ordering
+            // constraints, which are handled by regular chaining.
+            can_reorder_ = false;
+            return;
+          }
+        }
+        expansion_ids_.push_back(expansion_id);
+        edges_.push_back(edge);
+      }
+    }
+    if (node_ids_.size() > std::numeric_limits<Mask>::digits || edges_.size() > std::numeric_limits<Mask>::digits) {
+      can_reorder_ = false;
+      return;
+    }
+    for (const auto &filter : matching_.filters) {
+      PatternFilter pattern_filter;
+      for (const auto &symbol : filter.used_symbols) {
+        if (auto node_it = node_ids_.find(symbol); node_it != node_ids_.end()) {
+          pattern_filter.nodes |= Mask{1U} << node_it->second;
+        } else if (auto edge_it = edge_symbols.find(symbol); edge_it != edge_symbols.end()) {
+          pattern_filter.edges |= Mask{1U} << edge_it->second;
+        }
+      }
+      // Filters bound only by the start node (or not at all) are the same for
+      // every order, so they are not interesting.
+      if ((pattern_filter.nodes & ~kStartNode) == 0U && pattern_filter.edges == 0U) continue;
+      filters_.push_back(pattern_filter);
+    }
+  }
+
+  int NodeId(const Symbol &symbol, std::vector<Symbol> &frontier) {
+    auto [it, inserted] = node_ids_.emplace(symbol, static_cast<int>(node_ids_.size()));
+    if (inserted) frontier.push_back(symbol);
+    return it->second;
+  }
+
+  Mask NodesOf(const PatternEdge &edge) const {
+    Mask nodes = Mask{1U} << edge.node1;
+    if (edge.node2 != -1) nodes |= Mask{1U} << edge.node2;
+    return nodes;
+  }
+
+  bool CanAttach(size_t edge_id, Mask bound_nodes) const { return (NodesOf(edges_[edge_id]) & bound_nodes) != 0U; }
+
+  // Estimated number of rows produced after performing all expansions in
+  // `edges`, which bind all of `nodes`.
+  double Cardinality(Mask edges, Mask nodes) const {
+    double cardinality = 1.0;
+    int pattern_edges = 0;
+    for (size_t i = 0; i < edges_.size(); ++i) {
+      if ((edges & (Mask{1U} << i)) == 0U || edges_[i].node2 == -1) continue;
+      cardinality *= edges_[i].cardinality;
+      ++pattern_edges;
+    }
+    // Every edge beyond the spanning tree of bound nodes closes a cycle.
+    const auto cycles = pattern_edges - (std::popcount(nodes) - 1);
+    for (int i = 0; i < cycles; ++i) cardinality *= kFilterCardinality;
+    for (const auto &filter : filters_) {
+      if ((filter.nodes & nodes) == filter.nodes && (filter.edges & edges) == filter.edges) {
+        cardinality *= kFilterCardinality;
+      }
+    }
+    return cardinality;
+  }
+
+  std::optional<std::vector<size_t>> OrderDp() const {
+    const auto budget = std::chrono::milliseconds(FLAGS_query_plan_join_order_budget_ms);
+    utils::Timer timer;
+    const Mask full = (Mask{1U} << edges_.size()) - 1U;
+    std::vector<double> costs(full + 1U, std::numeric_limits<double>::infinity());
+    std::vector<Mask> bound_nodes(full + 1U, 0U);
+    std::vector<int> last_edge(full + 1U, -1);
+    costs[0] = 0.0;
+    bound_nodes[0] = kStartNode;
+    for (Mask edges = 0U; edges < full; ++edges) {
+      if (costs[edges] == std::numeric_limits<double>::infinity()) continue;
+      if ((edges & 0x3FFU) == 0U && timer.Elapsed() > budget) return std::nullopt;
+      for (size_t i = 0; i < edges_.size(); ++i) {
+        const Mask edge = Mask{1U} << i;
+        if ((edges & edge) != 0U || !CanAttach(i, bound_nodes[edges])) continue;
+        const Mask next_edges = edges | edge;
+        const Mask next_nodes = bound_nodes[edges] | NodesOf(edges_[i]);
+        const double cost = costs[edges] + Cardinality(next_edges, next_nodes);
+        if (cost < costs[next_edges]) {
+          costs[next_edges] = cost;
+          bound_nodes[next_edges] = next_nodes;
+          last_edge[next_edges] = static_cast<int>(i);
+        }
+      }
+    }
+    std::vector<size_t> order;
+    order.reserve(edges_.size());
+    for (Mask edges = full; edges != 0U; edges &= ~(Mask{1U} << last_edge[edges])) {
+      MG_ASSERT(last_edge[edges] != -1, "Expected all expansions to be reachable from the start node");
+      order.push_back(last_edge[edges]);
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+  }
+
+  std::vector<size_t> OrderGreedy() const {
+    std::vector<size_t> order;
+    order.reserve(edges_.size());
+    Mask edges = 0U;
+    Mask nodes = kStartNode;
+    while (order.size() < edges_.size()) {
+      std::optional<size_t> best;
+      double best_cardinality = 0.0;
+      for (size_t i = 0; i < edges_.size(); ++i) {
+        if ((edges & (Mask{1U} << i)) != 0U || !CanAttach(i, nodes)) continue;
+        const double cardinality = Cardinality(edges | (Mask{1U} << i), nodes | NodesOf(edges_[i]));
+        if (!best || cardinality < best_cardinality) {
+          best = i;
+          best_cardinality = cardinality;
+        }
+      }
+      MG_ASSERT(best, "Expected all expansions to be reachable from the start node");
+      edges |= Mask{1U} << *best;
+      nodes |= NodesOf(edges_[*best]);
+      order.push_back(*best);
+    }
+    return order;
+  }
+
+  // Converts the order of pattern edges to expansions, flipping them so they
+  // start from an already bound node. Expansions not reachable from the start
+  // node are appended in their original order.
+  std::vector<Expansion> MakeExpansions(const std::vector<size_t> &order) const {
+    std::vector<Expansion> expansions;
+    expansions.reserve(matching_.expansions.size());
+    Mask nodes = kStartNode;
+    for (auto edge_id : order) {
+      const auto &edge = edges_[edge_id];
+      auto expansion = matching_.expansions[expansion_ids_[edge_id]];
+      if ((nodes & (Mask{1U} << edge.node1)) == 0U && expansion.edge->type_ != EdgeAtom::Type::BREADTH_FIRST) {
+        // BFS must *not* be flipped. Doing that changes the BFS results.
+        std::swap(expansion.node1, expansion.node2);
+        expansion.is_flipped = true;
+        if (expansion.direction != EdgeAtom::Direction::BOTH) {
+          expansion.direction =
+              expansion.direction == EdgeAtom::Direction::IN ? EdgeAtom::Direction::OUT : EdgeAtom::Direction::IN;
+        }
+      }
+      nodes |= NodesOf(edge);
+      expansions.emplace_back(std::move(expansion));
+    }
+    std::unordered_set<size_t> ordered(expansion_ids_.begin(), expansion_ids_.end());
+    for (size_t i = 0; i < matching_.expansions.size(); ++i) {
+      if (ordered.find(i) == ordered.end()) expansions.emplace_back(matching_.expansions[i]);
+    }
+    return expansions;
+  }
+
+  const Matching &matching_;
+  const SymbolTable &symbol_table_;
+  bool can_reorder_{true};
+  // Node symbols reachable from the start node, which has the id 0.
+  std::unordered_map<Symbol, int> node_ids_;
+  // Indices into `matching_.expansions` for each of `edges_`.
+  std::vector<size_t> expansion_ids_;
+  std::vector<PatternEdge> edges_;
+  std::vector<PatternFilter> filters_;
+};
+
 // Generates expansions emanating from the start_node by forming a chain. When
 // the chain can no longer be continued, a different starting node is picked
 // among remaining expansions and the process continues. This is done until all
-// matching.expansions are used.
+// matching.expansions are used. Large patterns are instead ordered by the
+// estimated cost of expansions, see `ExpansionOrderer`.
 std::vector<Expansion> ExpansionsFrom(const NodeAtom *start_node, const Matching &matching,
                                       const SymbolTable &symbol_table) {
+  if (matching.expansions.size() >= FLAGS_query_plan_join_order_min_expansions) {
+    auto ordered = ExpansionOrderer(symbol_table.at(*start_node->identifier_), matching, symbol_table).Order();
+    if (ordered) return *std::move(ordered);
+  }
   // Make a copy of node_symbol_to_expansions, because we will modify it as
   // expansions are chained.
   auto node_symbol_to_expansions = matching.node_symbol_to_expansions;
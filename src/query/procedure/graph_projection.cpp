@@ -0,0 +1,286 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/procedure/graph_projection.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include <fmt/format.h>
+
+#include "query/exceptions.hpp"
+#include "query/graph.hpp"
+#include "utils/logging.hpp"
+#include "utils/readable_size.hpp"
+
+namespace memgraph::query::procedure {
+
+GraphProjections gGraphProjections;
+
+namespace {
+
+constexpr uint64_t kNoOrdinal = std::numeric_limits<uint64_t>::max();
+
+template <class TResult>
+auto ValueOrThrow(TResult &&result) {
+  if (result.HasError()) {
+    throw QueryRuntimeException("Unable to read the graph while projecting it.");
+  }
+  return std::move(*result);
+}
+
+template <class TCallback>
+void ForEachOutEdge(DbAccessor * /*dba*/, const VertexAccessor &vertex, storage::View view,
+                    const std::vector<storage::EdgeTypeId> &edge_types, const TCallback &callback) {
+  for (const auto &edge : ValueOrThrow(vertex.OutEdges(view, edge_types))) callback(edge);
+}
+
+template <class TCallback>
+void ForEachOutEdge(SubgraphDbAccessor *dba, const VertexAccessor &vertex, storage::View view,
+                    const std::vector<storage::EdgeTypeId> &edge_types, const TCallback &callback) {
+  const auto &graph_edges = dba->getGraph()->edges();
+  for (const auto &edge : ValueOrThrow(vertex.OutEdges(view, edge_types))) {
+    if (graph_edges.contains(edge)) callback(edge);
+  }
+}
+
+double EdgeWeight(const EdgeAccessor &edge, storage::View view, storage::PropertyId property,
+                  const GraphProjection::Spec &spec) {
+  const auto value = ValueOrThrow(edge.GetProperty(view, property));
+  if (value.IsNull()) return spec.default_weight;
+  if (value.IsInt()) return static_cast<double>(value.ValueInt());
+  if (value.IsDouble()) return value.ValueDouble();
+  throw QueryRuntimeException("The edge weight property '{}' must be numeric.", *spec.weight_property);
+}
+
+double VertexPropertyValue(const VertexAccessor &vertex, storage::View view, storage::PropertyId property,
+                           const std::string &name) {
+  const auto value = ValueOrThrow(vertex.GetProperty(view, property));
+  if (value.IsNull()) return std::numeric_limits<double>::quiet_NaN();
+  if (value.IsInt()) return static_cast<double>(value.ValueInt());
+  if (value.IsDouble()) return value.ValueDouble();
+  throw QueryRuntimeException("The vertex property '{}' must be numeric.", name);
+}
+
+template <class T>
+size_t CapacityBytes(const std::vector<T> &values) {
+  return values.capacity() * sizeof(T);
+}
+
+}  // namespace
+
+template <class TDbAccessor>
+GraphProjection GraphProjection::Build(TDbAccessor *dba, storage::View view, const Spec &spec) {
+  std::vector<storage::LabelId> labels;
+  labels.reserve(spec.labels.size());
+  for (const auto &label : spec.labels) labels.push_back(dba->NameToLabel(label));
+  std::vector<storage::EdgeTypeId> edge_types;
+  edge_types.reserve(spec.edge_types.size());
+  for (const auto &edge_type : spec.edge_types) edge_types.push_back(dba->NameToEdgeType(edge_type));
+  std::optional<storage::PropertyId> weight_property;
+  if (spec.weight_property) weight_property = dba->NameToProperty(*spec.weight_property);
+
+  std::vector<std::pair<std::string, storage::PropertyId>> vertex_properties;
+  vertex_properties.reserve(spec.vertex_properties.size());
+  for (const auto &property : spec.vertex_properties) {
+    vertex_properties.emplace_back(property, dba->NameToProperty(property));
+  }
+
+  // The vertices are found through the numbering of the transaction, which is
+  // shared with other procedures and expansions, and their ordinals in it
+  // translate the targets of the edges to projected ordinals.
+  const auto ordinals = dba->GetVertexOrdinals(view);
+  std::vector<uint64_t> selected;
+  for (uint64_t ordinal = 0; ordinal < ordinals.size(); ++ordinal) {
+    const VertexAccessor vertex(ordinals.Vertex(ordinal));
+    if (!labels.empty() && std::none_of(labels.begin(), labels.end(), [&vertex, view](const auto label) {
+          return ValueOrThrow(vertex.HasLabel(view, label));
+        })) {
+      continue;
+    }
+    selected.push_back(ordinal);
+  }
+  // The storage numbers the vertices in the order of their Gids, while a
+  // subgraph numbers them in the order of its vertex set.
+  const auto gid_of = [&ordinals](const uint64_t ordinal) { return ordinals.numbering().vertex(ordinal)->gid; };
+  if (!std::is_sorted(selected.begin(), selected.end(),
+                      [&gid_of](const auto a, const auto b) { return gid_of(a) < gid_of(b); })) {
+    std::sort(selected.begin(), selected.end(), [&gid_of](const auto a, const auto b) { return gid_of(a) < gid_of(b); });
+  }
+
+  GraphProjection projection;
+  projection.weighted_ = weight_property.has_value();
+  const auto vertex_count = selected.size();
+  projection.gids_.reserve(vertex_count);
+  // Projected ordinals indexed by the ordinals of the numbering, which are only
+  // needed while the edges are projected.
+  std::vector<uint64_t> projected(ordinals.size(), kNoOrdinal);
+  for (const auto ordinal : selected) {
+    projected[ordinal] = projection.gids_.size();
+    projection.gids_.push_back(gid_of(ordinal));
+  }
+
+  for (const auto &[name, property] : vertex_properties) {
+    auto &column = projection.vertex_properties_[name];
+    column.reserve(vertex_count);
+    for (const auto ordinal : selected) {
+      column.push_back(VertexPropertyValue(VertexAccessor(ordinals.Vertex(ordinal)), view, property, name));
+    }
+  }
+
+  projection.out_offsets_.reserve(vertex_count + 1);
+  for (const auto ordinal : selected) {
+    ForEachOutEdge(dba, VertexAccessor(ordinals.Vertex(ordinal)), view, edge_types, [&](const EdgeAccessor &edge) {
+      const auto to = ordinals.Ordinal(edge.To().Gid());
+      if (!to || projected[*to] == kNoOrdinal) return;
+      projection.out_neighbors_.push_back(projected[*to]);
+      if (weight_property) projection.out_weights_.push_back(EdgeWeight(edge, view, *weight_property, spec));
+    });
+    projection.out_offsets_.push_back(projection.out_neighbors_.size());
+  }
+  projection.out_neighbors_.shrink_to_fit();
+  projection.out_weights_.shrink_to_fit();
+
+  // Incoming edges are the outgoing edges sorted by their targets, which is
+  // done with a counting sort.
+  const auto edge_count = projection.out_neighbors_.size();
+  projection.in_offsets_.assign(vertex_count + 1, 0);
+  for (const auto to : projection.out_neighbors_) ++projection.in_offsets_[to + 1];
+  std::partial_sum(projection.in_offsets_.begin(), projection.in_offsets_.end(), projection.in_offsets_.begin());
+  projection.in_neighbors_.resize(edge_count);
+  if (projection.weighted_) projection.in_weights_.resize(edge_count);
+  std::vector<uint64_t> positions(projection.in_offsets_.begin(), projection.in_offsets_.end() - 1);
+  for (uint64_t from = 0; from < vertex_count; ++from) {
+    for (auto i = projection.out_offsets_[from]; i < projection.out_offsets_[from + 1]; ++i) {
+      const auto position = positions[projection.out_neighbors_[i]]++;
+      projection.in_neighbors_[position] = from;
+      if (projection.weighted_) projection.in_weights_[position] = projection.out_weights_[i];
+    }
+  }
+  return projection;
+}
+
+template GraphProjection GraphProjection::Build(DbAccessor *dba, storage::View view, const Spec &spec);
+template GraphProjection GraphProjection::Build(SubgraphDbAccessor *dba, storage::View view, const Spec &spec);
+
+std::optional<uint64_t> GraphProjection::VertexOrdinal(storage::Gid gid) const {
+  const auto found = std::lower_bound(gids_.begin(), gids_.end(), gid);
+  if (found == gids_.end() || *found != gid) return std::nullopt;
+  return found - gids_.begin();
+}
+
+std::optional<std::span<const double>> GraphProjection::VertexProperty(std::string_view name) const {
+  const auto found = vertex_properties_.find(name);
+  if (found == vertex_properties_.end()) return std::nullopt;
+  return std::span<const double>(found->second);
+}
+
+size_t GraphProjection::GetAllocatedBytes() const {
+  auto bytes = sizeof(GraphProjection) + CapacityBytes(gids_) + CapacityBytes(out_offsets_) +
+               CapacityBytes(out_neighbors_) + CapacityBytes(out_weights_) + CapacityBytes(in_offsets_) +
+               CapacityBytes(in_neighbors_) + CapacityBytes(in_weights_);
+  for (const auto &[name, column] : vertex_properties_) bytes += name.capacity() + CapacityBytes(column);
+  return bytes;
+}
+
+bool GraphProjections::EvictLeastRecentlyUsed(Projections &projections) {
+  std::optional<std::pair<decltype(projections.owned)::iterator, std::map<std::string, Entry, std::less<>>::iterator>>
+      victim;
+  for (auto owned = projections.owned.begin(); owned != projections.owned.end(); ++owned) {
+    for (auto entry = owned->second.begin(); entry != owned->second.end(); ++entry) {
+      if (!victim || entry->second.last_used.load(std::memory_order_relaxed) <
+                         victim->second->second.last_used.load(std::memory_order_relaxed)) {
+        victim.emplace(owned, entry);
+      }
+    }
+  }
+  if (!victim) return false;
+  auto [owned, entry] = *victim;
+  spdlog::info("Evicting the graph projection '{}' to stay within the graph projection memory limit.", entry->first);
+  projections.allocated_bytes -= entry->second.bytes;
+  owned->second.erase(entry);
+  if (owned->second.empty()) projections.owned.erase(owned);
+  return true;
+}
+
+void GraphProjections::Set(const Owner &owner, std::string name, std::shared_ptr<const GraphProjection> projection) {
+  const auto bytes = projection->GetAllocatedBytes();
+  const auto memory_limit = memory_limit_.load(std::memory_order_relaxed);
+  if (memory_limit != 0 && bytes > memory_limit) {
+    throw QueryRuntimeException("The graph projection needs {}, which exceeds the graph projection memory limit of {}.",
+                                utils::GetReadableSize(static_cast<double>(bytes)),
+                                utils::GetReadableSize(static_cast<double>(memory_limit)));
+  }
+  projections_.WithLock([&](auto &projections) {
+    auto &owned = projections.owned[owner];
+    if (const auto found = owned.find(name); found != owned.end()) {
+      projections.allocated_bytes -= found->second.bytes;
+      owned.erase(found);
+    }
+    while (memory_limit != 0 && projections.allocated_bytes + bytes > memory_limit &&
+           EvictLeastRecentlyUsed(projections)) {
+    }
+    // Eviction may have dropped the map of the owner.
+    auto [entry, inserted] = projections.owned[owner].try_emplace(std::move(name), std::move(projection), ++clock_);
+    MG_ASSERT(inserted, "The replaced graph projection should have been removed.");
+    projections.allocated_bytes += entry->second.bytes;
+  });
+}
+
+std::shared_ptr<const GraphProjection> GraphProjections::Get(const Owner &owner, std::string_view name) const {
+  return projections_.WithReadLock([&](const auto &projections) -> std::shared_ptr<const GraphProjection> {
+    const auto owned = projections.owned.find(owner);
+    if (owned == projections.owned.end()) return nullptr;
+    const auto found = owned->second.find(name);
+    if (found == owned->second.end()) return nullptr;
+    found->second.last_used.store(++clock_, std::memory_order_relaxed);
+    return found->second.projection;
+  });
+}
+
+bool GraphProjections::Drop(const Owner &owner, std::string_view name) {
+  return projections_.WithLock([&](auto &projections) {
+    const auto owned = projections.owned.find(owner);
+    if (owned == projections.owned.end()) return false;
+    const auto found = owned->second.find(name);
+    if (found == owned->second.end()) return false;
+    projections.allocated_bytes -= found->second.bytes;
+    owned->second.erase(found);
+    if (owned->second.empty()) projections.owned.erase(owned);
+    return true;
+  });
+}
+
+GraphProjections::Map GraphProjections::List(const Owner &owner) const {
+  return projections_.WithReadLock([&](const auto &projections) {
+    Map list;
+    const auto owned = projections.owned.find(owner);
+    if (owned == projections.owned.end()) return list;
+    for (const auto &[name, entry] : owned->second) list.emplace(name, entry.projection);
+    return list;
+  });
+}
+
+void GraphProjections::DropStorage(std::string_view storage) {
+  projections_.WithLock([&](auto &projections) {
+    for (auto owned = projections.owned.begin(); owned != projections.owned.end();) {
+      if (owned->first.storage != storage) {
+        ++owned;
+        continue;
+      }
+      for (const auto &[name, entry] : owned->second) projections.allocated_bytes -= entry.bytes;
+      owned = projections.owned.erase(owned);
+    }
+  });
+}
+
+}  // namespace memgraph::query::procedure
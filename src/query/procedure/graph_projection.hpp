@@ -0,0 +1,218 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// Read-only projections of the graph for analytical procedures.
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "query/db_accessor.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/rw_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::query::procedure {
+
+/// Immutable copy of a part of the graph in compressed sparse row (CSR)
+/// format, taken at the snapshot of the transaction which built it.
+///
+/// Projected vertices are numbered from 0 to `VertexCount() - 1` in the order
+/// of their Gids. The neighbors of a vertex are stored as ordinals in one
+/// contiguous array, so that iterative algorithms can traverse the projection
+/// without going through MVCC, and neighbor spans can be handed out without
+/// copying. Multiple edges between the same vertices are all kept. Numeric
+/// vertex properties can be projected as columns indexed by ordinal.
+class GraphProjection final {
+ public:
+  /// Selects the part of the graph which is projected.
+  struct Spec {
+    /// Vertices with at least one of the labels are projected, all vertices
+    /// if empty.
+    std::vector<std::string> labels;
+    /// Edges of one of the types between projected vertices are projected,
+    /// edges of all types if empty.
+    std::vector<std::string> edge_types;
+    /// Numeric edge property which is projected as edge weights, no weights
+    /// are projected if not set.
+    std::optional<std::string> weight_property;
+    /// Weight of the edges which don't have the weight property.
+    double default_weight{1.0};
+    /// Numeric vertex properties which are projected as columns, see
+    /// `VertexProperty`.
+    std::vector<std::string> vertex_properties;
+  };
+
+  /// Projects the graph visible through the accessor in the given view.
+  /// @throw QueryRuntimeException if the weight property or one of the vertex
+  ///                              properties isn't numeric
+  /// @throw std::bad_alloc
+  template <class TDbAccessor>
+  static GraphProjection Build(TDbAccessor *dba, storage::View view, const Spec &spec);
+
+  uint64_t VertexCount() const { return gids_.size(); }
+  uint64_t EdgeCount() const { return out_neighbors_.size(); }
+  bool HasWeights() const { return weighted_; }
+
+  /// Gid of the vertex with the given ordinal, which must be less than
+  /// `VertexCount()`.
+  storage::Gid VertexGid(uint64_t ordinal) const { return gids_[ordinal]; }
+
+  /// Ordinal of the vertex with the given Gid, or `std::nullopt` if the vertex
+  /// isn't projected.
+  std::optional<uint64_t> VertexOrdinal(storage::Gid gid) const;
+
+  /// Ordinals of the targets of the outgoing edges of the vertex.
+  std::span<const uint64_t> OutNeighbors(uint64_t ordinal) const {
+    return Span(out_neighbors_, out_offsets_, ordinal);
+  }
+
+  /// Ordinals of the sources of the incoming edges of the vertex.
+  std::span<const uint64_t> InNeighbors(uint64_t ordinal) const { return Span(in_neighbors_, in_offsets_, ordinal); }
+
+  /// Weights of the outgoing edges of the vertex, in the order of
+  /// `OutNeighbors`. Empty if the projection has no weights.
+  std::span<const double> OutWeights(uint64_t ordinal) const {
+    if (!weighted_) return {};
+    return Span(out_weights_, out_offsets_, ordinal);
+  }
+
+  /// Weights of the incoming edges of the vertex, in the order of
+  /// `InNeighbors`. Empty if the projection has no weights.
+  std::span<const double> InWeights(uint64_t ordinal) const {
+    if (!weighted_) return {};
+    return Span(in_weights_, in_offsets_, ordinal);
+  }
+
+  /// Values of the projected vertex property indexed by ordinal, NaN for the
+  /// vertices which don't have it. `std::nullopt` if the property wasn't
+  /// projected.
+  std::optional<std::span<const double>> VertexProperty(std::string_view name) const;
+
+  /// Bytes allocated for the projection.
+  size_t GetAllocatedBytes() const;
+
+ private:
+  template <class T>
+  static std::span<const T> Span(const std::vector<T> &values, const std::vector<uint64_t> &offsets,
+                                 uint64_t ordinal) {
+    return {values.data() + offsets[ordinal], values.data() + offsets[ordinal + 1]};
+  }
+
+  // Gids of the projected vertices, sorted, indexed by ordinal.
+  std::vector<storage::Gid> gids_;
+  // Edges of the vertex with ordinal `i` are stored at positions from
+  // `offsets[i]` to `offsets[i + 1]`.
+  std::vector<uint64_t> out_offsets_{0};
+  std::vector<uint64_t> out_neighbors_;
+  std::vector<double> out_weights_;
+  std::vector<uint64_t> in_offsets_{0};
+  std::vector<uint64_t> in_neighbors_;
+  std::vector<double> in_weights_;
+  bool weighted_{false};
+  std::map<std::string, std::vector<double>, std::less<>> vertex_properties_;
+};
+
+/// Graph projections cached by name. A projection stays cached, and doesn't
+/// see any later changes of the graph, until it's replaced or dropped.
+///
+/// Projections are cached separately for each storage and user, so a
+/// projection is only visible to the user who projected it from the same
+/// storage.
+///
+/// The memory of all cached projections is bounded by a limit. Caching a
+/// projection which doesn't fit evicts the least recently used projections of
+/// all owners, while procedures which got them can keep using them.
+class GraphProjections final {
+ public:
+  using Map = std::map<std::string, std::shared_ptr<const GraphProjection>, std::less<>>;
+
+  struct Owner {
+    /// UUID of the projected storage.
+    std::string storage;
+    /// User who projected the graph, not set if authentication is disabled.
+    std::optional<std::string> user;
+
+    auto operator<=>(const Owner &) const = default;
+  };
+
+  /// Caches the projection under the given name, replacing the one the owner
+  /// cached under the same name and evicting the least recently used
+  /// projections if it doesn't fit the memory limit.
+  /// @throw QueryRuntimeException if the projection alone exceeds the limit
+  void Set(const Owner &owner, std::string name, std::shared_ptr<const GraphProjection> projection);
+
+  /// Returns the projection the owner cached under the given name, or nullptr.
+  /// Marks the projection as the most recently used one.
+  std::shared_ptr<const GraphProjection> Get(const Owner &owner, std::string_view name) const;
+
+  /// Drops the projection the owner cached under the given name. Procedures
+  /// which got it can keep using it. Returns false if there's no such
+  /// projection.
+  bool Drop(const Owner &owner, std::string_view name);
+
+  /// Returns all projections the owner cached sorted by name.
+  Map List(const Owner &owner) const;
+
+  /// Drops the projections of all users from the storage with the given UUID,
+  /// which is called once the storage is gone.
+  void DropStorage(std::string_view storage);
+
+  /// Sets the limit of the bytes allocated for all cached projections, 0 for
+  /// no limit. Projections which are already cached are evicted only when the
+  /// next one is cached.
+  void SetMemoryLimit(size_t bytes) { memory_limit_.store(bytes, std::memory_order_relaxed); }
+
+  /// Bytes allocated for all cached projections.
+  size_t GetAllocatedBytes() const {
+    return projections_.WithReadLock([](const auto &projections) { return projections.allocated_bytes; });
+  }
+
+ private:
+  struct Entry {
+    Entry(std::shared_ptr<const GraphProjection> projection, uint64_t last_used)
+        : projection(std::move(projection)), bytes(this->projection->GetAllocatedBytes()), last_used(last_used) {}
+
+    std::shared_ptr<const GraphProjection> projection;
+    size_t bytes;
+    // Updated by `Get` under the read lock.
+    mutable std::atomic<uint64_t> last_used;
+  };
+
+  struct Projections {
+    std::map<Owner, std::map<std::string, Entry, std::less<>>> owned;
+    size_t allocated_bytes{0};
+  };
+
+  // Removes the projection which was used the least recently. Returns false if
+  // there are no projections.
+  static bool EvictLeastRecentlyUsed(Projections &projections);
+
+  utils::Synchronized<Projections, utils::WritePrioritizedRWLock> projections_;
+  std::atomic<size_t> memory_limit_{0};
+  // Logical clock which orders the uses of the projections.
+  mutable std::atomic<uint64_t> clock_{0};
+};
+
+/// Projections shared by all procedures.
+extern GraphProjections gGraphProjections;
+
+}  // namespace memgraph::query::procedure
@@ -12,10 +12,12 @@
 #include "query/procedure/mg_procedure_impl.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <regex>
 #include <stdexcept>
@@ -38,6 +40,7 @@
 #include "utils/memory.hpp"
 #include "utils/string.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/variant_helpers.hpp"
 
 #include <cppitertools/filter.hpp>
@@ -201,7 +204,7 @@ template <typename TFunc, typename... Args>
 
 // Graph mutations
 bool MgpGraphIsMutable(const mgp_graph &graph) noexcept {
-  return graph.view == memgraph::storage::View::NEW && graph.ctx != nullptr;
+  return graph.view == memgraph::storage::View::NEW && graph.ctx != nullptr && !graph.is_parallel_worker;
 }
 
 bool MgpVertexIsMutable(const mgp_vertex &vertex) { return MgpGraphIsMutable(*vertex.graph); }
@@ -1502,6 +1505,10 @@ mgp_error mgp_result_new_record(mgp_result *res, mgp_result_record **result) {
       result);
 }
 
+mgp_error mgp_result_batch_size(mgp_result *res, size_t *result) {
+  return WrapExceptions([res] { return res->batch_size; }, result);
+}
+
 mgp_error mgp_result_record_insert(mgp_result_record *record, const char *field_name, mgp_value *val) {
   return WrapExceptions([=] {
     auto *memory = record->values.get_allocator().GetMemoryResource();
@@ -1584,6 +1591,33 @@ mgp_error mgp_vertex_get_id(mgp_vertex *v, mgp_vertex_id *result) {
       result);
 }
 
+namespace {
+const memgraph::storage::VertexOrdinals &GetVertexOrdinals(mgp_graph *graph) {
+  if (!graph->vertex_ordinals) {
+    auto *pool = graph->ctx ? graph->ctx->procedure_worker_pool : nullptr;
+    auto ordinals =
+        std::visit([graph, pool](auto *impl) { return impl->GetVertexOrdinals(graph->view, pool); }, graph->impl);
+    const auto allocated_bytes = ordinals.numbering().GetAllocatedBytes();
+    graph->vertex_ordinals.reset(new mgp_graph::LimitedVertexOrdinals{
+        std::move(ordinals), {graph->ctx ? graph->ctx->memory_limit : nullptr, allocated_bytes}});
+  }
+  return graph->vertex_ordinals->ordinals;
+}
+}  // namespace
+
+mgp_error mgp_vertex_get_ordinal(mgp_vertex *v, size_t *result) {
+  return WrapExceptions(
+      [v] {
+        const auto gid = std::visit([](auto &impl) { return impl.Gid(); }, v->impl);
+        const auto ordinal = GetVertexOrdinals(v->graph).Ordinal(gid);
+        if (!ordinal) {
+          throw std::out_of_range(fmt::format("Vertex {} doesn't have an ordinal", gid.AsInt()));
+        }
+        return static_cast<size_t>(*ordinal);
+      },
+      result);
+}
+
 mgp_error mgp_vertex_underlying_graph_is_mutable(mgp_vertex *v, int *result) {
   return mgp_graph_is_mutable(v->graph, result);
 }
@@ -2300,6 +2334,122 @@ mgp_error mgp_graph_get_vertex_by_id(mgp_graph *graph, mgp_vertex_id id, mgp_mem
       result);
 }
 
+mgp_error mgp_graph_vertex_ordinal_count(mgp_graph *graph, size_t *result) {
+  return WrapExceptions([graph] { return static_cast<size_t>(GetVertexOrdinals(graph).size()); }, result);
+}
+
+mgp_error mgp_graph_get_vertex_by_ordinal(mgp_graph *graph, size_t ordinal, mgp_memory *memory, mgp_vertex **result) {
+  return WrapExceptions(
+      [graph, ordinal, memory]() -> mgp_vertex * {
+        const auto &ordinals = GetVertexOrdinals(graph);
+        if (ordinal >= ordinals.size()) {
+          throw std::out_of_range(fmt::format("Vertex ordinal {} is out of range", ordinal));
+        }
+        memgraph::query::VertexAccessor vertex(ordinals.Vertex(ordinal));
+        return std::visit(memgraph::utils::Overloaded{
+                              [memory, graph, &vertex](memgraph::query::DbAccessor *) {
+                                return NewRawMgpObject<mgp_vertex>(memory, vertex, graph);
+                              },
+                              [memory, graph, &vertex](memgraph::query::SubgraphDbAccessor *impl) {
+                                return NewRawMgpObject<mgp_vertex>(
+                                    memory, memgraph::query::SubgraphVertexAccessor(vertex, impl->getGraph()), graph);
+                              }},
+                          graph->impl);
+      },
+      result);
+}
+
+namespace {
+memgraph::utils::ThreadPool *ProcedureWorkerPool(const mgp_graph &graph) {
+  // Workers run on the pool, so they would wait on themselves if they handed
+  // out tasks to it.
+  if (graph.is_parallel_worker || !graph.ctx) return nullptr;
+  return graph.ctx->procedure_worker_pool;
+}
+
+size_t ParallelWorkerCount(const mgp_graph &graph) {
+  auto *pool = ProcedureWorkerPool(graph);
+  return pool ? pool->Size() : 1;
+}
+
+/// Hands out consecutive ranges of at most `grain_size` indices from
+/// [0, size) to at most `max_workers` workers, or to all of them if it's 0,
+/// until all ranges are processed or `process_range` returns an error, which
+/// is then returned.
+/// @throw std::invalid_argument if `grain_size` is 0
+template <class TProcessRange>
+std::optional<mgp_error> ParallelForRanges(const mgp_graph &graph, const size_t size, const size_t grain_size,
+                                           const size_t max_workers, const TProcessRange &process_range) {
+  if (grain_size == 0U) {
+    throw std::invalid_argument{"Grain size of a parallel for must be greater than 0"};
+  }
+  const auto num_ranges = (size + grain_size - 1) / grain_size;
+  auto num_workers = std::min(ParallelWorkerCount(graph), num_ranges);
+  if (max_workers > 0U) num_workers = std::min(num_workers, max_workers);
+  std::atomic<size_t> next_range{0};
+  std::atomic<bool> stop{false};
+  std::optional<mgp_error> range_error;
+  std::mutex error_lock;
+  auto *query_memory_limit = graph.ctx ? graph.ctx->memory_limit : nullptr;
+  memgraph::utils::ParallelFor(ProcedureWorkerPool(graph), num_workers, [&](const size_t worker) {
+    // Each worker allocates from an arena of its own, as memory resources
+    // aren't thread-safe. The arenas are counted against the memory limits of
+    // the query and of the procedure.
+    memgraph::utils::LimitedMemoryResource query_memory(memgraph::utils::NewDeleteResource(), query_memory_limit);
+    memgraph::utils::LimitedMemoryResource procedure_memory(&query_memory, graph.procedure_memory_limit);
+    memgraph::utils::PoolResource arena(128, 1024, &procedure_memory, &procedure_memory);
+    mgp_memory memory{&arena};
+    while (!stop.load(std::memory_order_acquire)) {
+      const auto range = next_range.fetch_add(1, std::memory_order_relaxed);
+      if (range >= num_ranges) break;
+      const auto begin = range * grain_size;
+      const auto end = std::min(begin + grain_size, size);
+      if (const auto error = process_range(worker, begin, end, &memory); error != mgp_error::MGP_ERROR_NO_ERROR) {
+        std::lock_guard guard(error_lock);
+        if (!range_error) range_error = error;
+        stop.store(true, std::memory_order_release);
+      }
+    }
+  });
+  return range_error;
+}
+}  // namespace
+
+mgp_error mgp_graph_parallel_worker_count(mgp_graph *graph, size_t *result) {
+  return WrapExceptions([graph] { return ParallelWorkerCount(*graph); }, result);
+}
+
+mgp_error mgp_graph_parallel_for_vertices(mgp_graph *graph, size_t grain_size, mgp_vertex_range_cb cb, void *data) {
+  // Errors of the callback are returned as they are, instead of being wrapped.
+  std::optional<mgp_error> cb_error;
+  const auto error = WrapExceptions([&] {
+    // The numbering is built up front, since the workers share it.
+    const auto vertex_count = static_cast<size_t>(GetVertexOrdinals(graph).size());
+    auto worker_graph = *graph;
+    worker_graph.is_parallel_worker = true;
+    cb_error = ParallelForRanges(*graph, vertex_count, grain_size, 0U,
+                                 [&](size_t worker, size_t begin, size_t end, mgp_memory *memory) {
+                                   return cb(&worker_graph, worker, begin, end, memory, data);
+                                 });
+  });
+  if (error != mgp_error::MGP_ERROR_NO_ERROR) return error;
+  return cb_error.value_or(mgp_error::MGP_ERROR_NO_ERROR);
+}
+
+mgp_error mgp_graph_parallel_for(mgp_graph *graph, size_t size, size_t grain_size, size_t max_workers, mgp_range_cb cb,
+                                 void *data) {
+  // Errors of the callback are returned as they are, instead of being wrapped.
+  std::optional<mgp_error> cb_error;
+  const auto error = WrapExceptions([&] {
+    cb_error = ParallelForRanges(*graph, size, grain_size, max_workers,
+                                 [&](size_t worker, size_t begin, size_t end, mgp_memory * /*memory*/) {
+                                   return cb(worker, begin, end, data);
+                                 });
+  });
+  if (error != mgp_error::MGP_ERROR_NO_ERROR) return error;
+  return cb_error.value_or(mgp_error::MGP_ERROR_NO_ERROR);
+}
+
 mgp_error mgp_graph_is_mutable(mgp_graph *graph, int *result) {
   *result = MgpGraphIsMutable(*graph) ? 1 : 0;
   return mgp_error::MGP_ERROR_NO_ERROR;
@@ -2654,6 +2804,120 @@ mgp_error mgp_vertices_iterator_next(mgp_vertices_iterator *it, mgp_vertex **res
       result);
 }
 
+mgp_error mgp_graph_get_projection(mgp_graph *graph, const char *name, mgp_memory *memory,
+                                   mgp_graph_projection **result) {
+  return WrapExceptions(
+      [graph, name, memory]() -> mgp_graph_projection * {
+        auto projection = memgraph::query::procedure::gGraphProjections.Get(
+            memgraph::query::procedure::GetGraphProjectionOwner(*graph), name);
+        if (!projection) {
+          return nullptr;
+        }
+        return NewRawMgpObject<mgp_graph_projection>(memory, std::move(projection));
+      },
+      result);
+}
+
+void mgp_graph_projection_destroy(mgp_graph_projection *projection) { DeleteRawMgpObject(projection); }
+
+mgp_error mgp_graph_projection_vertex_count(mgp_graph_projection *projection, size_t *result) {
+  return WrapExceptions([projection] { return static_cast<size_t>(projection->impl->VertexCount()); }, result);
+}
+
+mgp_error mgp_graph_projection_edge_count(mgp_graph_projection *projection, size_t *result) {
+  return WrapExceptions([projection] { return static_cast<size_t>(projection->impl->EdgeCount()); }, result);
+}
+
+mgp_error mgp_graph_projection_has_weights(mgp_graph_projection *projection, int *result) {
+  return WrapExceptions([projection] { return projection->impl->HasWeights() ? 1 : 0; }, result);
+}
+
+namespace {
+void CheckProjectionOrdinal(const mgp_graph_projection &projection, size_t ordinal) {
+  if (ordinal >= projection.impl->VertexCount()) {
+    throw std::out_of_range(fmt::format("Vertex ordinal {} is out of range", ordinal));
+  }
+}
+}  // namespace
+
+mgp_error mgp_graph_projection_vertex_id(mgp_graph_projection *projection, size_t ordinal, mgp_vertex_id *result) {
+  return WrapExceptions(
+      [projection, ordinal] {
+        CheckProjectionOrdinal(*projection, ordinal);
+        return mgp_vertex_id{.as_int = projection->impl->VertexGid(ordinal).AsInt()};
+      },
+      result);
+}
+
+mgp_error mgp_graph_projection_vertex_ordinal(mgp_graph_projection *projection, mgp_vertex_id id, size_t *result) {
+  return WrapExceptions(
+      [projection, id] {
+        const auto ordinal = projection->impl->VertexOrdinal(memgraph::storage::Gid::FromInt(id.as_int));
+        if (!ordinal) {
+          throw std::out_of_range(fmt::format("Vertex {} isn't projected", id.as_int));
+        }
+        return static_cast<size_t>(*ordinal);
+      },
+      result);
+}
+
+mgp_error mgp_graph_projection_out_neighbors(mgp_graph_projection *projection, size_t ordinal,
+                                             const uint64_t **neighbors, size_t *count) {
+  return WrapExceptions([projection, ordinal, neighbors, count] {
+    CheckProjectionOrdinal(*projection, ordinal);
+    const auto span = projection->impl->OutNeighbors(ordinal);
+    *neighbors = span.data();
+    *count = span.size();
+  });
+}
+
+mgp_error mgp_graph_projection_in_neighbors(mgp_graph_projection *projection, size_t ordinal,
+                                            const uint64_t **neighbors, size_t *count) {
+  return WrapExceptions([projection, ordinal, neighbors, count] {
+    CheckProjectionOrdinal(*projection, ordinal);
+    const auto span = projection->impl->InNeighbors(ordinal);
+    *neighbors = span.data();
+    *count = span.size();
+  });
+}
+
+mgp_error mgp_graph_projection_out_weights(mgp_graph_projection *projection, size_t ordinal, const double **result) {
+  return WrapExceptions(
+      [projection, ordinal]() -> const double * {
+        CheckProjectionOrdinal(*projection, ordinal);
+        if (!projection->impl->HasWeights()) {
+          return nullptr;
+        }
+        return projection->impl->OutWeights(ordinal).data();
+      },
+      result);
+}
+
+mgp_error mgp_graph_projection_in_weights(mgp_graph_projection *projection, size_t ordinal, const double **result) {
+  return WrapExceptions(
+      [projection, ordinal]() -> const double * {
+        CheckProjectionOrdinal(*projection, ordinal);
+        if (!projection->impl->HasWeights()) {
+          return nullptr;
+        }
+        return projection->impl->InWeights(ordinal).data();
+      },
+      result);
+}
+
+mgp_error mgp_graph_projection_vertex_property(mgp_graph_projection *projection, const char *name,
+                                               const double **result) {
+  return WrapExceptions(
+      [projection, name]() -> const double * {
+        const auto values = projection->impl->VertexProperty(name);
+        if (!values) {
+          return nullptr;
+        }
+        return values->data();
+      },
+      result);
+}
+
 /// Type System
 ///
 /// All types are allocated globally, so that we simplify the API and minimize
@@ -2731,7 +2995,8 @@ mgp_error mgp_type_nullable(mgp_type *type, mgp_type **result) {
 }
 
 namespace {
-mgp_proc *mgp_module_add_procedure(mgp_module *module, const char *name, mgp_proc_cb cb,
+template <class TCallbacks>
+mgp_proc *mgp_module_add_procedure(mgp_module *module, const char *name, TCallbacks callbacks,
                                    const ProcedureInfo &procedure_info) {
   if (!IsValidIdentifierName(name)) {
     throw std::invalid_argument{fmt::format("Invalid procedure name: {}", name)};
@@ -2742,7 +3007,16 @@ mgp_proc *mgp_module_add_procedure(mgp_module *module, const char *name, mgp_pro
 
   auto *memory = module->procedures.get_allocator().GetMemoryResource();
   // May throw std::bad_alloc, std::length_error
-  return &module->procedures.emplace(name, mgp_proc(name, cb, memory, procedure_info)).first->second;
+  return &module->procedures.emplace(name, mgp_proc(name, std::move(callbacks), memory, procedure_info))
+              .first->second;
+}
+
+ProcedureBatchCallbacks MakeBatchCallbacks(mgp_proc_batch_init init, mgp_proc_batch_cb cb,
+                                           mgp_proc_batch_cleanup cleanup) {
+  if (init == nullptr || cb == nullptr || cleanup == nullptr) {
+    throw std::invalid_argument{"All callbacks of a batched procedure must be set"};
+  }
+  return {.init = init, .next = cb, .cleanup = cleanup};
 }
 }  // namespace
 
@@ -2754,6 +3028,26 @@ mgp_error mgp_module_add_write_procedure(mgp_module *module, const char *name, m
   return WrapExceptions([=] { return mgp_module_add_procedure(module, name, cb, {.is_write = true}); }, result);
 }
 
+mgp_error mgp_module_add_batch_read_procedure(mgp_module *module, const char *name, mgp_proc_batch_init init,
+                                              mgp_proc_batch_cb cb, mgp_proc_batch_cleanup cleanup,
+                                              mgp_proc **result) {
+  return WrapExceptions(
+      [=] {
+        return mgp_module_add_procedure(module, name, MakeBatchCallbacks(init, cb, cleanup), {.is_write = false});
+      },
+      result);
+}
+
+mgp_error mgp_module_add_batch_write_procedure(mgp_module *module, const char *name, mgp_proc_batch_init init,
+                                               mgp_proc_batch_cb cb, mgp_proc_batch_cleanup cleanup,
+                                               mgp_proc **result) {
+  return WrapExceptions(
+      [=] {
+        return mgp_module_add_procedure(module, name, MakeBatchCallbacks(init, cb, cleanup), {.is_write = true});
+      },
+      result);
+}
+
 namespace {
 template <typename T>
 concept IsCallable = memgraph::utils::SameAsAnyOf<T, mgp_proc, mgp_func>;
@@ -2978,6 +3272,19 @@ bool IsValidIdentifierName(const char *name) {
   return std::regex_match(name, regex);
 }
 
+GraphProjections::Owner GetGraphProjectionOwner(const mgp_graph &graph) {
+#ifdef MG_ENTERPRISE
+  // Projections are read without the fine-grained checks of labels and edge
+  // types, so they would expose data hidden from the user.
+  if (license::global_license_checker.IsEnterpriseValidFast() && graph.ctx && graph.ctx->auth_checker) {
+    throw AuthorizationException{"Graph projections can't be used with fine-grained access control!"};
+  }
+#endif
+  GraphProjections::Owner owner{.storage = std::visit([](const auto *impl) { return impl->StorageUuid(); }, graph.impl)};
+  if (graph.ctx) owner.user = graph.ctx->username;
+  return owner;
+}
+
 }  // namespace memgraph::query::procedure
 
 namespace {
@@ -3131,6 +3438,12 @@ mgp_error mgp_messages_at(mgp_messages *messages, size_t index, mgp_message **re
       result);
 }
 
+mgp_error mgp_messages_transformation_config(mgp_messages *messages, mgp_map **result) {
+  static_assert(noexcept(&messages->transformation_config));
+  *result = &messages->transformation_config;
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
 mgp_error mgp_module_add_transformation(mgp_module *module, const char *name, mgp_trans_cb cb) {
   return WrapExceptions([=] {
     if (!IsValidIdentifierName(name)) {
@@ -16,6 +16,7 @@
 
 #include "mg_procedure.h"
 
+#include <memory>
 #include <optional>
 #include <ostream>
 
@@ -25,7 +26,9 @@
 #include "query/db_accessor.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/procedure/cypher_type_ptr.hpp"
+#include "query/procedure/graph_projection.hpp"
 #include "query/typed_value.hpp"
+#include "storage/v2/vertex_ordinals.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/memory.hpp"
 #include "utils/pmr/map.hpp"
@@ -569,6 +572,22 @@ struct mgp_graph {
   // TODO: Merge `mgp_graph` and `mgp_memory` into a single `mgp_context`. The
   // `ctx` field is out of place here.
   memgraph::query::ExecutionContext *ctx;
+  // Dense numbering of the vertices, got on first use by the vertex ordinal
+  // functions. Other queries may share the numbering, so it isn't allocated
+  // from the query memory, but counted against the query memory limit while
+  // the graph uses it.
+  struct LimitedVertexOrdinals {
+    memgraph::storage::VertexOrdinals ordinals;
+    memgraph::utils::MemoryLimitCharge charge;
+  };
+  std::shared_ptr<const LimitedVertexOrdinals> vertex_ordinals{};
+  // Set on the read-only views handed to the workers of
+  // mgp_graph_parallel_for_vertices, which may be used concurrently.
+  bool is_parallel_worker{false};
+  // PROCEDURE MEMORY LIMIT of the call, which the arenas of the parallel
+  // workers are counted against next to the memory of the procedure. Not set
+  // if the call has no limit.
+  memgraph::utils::MemoryLimit *procedure_memory_limit{nullptr};
 
   static mgp_graph WritableGraph(memgraph::query::DbAccessor &acc, memgraph::storage::View view,
                                  memgraph::query::ExecutionContext &ctx) {
@@ -608,6 +627,9 @@ struct mgp_result {
                                   std::pair<const memgraph::query::procedure::CypherType *, bool>> *signature;
   memgraph::utils::pmr::vector<mgp_result_record> rows;
   std::optional<memgraph::utils::pmr::string> error_msg;
+  /// Number of records a call of a batched procedure should produce, 0 for
+  /// procedures which aren't batched.
+  size_t batch_size{0};
 };
 
 struct mgp_func_result {
@@ -724,6 +746,19 @@ struct mgp_vertices_iterator {
   std::optional<mgp_vertex> current_v;
 };
 
+struct mgp_graph_projection {
+  using allocator_type = memgraph::utils::Allocator<mgp_graph_projection>;
+
+  mgp_graph_projection(std::shared_ptr<const memgraph::query::procedure::GraphProjection> impl,
+                       memgraph::utils::MemoryResource *memory) noexcept
+      : memory(memory), impl(std::move(impl)) {}
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const noexcept { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  std::shared_ptr<const memgraph::query::procedure::GraphProjection> impl;
+};
+
 struct mgp_type {
   memgraph::query::procedure::CypherTypePtr impl;
 };
@@ -732,6 +767,15 @@ struct ProcedureInfo {
   bool is_write = false;
   std::optional<memgraph::query::AuthQuery::Privilege> required_privilege = std::nullopt;
 };
+
+/// Callbacks of a batched procedure, which are invoked instead of
+/// `mgp_proc::cb`; see mgp_module_add_batch_read_procedure.
+struct ProcedureBatchCallbacks {
+  std::function<void *(mgp_list *, mgp_graph *, mgp_result *, mgp_memory *)> init;
+  std::function<void(void *, mgp_graph *, mgp_result *, mgp_memory *)> next;
+  std::function<void(void *, mgp_memory *)> cleanup;
+};
+
 struct mgp_proc {
   using allocator_type = memgraph::utils::Allocator<mgp_proc>;
 
@@ -752,6 +796,17 @@ struct mgp_proc {
            memgraph::utils::MemoryResource *memory, const ProcedureInfo &info = {})
       : name(name, memory), cb(cb), args(memory), opt_args(memory), results(memory), info(info) {}
 
+  /// @throw std::bad_alloc
+  /// @throw std::length_error
+  mgp_proc(const std::string_view name, ProcedureBatchCallbacks batch, memgraph::utils::MemoryResource *memory,
+           const ProcedureInfo &info = {})
+      : name(name, memory),
+        args(memory),
+        opt_args(memory),
+        results(memory),
+        info(info),
+        batch(std::move(batch)) {}
+
   /// @throw std::bad_alloc
   /// @throw std::length_error
   mgp_proc(const mgp_proc &other, memgraph::utils::MemoryResource *memory)
@@ -760,7 +815,8 @@ struct mgp_proc {
         args(other.args, memory),
         opt_args(other.opt_args, memory),
         results(other.results, memory),
-        info(other.info) {}
+        info(other.info),
+        batch(other.batch) {}
 
   mgp_proc(mgp_proc &&other, memgraph::utils::MemoryResource *memory)
       : name(std::move(other.name), memory),
@@ -768,7 +824,8 @@ struct mgp_proc {
         args(std::move(other.args), memory),
         opt_args(std::move(other.opt_args), memory),
         results(std::move(other.results), memory),
-        info(other.info) {}
+        info(other.info),
+        batch(std::move(other.batch)) {}
 
   mgp_proc(const mgp_proc &other) = default;
   mgp_proc(mgp_proc &&other) = default;
@@ -794,6 +851,8 @@ struct mgp_proc {
                             std::pair<const memgraph::query::procedure::CypherType *, bool>>
       results;
   ProcedureInfo info;
+  /// Set for batched procedures, which don't have `cb`.
+  std::optional<ProcedureBatchCallbacks> batch;
 };
 
 struct mgp_trans {
@@ -927,6 +986,12 @@ void PrintFuncSignature(const mgp_func &, std::ostream &);
 
 bool IsValidIdentifierName(const char *name);
 
+/// Returns the owner of the graph projections a procedure may use through
+/// the graph.
+/// @throw utils::BasicException if fine-grained access control applies to
+/// the graph, which projections don't respect.
+GraphProjections::Owner GetGraphProjectionOwner(const mgp_graph &graph);
+
 }  // namespace memgraph::query::procedure
 
 struct mgp_message {
@@ -941,7 +1006,8 @@ struct mgp_message {
 struct mgp_messages {
   using allocator_type = memgraph::utils::Allocator<mgp_messages>;
   using storage_type = memgraph::utils::pmr::vector<mgp_message>;
-  explicit mgp_messages(storage_type &&storage) : messages(std::move(storage)) {}
+  explicit mgp_messages(storage_type &&storage)
+      : messages(std::move(storage)), transformation_config(messages.get_allocator().GetMemoryResource()) {}
 
   mgp_messages(const mgp_messages &) = delete;
   mgp_messages &operator=(const mgp_messages &) = delete;
@@ -952,6 +1018,8 @@ struct mgp_messages {
   ~mgp_messages() = default;
 
   storage_type messages;
+  // String values of the TRANSFORM_CONFIG of the stream.
+  mgp_map transformation_config;
 };
 
 memgraph::query::TypedValue ToTypedValue(const mgp_value &val, memgraph::utils::MemoryResource *memory);
@@ -22,6 +22,7 @@ extern "C" {
 #include <unistd.h>
 
 #include "py/py.hpp"
+#include "query/procedure/graph_projection.hpp"
 #include "query/procedure/mg_procedure_helpers.hpp"
 #include "query/procedure/py_module.hpp"
 #include "utils/file.hpp"
@@ -59,6 +60,24 @@ ModuleRegistry gModuleRegistry;
 
 Module::~Module() {}
 
+void Module::AddBatchedCallCleanUp(std::weak_ptr<void> call, std::function<void()> clean_up) const {
+  std::lock_guard<std::mutex> guard(batched_calls_lock_);
+  // Calls which finished in the meantime don't need to be cleaned up anymore.
+  std::erase_if(batched_calls_, [](const auto &batched_call) { return batched_call.first.expired(); });
+  batched_calls_.emplace_back(std::move(call), std::move(clean_up));
+}
+
+void Module::CleanUpBatchedCalls() const {
+  std::vector<std::pair<std::weak_ptr<void>, std::function<void()>>> batched_calls;
+  {
+    std::lock_guard<std::mutex> guard(batched_calls_lock_);
+    batched_calls.swap(batched_calls_);
+  }
+  for (auto &[call, clean_up] : batched_calls) {
+    if (auto alive = call.lock()) clean_up();
+  }
+}
+
 class BuiltinModule final : public Module {
  public:
   BuiltinModule();
@@ -768,6 +787,154 @@ void RegisterMgDeleteModuleFile(ModuleRegistry *module_registry, utils::RWLock *
   module->AddProcedure("delete_module_file", std::move(delete_module_file));
 }
 
+std::vector<std::string> GetStringListArgument(mgp_list *args, size_t index) {
+  auto *list = Call<mgp_list *>(mgp_value_get_list, Call<mgp_value *>(mgp_list_at, args, index));
+  const auto size = Call<size_t>(mgp_list_size, list);
+  std::vector<std::string> strings;
+  strings.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    strings.emplace_back(Call<const char *>(mgp_value_get_string, Call<mgp_value *>(mgp_list_at, list, i)));
+  }
+  return strings;
+}
+
+[[nodiscard]] bool InsertGraphProjectionOrSetError(mgp_result *result, mgp_memory *memory, const char *name,
+                                                   const GraphProjection &projection) {
+  mgp_result_record *record{nullptr};
+  if (!TryOrSetError([&] { return mgp_result_new_record(result, &record); }, result)) {
+    return false;
+  }
+
+  const auto name_value = GetStringValueOrSetError(name, memory, result);
+  if (!name_value) {
+    return false;
+  }
+
+  MgpUniquePtr<mgp_value> vertex_count_value{nullptr, mgp_value_destroy};
+  if (!TryOrSetError(
+          [&] {
+            return CreateMgpObject(vertex_count_value, mgp_value_make_int,
+                                   static_cast<int64_t>(projection.VertexCount()), memory);
+          },
+          result)) {
+    return false;
+  }
+
+  MgpUniquePtr<mgp_value> edge_count_value{nullptr, mgp_value_destroy};
+  if (!TryOrSetError(
+          [&] {
+            return CreateMgpObject(edge_count_value, mgp_value_make_int, static_cast<int64_t>(projection.EdgeCount()),
+                                   memory);
+          },
+          result)) {
+    return false;
+  }
+
+  MgpUniquePtr<mgp_value> weighted_value{nullptr, mgp_value_destroy};
+  if (!TryOrSetError(
+          [&] { return CreateMgpObject(weighted_value, mgp_value_make_bool, projection.HasWeights() ? 1 : 0, memory); },
+          result)) {
+    return false;
+  }
+
+  return InsertResultOrSetError(result, record, "name", name_value.get()) &&
+         InsertResultOrSetError(result, record, "vertex_count", vertex_count_value.get()) &&
+         InsertResultOrSetError(result, record, "edge_count", edge_count_value.get()) &&
+         InsertResultOrSetError(result, record, "weighted", weighted_value.get());
+}
+
+void AddGraphProjectionResults(mgp_proc *proc) {
+  MG_ASSERT(mgp_proc_add_result(proc, "name", Call<mgp_type *>(mgp_type_string)) == mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_result(proc, "vertex_count", Call<mgp_type *>(mgp_type_int)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_result(proc, "edge_count", Call<mgp_type *>(mgp_type_int)) == mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_result(proc, "weighted", Call<mgp_type *>(mgp_type_bool)) == mgp_error::MGP_ERROR_NO_ERROR);
+}
+
+void RegisterMgGraphProjections(BuiltinModule *module) {
+  auto project_graph_cb = [](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+    MG_ASSERT(Call<size_t>(mgp_list_size, args) == 5U, "Should have been type checked already");
+    const auto *name = Call<const char *>(mgp_value_get_string, Call<mgp_value *>(mgp_list_at, args, 0));
+    GraphProjection::Spec spec{.labels = GetStringListArgument(args, 1),
+                               .edge_types = GetStringListArgument(args, 2),
+                               .vertex_properties = GetStringListArgument(args, 4)};
+    auto *weight_property = Call<mgp_value *>(mgp_list_at, args, 3);
+    if (!CallBool(mgp_value_is_null, weight_property)) {
+      spec.weight_property = Call<const char *>(mgp_value_get_string, weight_property);
+    }
+
+    GraphProjections::Owner owner;
+    std::shared_ptr<const GraphProjection> projection;
+    try {
+      owner = GetGraphProjectionOwner(*graph);
+      projection = std::make_shared<const GraphProjection>(
+          std::visit([&](auto *impl) { return GraphProjection::Build(impl, graph->view, spec); }, graph->impl));
+      gGraphProjections.Set(owner, name, projection);
+    } catch (const std::exception &e) {
+      static_cast<void>(mgp_result_set_error_msg(result, e.what()));
+      return;
+    }
+    static_cast<void>(InsertGraphProjectionOrSetError(result, memory, name, *projection));
+  };
+  mgp_proc project_graph("project_graph", project_graph_cb, utils::NewDeleteResource());
+  MG_ASSERT(mgp_proc_add_arg(&project_graph, "name", Call<mgp_type *>(mgp_type_string)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&project_graph, "labels",
+                             Call<mgp_type *>(mgp_type_list, Call<mgp_type *>(mgp_type_string))) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&project_graph, "edge_types",
+                             Call<mgp_type *>(mgp_type_list, Call<mgp_type *>(mgp_type_string))) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&project_graph, "weight_property",
+                             Call<mgp_type *>(mgp_type_nullable, Call<mgp_type *>(mgp_type_string))) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  mgp_memory memory{utils::NewDeleteResource()};
+  MgpUniquePtr<mgp_value> no_vertex_properties{
+      Call<mgp_value *>(mgp_value_make_list, Call<mgp_list *>(mgp_list_make_empty, 0, &memory)), mgp_value_destroy};
+  MG_ASSERT(mgp_proc_add_opt_arg(&project_graph, "vertex_properties",
+                                 Call<mgp_type *>(mgp_type_list, Call<mgp_type *>(mgp_type_string)),
+                                 no_vertex_properties.get()) == mgp_error::MGP_ERROR_NO_ERROR);
+  AddGraphProjectionResults(&project_graph);
+  module->AddProcedure("project_graph", std::move(project_graph));
+
+  auto drop_graph_projection_cb = [](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory * /*memory*/) {
+    MG_ASSERT(Call<size_t>(mgp_list_size, args) == 1U, "Should have been type checked already");
+    const auto *name = Call<const char *>(mgp_value_get_string, Call<mgp_value *>(mgp_list_at, args, 0));
+    GraphProjections::Owner owner;
+    try {
+      owner = GetGraphProjectionOwner(*graph);
+    } catch (const std::exception &e) {
+      static_cast<void>(mgp_result_set_error_msg(result, e.what()));
+      return;
+    }
+    if (!gGraphProjections.Drop(owner, name)) {
+      static_cast<void>(mgp_result_set_error_msg(result, "There's no graph projection with the given name."));
+    }
+  };
+  mgp_proc drop_graph_projection("drop_graph_projection", drop_graph_projection_cb, utils::NewDeleteResource());
+  MG_ASSERT(mgp_proc_add_arg(&drop_graph_projection, "name", Call<mgp_type *>(mgp_type_string)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  module->AddProcedure("drop_graph_projection", std::move(drop_graph_projection));
+
+  auto graph_projections_cb = [](mgp_list * /*args*/, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+    GraphProjections::Owner owner;
+    try {
+      owner = GetGraphProjectionOwner(*graph);
+    } catch (const std::exception &e) {
+      static_cast<void>(mgp_result_set_error_msg(result, e.what()));
+      return;
+    }
+    for (const auto &[name, projection] : gGraphProjections.List(owner)) {
+      if (!InsertGraphProjectionOrSetError(result, memory, name.c_str(), *projection)) {
+        return;
+      }
+    }
+  };
+  mgp_proc graph_projections("graph_projections", graph_projections_cb, utils::NewDeleteResource());
+  AddGraphProjectionResults(&graph_projections);
+  module->AddProcedure("graph_projections", std::move(graph_projections));
+}
+
 // Run `fun` with `mgp_module *` and `mgp_memory *` arguments. If `fun` returned
 // a `true` value, store the `mgp_module::procedures` and
 // `mgp_module::transformations into `proc_map`. The return value of WithModuleRegistration
@@ -1172,6 +1339,9 @@ void ModuleRegistry::DoUnloadAllModules() {
   // This is correct because the destructor will close each module. However,
   // we don't want to unload the builtin "mg" module.
   auto module = std::move(modules_["mg"]);
+  for (const auto &[name, loaded_module] : modules_) {
+    if (loaded_module) loaded_module->CleanUpBatchedCalls();
+  }
   modules_.clear();
   modules_.emplace("mg", std::move(module));
 }
@@ -1187,6 +1357,7 @@ ModuleRegistry::ModuleRegistry() {
   RegisterMgCreateModuleFile(this, &lock_, module.get());
   RegisterMgUpdateModuleFile(this, &lock_, module.get());
   RegisterMgDeleteModuleFile(this, &lock_, module.get());
+  RegisterMgGraphProjections(module.get());
   modules_.emplace("mg", std::move(module));
 }
 
@@ -1223,6 +1394,7 @@ bool ModuleRegistry::LoadOrReloadModuleFromName(const std::string_view name) {
   std::unique_lock<utils::RWLock> guard(lock_);
   auto found_it = modules_.find(name);
   if (found_it != modules_.end()) {
+    found_it->second->CleanUpBatchedCalls();
     if (!found_it->second->Close()) {
       spdlog::warn("Failed to close module {}", found_it->first);
     }
@@ -16,11 +16,15 @@
 #include <dlfcn.h>
 #include <filesystem>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "query/procedure/cypher_types.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
@@ -51,6 +55,19 @@ class Module {
   virtual const std::map<std::string, mgp_func, std::less<>> *Functions() const = 0;
 
   virtual std::optional<std::filesystem::path> Path() const = 0;
+
+  /// Registers the clean up of a call of a batched procedure, which spans
+  /// multiple pulls. If the module is closed while `call` is still alive,
+  /// `clean_up` is invoked before the code of the module is unloaded.
+  void AddBatchedCallCleanUp(std::weak_ptr<void> call, std::function<void()> clean_up) const;
+
+  /// Invokes the clean ups of the batched procedure calls which are still
+  /// alive. Must be called before the module is closed.
+  void CleanUpBatchedCalls() const;
+
+ private:
+  mutable std::mutex batched_calls_lock_;
+  mutable std::vector<std::pair<std::weak_ptr<void>, std::function<void()>>> batched_calls_;
 };
 
 /// Proxy for a registered Module, acquires a read lock from ModuleRegistry.
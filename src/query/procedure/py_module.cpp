@@ -14,10 +14,16 @@
 #include <datetime.h>
 #include <pyerrors.h>
 #include <array>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <variant>
 
 #include "mg_procedure.h"
 #include "query/procedure/mg_procedure_helpers.hpp"
@@ -337,6 +343,134 @@ PyObject *PyGraphGetVertexById(PyGraph *self, PyObject *args) {
   return py_vertex;
 }
 
+PyObject *PyGraphVertexOrdinalCount(PyGraph *self, PyObject *Py_UNUSED(ignored)) {
+  MG_ASSERT(PyGraphIsValidImpl(*self));
+  size_t count{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_vertex_ordinal_count(self->graph, &count))) {
+    return nullptr;
+  }
+  return PyLong_FromSize_t(count);
+}
+
+PyObject *PyGraphGetVertexByOrdinal(PyGraph *self, PyObject *args) {
+  MG_ASSERT(PyGraphIsValidImpl(*self));
+  MG_ASSERT(self->memory);
+  Py_ssize_t ordinal = 0;
+  if (!PyArg_ParseTuple(args, "n", &ordinal)) return nullptr;
+  if (ordinal < 0) {
+    PyErr_SetString(gMgpOutOfRangeError, "Out of range.");
+    return nullptr;
+  }
+  mgp_vertex *vertex{nullptr};
+  if (RaiseExceptionFromErrorCode(
+          mgp_graph_get_vertex_by_ordinal(self->graph, static_cast<size_t>(ordinal), self->memory, &vertex))) {
+    return nullptr;
+  }
+  auto *py_vertex = MakePyVertexWithoutCopy(*vertex, self);
+  if (!py_vertex) mgp_vertex_destroy(vertex);
+  return py_vertex;
+}
+
+/// Failure of `FillVertexPropertyColumn`, which is raised as a Python exception
+/// once the GIL is acquired again.
+struct PropertyColumnError {
+  mgp_error error{mgp_error::MGP_ERROR_NO_ERROR};
+  std::optional<size_t> wrong_type_ordinal;
+};
+
+// Fills `column` with the property of the vertices in the order of their
+// ordinals. Vertices without the property get `default_value`. It doesn't use
+// the Python C API, so it's called without holding the GIL.
+template <typename TValue>
+std::optional<PropertyColumnError> FillVertexPropertyColumn(mgp_graph *graph, const char *property_name,
+                                                            TValue default_value, TValue *column, size_t count) {
+  // The memory resource of the procedure isn't thread-safe and other Python
+  // threads of the procedure may use it while the GIL is released. Values are
+  // read one at a time, so they're allocated from a small arena of their own
+  // which is counted against the memory limits of the query and of the
+  // procedure, like the arenas of the parallel workers.
+  utils::LimitedMemoryResource query_memory(utils::NewDeleteResource(),
+                                            graph->ctx ? graph->ctx->memory_limit : nullptr);
+  utils::LimitedMemoryResource procedure_memory(&query_memory, graph->procedure_memory_limit);
+  utils::PoolResource arena(128, 1024, &procedure_memory, &procedure_memory);
+  mgp_memory memory{&arena};
+  for (size_t ordinal = 0; ordinal < count; ++ordinal) {
+    MgpUniquePtr<mgp_vertex> vertex{nullptr, mgp_vertex_destroy};
+    if (const auto err = CreateMgpObject(vertex, mgp_graph_get_vertex_by_ordinal, graph, ordinal, &memory);
+        err != mgp_error::MGP_ERROR_NO_ERROR) {
+      return PropertyColumnError{.error = err};
+    }
+    MgpUniquePtr<mgp_value> value{nullptr, mgp_value_destroy};
+    if (const auto err = CreateMgpObject(value, mgp_vertex_get_property, vertex.get(), property_name, &memory);
+        err != mgp_error::MGP_ERROR_NO_ERROR) {
+      return PropertyColumnError{.error = err};
+    }
+    if (value->type == MGP_VALUE_TYPE_NULL) {
+      column[ordinal] = default_value;
+    } else if (value->type == MGP_VALUE_TYPE_INT) {
+      column[ordinal] = static_cast<TValue>(value->int_v);
+    } else if (std::is_floating_point_v<TValue> && value->type == MGP_VALUE_TYPE_DOUBLE) {
+      column[ordinal] = static_cast<TValue>(value->double_v);
+    } else {
+      return PropertyColumnError{.wrong_type_ordinal = ordinal};
+    }
+  }
+  return std::nullopt;
+}
+
+PyObject *PyGraphVertexPropertyColumn(PyGraph *self, PyObject *args) {
+  MG_ASSERT(PyGraphIsValidImpl(*self));
+  MG_ASSERT(self->memory);
+  const char *property_name{nullptr};
+  int typecode{0};
+  PyObject *py_default{nullptr};
+  if (!PyArg_ParseTuple(args, "sCO", &property_name, &typecode, &py_default)) return nullptr;
+  if (typecode != 'd' && typecode != 'q') {
+    PyErr_SetString(PyExc_ValueError, "Expected typecode 'd' or 'q'.");
+    return nullptr;
+  }
+  size_t count{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_vertex_ordinal_count(self->graph, &count))) {
+    return nullptr;
+  }
+  static_assert(sizeof(double) == sizeof(int64_t));
+  // The column is written straight into the storage of a bytearray, which the
+  // returned memoryview exposes as an array of numbers, so that it can be
+  // wrapped by NumPy and similar libraries without copying.
+  py::Object py_bytes(PyByteArray_FromStringAndSize(nullptr, static_cast<Py_ssize_t>(count * sizeof(double))));
+  if (!py_bytes) return nullptr;
+  auto *column = PyByteArray_AS_STRING(py_bytes.Ptr());
+  std::optional<PropertyColumnError> maybe_error;
+  if (typecode == 'd') {
+    const auto default_value = PyFloat_AsDouble(py_default);
+    if (PyErr_Occurred()) return nullptr;
+    // Reading the properties only touches the storage and the bytearray which
+    // isn't shared yet, so other threads may run Python code in the meantime.
+    py::ReleaseGIL no_gil;
+    maybe_error = FillVertexPropertyColumn(self->graph, property_name, default_value,
+                                           reinterpret_cast<double *>(column), count);
+  } else {
+    const int64_t default_value = PyLong_AsLongLong(py_default);
+    if (PyErr_Occurred()) return nullptr;
+    py::ReleaseGIL no_gil;
+    maybe_error = FillVertexPropertyColumn(self->graph, property_name, default_value,
+                                           reinterpret_cast<int64_t *>(column), count);
+  }
+  if (maybe_error) {
+    if (maybe_error->wrong_type_ordinal) {
+      PyErr_Format(gMgpValueConversionError, "Property '%s' of the vertex with ordinal %zu isn't %s.", property_name,
+                   *maybe_error->wrong_type_ordinal, typecode == 'd' ? "a number" : "an integer");
+    } else {
+      static_cast<void>(RaiseExceptionFromErrorCode(maybe_error->error));
+    }
+    return nullptr;
+  }
+  py::Object py_view(PyMemoryView_FromObject(py_bytes.Ptr()));
+  if (!py_view) return nullptr;
+  const char format[] = {static_cast<char>(typecode), '\0'};
+  return PyObject_CallMethod(py_view.Ptr(), "cast", "s", format);
+}
+
 PyObject *PyGraphCreateVertex(PyGraph *self, PyObject *Py_UNUSED(ignored)) {
   MG_ASSERT(PyGraphIsValidImpl(*self));
   MG_ASSERT(self->memory);
@@ -382,6 +516,277 @@ PyObject *PyGraphMustAbort(PyGraph *self, PyObject *Py_UNUSED(ignored)) {
   return PyBool_FromLong(mgp_must_abort(self->graph));
 }
 
+// clang-format off
+struct PyGraphProjection {
+  PyObject_HEAD
+  mgp_graph_projection *projection;
+};
+// clang-format on
+
+void PyGraphProjectionDealloc(PyGraphProjection *self) {
+  MG_ASSERT(self->projection);
+  // The projection isn't allocated from the memory of the query, so it can
+  // outlive the procedure.
+  mgp_graph_projection_destroy(self->projection);
+  Py_TYPE(self)->tp_free(self);
+}
+
+// Array of a graph projection exported through the buffer protocol, so that it
+// can be wrapped in a memoryview without copying. The array is kept alive by
+// holding a reference to the projection.
+// clang-format off
+struct PyGraphProjectionArray {
+  PyObject_HEAD
+  PyGraphProjection *py_projection;
+  const void *data;
+  Py_ssize_t size;
+  const char *format;
+};
+// clang-format on
+
+static_assert(sizeof(uint64_t) == sizeof(double));
+constexpr Py_ssize_t kGraphProjectionItemSize = sizeof(uint64_t);
+
+void PyGraphProjectionArrayDealloc(PyGraphProjectionArray *self) {
+  Py_DECREF(self->py_projection);
+  Py_TYPE(self)->tp_free(self);
+}
+
+int PyGraphProjectionArrayGetBuffer(PyGraphProjectionArray *self, Py_buffer *view, int flags) {
+  if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+    PyErr_SetString(PyExc_BufferError, "Graph projections are read-only.");
+    view->obj = nullptr;
+    return -1;
+  }
+  static Py_ssize_t item_size = kGraphProjectionItemSize;
+  // Empty arrays may not have any storage, but the buffer must not be null.
+  static uint64_t empty{0};
+  Py_INCREF(self);
+  view->obj = reinterpret_cast<PyObject *>(self);
+  view->buf = const_cast<void *>(self->size == 0 ? &empty : self->data);
+  view->len = self->size * kGraphProjectionItemSize;
+  view->readonly = 1;
+  view->itemsize = kGraphProjectionItemSize;
+  view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? const_cast<char *>(self->format) : nullptr;
+  view->ndim = 1;
+  view->shape = (flags & PyBUF_ND) == PyBUF_ND ? &self->size : nullptr;
+  view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &item_size : nullptr;
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+  return 0;
+}
+
+static PyBufferProcs PyGraphProjectionArrayBufferProcs = {
+    .bf_getbuffer = reinterpret_cast<getbufferproc>(PyGraphProjectionArrayGetBuffer),
+    .bf_releasebuffer = nullptr,
+};
+
+// clang-format off
+static PyTypeObject PyGraphProjectionArrayType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+    .tp_name = "_mgp.GraphProjectionArray",
+    .tp_basicsize = sizeof(PyGraphProjectionArray),
+    .tp_dealloc = reinterpret_cast<destructor>(PyGraphProjectionArrayDealloc),
+    .tp_as_buffer = &PyGraphProjectionArrayBufferProcs,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "Array of a graph projection exported through the buffer protocol.",
+};
+// clang-format on
+
+// Returns a read-only memoryview of the array.
+PyObject *MakePyGraphProjectionArray(PyGraphProjection *py_projection, const void *data, size_t size,
+                                     const char *format) {
+  auto *array = PyObject_New(PyGraphProjectionArray, &PyGraphProjectionArrayType);
+  if (!array) return nullptr;
+  Py_INCREF(py_projection);
+  array->py_projection = py_projection;
+  array->data = data;
+  array->size = static_cast<Py_ssize_t>(size);
+  array->format = format;
+  auto *memory_view = PyMemoryView_FromObject(reinterpret_cast<PyObject *>(array));
+  Py_DECREF(array);
+  return memory_view;
+}
+
+std::optional<size_t> ParseProjectionOrdinal(PyObject *args) {
+  Py_ssize_t ordinal = 0;
+  if (!PyArg_ParseTuple(args, "n", &ordinal)) return std::nullopt;
+  if (ordinal < 0) {
+    PyErr_SetString(gMgpOutOfRangeError, "Out of range.");
+    return std::nullopt;
+  }
+  return static_cast<size_t>(ordinal);
+}
+
+PyObject *PyGraphProjectionVertexCount(PyGraphProjection *self, PyObject *Py_UNUSED(ignored)) {
+  size_t count{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_projection_vertex_count(self->projection, &count))) {
+    return nullptr;
+  }
+  return PyLong_FromSize_t(count);
+}
+
+PyObject *PyGraphProjectionEdgeCount(PyGraphProjection *self, PyObject *Py_UNUSED(ignored)) {
+  size_t count{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_projection_edge_count(self->projection, &count))) {
+    return nullptr;
+  }
+  return PyLong_FromSize_t(count);
+}
+
+PyObject *PyGraphProjectionHasWeights(PyGraphProjection *self, PyObject *Py_UNUSED(ignored)) {
+  int has_weights{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_projection_has_weights(self->projection, &has_weights))) {
+    return nullptr;
+  }
+  return PyBool_FromLong(has_weights);
+}
+
+PyObject *PyGraphProjectionVertexId(PyGraphProjection *self, PyObject *args) {
+  const auto ordinal = ParseProjectionOrdinal(args);
+  if (!ordinal) return nullptr;
+  mgp_vertex_id id{};
+  if (RaiseExceptionFromErrorCode(mgp_graph_projection_vertex_id(self->projection, *ordinal, &id))) {
+    return nullptr;
+  }
+  return PyLong_FromLongLong(id.as_int);
+}
+
+PyObject *PyGraphProjectionVertexOrdinal(PyGraphProjection *self, PyObject *args) {
+  static_assert(std::is_same_v<int64_t, long>, "Expected vertex IDs to be of type long");
+  int64_t id = 0;
+  if (!PyArg_ParseTuple(args, "l", &id)) return nullptr;
+  size_t ordinal{0};
+  if (RaiseExceptionFromErrorCode(
+          mgp_graph_projection_vertex_ordinal(self->projection, mgp_vertex_id{.as_int = id}, &ordinal))) {
+    return nullptr;
+  }
+  return PyLong_FromSize_t(ordinal);
+}
+
+PyObject *PyGraphProjectionOutNeighbors(PyGraphProjection *self, PyObject *args) {
+  const auto ordinal = ParseProjectionOrdinal(args);
+  if (!ordinal) return nullptr;
+  const uint64_t *neighbors{nullptr};
+  size_t count{0};
+  if (RaiseExceptionFromErrorCode(
+          mgp_graph_projection_out_neighbors(self->projection, *ordinal, &neighbors, &count))) {
+    return nullptr;
+  }
+  return MakePyGraphProjectionArray(self, neighbors, count, "Q");
+}
+
+PyObject *PyGraphProjectionInNeighbors(PyGraphProjection *self, PyObject *args) {
+  const auto ordinal = ParseProjectionOrdinal(args);
+  if (!ordinal) return nullptr;
+  const uint64_t *neighbors{nullptr};
+  size_t count{0};
+  if (RaiseExceptionFromErrorCode(mgp_graph_projection_in_neighbors(self->projection, *ordinal, &neighbors, &count))) {
+    return nullptr;
+  }
+  return MakePyGraphProjectionArray(self, neighbors, count, "Q");
+}
+
+PyObject *PyGraphProjectionOutWeights(PyGraphProjection *self, PyObject *args) {
+  const auto ordinal = ParseProjectionOrdinal(args);
+  if (!ordinal) return nullptr;
+  const uint64_t *neighbors{nullptr};
+  size_t count{0};
+  const double *weights{nullptr};
+  if (RaiseExceptionFromErrorCode(
+          mgp_graph_projection_out_neighbors(self->projection, *ordinal, &neighbors, &count)) ||
+      RaiseExceptionFromErrorCode(mgp_graph_projection_out_weights(self->projection, *ordinal, &weights))) {
+    return nullptr;
+  }
+  if (weights == nullptr) Py_RETURN_NONE;
+  return MakePyGraphProjectionArray(self, weights, count, "d");
+}
+
+PyObject *PyGraphProjectionInWeights(PyGraphProjection *self, PyObject *args) {
+  const auto ordinal = ParseProjectionOrdinal(args);
+  if (!ordinal) return nullptr;
+  const uint64_t *neighbors{nullptr};
+  size_t count{0};
+  const double *weights{nullptr};
+  if (RaiseExceptionFromErrorCode(mgp_graph_projection_in_neighbors(self->projection, *ordinal, &neighbors, &count)) ||
+      RaiseExceptionFromErrorCode(mgp_graph_projection_in_weights(self->projection, *ordinal, &weights))) {
+    return nullptr;
+  }
+  if (weights == nullptr) Py_RETURN_NONE;
+  return MakePyGraphProjectionArray(self, weights, count, "d");
+}
+
+PyObject *PyGraphProjectionVertexProperty(PyGraphProjection *self, PyObject *args) {
+  const char *name = nullptr;
+  if (!PyArg_ParseTuple(args, "s", &name)) return nullptr;
+  size_t count{0};
+  const double *values{nullptr};
+  if (RaiseExceptionFromErrorCode(mgp_graph_projection_vertex_count(self->projection, &count)) ||
+      RaiseExceptionFromErrorCode(mgp_graph_projection_vertex_property(self->projection, name, &values))) {
+    return nullptr;
+  }
+  if (values == nullptr) Py_RETURN_NONE;
+  return MakePyGraphProjectionArray(self, values, count, "d");
+}
+
+static PyMethodDef PyGraphProjectionMethods[] = {
+    {"__reduce__", reinterpret_cast<PyCFunction>(DisallowPickleAndCopy), METH_NOARGS, "__reduce__ is not supported"},
+    {"vertex_count", reinterpret_cast<PyCFunction>(PyGraphProjectionVertexCount), METH_NOARGS,
+     "Return the number of projected vertices."},
+    {"edge_count", reinterpret_cast<PyCFunction>(PyGraphProjectionEdgeCount), METH_NOARGS,
+     "Return the number of projected edges."},
+    {"has_weights", reinterpret_cast<PyCFunction>(PyGraphProjectionHasWeights), METH_NOARGS,
+     "Return True if the edge weights were projected."},
+    {"vertex_id", reinterpret_cast<PyCFunction>(PyGraphProjectionVertexId), METH_VARARGS,
+     "Return the ID of the vertex with the given ordinal."},
+    {"vertex_ordinal", reinterpret_cast<PyCFunction>(PyGraphProjectionVertexOrdinal), METH_VARARGS,
+     "Return the ordinal of the vertex with the given ID."},
+    {"out_neighbors", reinterpret_cast<PyCFunction>(PyGraphProjectionOutNeighbors), METH_VARARGS,
+     "Return a memoryview of the ordinals of the targets of the outgoing edges."},
+    {"in_neighbors", reinterpret_cast<PyCFunction>(PyGraphProjectionInNeighbors), METH_VARARGS,
+     "Return a memoryview of the ordinals of the sources of the incoming edges."},
+    {"out_weights", reinterpret_cast<PyCFunction>(PyGraphProjectionOutWeights), METH_VARARGS,
+     "Return a memoryview of the weights of the outgoing edges or None."},
+    {"in_weights", reinterpret_cast<PyCFunction>(PyGraphProjectionInWeights), METH_VARARGS,
+     "Return a memoryview of the weights of the incoming edges or None."},
+    {"vertex_property", reinterpret_cast<PyCFunction>(PyGraphProjectionVertexProperty), METH_VARARGS,
+     "Return a memoryview of the values of the projected vertex property or None."},
+    {nullptr},
+};
+
+// clang-format off
+static PyTypeObject PyGraphProjectionType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+    .tp_name = "_mgp.GraphProjection",
+    .tp_basicsize = sizeof(PyGraphProjection),
+    .tp_dealloc = reinterpret_cast<destructor>(PyGraphProjectionDealloc),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "Wraps struct mgp_graph_projection.",
+    .tp_methods = PyGraphProjectionMethods,
+};
+// clang-format on
+
+PyObject *PyGraphGetProjection(PyGraph *self, PyObject *args) {
+  MG_ASSERT(PyGraphIsValidImpl(*self));
+  const char *name = nullptr;
+  if (!PyArg_ParseTuple(args, "s", &name)) return nullptr;
+  // Python objects can be kept after the procedure is done, so the projection
+  // can't be allocated from the memory of the query.
+  mgp_memory memory{memgraph::utils::NewDeleteResource()};
+  mgp_graph_projection *projection{nullptr};
+  if (RaiseExceptionFromErrorCode(mgp_graph_get_projection(self->graph, name, &memory, &projection))) {
+    return nullptr;
+  }
+  if (projection == nullptr) Py_RETURN_NONE;
+  auto *py_projection = PyObject_New(PyGraphProjection, &PyGraphProjectionType);
+  if (!py_projection) {
+    mgp_graph_projection_destroy(projection);
+    return nullptr;
+  }
+  py_projection->projection = projection;
+  return reinterpret_cast<PyObject *>(py_projection);
+}
+
 static PyMethodDef PyGraphMethods[] = {
     {"__reduce__", reinterpret_cast<PyCFunction>(DisallowPickleAndCopy), METH_NOARGS, "__reduce__ is not supported"},
     {"invalidate", reinterpret_cast<PyCFunction>(PyGraphInvalidate), METH_NOARGS,
@@ -392,6 +797,12 @@ static PyMethodDef PyGraphMethods[] = {
      "Return True if Graph is mutable and can be used to modify vertices and edges."},
     {"get_vertex_by_id", reinterpret_cast<PyCFunction>(PyGraphGetVertexById), METH_VARARGS,
      "Get the vertex or raise IndexError."},
+    {"vertex_ordinal_count", reinterpret_cast<PyCFunction>(PyGraphVertexOrdinalCount), METH_NOARGS,
+     "Return the number of vertices in the dense numbering of vertices."},
+    {"get_vertex_by_ordinal", reinterpret_cast<PyCFunction>(PyGraphGetVertexByOrdinal), METH_VARARGS,
+     "Get the vertex with the given ordinal or raise IndexError."},
+    {"vertex_property_column", reinterpret_cast<PyCFunction>(PyGraphVertexPropertyColumn), METH_VARARGS,
+     "Return a memoryview of a numeric property of the vertices in the order of their ordinals."},
     {"create_vertex", reinterpret_cast<PyCFunction>(PyGraphCreateVertex), METH_NOARGS, "Create a vertex."},
     {"create_edge", reinterpret_cast<PyCFunction>(PyGraphCreateEdge), METH_VARARGS, "Create an edge."},
     {"delete_vertex", reinterpret_cast<PyCFunction>(PyGraphDeleteVertex), METH_VARARGS, "Delete a vertex."},
@@ -399,6 +810,8 @@ static PyMethodDef PyGraphMethods[] = {
      "Delete a vertex and all of its edges."},
     {"delete_edge", reinterpret_cast<PyCFunction>(PyGraphDeleteEdge), METH_VARARGS, "Delete an edge."},
     {"iter_vertices", reinterpret_cast<PyCFunction>(PyGraphIterVertices), METH_NOARGS, "Return _mgp.VerticesIterator."},
+    {"get_projection", reinterpret_cast<PyCFunction>(PyGraphGetProjection), METH_VARARGS,
+     "Return the graph projection with the given name or None."},
     {"must_abort", reinterpret_cast<PyCFunction>(PyGraphMustAbort), METH_NOARGS,
      "Check whether the running procedure should abort"},
     {nullptr},
@@ -800,6 +1213,20 @@ PyObject *PyMessagesGetMessageAt(PyMessages *self, PyObject *args) {
   return reinterpret_cast<PyObject *>(py_message);
 }
 
+PyObject *PyMessagesGetTransformationConfig(PyMessages *self, PyObject *Py_UNUSED(ignored)) {
+  MG_ASSERT(self->messages);
+  MG_ASSERT(self->memory);
+  py::Object py_config(PyDict_New());
+  if (!py_config) return nullptr;
+  for (const auto &[key, value] : self->messages->transformation_config.items) {
+    py::Object py_value(PyUnicode_FromString(value.string_v.c_str()));
+    if (!py_value) return nullptr;
+    // Unlike PyList_SET_ITEM, PyDict_SetItem does not steal the value.
+    if (PyDict_SetItemString(py_config.Ptr(), key.c_str(), py_value.Ptr()) != 0) return nullptr;
+  }
+  return py_config.Steal();
+}
+
 // NOLINTNEXTLINE
 static PyMethodDef PyMessagesMethods[] = {
     {"__reduce__", reinterpret_cast<PyCFunction>(DisallowPickleAndCopy), METH_NOARGS, "__reduce__ is not supported"},
@@ -811,6 +1238,8 @@ static PyMethodDef PyMessagesMethods[] = {
      "Get number of messages available"},
     {"message_at", reinterpret_cast<PyCFunction>(PyMessagesGetMessageAt), METH_VARARGS,
      "Get message at index idx from messages"},
+    {"transformation_config", reinterpret_cast<PyCFunction>(PyMessagesGetTransformationConfig), METH_NOARGS,
+     "Get the TRANSFORM_CONFIG of the stream as a dict of strings"},
     {nullptr},
 };
 
@@ -860,37 +1289,40 @@ py::Object MgpListToPyTuple(mgp_list *list, PyObject *py_graph) {
 }
 
 namespace {
-std::optional<py::ExceptionInfo> AddRecordFromPython(mgp_result *result, py::Object py_record) {
+// Returns `mgp.Record`, so that it's looked up once for a whole batch of
+// records.
+py::Object GetRecordClass() {
   py::Object py_mgp(PyImport_ImportModule("mgp"));
-  if (!py_mgp) return py::FetchError();
-  auto record_cls = py_mgp.GetAttr("Record");
-  if (!record_cls) return py::FetchError();
-  if (!PyObject_IsInstance(py_record.Ptr(), record_cls.Ptr())) {
+  if (!py_mgp) return nullptr;
+  return py_mgp.GetAttr("Record");
+}
+
+std::optional<py::ExceptionInfo> AddRecordFromPython(mgp_result *result, PyObject *py_record,
+                                                     const py::Object &record_cls) {
+  if (!PyObject_IsInstance(py_record, record_cls.Ptr())) {
     std::stringstream ss;
-    ss << "Value '" << py_record << "' is not an instance of 'mgp.Record'";
+    ss << "Value '" << py::Object::FromBorrow(py_record) << "' is not an instance of 'mgp.Record'";
     const auto &msg = ss.str();
     PyErr_SetString(PyExc_TypeError, msg.c_str());
     return py::FetchError();
   }
-  py::Object fields(py_record.GetAttr("fields"));
+  py::Object fields(PyObject_GetAttrString(py_record, "fields"));
   if (!fields) return py::FetchError();
   if (!PyDict_Check(fields)) {
     PyErr_SetString(PyExc_TypeError, "Expected 'mgp.Record.fields' to be a 'dict'");
     return py::FetchError();
   }
-  py::Object items(PyDict_Items(fields.Ptr()));
-  if (!items) return py::FetchError();
   mgp_result_record *record{nullptr};
   if (RaiseExceptionFromErrorCode(mgp_result_new_record(result, &record))) {
     return py::FetchError();
   }
-  Py_ssize_t len = PyList_GET_SIZE(items.Ptr());
-  for (Py_ssize_t i = 0; i < len; ++i) {
-    auto *item = PyList_GET_ITEM(items.Ptr(), i);
-    if (!item) return py::FetchError();
-    MG_ASSERT(PyTuple_Check(item));
-    auto *key = PyTuple_GetItem(item, 0);
-    if (!key) return py::FetchError();
+  mgp_memory memory{result->rows.get_allocator().GetMemoryResource()};
+  // The fields are iterated in place, as copying them into a list of items
+  // would allocate for every record.
+  PyObject *key{nullptr};
+  PyObject *val{nullptr};
+  Py_ssize_t pos{0};
+  while (PyDict_Next(fields.Ptr(), &pos, &key, &val)) {
     if (!PyUnicode_Check(key)) {
       std::stringstream ss;
       ss << "Field name '" << py::Object::FromBorrow(key) << "' is not an instance of 'str'";
@@ -900,9 +1332,6 @@ std::optional<py::ExceptionInfo> AddRecordFromPython(mgp_result *result, py::Obj
     }
     const auto *field_name = PyUnicode_AsUTF8(key);
     if (!field_name) return py::FetchError();
-    auto *val = PyTuple_GetItem(item, 1);
-    if (!val) return py::FetchError();
-    mgp_memory memory{result->rows.get_allocator().GetMemoryResource()};
     mgp_value *field_val = PyObjectToMgpValueWithPythonExceptions(val, &memory);
     if (field_val == nullptr) {
       return py::FetchError();
@@ -921,32 +1350,55 @@ std::optional<py::ExceptionInfo> AddRecordFromPython(mgp_result *result, py::Obj
   return std::nullopt;
 }
 
+std::optional<py::ExceptionInfo> AddRecordFromPython(mgp_result *result, py::Object py_record) {
+  auto record_cls = GetRecordClass();
+  if (!record_cls) return py::FetchError();
+  return AddRecordFromPython(result, py_record.Ptr(), record_cls);
+}
+
 std::optional<py::ExceptionInfo> AddMultipleRecordsFromPython(mgp_result *result, py::Object py_seq) {
-  Py_ssize_t len = PySequence_Size(py_seq.Ptr());
-  if (len == -1) return py::FetchError();
+  auto record_cls = GetRecordClass();
+  if (!record_cls) return py::FetchError();
+  // Lists and tuples are used as they are, and other sequences are copied
+  // into a list once, so that the records are accessed without a call each.
+  py::Object py_fast_seq(PySequence_Fast(py_seq.Ptr(), "Expected a sequence of 'mgp.Record'"));
+  if (!py_fast_seq) return py::FetchError();
+  const auto len = PySequence_Fast_GET_SIZE(py_fast_seq.Ptr());
+  auto **py_records = PySequence_Fast_ITEMS(py_fast_seq.Ptr());
+  result->rows.reserve(result->rows.size() + static_cast<size_t>(len));
   for (Py_ssize_t i = 0; i < len; ++i) {
-    py::Object py_record(PySequence_GetItem(py_seq.Ptr(), i));
-    if (!py_record) return py::FetchError();
-    auto maybe_exc = AddRecordFromPython(result, py_record);
+    auto maybe_exc = AddRecordFromPython(result, py_records[i], record_cls);
     if (maybe_exc) return maybe_exc;
   }
   return std::nullopt;
 }
 
+// The caller must keep `py_object` alive until the returned function is
+// called.
 std::function<void()> PyObjectCleanup(py::Object &py_object) {
   return [py_object]() {
-    // Run `gc.collect` (reference cycle-detection) explicitly, so that we are
-    // sure the procedure cleaned up everything it held references to. If the
-    // user stored a reference to one of our `_mgp` instances then the
-    // internally used `mgp_*` structs will stay unfreed and a memory leak
-    // will be reported at the end of the query execution.
-    py::Object gc(PyImport_ImportModule("gc"));
-    if (!gc) {
-      LOG_FATAL(py::FetchError().value());
-    }
+    // Every `_mgp` instance which refers to the graph holds a reference to
+    // `_mgp.Graph`. When the only references left are the caller's and the
+    // one captured here, nothing can outlive the procedure, so the costly
+    // collection below is skipped. It's a full collection done while holding
+    // the GIL, which stalls Python procedures in all other sessions.
+    constexpr Py_ssize_t kOwnReferences = 2;
+    const bool has_other_references = !py_object || !PyObject_TypeCheck(py_object.Ptr(), &PyGraphType) ||
+                                      Py_REFCNT(py_object.Ptr()) > kOwnReferences;
+    if (has_other_references) {
+      // Run `gc.collect` (reference cycle-detection) explicitly, so that we
+      // are sure the procedure cleaned up everything it held references to.
+      // If the user stored a reference to one of our `_mgp` instances then
+      // the internally used `mgp_*` structs will stay unfreed and a memory
+      // leak will be reported at the end of the query execution.
+      py::Object gc(PyImport_ImportModule("gc"));
+      if (!gc) {
+        LOG_FATAL(py::FetchError().value());
+      }
 
-    if (!gc.CallMethod("collect")) {
-      LOG_FATAL(py::FetchError().value());
+      if (!gc.CallMethod("collect")) {
+        LOG_FATAL(py::FetchError().value());
+      }
     }
 
     // After making sure all references from our side have been cleared,
@@ -962,6 +1414,9 @@ std::function<void()> PyObjectCleanup(py::Object &py_object) {
 
 void CallPythonProcedure(const py::Object &py_cb, mgp_list *args, mgp_graph *graph, mgp_result *result,
                          mgp_memory *memory) {
+  // All Python modules share the main interpreter, so Python procedures of
+  // concurrent queries still run one at a time. Only the work which doesn't
+  // need the GIL releases it, see `py::ReleaseGIL`.
   auto gil = py::EnsureGIL();
 
   auto error_to_msg = [](const std::optional<py::ExceptionInfo> &exc_info) -> std::optional<std::string> {
@@ -1010,6 +1465,103 @@ void CallPythonProcedure(const py::Object &py_cb, mgp_list *args, mgp_graph *gra
   }
 }
 
+/// State of a single call of a batched Python procedure. It lives from the
+/// first batch until the procedure is exhausted, fails or the query is
+/// aborted.
+struct PyProcedureBatchState {
+  py::Object py_graph;
+  py::Object py_iterator;
+};
+
+void *InitPythonBatchedProcedure(const py::Object &py_cb, mgp_list *args, mgp_graph *graph, mgp_result *result,
+                                 mgp_memory *memory) {
+  auto gil = py::EnsureGIL();
+
+  py::Object py_graph(MakePyGraph(graph, memory));
+  if (!py_graph) {
+    const auto msg = py::FormatException(*py::FetchError());
+    static_cast<void>(mgp_result_set_error_msg(result, msg.c_str()));
+    return nullptr;
+  }
+
+  auto start = [&]() -> std::variant<py::Object, py::ExceptionInfo> {
+    py::Object py_args(MgpListToPyTuple(args, py_graph.Ptr()));
+    if (!py_args) return *py::FetchError();
+    auto py_res = py_cb.Call(py_graph, py_args);
+    if (!py_res) return *py::FetchError();
+    py::Object py_iterator(PyObject_GetIter(py_res.Ptr()));
+    if (!py_iterator) return *py::FetchError();
+    return py_iterator;
+  };
+
+  // See `CallPythonProcedure` on why the `ExceptionInfo` mustn't outlive the
+  // formatting of the error message.
+  std::optional<std::string> maybe_msg;
+  py::Object py_iterator;
+  {
+    auto maybe_iterator = start();
+    if (auto *exc_info = std::get_if<py::ExceptionInfo>(&maybe_iterator)) {
+      maybe_msg = py::FormatException(*exc_info, /* skip_first_line = */ true);
+    } else {
+      py_iterator = std::move(std::get<py::Object>(maybe_iterator));
+    }
+  }
+
+  if (maybe_msg) {
+    PyObjectCleanup(py_graph)();
+    static_cast<void>(mgp_result_set_error_msg(result, maybe_msg->c_str()));
+    return nullptr;
+  }
+  return new PyProcedureBatchState{std::move(py_graph), std::move(py_iterator)};
+}
+
+void NextPythonProcedureBatch(void *state, mgp_result *result) {
+  auto gil = py::EnsureGIL();
+  auto *batch_state = static_cast<PyProcedureBatchState *>(state);
+
+  auto next = [&]() -> std::optional<py::ExceptionInfo> {
+    auto record_cls = GetRecordClass();
+    if (!record_cls) return py::FetchError();
+    while (result->rows.size() < result->batch_size) {
+      py::Object py_record(PyIter_Next(batch_state->py_iterator.Ptr()));
+      if (!py_record) {
+        // `PyIter_Next` doesn't set an error when the iterator is exhausted.
+        if (PyErr_Occurred()) return py::FetchError();
+        break;
+      }
+      auto maybe_exc = AddRecordFromPython(result, py_record.Ptr(), record_cls);
+      if (maybe_exc) return maybe_exc;
+    }
+    return std::nullopt;
+  };
+
+  std::optional<std::string> maybe_msg;
+  {
+    auto maybe_exc = next();
+    // The traceback starts in the user's generator, so there is no wrapper
+    // line to skip.
+    if (maybe_exc) maybe_msg = py::FormatException(*maybe_exc);
+  }
+
+  if (maybe_msg) {
+    static_cast<void>(mgp_result_set_error_msg(result, maybe_msg->c_str()));
+  }
+}
+
+void CleanUpPythonProcedureBatch(void *state) {
+  auto gil = py::EnsureGIL();
+  std::unique_ptr<PyProcedureBatchState> batch_state(static_cast<PyProcedureBatchState *>(state));
+  // Closing an unfinished generator runs its `finally` blocks and context
+  // manager exits while the graph is still valid.
+  if (PyGen_Check(batch_state->py_iterator.Ptr())) {
+    if (!batch_state->py_iterator.CallMethod("close")) {
+      spdlog::warn("Unable to close a batched Python procedure: {}", py::FormatException(*py::FetchError()));
+    }
+  }
+  batch_state->py_iterator = py::Object();
+  PyObjectCleanup(batch_state->py_graph)();
+}
+
 void CallPythonTransformation(const py::Object &py_cb, mgp_messages *msgs, mgp_graph *graph, mgp_result *result,
                               mgp_memory *memory) {
   auto gil = py::EnsureGIL();
@@ -1117,7 +1669,8 @@ void CallPythonFunction(const py::Object &py_cb, mgp_list *args, mgp_graph *grap
   }
 }
 
-PyObject *PyQueryModuleAddProcedure(PyQueryModule *self, PyObject *cb, bool is_write_procedure) {
+PyObject *PyQueryModuleAddProcedure(PyQueryModule *self, PyObject *cb, bool is_write_procedure,
+                                    bool is_batched = false) {
   MG_ASSERT(self->module);
   if (!PyCallable_Check(cb)) {
     PyErr_SetString(PyExc_TypeError, "Expected a callable object.");
@@ -1132,12 +1685,27 @@ PyObject *PyQueryModuleAddProcedure(PyQueryModule *self, PyObject *cb, bool is_w
     return nullptr;
   }
   auto *memory = self->module->procedures.get_allocator().GetMemoryResource();
-  mgp_proc proc(name,
-                [py_cb](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
-                  CallPythonProcedure(py_cb, args, graph, result, memory);
-                },
-                memory, {.is_write = is_write_procedure});
-  const auto &[proc_it, did_insert] = self->module->procedures.emplace(name, std::move(proc));
+  auto make_proc = [&]() {
+    if (is_batched) {
+      return mgp_proc(
+          name,
+          ProcedureBatchCallbacks{
+              .init =
+                  [py_cb](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+                    return InitPythonBatchedProcedure(py_cb, args, graph, result, memory);
+                  },
+              .next = [](void *state, mgp_graph * /*graph*/, mgp_result *result,
+                         mgp_memory * /*memory*/) { NextPythonProcedureBatch(state, result); },
+              .cleanup = [](void *state, mgp_memory * /*memory*/) { CleanUpPythonProcedureBatch(state); }},
+          memory, {.is_write = is_write_procedure});
+    }
+    return mgp_proc(name,
+                    [py_cb](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+                      CallPythonProcedure(py_cb, args, graph, result, memory);
+                    },
+                    memory, {.is_write = is_write_procedure});
+  };
+  const auto &[proc_it, did_insert] = self->module->procedures.emplace(name, make_proc());
   if (!did_insert) {
     PyErr_SetString(PyExc_ValueError, "Already registered a procedure with the same name.");
     return nullptr;
@@ -1157,6 +1725,14 @@ PyObject *PyQueryModuleAddWriteProcedure(PyQueryModule *self, PyObject *cb) {
   return PyQueryModuleAddProcedure(self, cb, true);
 }
 
+PyObject *PyQueryModuleAddBatchReadProcedure(PyQueryModule *self, PyObject *cb) {
+  return PyQueryModuleAddProcedure(self, cb, false, true);
+}
+
+PyObject *PyQueryModuleAddBatchWriteProcedure(PyQueryModule *self, PyObject *cb) {
+  return PyQueryModuleAddProcedure(self, cb, true, true);
+}
+
 PyObject *PyQueryModuleAddTransformation(PyQueryModule *self, PyObject *cb) {
   MG_ASSERT(self->module);
   if (!PyCallable_Check(cb)) {
@@ -1225,6 +1801,10 @@ static PyMethodDef PyQueryModuleMethods[] = {
      "Register a read-only procedure with this module."},
     {"add_write_procedure", reinterpret_cast<PyCFunction>(PyQueryModuleAddWriteProcedure), METH_O,
      "Register a writeable procedure with this module."},
+    {"add_batch_read_procedure", reinterpret_cast<PyCFunction>(PyQueryModuleAddBatchReadProcedure), METH_O,
+     "Register a read-only procedure which yields its records in batches."},
+    {"add_batch_write_procedure", reinterpret_cast<PyCFunction>(PyQueryModuleAddBatchWriteProcedure), METH_O,
+     "Register a writeable procedure which yields its records in batches."},
     {"add_transformation", reinterpret_cast<PyCFunction>(PyQueryModuleAddTransformation), METH_O,
      "Register a transformation with this module."},
     {"add_function", reinterpret_cast<PyCFunction>(PyQueryModuleAddFunction), METH_O,
@@ -1662,6 +2242,18 @@ PyObject *PyVertexGetId(PyVertex *self, PyObject *Py_UNUSED(ignored)) {
   return PyLong_FromLongLong(id.as_int);
 }
 
+PyObject *PyVertexGetOrdinal(PyVertex *self, PyObject *Py_UNUSED(ignored)) {
+  MG_ASSERT(self);
+  MG_ASSERT(self->vertex);
+  MG_ASSERT(self->py_graph);
+  MG_ASSERT(self->py_graph->graph);
+  size_t ordinal{0};
+  if (RaiseExceptionFromErrorCode(mgp_vertex_get_ordinal(self->vertex, &ordinal))) {
+    return nullptr;
+  }
+  return PyLong_FromSize_t(ordinal);
+}
+
 PyObject *PyVertexLabelsCount(PyVertex *self, PyObject *Py_UNUSED(ignored)) {
   MG_ASSERT(self);
   MG_ASSERT(self->vertex);
@@ -1827,6 +2419,8 @@ static PyMethodDef PyVertexMethods[] = {
     {"underlying_graph_is_mutable", reinterpret_cast<PyCFunction>(PyVertexUnderlyingGraphIsMutable), METH_NOARGS,
      "Return True if the vertex is mutable and can be modified."},
     {"get_id", reinterpret_cast<PyCFunction>(PyVertexGetId), METH_NOARGS, "Return vertex id."},
+    {"get_ordinal", reinterpret_cast<PyCFunction>(PyVertexGetOrdinal), METH_NOARGS,
+     "Return the ordinal of the vertex in the dense numbering of vertices."},
     {"labels_count", reinterpret_cast<PyCFunction>(PyVertexLabelsCount), METH_NOARGS,
      "Return number of lables of a vertex."},
     {"label_at", reinterpret_cast<PyCFunction>(PyVertexLabelAt), METH_VARARGS,
@@ -2174,6 +2768,8 @@ PyObject *PyInitMgpModule() {
   if (!register_type(&PyVerticesIteratorType, "VerticesIterator")) return nullptr;
   if (!register_type(&PyEdgesIteratorType, "EdgesIterator")) return nullptr;
   if (!register_type(&PyGraphType, "Graph")) return nullptr;
+  if (!register_type(&PyGraphProjectionType, "GraphProjection")) return nullptr;
+  if (!register_type(&PyGraphProjectionArrayType, "GraphProjectionArray")) return nullptr;
   if (!register_type(&PyEdgeType, "Edge")) return nullptr;
   if (!register_type(&PyQueryProcType, "Proc")) return nullptr;
   if (!register_type(&PyMagicFuncType, "Func")) return nullptr;
@@ -2365,6 +2961,125 @@ py::Object MgpValueToPyObject(const mgp_value &value, PyGraph *py_graph) {
   }
 }
 
+namespace {
+// Reads a buffer item as a bool, an int64_t or a double.
+template <typename T>
+auto ReadBufferItem(const char *item) {
+  T value;
+  std::memcpy(&value, item, sizeof(T));
+  if constexpr (std::is_same_v<T, bool>) {
+    return value;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<double>(value);
+  } else {
+    if constexpr (std::is_unsigned_v<T> && sizeof(T) >= sizeof(int64_t)) {
+      if (value > static_cast<T>(std::numeric_limits<int64_t>::max())) {
+        throw std::overflow_error("Buffer item is out of the integer range");
+      }
+    }
+    return static_cast<int64_t>(value);
+  }
+}
+
+// Converts objects which export numbers through the buffer protocol, like
+// NumPy arrays and `array.array`, by reading their memory directly instead of
+// going through a Python object for each item. A one-dimensional buffer
+// becomes a list, and a zero-dimensional one (e.g. a NumPy scalar) a single
+// value.
+mgp_value *PyBufferToMgpValue(PyObject *o, mgp_memory *memory) {
+  Py_buffer view;
+  if (PyObject_GetBuffer(o, &view, PyBUF_FORMAT | PyBUF_STRIDES) != 0) {
+    PyErr_Clear();
+    throw std::invalid_argument("Unsupported PyObject conversion");
+  }
+  utils::OnScopeExit release_view([&view] { PyBuffer_Release(&view); });
+  if (view.ndim > 1) {
+    throw std::invalid_argument("Only one-dimensional buffers can be converted to a list");
+  }
+  std::string_view format = view.format ? view.format : "B";
+  // Only the native byte order is supported, which is the default one.
+  if (format.size() == 2 && format.front() == '@') format.remove_prefix(1);
+  if (format.size() != 1) {
+    throw std::invalid_argument(fmt::format("Unsupported buffer format '{}'", format));
+  }
+
+  auto convert = [&]<typename T>() -> mgp_value * {
+    if (view.itemsize != static_cast<Py_ssize_t>(sizeof(T))) {
+      throw std::invalid_argument(fmt::format("Unexpected size of buffer items of format '{}'", format));
+    }
+    const auto *buf = static_cast<const char *>(view.buf);
+    mgp_value *result{nullptr};
+    if (view.ndim == 0) {
+      const auto item = ReadBufferItem<T>(buf);
+      mgp_error err{mgp_error::MGP_ERROR_NO_ERROR};
+      if constexpr (std::is_same_v<decltype(item), const bool>) {
+        err = mgp_value_make_bool(static_cast<int>(item), memory, &result);
+      } else if constexpr (std::is_same_v<decltype(item), const double>) {
+        err = mgp_value_make_double(item, memory, &result);
+      } else {
+        err = mgp_value_make_int(item, memory, &result);
+      }
+      if (err != mgp_error::MGP_ERROR_NO_ERROR) {
+        throw std::bad_alloc{};
+      }
+      return result;
+    }
+    MgpUniquePtr<mgp_list> list{nullptr, &mgp_list_destroy};
+    if (const auto err = CreateMgpObject(list, mgp_list_make_empty, view.shape[0], memory);
+        err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::bad_alloc{};
+    }
+    for (Py_ssize_t i = 0; i < view.shape[0]; ++i) {
+      // Items are appended by copying, so they're built on the stack.
+      mgp_value value(ReadBufferItem<T>(buf + i * view.strides[0]), memory->impl);
+      if (mgp_list_append(list.get(), &value) != mgp_error::MGP_ERROR_NO_ERROR) {
+        throw std::bad_alloc{};
+      }
+    }
+    if (mgp_value_make_list(list.get(), &result) != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::bad_alloc{};
+    }
+    static_cast<void>(list.release());
+    return result;
+  };
+
+  switch (format.front()) {
+    case '?':
+      return convert.operator()<bool>();
+    case 'b':
+      return convert.operator()<signed char>();
+    case 'B':
+      return convert.operator()<unsigned char>();
+    case 'h':
+      return convert.operator()<short>();  // NOLINT(google-runtime-int)
+    case 'H':
+      return convert.operator()<unsigned short>();  // NOLINT(google-runtime-int)
+    case 'i':
+      return convert.operator()<int>();
+    case 'I':
+      return convert.operator()<unsigned int>();
+    case 'l':
+      return convert.operator()<long>();  // NOLINT(google-runtime-int)
+    case 'L':
+      return convert.operator()<unsigned long>();  // NOLINT(google-runtime-int)
+    case 'q':
+      return convert.operator()<long long>();  // NOLINT(google-runtime-int)
+    case 'Q':
+      return convert.operator()<unsigned long long>();  // NOLINT(google-runtime-int)
+    case 'n':
+      return convert.operator()<Py_ssize_t>();
+    case 'N':
+      return convert.operator()<size_t>();
+    case 'f':
+      return convert.operator()<float>();
+    case 'd':
+      return convert.operator()<double>();
+    default:
+      throw std::invalid_argument(fmt::format("Unsupported buffer format '{}'", format));
+  }
+}
+}  // namespace
+
 mgp_value *PyObjectToMgpValue(PyObject *o, mgp_memory *memory) {
   auto py_seq_to_list = [memory](PyObject *seq, Py_ssize_t len, const auto &py_seq_get_item) {
     static_assert(std::numeric_limits<Py_ssize_t>::max() <= std::numeric_limits<size_t>::max());
@@ -2398,8 +3113,13 @@ mgp_value *PyObjectToMgpValue(PyObject *o, mgp_memory *memory) {
     return v;
   };
 
-  auto is_mgp_instance = [](PyObject *obj, const char *mgp_type_name) {
-    py::Object py_mgp(PyImport_ImportModule("mgp"));
+  // The 'mgp' module is imported at most once per conversion, as it's needed
+  // for up to three checks.
+  py::Object py_mgp;
+  auto is_mgp_instance = [&py_mgp](PyObject *obj, const char *mgp_type_name) {
+    if (!py_mgp) {
+      py_mgp = py::Object(PyImport_ImportModule("mgp"));
+    }
     if (!py_mgp) {
       PyErr_Clear();
       // This way we skip conversions of types from user-facing 'mgp' module.
@@ -2660,6 +3380,8 @@ mgp_value *PyObjectToMgpValue(PyObject *o, mgp_memory *memory) {
       throw std::runtime_error{"Unexpected error while creating mgp_value"};
     }
     static_cast<void>(duration.release());
+  } else if (PyObject_CheckBuffer(o) && !PyBytes_Check(o) && !PyByteArray_Check(o)) {
+    mgp_v = PyBufferToMgpValue(o, memory);
   } else {
     throw std::invalid_argument("Unsupported PyObject conversion");
   }
@@ -29,6 +29,12 @@ inline constexpr int64_t kDefaultBatchSize{1000};
 template <typename TMessage>
 using ConsumerFunction = std::function<void(const std::vector<TMessage> &)>;
 
+/// Consumer function which processes a batch in two stages: the function itself transforms the messages and the
+/// returned function executes the result of the transformation. Stream sources which support pipelining might run the
+/// first stage of a batch while the second stage of the previous batch is still in progress.
+template <typename TMessage>
+using PipelinedConsumerFunction = std::function<std::function<void()>(const std::vector<TMessage> &)>;
+
 struct CommonStreamInfo {
   std::chrono::milliseconds batch_interval;
   int64_t batch_size;
@@ -50,7 +56,7 @@ template <typename TStream>
 concept Stream = requires(TStream stream) {
   typename TStream::StreamInfo;
   typename TStream::Message;
-  TStream{std::string{""}, typename TStream::StreamInfo{}, ConsumerFunction<typename TStream::Message>{}};
+  TStream{std::string{""}, typename TStream::StreamInfo{}, PipelinedConsumerFunction<typename TStream::Message>{}};
   { stream.Start() } -> std::same_as<void>;
   { stream.StartWithLimit(uint64_t{}, std::optional<std::chrono::milliseconds>{}) } -> std::same_as<void>;
   { stream.Stop() } -> std::same_as<void>;
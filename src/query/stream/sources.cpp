@@ -17,7 +17,8 @@
 
 namespace memgraph::query::stream {
 KafkaStream::KafkaStream(std::string stream_name, StreamInfo stream_info,
-                         ConsumerFunction<integrations::kafka::Message> consumer_function) {
+                         PipelinedConsumerFunction<integrations::kafka::Message> consumer_function)
+    : transform_config_(std::move(stream_info.transform_config)) {
   integrations::kafka::ConsumerInfo consumer_info{
       .consumer_name = std::move(stream_name),
       .topics = std::move(stream_info.topics),
@@ -25,6 +26,8 @@ KafkaStream::KafkaStream(std::string stream_name, StreamInfo stream_info,
       .bootstrap_servers = std::move(stream_info.bootstrap_servers),
       .batch_interval = stream_info.common_info.batch_interval,
       .batch_size = stream_info.common_info.batch_size,
+      .parallelism = stream_info.parallelism,
+      .pipeline_depth = stream_info.pipeline_depth,
       .public_configs = std::move(stream_info.configs),
       .private_configs = std::move(stream_info.credentials),
   };
@@ -40,7 +43,10 @@ KafkaStream::StreamInfo KafkaStream::Info(std::string transformation_name) const
           .consumer_group = info.consumer_group,
           .bootstrap_servers = info.bootstrap_servers,
           .configs = info.public_configs,
-          .credentials = info.private_configs};
+          .credentials = info.private_configs,
+          .parallelism = info.parallelism,
+          .pipeline_depth = info.pipeline_depth,
+          .transform_config = transform_config_};
 }
 
 void KafkaStream::Start() { consumer_->Start(); }
@@ -65,6 +71,9 @@ const std::string kConsumerGroupKey{"consumer_group"};
 const std::string kBoostrapServers{"bootstrap_servers"};
 const std::string kConfigs{"configs"};
 const std::string kCredentials{"credentials"};
+const std::string kParallelism{"parallelism"};
+const std::string kPipelineDepth{"pipeline_depth"};
+const std::string kTransformConfig{"transform_config"};
 
 const std::unordered_map<std::string, std::string> kDefaultConfigsMap;
 }  // namespace
@@ -76,6 +85,9 @@ void to_json(nlohmann::json &data, KafkaStream::StreamInfo &&info) {
   data[kBoostrapServers] = std::move(info.bootstrap_servers);
   data[kConfigs] = std::move(info.configs);
   data[kCredentials] = std::move(info.credentials);
+  data[kParallelism] = info.parallelism;
+  data[kPipelineDepth] = info.pipeline_depth;
+  data[kTransformConfig] = std::move(info.transform_config);
 }
 
 void from_json(const nlohmann::json &data, KafkaStream::StreamInfo &info) {
@@ -86,17 +98,24 @@ void from_json(const nlohmann::json &data, KafkaStream::StreamInfo &info) {
   // These values might not be present in the persisted JSON object
   info.configs = data.value(kConfigs, kDefaultConfigsMap);
   info.credentials = data.value(kCredentials, kDefaultConfigsMap);
+  info.parallelism = data.value(kParallelism, integrations::kDefaultParallelism);
+  info.pipeline_depth = data.value(kPipelineDepth, integrations::kDefaultPipelineDepth);
+  info.transform_config = data.value(kTransformConfig, kDefaultConfigsMap);
 }
 
 PulsarStream::PulsarStream(std::string stream_name, StreamInfo stream_info,
-                           ConsumerFunction<integrations::pulsar::Message> consumer_function) {
+                           PipelinedConsumerFunction<integrations::pulsar::Message> consumer_function) {
   integrations::pulsar::ConsumerInfo consumer_info{.batch_size = stream_info.common_info.batch_size,
                                                    .batch_interval = stream_info.common_info.batch_interval,
                                                    .topics = std::move(stream_info.topics),
                                                    .consumer_name = std::move(stream_name),
                                                    .service_url = std::move(stream_info.service_url)};
 
-  consumer_.emplace(std::move(consumer_info), std::move(consumer_function));
+  // Pulsar consumer doesn't support pipelining, so both stages are run right after each other.
+  consumer_.emplace(std::move(consumer_info),
+                    [consumer_function = std::move(consumer_function)](const std::vector<Message> &messages) {
+                      consumer_function(messages)();
+                    });
 };
 
 PulsarStream::StreamInfo PulsarStream::Info(std::string transformation_name) const {
@@ -26,12 +26,16 @@ struct KafkaStream {
     std::string bootstrap_servers;
     std::unordered_map<std::string, std::string> configs;
     std::unordered_map<std::string, std::string> credentials;
+    int64_t parallelism{integrations::kDefaultParallelism};
+    int64_t pipeline_depth{integrations::kDefaultPipelineDepth};
+    // Passed to the transformation, see mgp_messages_transformation_config.
+    std::unordered_map<std::string, std::string> transform_config;
   };
 
   using Message = integrations::kafka::Message;
 
   KafkaStream(std::string stream_name, StreamInfo stream_info,
-              ConsumerFunction<integrations::kafka::Message> consumer_function);
+              PipelinedConsumerFunction<integrations::kafka::Message> consumer_function);
 
   StreamInfo Info(std::string transformation_name) const;
 
@@ -48,6 +52,7 @@ struct KafkaStream {
  private:
   using Consumer = integrations::kafka::Consumer;
   std::optional<Consumer> consumer_;
+  std::unordered_map<std::string, std::string> transform_config_;
 };
 
 void to_json(nlohmann::json &data, KafkaStream::StreamInfo &&info);
@@ -67,7 +72,7 @@ struct PulsarStream {
 
   using Message = integrations::pulsar::Message;
 
-  PulsarStream(std::string stream_name, StreamInfo stream_info, ConsumerFunction<Message> consumer_function);
+  PulsarStream(std::string stream_name, StreamInfo stream_info, PipelinedConsumerFunction<Message> consumer_function);
 
   StreamInfo Info(std::string transformation_name) const;
 
@@ -34,6 +34,9 @@
 #include "utils/memory.hpp"
 #include "utils/on_scope_exit.hpp"
 #include "utils/pmr/string.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+#include "utils/timer.hpp"
 #include "utils/variant_helpers.hpp"
 
 namespace EventCounter {
@@ -81,10 +84,38 @@ std::pair<TypedValue /*query*/, TypedValue /*parameters*/> ExtractTransformation
   return {query_value, params_value};
 }
 
+/// A query of a transformation result together with the parameters of its consecutive executions.
+using QueryBatch = std::pair<std::string, std::vector<std::map<std::string, storage::PropertyValue>>>;
+
+/// Groups the consecutive rows of a transformation result with the same query, so every group can be prepared only
+/// once and executed with each of the parameters. Only consecutive rows are grouped to preserve the execution order.
+std::vector<QueryBatch> GroupTransformationResult(const utils::pmr::vector<mgp_result_record> &rows,
+                                                  const std::string_view transformation_name,
+                                                  const std::string_view stream_name) {
+  std::vector<QueryBatch> query_batches;
+  for (const auto &row : rows) {
+    auto [query_value, params_value] = ExtractTransformationResult(row.values, transformation_name, stream_name);
+    const std::string_view query{query_value.ValueString()};
+    if (query_batches.empty() || query_batches.back().first != query) {
+      query_batches.emplace_back(std::string{query}, std::vector<std::map<std::string, storage::PropertyValue>>{});
+    }
+    storage::PropertyValue params_prop{params_value};
+    auto &params_batch = query_batches.back().second;
+    if (params_prop.IsNull()) {
+      params_batch.emplace_back();
+    } else {
+      params_batch.push_back(std::move(params_prop.ValueMap()));
+    }
+  }
+  return query_batches;
+}
+
 template <typename TMessage>
-void CallCustomTransformation(const std::string &transformation_name, const std::vector<TMessage> &messages,
-                              mgp_result &result, storage::Storage::Accessor &storage_accessor,
-                              utils::MemoryResource &memory_resource, const std::string &stream_name) {
+void CallCustomTransformation(const std::string &transformation_name,
+                              const std::unordered_map<std::string, std::string> &transformation_config,
+                              const std::vector<TMessage> &messages, mgp_result &result,
+                              storage::Storage::Accessor &storage_accessor, utils::MemoryResource &memory_resource,
+                              const std::string &stream_name) {
   DbAccessor db_accessor{&storage_accessor};
   {
     auto maybe_transformation =
@@ -97,6 +128,9 @@ void CallCustomTransformation(const std::string &transformation_name, const std:
     mgp_messages mgp_messages{mgp_messages::storage_type{&memory_resource}};
     std::transform(messages.begin(), messages.end(), std::back_inserter(mgp_messages.messages),
                    [](const TMessage &message) { return mgp_message{message}; });
+    for (const auto &[key, value] : transformation_config) {
+      mgp_messages.transformation_config.items.emplace(key.c_str(), mgp_value(value.c_str(), &memory_resource));
+    }
     mgp_graph graph{&db_accessor, storage::View::OLD, nullptr};
     mgp_memory memory{&memory_resource};
     result.rows.clear();
@@ -481,68 +515,100 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
   }
 
   auto *memory_resource = utils::NewDeleteResource();
+  // Only Kafka streams can be given a TRANSFORM_CONFIG.
+  std::unordered_map<std::string, std::string> transformation_config;
+  if constexpr (std::same_as<TStream, KafkaStream>) {
+    transformation_config = stream_info.transform_config;
+  }
 
+  // The consumer function might be called concurrently when the stream processes the messages of different
+  // partitions in parallel, therefore each call takes an interpreter of its own from this pool.
+  using InterpreterPool = utils::Synchronized<std::vector<std::unique_ptr<Interpreter>>, utils::SpinLock>;
+  auto latencies = std::make_shared<StageLatencies>();
+  // The transformation is the first stage and the execution of its result is the second one, so a pipelined stream
+  // can transform the next batch while the queries of the previous batch are executed. The second stage copies
+  // everything it needs, because it is run after the first stage returns.
   auto consumer_function = [interpreter_context = interpreter_context_, memory_resource, stream_name,
-                            transformation_name = stream_info.common_info.transformation_name, owner = owner,
-                            interpreter = std::make_shared<Interpreter>(interpreter_context_),
-                            result = mgp_result{nullptr, memory_resource},
+                            transformation_name = stream_info.common_info.transformation_name,
+                            transformation_config, owner = owner,
+                            interpreters = std::make_shared<InterpreterPool>(), latencies,
                             total_retries = interpreter_context_->config.stream_transaction_conflict_retries,
                             retry_interval = interpreter_context_->config.stream_transaction_retry_interval](
-                               const std::vector<typename TStream::Message> &messages) mutable {
-    auto accessor = interpreter_context->db->Access();
-    EventCounter::IncrementCounter(EventCounter::MessagesConsumed, messages.size());
-    CallCustomTransformation(transformation_name, messages, result, accessor, *memory_resource, stream_name);
-
-    DiscardValueResultStream stream;
-
-    spdlog::trace("Start transaction in stream '{}'", stream_name);
-    utils::OnScopeExit cleanup{[&interpreter, &result]() {
-      result.rows.clear();
-      interpreter->Abort();
-    }};
+                               const std::vector<typename TStream::Message> &messages) {
+    auto result = std::make_shared<mgp_result>(nullptr, memory_resource);
+    {
+      const utils::Timer timer;
+      auto accessor = interpreter_context->db->Access();
+      EventCounter::IncrementCounter(EventCounter::MessagesConsumed, messages.size());
+      CallCustomTransformation(transformation_name, transformation_config, messages, *result, accessor,
+                               *memory_resource, stream_name);
+      latencies->transformation_us.store(timer.Elapsed<std::chrono::microseconds>().count());
+    }
 
-    const static std::map<std::string, storage::PropertyValue> empty_parameters{};
-    uint32_t i = 0;
-    while (true) {
-      try {
-        interpreter->BeginTransaction();
-        for (auto &row : result.rows) {
-          spdlog::trace("Processing row in stream '{}'", stream_name);
-          auto [query_value, params_value] = ExtractTransformationResult(row.values, transformation_name, stream_name);
-          storage::PropertyValue params_prop{params_value};
-
-          std::string query{query_value.ValueString()};
-          spdlog::trace("Executing query '{}' in stream '{}'", query, stream_name);
-          auto prepare_result =
-              interpreter->Prepare(query, params_prop.IsNull() ? empty_parameters : params_prop.ValueMap(), nullptr);
-          if (!interpreter_context->auth_checker->IsUserAuthorized(owner, prepare_result.privileges)) {
-            throw StreamsException{
-                "Couldn't execute query '{}' for stream '{}' because the owner is not authorized to execute the "
-                "query!",
-                query, stream_name};
-          }
-          interpreter->PullAll(&stream);
+    return std::function<void()>{[interpreter_context, stream_name, transformation_name, owner, interpreters,
+                                  latencies, total_retries, retry_interval, result = std::move(result)]() {
+      const utils::Timer timer;
+      auto interpreter = interpreters->WithLock([&](auto &pool) {
+        if (pool.empty()) {
+          return std::make_unique<Interpreter>(interpreter_context);
         }
-
-        spdlog::trace("Commit transaction in stream '{}'", stream_name);
-        interpreter->CommitTransaction();
-        result.rows.clear();
-        break;
-      } catch (const query::TransactionSerializationException &e) {
+        auto pooled_interpreter = std::move(pool.back());
+        pool.pop_back();
+        return pooled_interpreter;
+      });
+      utils::OnScopeExit return_interpreter{
+          [&interpreters, &interpreter]() { interpreters->Lock()->push_back(std::move(interpreter)); }};
+
+      DiscardValueResultStream stream;
+
+      spdlog::trace("Start transaction in stream '{}'", stream_name);
+      utils::OnScopeExit cleanup{[&interpreter, &result]() {
+        result->rows.clear();
         interpreter->Abort();
-        if (i == total_retries) {
-          throw;
+      }};
+
+      const auto query_batches = GroupTransformationResult(result->rows, transformation_name, stream_name);
+      uint32_t i = 0;
+      while (true) {
+        try {
+          interpreter->BeginTransaction();
+          for (const auto &[query, params_batch] : query_batches) {
+            spdlog::trace("Executing query '{}' {} time(s) in stream '{}'", query, params_batch.size(), stream_name);
+            auto prepare_result = params_batch.size() == 1
+                                      ? interpreter->Prepare(query, params_batch.front(), nullptr)
+                                      : interpreter->PrepareBatch(query, params_batch, nullptr);
+            if (!interpreter_context->auth_checker->IsUserAuthorized(owner, prepare_result.privileges)) {
+              throw StreamsException{
+                  "Couldn't execute query '{}' for stream '{}' because the owner is not authorized to execute the "
+                  "query!",
+                  query, stream_name};
+            }
+            interpreter->PullAll(&stream);
+          }
+
+          spdlog::trace("Commit transaction in stream '{}'", stream_name);
+          interpreter->CommitTransaction();
+          result->rows.clear();
+          break;
+        } catch (const query::TransactionSerializationException &e) {
+          interpreter->Abort();
+          if (i == total_retries) {
+            throw;
+          }
+          ++i;
+          std::this_thread::sleep_for(retry_interval);
         }
-        ++i;
-        std::this_thread::sleep_for(retry_interval);
       }
-    }
+      latencies->execution_us.store(timer.Elapsed<std::chrono::microseconds>().count());
+    }};
   };
 
   auto insert_result = map.try_emplace(
-      stream_name, StreamData<TStream>{std::move(stream_info.common_info.transformation_name), std::move(owner),
+      stream_name, StreamData<TStream>{std::move(stream_info.common_info.transformation_name),
+                                       std::move(transformation_config), std::move(owner),
                                        std::make_unique<SynchronizedStreamSource<TStream>>(
-                                           stream_name, std::move(stream_info), std::move(consumer_function))});
+                                           stream_name, std::move(stream_info), std::move(consumer_function)),
+                                       std::move(latencies)});
   MG_ASSERT(insert_result.second, "Unexpected error during storing consumer '{}'", stream_name);
   return insert_result.first;
 }
@@ -707,9 +773,19 @@ std::vector<StreamStatus<>> Streams::GetStreamInfo() const {
           [&, &stream_name = stream_name](const auto &stream_data) {
             auto locked_stream_source = stream_data.stream_source->ReadLock();
             auto info = locked_stream_source->Info(stream_data.transformation_name);
-            result.emplace_back(StreamStatus<>{stream_name, StreamType(*locked_stream_source),
-                                               locked_stream_source->IsRunning(), std::move(info.common_info),
-                                               stream_data.owner});
+            const auto to_latency =
+                [](const std::atomic<int64_t> &latency_us) -> std::optional<std::chrono::microseconds> {
+              const auto latency = latency_us.load();
+              if (latency == StageLatencies::kNoBatch) {
+                return std::nullopt;
+              }
+              return std::chrono::microseconds{latency};
+            };
+            result.emplace_back(StreamStatus<>{
+                stream_name, StreamType(*locked_stream_source), locked_stream_source->IsRunning(),
+                std::move(info.common_info), stream_data.owner,
+                StreamLatencies{.transformation = to_latency(stream_data.latencies->transformation_us),
+                                .execution = to_latency(stream_data.latencies->execution_us)}});
           },
           stream_data);
     }
@@ -728,6 +804,7 @@ TransformationResult Streams::Check(const std::string &stream_name, std::optiona
         // that
         const auto locked_stream_source = stream_data.stream_source->ReadLock();
         const auto transformation_name = stream_data.transformation_name;
+        const auto transformation_config = stream_data.transformation_config;
         locked_streams.reset();
 
         auto *memory_resource = utils::NewDeleteResource();
@@ -735,10 +812,12 @@ TransformationResult Streams::Check(const std::string &stream_name, std::optiona
         TransformationResult test_result;
 
         auto consumer_function = [interpreter_context = interpreter_context_, memory_resource, &stream_name,
-                                  &transformation_name = transformation_name, &result,
+                                  &transformation_name = transformation_name,
+                                  &transformation_config = transformation_config, &result,
                                   &test_result]<typename T>(const std::vector<T> &messages) mutable {
           auto accessor = interpreter_context->db->Access();
-          CallCustomTransformation(transformation_name, messages, result, accessor, *memory_resource, stream_name);
+          CallCustomTransformation(transformation_name, transformation_config, messages, result, accessor,
+                                   *memory_resource, stream_name);
 
           auto result_row = std::vector<TypedValue>();
           result_row.reserve(kCheckStreamResultSize);
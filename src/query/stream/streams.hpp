@@ -11,9 +11,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <concepts>
 #include <functional>
 #include <map>
+#include <memory>
 #include <optional>
 #include <type_traits>
 #include <unordered_map>
@@ -59,6 +62,12 @@ struct StreamInfo<TStream> {
 template <typename T>
 using StreamInfoType = typename StreamInfo<T>::Type;
 
+/// Latencies of the stages of the last batch processed by a stream, empty if no batch was processed yet.
+struct StreamLatencies {
+  std::optional<std::chrono::microseconds> transformation;
+  std::optional<std::chrono::microseconds> execution;
+};
+
 template <typename T = void>
 struct StreamStatus {
   std::string name;
@@ -66,6 +75,8 @@ struct StreamStatus {
   bool is_running;
   StreamInfoType<T> info;
   std::optional<std::string> owner;
+  // Runtime statistics, they are not persisted.
+  StreamLatencies latencies{};
 };
 
 using TransformationResult = std::vector<std::vector<TypedValue>>;
@@ -169,11 +180,20 @@ class Streams final {
   template <Stream TStream>
   using SynchronizedStreamSource = utils::Synchronized<TStream, utils::WritePrioritizedRWLock>;
 
+  // Updated by the consumer function of the stream, which might run concurrently with the readers.
+  struct StageLatencies {
+    static constexpr int64_t kNoBatch{-1};
+    std::atomic<int64_t> transformation_us{kNoBatch};
+    std::atomic<int64_t> execution_us{kNoBatch};
+  };
+
   template <Stream TStream>
   struct StreamData {
     std::string transformation_name;
+    std::unordered_map<std::string, std::string> transformation_config;
     std::optional<std::string> owner;
     std::unique_ptr<SynchronizedStreamSource<TStream>> stream_source;
+    std::shared_ptr<StageLatencies> latencies;
   };
 
   using StreamDataVariant = std::variant<StreamData<KafkaStream>, StreamData<PulsarStream>>;
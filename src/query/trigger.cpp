@@ -150,15 +150,57 @@ std::vector<std::pair<Identifier, TriggerIdentifierTag>> GetPredefinedIdentifier
 }
 }  // namespace
 
+std::string TriggerScopeInfoToString(const TriggerScopeInfo &scope_info) {
+  std::stringstream stream;
+  stream << ':' << scope_info.name;
+  if (!scope_info.properties.empty()) {
+    stream << '(';
+    utils::PrintIterable(stream, scope_info.properties, ", ");
+    stream << ')';
+  }
+  return stream.str();
+}
+
 Trigger::Trigger(std::string name, const std::string &query,
                  const std::map<std::string, storage::PropertyValue> &user_parameters,
                  const TriggerEventType event_type, utils::SkipList<QueryCacheEntry> *query_cache,
                  DbAccessor *db_accessor, const InterpreterConfig::Query &query_config,
-                 std::optional<std::string> owner, const query::AuthChecker *auth_checker)
+                 std::optional<std::string> owner, const query::AuthChecker *auth_checker,
+                 std::optional<TriggerScopeInfo> scope_info)
     : name_{std::move(name)},
       parsed_statements_{ParseQuery(query, user_parameters, query_cache, query_config)},
       event_type_{event_type},
+      scope_info_{std::move(scope_info)},
       owner_{std::move(owner)} {
+  if (scope_info_) {
+    auto &scope = scope_.emplace();
+    switch (event_type_) {
+      case TriggerEventType::VERTEX_CREATE:
+      case TriggerEventType::VERTEX_DELETE:
+      case TriggerEventType::VERTEX_UPDATE:
+        scope.label = db_accessor->NameToLabel(scope_info_->name);
+        break;
+      case TriggerEventType::EDGE_CREATE:
+      case TriggerEventType::EDGE_DELETE:
+      case TriggerEventType::EDGE_UPDATE:
+        scope.edge_type = db_accessor->NameToEdgeType(scope_info_->name);
+        break;
+      case TriggerEventType::ANY:
+      case TriggerEventType::CREATE:
+      case TriggerEventType::DELETE:
+      case TriggerEventType::UPDATE:
+        throw utils::BasicException("Only the events on vertices or edges can be restricted to a scope.");
+    }
+    if (!scope_info_->properties.empty() && event_type_ != TriggerEventType::VERTEX_UPDATE &&
+        event_type_ != TriggerEventType::EDGE_UPDATE) {
+      throw utils::BasicException("Only the update events can be restricted to properties.");
+    }
+    scope.properties.reserve(scope_info_->properties.size());
+    for (const auto &property : scope_info_->properties) {
+      scope.properties.push_back(db_accessor->NameToProperty(property));
+    }
+  }
+
   // We check immediately if the query is valid by trying to create a plan.
   GetPlan(db_accessor, auth_checker);
 }
@@ -196,7 +238,15 @@ std::shared_ptr<Trigger::TriggerPlan> Trigger::GetPlan(DbAccessor *db_accessor,
 void Trigger::Execute(DbAccessor *dba, utils::MonotonicBufferResource *execution_memory,
                       const double max_execution_time_sec, std::atomic<bool> *is_shutting_down,
                       const TriggerContext &context, const AuthChecker *auth_checker) const {
-  if (!context.ShouldEventTrigger(event_type_)) {
+  // A scoped trigger works with its own context which contains
+  // only the objects from its scope
+  std::optional<TriggerContext> scoped_context;
+  if (scope_) {
+    scoped_context.emplace(context.RestrictedToScope(*scope_));
+  }
+  const auto &trigger_context = scoped_context ? *scoped_context : context;
+
+  if (!trigger_context.ShouldEventTrigger(event_type_)) {
     return;
   }
 
@@ -239,7 +289,7 @@ void Trigger::Execute(DbAccessor *dba, utils::MonotonicBufferResource *execution
       continue;
     }
 
-    frame[plan.symbol_table().at(identifier)] = context.GetTypedValue(tag, dba);
+    frame[plan.symbol_table().at(identifier)] = trigger_context.GetTypedValue(tag, dba);
   }
 
   while (cursor->Pull(frame, ctx))
@@ -315,10 +365,29 @@ void TriggerStore::RestoreTriggers(utils::SkipList<QueryCacheEntry> *query_cache
       continue;
     }
 
+    // Triggers created before the scopes were introduced don't have the scope field
+    const auto scope_json = json_trigger_data["scope"];
+    std::optional<TriggerScopeInfo> scope_info{};
+    if (scope_json.is_object()) {
+      const auto &properties_json = scope_json["properties"];
+      if (!scope_json["name"].is_string() || !properties_json.is_array() ||
+          !std::all_of(properties_json.begin(), properties_json.end(),
+                       [](const auto &property) { return property.is_string(); })) {
+        spdlog::warn(invalid_state_message);
+        continue;
+      }
+      auto &info = scope_info.emplace();
+      info.name = scope_json["name"].get<std::string>();
+      info.properties = properties_json.get<std::vector<std::string>>();
+    } else if (!scope_json.is_null()) {
+      spdlog::warn(invalid_state_message);
+      continue;
+    }
+
     std::optional<Trigger> trigger;
     try {
       trigger.emplace(trigger_name, statement, user_parameters, event_type, query_cache, db_accessor, query_config,
-                      std::move(owner), auth_checker);
+                      std::move(owner), auth_checker, std::move(scope_info));
     } catch (const utils::BasicException &e) {
       spdlog::warn("Failed to create trigger '{}' because: {}", trigger_name, e.what());
       continue;
@@ -337,7 +406,7 @@ void TriggerStore::AddTrigger(std::string name, const std::string &query,
                               TriggerEventType event_type, TriggerPhase phase,
                               utils::SkipList<QueryCacheEntry> *query_cache, DbAccessor *db_accessor,
                               const InterpreterConfig::Query &query_config, std::optional<std::string> owner,
-                              const query::AuthChecker *auth_checker) {
+                              const query::AuthChecker *auth_checker, std::optional<TriggerScopeInfo> scope_info) {
   std::unique_lock store_guard{store_lock_};
   if (storage_.Get(name)) {
     throw utils::BasicException("Trigger with the same name already exists.");
@@ -346,7 +415,7 @@ void TriggerStore::AddTrigger(std::string name, const std::string &query,
   std::optional<Trigger> trigger;
   try {
     trigger.emplace(std::move(name), query, user_parameters, event_type, query_cache, db_accessor, query_config,
-                    std::move(owner), auth_checker);
+                    std::move(owner), auth_checker, std::move(scope_info));
   } catch (const utils::BasicException &e) {
     const auto identifiers = GetPredefinedIdentifiers(event_type);
     std::stringstream identifier_names_stream;
@@ -373,6 +442,12 @@ void TriggerStore::AddTrigger(std::string name, const std::string &query,
   } else {
     data["owner"] = nullptr;
   }
+
+  if (const auto &scope_info_from_trigger = trigger->ScopeInfo(); scope_info_from_trigger.has_value()) {
+    data["scope"] = {{"name", scope_info_from_trigger->name}, {"properties", scope_info_from_trigger->properties}};
+  } else {
+    data["scope"] = nullptr;
+  }
   storage_.Put(trigger->Name(), data.dump());
   store_guard.unlock();
 
@@ -415,7 +490,8 @@ std::vector<TriggerStore::TriggerInfo> TriggerStore::GetTriggerInfo() const {
 
   const auto add_info = [&](const utils::SkipList<Trigger> &trigger_list, const TriggerPhase phase) {
     for (const auto &trigger : trigger_list.access()) {
-      info.push_back({trigger.Name(), trigger.OriginalStatement(), trigger.EventType(), phase, trigger.Owner()});
+      info.push_back(
+          {trigger.Name(), trigger.OriginalStatement(), trigger.EventType(), phase, trigger.Owner(), trigger.ScopeInfo()});
     }
   };
 
@@ -425,17 +501,18 @@ std::vector<TriggerStore::TriggerInfo> TriggerStore::GetTriggerInfo() const {
   return info;
 }
 
-std::unordered_set<TriggerEventType> TriggerStore::GetEventTypes() const {
-  std::unordered_set<TriggerEventType> event_types;
+std::vector<ScopedTriggerEvent> TriggerStore::GetScopedEvents() const {
+  std::vector<ScopedTriggerEvent> events;
+  events.reserve(before_commit_triggers_.size() + after_commit_triggers_.size());
 
-  const auto add_event_types = [&](const utils::SkipList<Trigger> &trigger_list) {
+  const auto add_events = [&](const utils::SkipList<Trigger> &trigger_list) {
     for (const auto &trigger : trigger_list.access()) {
-      event_types.insert(trigger.EventType());
+      events.push_back({trigger.EventType(), trigger.Scope()});
     }
   };
 
-  add_event_types(before_commit_triggers_);
-  add_event_types(after_commit_triggers_);
-  return event_types;
+  add_events(before_commit_triggers_);
+  add_events(after_commit_triggers_);
+  return events;
 }
 }  // namespace memgraph::query
@@ -15,6 +15,7 @@
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,12 +32,21 @@
 #include "utils/spin_lock.hpp"
 
 namespace memgraph::query {
+// Scope of a trigger event as it was defined by the user, e.g. `:Order(status)` in `ON () UPDATE :Order(status)`
+struct TriggerScopeInfo {
+  // Label of the vertices or the edge type of the edges
+  std::string name;
+  std::vector<std::string> properties;
+};
+
+std::string TriggerScopeInfoToString(const TriggerScopeInfo &scope_info);
+
 struct Trigger {
   explicit Trigger(std::string name, const std::string &query,
                    const std::map<std::string, storage::PropertyValue> &user_parameters, TriggerEventType event_type,
                    utils::SkipList<QueryCacheEntry> *query_cache, DbAccessor *db_accessor,
                    const InterpreterConfig::Query &query_config, std::optional<std::string> owner,
-                   const query::AuthChecker *auth_checker);
+                   const query::AuthChecker *auth_checker, std::optional<TriggerScopeInfo> scope_info = std::nullopt);
 
   void Execute(DbAccessor *dba, utils::MonotonicBufferResource *execution_memory, double max_execution_time_sec,
                std::atomic<bool> *is_shutting_down, const TriggerContext &context,
@@ -53,6 +63,8 @@ struct Trigger {
   const auto &OriginalStatement() const noexcept { return parsed_statements_.query_string; }
   const auto &Owner() const noexcept { return owner_; }
   auto EventType() const noexcept { return event_type_; }
+  const auto &ScopeInfo() const noexcept { return scope_info_; }
+  const auto &Scope() const noexcept { return scope_; }
 
  private:
   struct TriggerPlan {
@@ -69,6 +81,8 @@ struct Trigger {
   ParsedQuery parsed_statements_;
 
   TriggerEventType event_type_;
+  std::optional<TriggerScopeInfo> scope_info_;
+  std::optional<TriggerScope> scope_;
 
   mutable utils::SpinLock plan_lock_;
   mutable std::shared_ptr<TriggerPlan> trigger_plan_;
@@ -87,7 +101,7 @@ struct TriggerStore {
                   const std::map<std::string, storage::PropertyValue> &user_parameters, TriggerEventType event_type,
                   TriggerPhase phase, utils::SkipList<QueryCacheEntry> *query_cache, DbAccessor *db_accessor,
                   const InterpreterConfig::Query &query_config, std::optional<std::string> owner,
-                  const query::AuthChecker *auth_checker);
+                  const query::AuthChecker *auth_checker, std::optional<TriggerScopeInfo> scope_info = std::nullopt);
 
   void DropTrigger(const std::string &name);
 
@@ -97,6 +111,7 @@ struct TriggerStore {
     TriggerEventType event_type;
     TriggerPhase phase;
     std::optional<std::string> owner;
+    std::optional<TriggerScopeInfo> scope_info{};
   };
 
   std::vector<TriggerInfo> GetTriggerInfo() const;
@@ -105,7 +120,8 @@ struct TriggerStore {
   const auto &AfterCommitTriggers() const noexcept { return after_commit_triggers_; }
 
   bool HasTriggers() const noexcept { return before_commit_triggers_.size() > 0 || after_commit_triggers_.size() > 0; }
-  std::unordered_set<TriggerEventType> GetEventTypes() const;
+  // The events of all triggers with their scopes, used to set up the TriggerContextCollector
+  std::vector<ScopedTriggerEvent> GetScopedEvents() const;
 
  private:
   utils::SpinLock store_lock_;
@@ -12,6 +12,7 @@
 #include "query/trigger.hpp"
 
 #include <concepts>
+#include <iterator>
 
 #include "query/context.hpp"
 #include "query/cypher_query_interpreter.hpp"
@@ -21,6 +22,7 @@
 #include "query/serialization/property_value.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/property_value.hpp"
+#include "utils/logging.hpp"
 #include "utils/memory.hpp"
 
 namespace memgraph::query {
@@ -202,10 +204,15 @@ template <detail::ObjectAccessor TAccessor>
   auto [set_object_properties, removed_object_properties] = PropertyMapToList(std::move(registry.property_changes));
   std::vector<detail::CreatedObject<TAccessor>> created_objects_vec;
   created_objects_vec.reserve(registry.created_objects.size());
-  std::transform(registry.created_objects.begin(), registry.created_objects.end(),
-                 std::back_inserter(created_objects_vec),
-                 [](const auto &gid_and_created_object) { return gid_and_created_object.second; });
+  for (const auto &[gid, created_object] : registry.created_objects) {
+    // The objects were in the scope when they were registered, but a created vertex could lose the label later
+    if (std::same_as<TAccessor, EdgeAccessor> ||
+        detail::IsInScope(registry.created_objects_scopes, created_object.object, storage::View::NEW)) {
+      created_objects_vec.push_back(created_object);
+    }
+  }
   registry.created_objects.clear();
+  registry.created_objects_out_of_scope.clear();
 
   return {std::move(created_objects_vec), std::move(registry.deleted_objects), std::move(set_object_properties),
           std::move(removed_object_properties)};
@@ -226,6 +233,28 @@ std::map<std::string, TypedValue> RemovedVertexLabel::ToMap(DbAccessor *dba) con
 }
 }  // namespace detail
 
+bool TriggerScope::Matches(const VertexAccessor &vertex, const storage::View view) const {
+  if (!label) {
+    return true;
+  }
+  const auto maybe_has_label = vertex.HasLabel(view, *label);
+  return maybe_has_label.HasValue() && *maybe_has_label;
+}
+
+bool TriggerScope::Matches(const EdgeAccessor &edge, [[maybe_unused]] const storage::View view) const {
+  return !edge_type || edge.EdgeType() == *edge_type;
+}
+
+bool TriggerScope::MatchesProperty(const storage::PropertyId property) const {
+  return properties.empty() || std::find(properties.begin(), properties.end(), property) != properties.end();
+}
+
+bool TriggerScope::MatchesLabelChange(const VertexAccessor &vertex, const storage::LabelId label_id,
+                                      const storage::View view) const {
+  // A removed label is not on the vertex anymore, so the changed label is checked on its own
+  return properties.empty() && (label == label_id || Matches(vertex, view));
+}
+
 const char *TriggerEventTypeToString(const TriggerEventType event_type) {
   switch (event_type) {
     case TriggerEventType::ANY:
@@ -260,6 +289,50 @@ const char *TriggerEventTypeToString(const TriggerEventType event_type) {
   }
 }
 
+void TriggerContext::Merge(TriggerContext other) {
+  const auto append = [](auto *values, auto &&other_values) {
+    values->insert(values->end(), std::make_move_iterator(other_values.begin()),
+                   std::make_move_iterator(other_values.end()));
+  };
+
+  append(&created_vertices_, std::move(other.created_vertices_));
+  append(&deleted_vertices_, std::move(other.deleted_vertices_));
+  append(&set_vertex_properties_, std::move(other.set_vertex_properties_));
+  append(&removed_vertex_properties_, std::move(other.removed_vertex_properties_));
+  append(&set_vertex_labels_, std::move(other.set_vertex_labels_));
+  append(&removed_vertex_labels_, std::move(other.removed_vertex_labels_));
+  append(&created_edges_, std::move(other.created_edges_));
+  append(&deleted_edges_, std::move(other.deleted_edges_));
+  append(&set_edge_properties_, std::move(other.set_edge_properties_));
+  append(&removed_edge_properties_, std::move(other.removed_edge_properties_));
+}
+
+TriggerContext TriggerContext::RestrictedToScope(const TriggerScope &scope) const {
+  const auto restrict = [](const auto &values, const auto &is_in_scope) {
+    std::remove_cvref_t<decltype(values)> restricted_values;
+    std::copy_if(values.begin(), values.end(), std::back_inserter(restricted_values), is_in_scope);
+    return restricted_values;
+  };
+  const auto object_in_scope = [&scope](const auto &value) { return scope.Matches(value.object, storage::View::OLD); };
+  const auto property_change_in_scope = [&scope](const auto &value) {
+    return scope.MatchesProperty(value.key) && scope.Matches(value.object, storage::View::OLD);
+  };
+  const auto label_change_in_scope = [&scope](const auto &value) {
+    return scope.MatchesLabelChange(value.object, value.label_id, storage::View::OLD);
+  };
+
+  return {restrict(created_vertices_, object_in_scope),
+          restrict(deleted_vertices_, object_in_scope),
+          restrict(set_vertex_properties_, property_change_in_scope),
+          restrict(removed_vertex_properties_, property_change_in_scope),
+          restrict(set_vertex_labels_, label_change_in_scope),
+          restrict(removed_vertex_labels_, label_change_in_scope),
+          restrict(created_edges_, object_in_scope),
+          restrict(deleted_edges_, object_in_scope),
+          restrict(set_edge_properties_, property_change_in_scope),
+          restrict(removed_edge_properties_, property_change_in_scope)};
+}
+
 void TriggerContext::AdaptForAccessor(DbAccessor *accessor) {
   {
     // adapt created_vertices_
@@ -435,7 +508,17 @@ bool TriggerContext::ShouldEventTrigger(const TriggerEventType event_type) const
 void TriggerContextCollector::UpdateLabelMap(const VertexAccessor vertex, const storage::LabelId label_id,
                                              const LabelChange change) {
   auto &registry = GetRegistry<VertexAccessor>();
-  if (!registry.should_register_updated_objects || registry.created_objects.count(vertex.Gid())) {
+  if (change == LabelChange::ADD) {
+    // A vertex created out of the scope of the created objects gets into it with the label of the scope
+    if (auto it = registry.created_objects_out_of_scope.find(vertex.Gid());
+        it != registry.created_objects_out_of_scope.end() &&
+        detail::IsInScope(registry.created_objects_scopes, vertex, storage::View::NEW)) {
+      registry.created_objects_out_of_scope.erase(it);
+      registry.created_objects.emplace(vertex.Gid(), detail::CreatedObject{vertex});
+    }
+  }
+
+  if (!registry.should_register_updated_objects || registry.IsCreatedObject(vertex.Gid())) {
     return;
   }
 
@@ -444,49 +527,98 @@ void TriggerContextCollector::UpdateLabelMap(const VertexAccessor vertex, const
     return;
   }
 
+  const auto &scopes = registry.updated_objects_scopes;
+  if (scopes && std::none_of(scopes->begin(), scopes->end(), [&](const auto &scope) {
+        return scope.MatchesLabelChange(vertex, label_id, storage::View::NEW);
+      })) {
+    return;
+  }
+
+  if (!TryRegisterNewObject()) {
+    return;
+  }
+
   label_changes_.emplace(std::make_pair(vertex, label_id), LabelChangeToInt(change));
 }
 
-TriggerContextCollector::TriggerContextCollector(const std::unordered_set<TriggerEventType> &event_types) {
-  for (const auto event_type : event_types) {
+namespace {
+std::vector<ScopedTriggerEvent> ToUnscopedEvents(const std::unordered_set<TriggerEventType> &event_types) {
+  std::vector<ScopedTriggerEvent> events;
+  events.reserve(event_types.size());
+  std::transform(event_types.begin(), event_types.end(), std::back_inserter(events),
+                 [](const auto event_type) { return ScopedTriggerEvent{event_type, std::nullopt}; });
+  return events;
+}
+
+// An event without a scope makes the registration of all objects necessary, no matter
+// which scopes the other events have
+void AddScope(bool *should_register, TriggerScopeFilter *scopes, const std::optional<TriggerScope> &scope) {
+  if (!scope) {
+    scopes->reset();
+  } else if (!*should_register) {
+    *scopes = std::vector<TriggerScope>{*scope};
+  } else if (*scopes) {
+    (*scopes)->push_back(*scope);
+  }
+  *should_register = true;
+}
+}  // namespace
+
+TriggerContextCollector::TriggerContextCollector(const std::unordered_set<TriggerEventType> &event_types)
+    : TriggerContextCollector(ToUnscopedEvents(event_types)) {}
+
+TriggerContextCollector::TriggerContextCollector(const std::vector<ScopedTriggerEvent> &events,
+                                                 const size_t max_objects)
+    : max_objects_{max_objects} {
+  const auto add_created = [](auto &registry, const auto &scope) {
+    AddScope(&registry.should_register_created_objects, &registry.created_objects_scopes, scope);
+  };
+  const auto add_deleted = [](auto &registry, const auto &scope) {
+    AddScope(&registry.should_register_deleted_objects, &registry.deleted_objects_scopes, scope);
+  };
+  const auto add_updated = [](auto &registry, const auto &scope) {
+    AddScope(&registry.should_register_updated_objects, &registry.updated_objects_scopes, scope);
+  };
+
+  for (const auto &[event_type, scope] : events) {
     switch (event_type) {
       case TriggerEventType::ANY:
-        vertex_registry_.should_register_created_objects = true;
-        edge_registry_.should_register_created_objects = true;
-        vertex_registry_.should_register_deleted_objects = true;
-        edge_registry_.should_register_deleted_objects = true;
-        vertex_registry_.should_register_updated_objects = true;
-        edge_registry_.should_register_updated_objects = true;
+        add_created(vertex_registry_, scope);
+        add_created(edge_registry_, scope);
+        add_deleted(vertex_registry_, scope);
+        add_deleted(edge_registry_, scope);
+        add_updated(vertex_registry_, scope);
+        add_updated(edge_registry_, scope);
         break;
       case TriggerEventType::VERTEX_CREATE:
-        vertex_registry_.should_register_created_objects = true;
+        add_created(vertex_registry_, scope);
         break;
       case TriggerEventType::EDGE_CREATE:
-        edge_registry_.should_register_created_objects = true;
+        add_created(edge_registry_, scope);
         break;
       case TriggerEventType::CREATE:
-        vertex_registry_.should_register_created_objects = true;
-        edge_registry_.should_register_created_objects = true;
+        add_created(vertex_registry_, scope);
+        add_created(edge_registry_, scope);
         break;
       case TriggerEventType::VERTEX_DELETE:
-        vertex_registry_.should_register_deleted_objects = true;
+        add_deleted(vertex_registry_, scope);
         break;
       case TriggerEventType::EDGE_DELETE:
-        edge_registry_.should_register_deleted_objects = true;
+        add_deleted(edge_registry_, scope);
         break;
       case TriggerEventType::DELETE:
-        vertex_registry_.should_register_deleted_objects = true;
-        edge_registry_.should_register_deleted_objects = true;
+        add_deleted(vertex_registry_, scope);
+        add_deleted(edge_registry_, scope);
         break;
       case TriggerEventType::VERTEX_UPDATE:
-        vertex_registry_.should_register_updated_objects = true;
+        add_updated(vertex_registry_, scope);
         break;
       case TriggerEventType::EDGE_UPDATE:
-        edge_registry_.should_register_updated_objects = true;
+        add_updated(edge_registry_, scope);
         break;
       case TriggerEventType::UPDATE:
-        vertex_registry_.should_register_updated_objects = true;
-        edge_registry_.should_register_updated_objects = true;
+        add_updated(vertex_registry_, scope);
+        add_updated(edge_registry_, scope);
         break;
     }
   }
@@ -504,6 +636,21 @@ TriggerContextCollector::TriggerContextCollector(const std::unordered_set<Trigge
   deduce_if_should_register_created(edge_registry_);
 }
 
+bool TriggerContextCollector::TryRegisterNewObject() {
+  if (max_objects_ == 0 || registered_objects_ < max_objects_) {
+    ++registered_objects_;
+    return true;
+  }
+  if (!max_objects_reached_) {
+    spdlog::warn(
+        "The number of objects registered for the triggers reached the limit of {}, the rest of the changes made by "
+        "the transaction won't be visible to the triggers!",
+        max_objects_);
+    max_objects_reached_ = true;
+  }
+  return false;
+}
+
 bool TriggerContextCollector::ShouldRegisterVertexLabelChange() const {
   return vertex_registry_.should_register_updated_objects;
 }
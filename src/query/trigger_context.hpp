@@ -12,11 +12,14 @@
 #pragma once
 
 #include <cstdint>
+#include <algorithm>
 #include <map>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -160,6 +163,45 @@ enum class TriggerEventType : uint8_t {
 
 const char *TriggerEventTypeToString(TriggerEventType event_type);
 
+// Restricts the events of a trigger to the vertices with a label or to the edges of an edge type. The update events
+// can be further restricted to the changes of the listed properties, in which case the label changes are not in the
+// scope. The scope of a change is checked at the moment the change is made, so e.g. a property set on a vertex
+// before it got the label of the scope is not in the scope.
+struct TriggerScope {
+  bool Matches(const VertexAccessor &vertex, storage::View view) const;
+  bool Matches(const EdgeAccessor &edge, storage::View view) const;
+  bool MatchesProperty(storage::PropertyId property) const;
+  bool MatchesLabelChange(const VertexAccessor &vertex, storage::LabelId label_id, storage::View view) const;
+
+  std::optional<storage::LabelId> label;
+  std::optional<storage::EdgeTypeId> edge_type;
+  std::vector<storage::PropertyId> properties;
+};
+
+struct ScopedTriggerEvent {
+  TriggerEventType event_type;
+  std::optional<TriggerScope> scope;
+};
+
+// Scopes of the objects relevant for triggers, std::nullopt if all of the objects are relevant
+using TriggerScopeFilter = std::optional<std::vector<TriggerScope>>;
+
+namespace detail {
+template <ObjectAccessor TAccessor>
+bool IsInScope(const TriggerScopeFilter &scopes, const TAccessor &object, const storage::View view) {
+  return !scopes || std::any_of(scopes->begin(), scopes->end(),
+                                [&](const auto &scope) { return scope.Matches(object, view); });
+}
+
+template <ObjectAccessor TAccessor>
+bool IsPropertyChangeInScope(const TriggerScopeFilter &scopes, const TAccessor &object,
+                             const storage::PropertyId property, const storage::View view) {
+  return !scopes || std::any_of(scopes->begin(), scopes->end(), [&](const auto &scope) {
+           return scope.MatchesProperty(property) && scope.Matches(object, view);
+         });
+}
+}  // namespace detail
+
 static_assert(std::is_trivially_copy_constructible_v<VertexAccessor>,
               "VertexAccessor is not trivially copy constructible, move it where possible and remove this assert");
 static_assert(std::is_trivially_copy_constructible_v<EdgeAccessor>,
@@ -199,6 +241,14 @@ class TriggerContext {
   // to the sent DbAccessor so they can be used safely)
   void AdaptForAccessor(DbAccessor *accessor);
 
+  // Append the events of a transaction that committed after the transaction
+  // of this TriggerContext, so a single trigger execution handles both of them
+  void Merge(TriggerContext other);
+
+  // Returns only the events in the scope, so a trigger with a scoped event
+  // sees only the objects it is interested in
+  [[nodiscard]] TriggerContext RestrictedToScope(const TriggerScope &scope) const;
+
   // Get TypedValue for the identifier defined with tag
   TypedValue GetTypedValue(TriggerIdentifierTag tag, DbAccessor *dba) const;
   bool ShouldEventTrigger(TriggerEventType) const;
@@ -242,7 +292,18 @@ class TriggerContextCollector {
     bool should_register_created_objects{false};
     bool should_register_deleted_objects{false};
     bool should_register_updated_objects{false};  // Set/removed properties (and labels for vertices)
+    TriggerScopeFilter created_objects_scopes;
+    TriggerScopeFilter deleted_objects_scopes;
+    TriggerScopeFilter updated_objects_scopes;
     std::unordered_map<storage::Gid, detail::CreatedObject<TAccessor>> created_objects;
+    // The created objects out of the scope are kept only by their Gid, so they can still be eliminated
+    // from the other events. A vertex which gets a label of the scope later in the transaction is moved
+    // to created_objects.
+    std::unordered_set<storage::Gid> created_objects_out_of_scope;
+
+    bool IsCreatedObject(const storage::Gid gid) const {
+      return created_objects.count(gid) || created_objects_out_of_scope.count(gid);
+    }
     std::vector<detail::DeletedObject<TAccessor>> deleted_objects;
     // During the transaction, a single property on a single object could be changed multiple times.
     // We want to register only the global change, at the end of the transaction. The change consists of
@@ -251,6 +312,9 @@ class TriggerContextCollector {
   };
 
   explicit TriggerContextCollector(const std::unordered_set<TriggerEventType> &event_types);
+  // The collector registers only the objects in the scopes of the events. If max_objects is not 0,
+  // at most max_objects objects and changes are registered and the rest of them are dropped.
+  explicit TriggerContextCollector(const std::vector<ScopedTriggerEvent> &events, size_t max_objects = 0);
   TriggerContextCollector(const TriggerContextCollector &) = default;
   TriggerContextCollector(TriggerContextCollector &&) = default;
   TriggerContextCollector &operator=(const TriggerContextCollector &) = default;
@@ -268,7 +332,24 @@ class TriggerContextCollector {
     if (!registry.should_register_created_objects) {
       return;
     }
-    registry.created_objects.emplace(created_object.Gid(), detail::CreatedObject{created_object});
+
+    const auto in_scope = detail::IsInScope(registry.created_objects_scopes, created_object, storage::View::NEW);
+    if constexpr (std::same_as<TAccessor, EdgeAccessor>) {
+      // The edge type never changes, so an edge out of the scope is needed only to eliminate its other events
+      if (!in_scope && !registry.should_register_updated_objects && !registry.should_register_deleted_objects) {
+        return;
+      }
+    }
+
+    if (!TryRegisterNewObject()) {
+      return;
+    }
+
+    if (in_scope) {
+      registry.created_objects.emplace(created_object.Gid(), detail::CreatedObject{created_object});
+    } else {
+      registry.created_objects_out_of_scope.insert(created_object.Gid());
+    }
   }
 
   template <detail::ObjectAccessor TAccessor>
@@ -279,7 +360,12 @@ class TriggerContextCollector {
   template <detail::ObjectAccessor TAccessor>
   void RegisterDeletedObject(const TAccessor &deleted_object) {
     auto &registry = GetRegistry<TAccessor>();
-    if (!registry.should_register_deleted_objects || registry.created_objects.count(deleted_object.Gid())) {
+    if (!registry.should_register_deleted_objects || registry.IsCreatedObject(deleted_object.Gid())) {
+      return;
+    }
+
+    if (!detail::IsInScope(registry.deleted_objects_scopes, deleted_object, storage::View::OLD) ||
+        !TryRegisterNewObject()) {
       return;
     }
 
@@ -299,7 +385,7 @@ class TriggerContextCollector {
       return;
     }
 
-    if (registry.created_objects.count(object.Gid())) {
+    if (registry.IsCreatedObject(object.Gid())) {
       return;
     }
 
@@ -308,6 +394,11 @@ class TriggerContextCollector {
       return;
     }
 
+    if (!detail::IsPropertyChangeInScope(registry.updated_objects_scopes, object, key, storage::View::NEW) ||
+        !TryRegisterNewObject()) {
+      return;
+    }
+
     registry.property_changes.emplace(std::make_pair(object, key),
                                       PropertyChangeInfo{std::move(old_value), std::move(new_value)});
   }
@@ -354,11 +445,18 @@ class TriggerContextCollector {
 
   void UpdateLabelMap(VertexAccessor vertex, storage::LabelId label_id, LabelChange change);
 
+  // Returns false if no more objects can be registered because of the max_objects limit
+  bool TryRegisterNewObject();
+
   Registry<VertexAccessor> vertex_registry_;
   Registry<EdgeAccessor> edge_registry_;
   // During the transaction, a single label on a single vertex could be added and removed multiple times.
   // We want to register only the global change, at the end of the transaction. The change consists of
   // the state of the label before the transaction start, and the latest state assigned throughout the transaction.
   LabelChangesMap label_changes_;
+
+  size_t max_objects_{0};
+  size_t registered_objects_{0};
+  bool max_objects_reached_{false};
 };
 }  // namespace memgraph::query
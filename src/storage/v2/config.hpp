@@ -14,11 +14,15 @@
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <string>
+#include <vector>
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/transaction.hpp"
 
 namespace memgraph::storage {
 
+class StringDictionary;
+
 /// Pass this class to the \ref Storage constructor to change the behavior of
 /// the storage. This class also defines the default behavior.
 struct Config {
@@ -27,12 +31,30 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    // A collection is split into steps which unlink at most this many deltas
+    // or check about as many index entries each, and release the main lock in
+    // between. 0 means no limit.
+    uint64_t max_deltas_per_step{100000};
+    // Number of threads cleaning up the indices and freeing garbage in
+    // parallel, 1 runs the collection on the GC thread only. New indices are
+    // built on the same threads.
+    uint64_t parallel_workers{1};
   } gc;
 
   struct Items {
     bool properties_on_edges{true};
+    // Dictionary of the storage, set by the storage itself. It is kept here
+    // because the items are passed to everything that reads or writes
+    // property values.
+    StringDictionary *string_dictionary{nullptr};
   } items;
 
+  struct Dictionary {
+    // String values of these properties are kept in the `StringDictionary` of
+    // the storage.
+    std::vector<std::string> properties{};
+  } dictionary;
+
   struct Durability {
     enum class SnapshotWalMode { DISABLED, PERIODIC_SNAPSHOT, PERIODIC_SNAPSHOT_WITH_WAL };
 
@@ -39,7 +39,7 @@ std::optional<size_t> FindPropertyPosition(const PropertyIdArray &property_array
 /// active.
 bool LastCommittedVersionHasLabelProperty(const Vertex &vertex, LabelId label, const std::set<PropertyId> &properties,
                                           const std::vector<PropertyValue> &value_array, const Transaction &transaction,
-                                          uint64_t commit_timestamp) {
+                                          uint64_t commit_timestamp, const StringDictionary *string_dictionary) {
   MG_ASSERT(properties.size() == value_array.size(), "Invalid database state!");
 
   PropertyIdArray property_array(properties.size());
@@ -63,7 +63,7 @@ bool LastCommittedVersionHasLabelProperty(const Vertex &vertex, LabelId label, c
 
     size_t i = 0;
     for (const auto &property : properties) {
-      current_value_equal_to_value[i] = vertex.properties.IsPropertyEqual(property, value_array[i]);
+      current_value_equal_to_value[i] = vertex.properties.IsPropertyEqual(property, value_array[i], string_dictionary);
       property_array.values[i] = property;
       i++;
     }
@@ -130,7 +130,8 @@ bool LastCommittedVersionHasLabelProperty(const Vertex &vertex, LabelId label, c
 /// there's a reachable version of the vertex that has the given label and
 /// property values.
 bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, const std::set<PropertyId> &properties,
-                                const std::vector<PropertyValue> &values, uint64_t timestamp) {
+                                const std::vector<PropertyValue> &values, uint64_t timestamp,
+                                const StringDictionary *string_dictionary) {
   MG_ASSERT(properties.size() == values.size(), "Invalid database state!");
 
   PropertyIdArray property_array(properties.size());
@@ -148,7 +149,7 @@ bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, const std::
 
     size_t i = 0;
     for (const auto &property : properties) {
-      current_value_equal_to_value[i] = vertex.properties.IsPropertyEqual(property, values[i]);
+      current_value_equal_to_value[i] = vertex.properties.IsPropertyEqual(property, values[i], string_dictionary);
       property_array.values[i] = property;
       i++;
     }
@@ -228,11 +229,12 @@ bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, const std::
 /// property values from the `vertex`.
 /// @throw std::bad_alloc
 std::optional<std::vector<PropertyValue>> ExtractPropertyValues(const Vertex &vertex,
-                                                                const std::set<PropertyId> &properties) {
+                                                                const std::set<PropertyId> &properties,
+                                                                const StringDictionary *string_dictionary) {
   std::vector<PropertyValue> value_array;
   value_array.reserve(properties.size());
   for (const auto &prop : properties) {
-    auto value = vertex.properties.GetProperty(prop);
+    auto value = vertex.properties.GetProperty(prop, string_dictionary);
     if (value.IsNull()) {
       return std::nullopt;
     }
@@ -270,7 +272,7 @@ void UniqueConstraints::UpdateBeforeCommit(const Vertex *vertex, const Transacti
     if (!utils::Contains(vertex->labels, label_props.first)) {
       continue;
     }
-    auto values = ExtractPropertyValues(*vertex, label_props.second);
+    auto values = ExtractPropertyValues(*vertex, label_props.second, string_dictionary_);
     if (values) {
       auto acc = storage.access();
       acc.insert(Entry{std::move(*values), vertex, tx.start_timestamp});
@@ -304,7 +306,7 @@ utils::BasicResult<ConstraintViolation, UniqueConstraints::CreationStatus> Uniqu
       if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
         continue;
       }
-      auto values = ExtractPropertyValues(vertex, properties);
+      auto values = ExtractPropertyValues(vertex, properties, string_dictionary_);
       if (!values) {
         continue;
       }
@@ -356,7 +358,7 @@ std::optional<ConstraintViolation> UniqueConstraints::Validate(const Vertex &ver
       continue;
     }
 
-    auto value_array = ExtractPropertyValues(vertex, properties);
+    auto value_array = ExtractPropertyValues(vertex, properties, string_dictionary_);
     if (!value_array) {
       continue;
     }
@@ -372,7 +374,8 @@ std::optional<ConstraintViolation> UniqueConstraints::Validate(const Vertex &ver
       // has the same label and property value as the last committed version of
       // the vertex from the list.
       if (&vertex != it->vertex &&
-          LastCommittedVersionHasLabelProperty(*it->vertex, label, properties, *value_array, tx, commit_timestamp)) {
+          LastCommittedVersionHasLabelProperty(*it->vertex, label, properties, *value_array, tx, commit_timestamp,
+                                               string_dictionary_)) {
         return ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, properties};
       }
     }
@@ -403,7 +406,7 @@ void UniqueConstraints::RemoveObsoleteEntries(uint64_t oldest_active_start_times
 
       if ((next_it != acc.end() && it->vertex == next_it->vertex && it->values == next_it->values) ||
           !AnyVersionHasLabelProperty(*it->vertex, label_props.first, label_props.second, it->values,
-                                      oldest_active_start_timestamp)) {
+                                      oldest_active_start_timestamp, string_dictionary_)) {
         acc.remove(*it);
       }
       it = next_it;
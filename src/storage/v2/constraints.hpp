@@ -59,6 +59,8 @@ struct ConstraintViolation {
 
 bool operator==(const ConstraintViolation &lhs, const ConstraintViolation &rhs);
 
+class StringDictionary;
+
 class UniqueConstraints {
  private:
   struct Entry {
@@ -74,6 +76,10 @@ class UniqueConstraints {
   };
 
  public:
+  /// The dictionary of the storage is used to read the property values.
+  explicit UniqueConstraints(const StringDictionary *string_dictionary = nullptr)
+      : string_dictionary_(string_dictionary) {}
+
   /// Status for creation of unique constraints.
   /// Note that this does not cover the case when the constraint is violated.
   enum class CreationStatus {
@@ -138,9 +144,12 @@ class UniqueConstraints {
 
  private:
   std::map<std::pair<LabelId, std::set<PropertyId>>, utils::SkipList<Entry>> constraints_;
+  const StringDictionary *string_dictionary_;
 };
 
 struct Constraints {
+  explicit Constraints(const StringDictionary *string_dictionary = nullptr) : unique_constraints(string_dictionary) {}
+
   std::vector<std::pair<LabelId, PropertyId>> existence_constraints;
   UniqueConstraints unique_constraints;
 };
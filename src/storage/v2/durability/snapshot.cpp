@@ -261,7 +261,7 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
               if (!value) throw RecoveryFailure("Invalid snapshot data!");
               SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for edge {}.",
                            name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
-              props.SetProperty(get_property_from_id(*key), *value);
+              props.SetProperty(get_property_from_id(*key), *value, items.string_dictionary);
             }
           }
         } else {
@@ -337,7 +337,7 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
           if (!value) throw RecoveryFailure("Invalid snapshot data!");
           SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for vertex {}.",
                        name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
-          props.SetProperty(get_property_from_id(*key), *value);
+          props.SetProperty(get_property_from_id(*key), *value, items.string_dictionary);
         }
       }
 
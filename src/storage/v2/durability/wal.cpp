@@ -506,7 +506,7 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Config::Ite
       // TODO (mferencevic): Mitigate the memory allocation introduced here
       // (with the `GetProperty` call). It is the only memory allocation in the
       // entire WAL file writing logic.
-      encoder->WritePropertyValue(vertex.properties.GetProperty(delta.property.key));
+      encoder->WritePropertyValue(vertex.properties.GetProperty(delta.property.key, items.string_dictionary));
       break;
     }
     case Delta::Action::ADD_LABEL:
@@ -537,8 +537,8 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Config::Ite
   }
 }
 
-void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta &delta, const Edge &edge,
-                 uint64_t timestamp) {
+void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Config::Items items, const Delta &delta,
+                 const Edge &edge, uint64_t timestamp) {
   // When converting a Delta to a WAL delta the logic is inverted. That is
   // because the Delta's represent undo actions and we want to store redo
   // actions.
@@ -555,7 +555,7 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta
       // TODO (mferencevic): Mitigate the memory allocation introduced here
       // (with the `GetProperty` call). It is the only memory allocation in the
       // entire WAL file writing logic.
-      encoder->WritePropertyValue(edge.properties.GetProperty(delta.property.key));
+      encoder->WritePropertyValue(edge.properties.GetProperty(delta.property.key, items.string_dictionary));
       break;
     }
     case Delta::Action::DELETE_OBJECT:
@@ -699,7 +699,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
           auto &property_value = delta.vertex_edge_set_property.value;
 
-          vertex->properties.SetProperty(property_id, property_value);
+          vertex->properties.SetProperty(property_id, property_value, items.string_dictionary);
 
           break;
         }
@@ -783,7 +783,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
           auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
           auto &property_value = delta.vertex_edge_set_property.value;
-          edge->properties.SetProperty(property_id, property_value);
+          edge->properties.SetProperty(property_id, property_value, items.string_dictionary);
           break;
         }
         case WalDeltaData::Type::TRANSACTION_END:
@@ -952,7 +952,7 @@ void WalFile::AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t tim
 }
 
 void WalFile::AppendDelta(const Delta &delta, const Edge &edge, uint64_t timestamp) {
-  EncodeDelta(&wal_, name_id_mapper_, delta, edge, timestamp);
+  EncodeDelta(&wal_, name_id_mapper_, items_, delta, edge, timestamp);
   UpdateStats(timestamp);
 }
 
@@ -11,6 +11,7 @@
 
 #include "storage/v2/edge_accessor.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <tuple>
 
@@ -110,7 +111,7 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
 
   if (edge_.ptr->deleted) return Error::DELETED_OBJECT;
 
-  auto current_value = edge_.ptr->properties.GetProperty(property);
+  auto current_value = edge_.ptr->properties.GetProperty(property, config_.string_dictionary);
   // We could skip setting the value if the previous one is the same to the new
   // one. This would save some memory as a delta would not be created as well as
   // avoid copying the value. The reason we are not doing that is because the
@@ -118,7 +119,7 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
   // "modify in-place". Additionally, the created delta will make other
   // transactions get a SERIALIZATION_ERROR.
   CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), property, current_value);
-  edge_.ptr->properties.SetProperty(property, value);
+  edge_.ptr->properties.SetProperty(property, value, config_.string_dictionary);
 
   return std::move(current_value);
 }
@@ -133,7 +134,7 @@ Result<bool> EdgeAccessor::InitProperties(const std::map<storage::PropertyId, st
 
   if (edge_.ptr->deleted) return Error::DELETED_OBJECT;
 
-  if (!edge_.ptr->properties.InitProperties(properties)) return false;
+  if (!edge_.ptr->properties.InitProperties(properties, config_.string_dictionary)) return false;
   for (const auto &[property, _] : properties) {
     CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), property, PropertyValue());
   }
@@ -150,12 +151,12 @@ Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::ClearProperties() {
 
   if (edge_.ptr->deleted) return Error::DELETED_OBJECT;
 
-  auto properties = edge_.ptr->properties.Properties();
+  auto properties = edge_.ptr->properties.Properties(config_.string_dictionary);
   for (const auto &property : properties) {
     CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), property.first, property.second);
   }
 
-  edge_.ptr->properties.ClearProperties();
+  edge_.ptr->properties.ClearProperties(config_.string_dictionary);
 
   return std::move(properties);
 }
@@ -169,7 +170,7 @@ Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view)
   {
     std::lock_guard<utils::SpinLock> guard(edge_.ptr->lock);
     deleted = edge_.ptr->deleted;
-    value = edge_.ptr->properties.GetProperty(property);
+    value = edge_.ptr->properties.GetProperty(property, config_.string_dictionary);
     delta = edge_.ptr->delta;
   }
   ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &value, property](const Delta &delta) {
@@ -202,6 +203,50 @@ Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view)
   return std::move(value);
 }
 
+Result<std::vector<PropertyValue>> EdgeAccessor::GetProperties(std::span<const PropertyId> properties,
+                                                               View view) const {
+  if (!config_.properties_on_edges) return std::vector<PropertyValue>(properties.size());
+  bool exists = true;
+  bool deleted = false;
+  std::vector<PropertyValue> values;
+  Delta *delta = nullptr;
+  {
+    std::lock_guard<utils::SpinLock> guard(edge_.ptr->lock);
+    deleted = edge_.ptr->deleted;
+    values = edge_.ptr->properties.GetProperties(properties, config_.string_dictionary);
+    delta = edge_.ptr->delta;
+  }
+  ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &values, properties](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::SET_PROPERTY: {
+        auto found = std::lower_bound(properties.begin(), properties.end(), delta.property.key);
+        if (found != properties.end() && *found == delta.property.key) {
+          values[found - properties.begin()] = delta.property.value;
+        }
+        break;
+      }
+      case Delta::Action::DELETE_OBJECT: {
+        exists = false;
+        break;
+      }
+      case Delta::Action::RECREATE_OBJECT: {
+        deleted = false;
+        break;
+      }
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+  });
+  if (!exists) return Error::NONEXISTENT_OBJECT;
+  if (!for_deleted_ && deleted) return Error::DELETED_OBJECT;
+  return std::move(values);
+}
+
 Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::Properties(View view) const {
   if (!config_.properties_on_edges) return std::map<PropertyId, PropertyValue>{};
   bool exists = true;
@@ -211,7 +256,7 @@ Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::Properties(View view)
   {
     std::lock_guard<utils::SpinLock> guard(edge_.ptr->lock);
     deleted = edge_.ptr->deleted;
-    properties = edge_.ptr->properties.Properties();
+    properties = edge_.ptr->properties.Properties(config_.string_dictionary);
     delta = edge_.ptr->delta;
   }
   ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &properties](const Delta &delta) {
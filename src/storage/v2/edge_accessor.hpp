@@ -12,6 +12,7 @@
 #pragma once
 
 #include <optional>
+#include <span>
 
 #include "storage/v2/edge.hpp"
 #include "storage/v2/edge_ref.hpp"
@@ -70,6 +71,11 @@ class EdgeAccessor final {
   /// @throw std::bad_alloc
   Result<PropertyValue> GetProperty(PropertyId property, View view) const;
 
+  /// Returns the values of all of the `properties`, which must be sorted by
+  /// their IDs, reading the properties only once.
+  /// @throw std::bad_alloc
+  Result<std::vector<PropertyValue>> GetProperties(std::span<const PropertyId> properties, View view) const;
+
   /// @throw std::bad_alloc
   Result<std::map<PropertyId, PropertyValue>> Properties(View view) const;
 
@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include "indices.hpp"
+#include <algorithm>
 #include <limits>
 
 #include "storage/v2/mvcc.hpp"
@@ -22,6 +23,82 @@ namespace memgraph::storage {
 
 namespace {
 
+/// Calls `func` with each vertex that isn't deleted and an accessor to the
+/// index that is being built. The vertices are split into one part for each
+/// worker of the pool and one for the calling thread. The index is a skip
+/// list, so the parts insert into it without any other synchronization.
+template <typename TEntry, typename TFunc>
+void IndexVerticesInParallel(utils::SkipList<Vertex>::Accessor &vertices, utils::SkipList<TEntry> *index,
+                             utils::ThreadPool *pool, const TFunc &func) {
+  const auto num_parts = pool ? pool->Size() + 1 : 1;
+  auto begins = vertices.partition(num_parts);
+  utils::ParallelFor(pool, begins.size(), [&](size_t part) {
+    // The enabler is per thread, so each worker has to set it up as well.
+    utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+    auto acc = index->access();
+    for (auto it = begins[part]; it != vertices.end(); ++it) {
+      if (it->deleted) continue;
+      func(*it, acc);
+    }
+  });
+}
+
+/// Indices with fewer entries than this per worker are cleaned up by fewer
+/// workers, so that small indices aren't spread over the whole pool.
+constexpr uint64_t kIndexCleanupMinEntriesPerPart = 10000;
+
+/// Removes the entries of `index` for which `is_obsolete` returns true. It's
+/// called with an entry and the entry after it, or nullptr for the last one.
+/// The index is partitioned between the workers of the pool and the calling
+/// thread, or cleaned up only by the calling thread without a pool.
+///
+/// The cleanup starts at the entry `begin`, or at the first entry. If
+/// `max_entries` isn't null, it stops after about that many entries, which are
+/// subtracted from it, and returns the entry to continue from. std::nullopt is
+/// returned once the end of the index is reached.
+template <typename TEntry, typename TFunc>
+std::optional<TEntry> RemoveObsoleteEntriesInParallel(utils::SkipList<TEntry> *index, utils::ThreadPool *pool,
+                                                      const std::optional<TEntry> &begin, uint64_t *max_entries,
+                                                      const TFunc &is_obsolete) {
+  auto acc = index->access();
+  std::optional<utils::Bound<TEntry>> lower;
+  if (begin) lower = utils::MakeBoundInclusive(*begin);
+  const std::optional<utils::Bound<TEntry>> upper;
+  const uint64_t remaining = begin ? acc.estimate_range_count(lower, upper) : acc.size();
+  const uint64_t step_entries = std::max<uint64_t>(max_entries ? std::min(remaining, *max_entries) : remaining, 1);
+  const uint64_t num_workers =
+      pool ? std::clamp<uint64_t>(step_entries / kIndexCleanupMinEntriesPerPart, 1, pool->Size() + 1) : 1;
+  // The remaining entries are split into ranges of about `step_entries /
+  // num_workers` entries, and the first `num_workers` ranges are cleaned up
+  // now. The entries before the range that is left for the next call are all
+  // checked, even if the estimates are off.
+  const uint64_t num_ranges =
+      max_entries ? std::max(num_workers, (remaining * num_workers + step_entries - 1) / step_entries) : num_workers;
+  auto begins = acc.partition(num_ranges, lower, upper);
+  const auto num_parts = std::min<size_t>(num_workers, begins.size());
+  utils::ParallelFor(pool, num_parts, [&](size_t part) {
+    auto part_acc = index->access();
+    // The entry after the last one of a part is the first one of the next
+    // part. If the next part removes it, it was either followed by an entry
+    // of the same vertex or no version of the vertex needs the entries, so
+    // the decision based on it is still correct. The first entry of the range
+    // left for the next call isn't removed before this one is checked.
+    const TEntry *next_part_begin =
+        part + 1 < begins.size() && begins[part + 1] != acc.end() ? &*begins[part + 1] : nullptr;
+    for (auto it = begins[part]; it != acc.end();) {
+      auto next_it = it;
+      ++next_it;
+      if (is_obsolete(*it, next_it != acc.end() ? &*next_it : next_part_begin)) {
+        part_acc.remove(*it);
+      }
+      it = next_it;
+    }
+  });
+  if (max_entries) *max_entries -= std::min(*max_entries, step_entries);
+  if (num_parts < begins.size() && begins[num_parts] != acc.end()) return *begins[num_parts];
+  return std::nullopt;
+}
+
 /// Traverses deltas visible from transaction with start timestamp greater than
 /// the provided timestamp, and calls the provided callback function for each
 /// delta. If the callback ever returns true, traversal is stopped and the
@@ -97,7 +174,7 @@ bool AnyVersionHasLabel(const Vertex &vertex, LabelId label, uint64_t timestamp)
 /// there's a reachable version of the vertex that has the given label and
 /// property value.
 bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, PropertyId key, const PropertyValue &value,
-                                uint64_t timestamp) {
+                                uint64_t timestamp, const StringDictionary *string_dictionary) {
   bool has_label;
   bool current_value_equal_to_value = value.IsNull();
   bool deleted;
@@ -105,7 +182,7 @@ bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, PropertyId
   {
     std::lock_guard<utils::SpinLock> guard(vertex.lock);
     has_label = utils::Contains(vertex.labels, label);
-    current_value_equal_to_value = vertex.properties.IsPropertyEqual(key, value);
+    current_value_equal_to_value = vertex.properties.IsPropertyEqual(key, value, string_dictionary);
     deleted = vertex.deleted;
     delta = vertex.delta;
   }
@@ -208,7 +285,7 @@ bool CurrentVersionHasLabel(const Vertex &vertex, LabelId label, Transaction *tr
 // this transaction can see the given vertex, and the visible version has the
 // given label and property.
 bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label, PropertyId key, const PropertyValue &value,
-                                    Transaction *transaction, View view) {
+                                    Transaction *transaction, View view, const StringDictionary *string_dictionary) {
   bool deleted;
   bool has_label;
   bool current_value_equal_to_value = value.IsNull();
@@ -217,7 +294,7 @@ bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label, Propert
     std::lock_guard<utils::SpinLock> guard(vertex.lock);
     deleted = vertex.deleted;
     has_label = utils::Contains(vertex.labels, label);
-    current_value_equal_to_value = vertex.properties.IsPropertyEqual(key, value);
+    current_value_equal_to_value = vertex.properties.IsPropertyEqual(key, value, string_dictionary);
     delta = vertex.delta;
   }
   ApplyDeltasForRead(transaction, delta, view,
@@ -270,7 +347,7 @@ void LabelIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transacti
   acc.insert(Entry{vertex, tx.start_timestamp});
 }
 
-bool LabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices) {
+bool LabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices, utils::ThreadPool *pool) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
   auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
   if (!emplaced) {
@@ -278,13 +355,10 @@ bool LabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor ve
     return false;
   }
   try {
-    auto acc = it->second.access();
-    for (Vertex &vertex : vertices) {
-      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
-        continue;
-      }
+    IndexVerticesInParallel(vertices, &it->second, pool, [&](Vertex &vertex, auto &acc) {
+      if (!utils::Contains(vertex.labels, label)) return;
       acc.insert(Entry{&vertex, 0});
-    }
+    });
   } catch (const utils::OutOfMemoryException &) {
     utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
     index_.erase(it);
@@ -302,26 +376,35 @@ std::vector<LabelId> LabelIndex::ListIndices() const {
   return ret;
 }
 
-void LabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
-  for (auto &label_storage : index_) {
-    auto vertices_acc = label_storage.second.access();
-    for (auto it = vertices_acc.begin(); it != vertices_acc.end();) {
-      auto next_it = it;
-      ++next_it;
-
-      if (it->timestamp >= oldest_active_start_timestamp) {
-        it = next_it;
-        continue;
-      }
-
-      if ((next_it != vertices_acc.end() && it->vertex == next_it->vertex) ||
-          !AnyVersionHasLabel(*it->vertex, label_storage.first, oldest_active_start_timestamp)) {
-        vertices_acc.remove(*it);
-      }
-
-      it = next_it;
+bool LabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, utils::ThreadPool *pool,
+                                       uint64_t *max_entries) {
+  auto it = cleanup_cursor_ && max_entries ? index_.lower_bound(cleanup_cursor_->first) : index_.begin();
+  std::optional<Entry> begin;
+  if (cleanup_cursor_ && max_entries && it != index_.end() && it->first == cleanup_cursor_->first) {
+    begin = cleanup_cursor_->second;
+  }
+  cleanup_cursor_.reset();
+  for (; it != index_.end(); ++it) {
+    auto &[label, index] = *it;
+    if (max_entries && *max_entries == 0) {
+      cleanup_cursor_.emplace(label, std::nullopt);
+      return false;
+    }
+    auto next = RemoveObsoleteEntriesInParallel(
+        &index, pool, begin, max_entries, [&, label = label](const Entry &entry, const Entry *next) {
+          if (entry.timestamp >= oldest_active_start_timestamp) {
+            return false;
+          }
+          return (next != nullptr && entry.vertex == next->vertex) ||
+                 !AnyVersionHasLabel(*entry.vertex, label, oldest_active_start_timestamp);
+        });
+    begin.reset();
+    if (next) {
+      cleanup_cursor_.emplace(label, std::move(next));
+      return false;
     }
   }
+  return true;
 }
 
 LabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
@@ -363,6 +446,33 @@ LabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
       constraints_(constraints),
       config_(config) {}
 
+std::vector<LabelIndex::Iterable> LabelIndex::PartitionVertices(LabelId label, View view, Transaction *transaction,
+                                                                uint64_t num_parts) {
+  auto it = index_.find(label);
+  MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
+  // All of the accessors are taken before the index is partitioned so that the
+  // entries at which the parts begin can't be freed while the parts are alive.
+  std::vector<Iterable> parts;
+  parts.reserve(num_parts);
+  for (uint64_t i = 0; i < num_parts; ++i) {
+    parts.emplace_back(it->second.access(), label, view, transaction, indices_, constraints_, config_);
+  }
+  auto &acc = parts.front().index_accessor_;
+  auto begins = acc.partition(num_parts);
+  while (parts.size() > begins.size()) parts.pop_back();
+  for (size_t i = 0; i < begins.size(); ++i) {
+    auto begin = begins[i];
+    // The entries of a vertex are next to each other. If they are split
+    // between two parts, the vertex is yielded by the part with the first one.
+    if (i > 0 && begin != acc.end() && acc.find_equal_or_greater(Entry{begin->vertex, 0}) != begin) {
+      auto *vertex = begin->vertex;
+      while (begin != acc.end() && begin->vertex == vertex) ++begin;
+    }
+    parts[i].begin_ = begin;
+  }
+  return parts;
+}
+
 void LabelIndex::RunGC() {
   for (auto &index_entry : index_) {
     index_entry.second.run_gc();
@@ -392,7 +502,7 @@ void LabelPropertyIndex::UpdateOnAddLabel(LabelId label, Vertex *vertex, const T
     if (label_prop.first != label) {
       continue;
     }
-    auto prop_value = vertex->properties.GetProperty(label_prop.second);
+    auto prop_value = vertex->properties.GetProperty(label_prop.second, config_.string_dictionary);
     if (!prop_value.IsNull()) {
       auto acc = storage.access();
       acc.insert(Entry{std::move(prop_value), vertex, tx.start_timestamp});
@@ -416,7 +526,8 @@ void LabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const Property
   }
 }
 
-bool LabelPropertyIndex::CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices) {
+bool LabelPropertyIndex::CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                                     utils::ThreadPool *pool) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
   auto [it, emplaced] =
       index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
@@ -425,17 +536,12 @@ bool LabelPropertyIndex::CreateIndex(LabelId label, PropertyId property, utils::
     return false;
   }
   try {
-    auto acc = it->second.access();
-    for (Vertex &vertex : vertices) {
-      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
-        continue;
-      }
-      auto value = vertex.properties.GetProperty(property);
-      if (value.IsNull()) {
-        continue;
-      }
+    IndexVerticesInParallel(vertices, &it->second, pool, [&](Vertex &vertex, auto &acc) {
+      if (!utils::Contains(vertex.labels, label)) return;
+      auto value = vertex.properties.GetProperty(property, config_.string_dictionary);
+      if (value.IsNull()) return;
       acc.insert(Entry{std::move(value), &vertex, 0});
-    }
+    });
   } catch (const utils::OutOfMemoryException &) {
     utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
     index_.erase(it);
@@ -453,26 +559,36 @@ std::vector<std::pair<LabelId, PropertyId>> LabelPropertyIndex::ListIndices() co
   return ret;
 }
 
-void LabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
-  for (auto &[label_property, index] : index_) {
-    auto index_acc = index.access();
-    for (auto it = index_acc.begin(); it != index_acc.end();) {
-      auto next_it = it;
-      ++next_it;
-
-      if (it->timestamp >= oldest_active_start_timestamp) {
-        it = next_it;
-        continue;
-      }
-
-      if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->value == next_it->value) ||
-          !AnyVersionHasLabelProperty(*it->vertex, label_property.first, label_property.second, it->value,
-                                      oldest_active_start_timestamp)) {
-        index_acc.remove(*it);
-      }
-      it = next_it;
+bool LabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, utils::ThreadPool *pool,
+                                               uint64_t *max_entries) {
+  auto it = cleanup_cursor_ && max_entries ? index_.lower_bound(cleanup_cursor_->first) : index_.begin();
+  std::optional<Entry> begin;
+  if (cleanup_cursor_ && max_entries && it != index_.end() && it->first == cleanup_cursor_->first) {
+    begin = cleanup_cursor_->second;
+  }
+  cleanup_cursor_.reset();
+  for (; it != index_.end(); ++it) {
+    auto &[label_property, index] = *it;
+    if (max_entries && *max_entries == 0) {
+      cleanup_cursor_.emplace(label_property, std::nullopt);
+      return false;
+    }
+    auto next = RemoveObsoleteEntriesInParallel(
+        &index, pool, begin, max_entries, [&, label_property = label_property](const Entry &entry, const Entry *next) {
+          if (entry.timestamp >= oldest_active_start_timestamp) {
+            return false;
+          }
+          return (next != nullptr && entry.vertex == next->vertex && entry.value == next->value) ||
+                 !AnyVersionHasLabelProperty(*entry.vertex, label_property.first, label_property.second,
+                                             entry.value, oldest_active_start_timestamp, config_.string_dictionary);
+        });
+    begin.reset();
+    if (next) {
+      cleanup_cursor_.emplace(label_property, std::move(next));
+      return false;
     }
   }
+  return true;
 }
 
 LabelPropertyIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
@@ -515,7 +631,8 @@ void LabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
     }
 
     if (CurrentVersionHasLabelProperty(*index_iterator_->vertex, self_->label_, self_->property_,
-                                       index_iterator_->value, self_->transaction_, self_->view_)) {
+                                       index_iterator_->value, self_->transaction_, self_->view_,
+                                       self_->config_.string_dictionary)) {
       current_vertex_ = index_iterator_->vertex;
       current_vertex_accessor_ =
           VertexAccessor(current_vertex_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_);
@@ -650,6 +767,7 @@ LabelPropertyIndex::Iterable::Iterator LabelPropertyIndex::Iterable::begin() {
   // If the bounds are set and don't have comparable types we don't yield any
   // items from the index.
   if (!bounds_valid_) return Iterator(this, index_accessor_.end());
+  if (begin_) return Iterator(this, *begin_);
   auto index_iterator = index_accessor_.begin();
   if (lower_bound_) {
     index_iterator = index_accessor_.find_equal_or_greater(lower_bound_->value());
@@ -661,6 +779,42 @@ LabelPropertyIndex::Iterable::Iterator LabelPropertyIndex::Iterable::end() {
   return Iterator(this, index_accessor_.end());
 }
 
+std::vector<LabelPropertyIndex::Iterable> LabelPropertyIndex::PartitionVertices(
+    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+    uint64_t num_parts) {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+  // All of the accessors are taken before the index is partitioned so that the
+  // entries at which the parts begin can't be freed while the parts are alive.
+  std::vector<Iterable> parts;
+  parts.reserve(num_parts);
+  for (uint64_t i = 0; i < num_parts; ++i) {
+    parts.emplace_back(it->second.access(), label, property, lower_bound, upper_bound, view, transaction, indices_,
+                       constraints_, config_);
+  }
+  // The bounds are taken from the iterable because it fixes them. If they
+  // aren't valid, no vertices are yielded and there is nothing to partition.
+  auto &first = parts.front();
+  auto &acc = first.index_accessor_;
+  auto begins = first.bounds_valid_ ? acc.partition(num_parts, first.lower_bound_, first.upper_bound_)
+                                    : std::vector<utils::SkipList<Entry>::Iterator>{acc.end()};
+  while (parts.size() > begins.size()) parts.pop_back();
+  for (size_t i = 0; i < begins.size(); ++i) {
+    auto begin = begins[i];
+    // The entries of a vertex with the same value are next to each other. If
+    // they are split between two parts, the vertex is yielded by the part with
+    // the first one.
+    if (i > 0 && begin != acc.end() && acc.find_equal_or_greater(Entry{begin->value, begin->vertex, 0}) != begin) {
+      const auto value = begin->value;
+      auto *vertex = begin->vertex;
+      while (begin != acc.end() && begin->vertex == vertex && begin->value == value) ++begin;
+    }
+    parts[i].begin_ = begin;
+  }
+  return parts;
+}
+
 int64_t LabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property,
                                                    const PropertyValue &value) const {
   auto it = index_.find({label, property});
@@ -697,16 +851,19 @@ void LabelPropertyIndex::RunGC() {
 void RemoveObsoleteEntries(Indices *indices, uint64_t oldest_active_start_timestamp) {
   indices->label_index.RemoveObsoleteEntries(oldest_active_start_timestamp);
   indices->label_property_index.RemoveObsoleteEntries(oldest_active_start_timestamp);
+  indices->property_columns.RemoveObsoleteEntries();
 }
 
 void UpdateOnAddLabel(Indices *indices, LabelId label, Vertex *vertex, const Transaction &tx) {
   indices->label_index.UpdateOnAddLabel(label, vertex, tx);
   indices->label_property_index.UpdateOnAddLabel(label, vertex, tx);
+  indices->property_columns.UpdateOnAddLabel(label, vertex);
 }
 
 void UpdateOnSetProperty(Indices *indices, PropertyId property, const PropertyValue &value, Vertex *vertex,
                          const Transaction &tx) {
   indices->label_property_index.UpdateOnSetProperty(property, value, vertex, tx);
+  indices->property_columns.UpdateOnSetProperty(property, value, vertex);
 }
 
 }  // namespace memgraph::storage
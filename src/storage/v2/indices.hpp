@@ -14,14 +14,17 @@
 #include <optional>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "storage/v2/config.hpp"
+#include "storage/v2/property_column.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/bound.hpp"
 #include "utils/logging.hpp"
 #include "utils/skip_list.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::storage {
 
@@ -57,8 +60,10 @@ class LabelIndex {
   /// @throw std::bad_alloc
   void UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx);
 
+  /// The vertices are partitioned and indexed by the workers of the pool and
+  /// the calling thread, or only by the calling thread without a pool.
   /// @throw std::bad_alloc
-  bool CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices);
+  bool CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices, utils::ThreadPool *pool = nullptr);
 
   /// Returns false if there was no index to drop
   bool DropIndex(LabelId label) { return index_.erase(label) > 0; }
@@ -67,7 +72,15 @@ class LabelIndex {
 
   std::vector<LabelId> ListIndices() const;
 
-  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+  /// Each index is partitioned and cleaned up by the workers of the pool and
+  /// the calling thread, or only by the calling thread without a pool.
+  ///
+  /// If `max_entries` isn't null, the cleanup stops after about that many
+  /// entries, which are subtracted from it, and the next call with a limit
+  /// continues where it stopped. Returns true once the cleanup reaches the
+  /// end of the last index. A call without a limit cleans up all indices.
+  bool RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, utils::ThreadPool *pool = nullptr,
+                             uint64_t *max_entries = nullptr);
 
   class Iterable {
    public:
@@ -94,11 +107,16 @@ class LabelIndex {
       Vertex *current_vertex_;
     };
 
-    Iterator begin() { return Iterator(this, index_accessor_.begin()); }
+    Iterator begin() { return Iterator(this, begin_ ? *begin_ : index_accessor_.begin()); }
     Iterator end() { return Iterator(this, index_accessor_.end()); }
 
    private:
+    friend class LabelIndex;
+
     utils::SkipList<Entry>::Accessor index_accessor_;
+    // Set when the iterable is a part of the index returned by
+    // `PartitionVertices`.
+    std::optional<utils::SkipList<Entry>::Iterator> begin_;
     LabelId label_;
     View view_;
     Transaction *transaction_;
@@ -114,6 +132,12 @@ class LabelIndex {
     return Iterable(it->second.access(), label, view, transaction, indices_, constraints_, config_);
   }
 
+  /// Returns at most `num_parts` iterables over the vertices visible from the
+  /// given transaction, split into consecutive parts of about the same size.
+  /// The parts can be iterated concurrently and together yield the same
+  /// vertices as `Vertices`.
+  std::vector<Iterable> PartitionVertices(LabelId label, View view, Transaction *transaction, uint64_t num_parts);
+
   int64_t ApproximateVertexCount(LabelId label) {
     auto it = index_.find(label);
     MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
@@ -126,6 +150,9 @@ class LabelIndex {
 
  private:
   std::map<LabelId, utils::SkipList<Entry>> index_;
+  // Index and entry where a cleanup that is done in several calls continues,
+  // or std::nullopt for the first entry of the index.
+  std::optional<std::pair<LabelId, std::optional<Entry>>> cleanup_cursor_;
   Indices *indices_;
   Constraints *constraints_;
   Config::Items config_;
@@ -155,8 +182,11 @@ class LabelPropertyIndex {
   /// @throw std::bad_alloc
   void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex, const Transaction &tx);
 
+  /// The vertices are indexed in parallel the same way as in
+  /// `LabelIndex::CreateIndex`.
   /// @throw std::bad_alloc
-  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                   utils::ThreadPool *pool = nullptr);
 
   bool DropIndex(LabelId label, PropertyId property) { return index_.erase({label, property}) > 0; }
 
@@ -164,7 +194,15 @@ class LabelPropertyIndex {
 
   std::vector<std::pair<LabelId, PropertyId>> ListIndices() const;
 
-  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+  /// Each index is partitioned and cleaned up by the workers of the pool and
+  /// the calling thread, or only by the calling thread without a pool.
+  ///
+  /// If `max_entries` isn't null, the cleanup stops after about that many
+  /// entries, which are subtracted from it, and the next call with a limit
+  /// continues where it stopped. Returns true once the cleanup reaches the
+  /// end of the last index. A call without a limit cleans up all indices.
+  bool RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, utils::ThreadPool *pool = nullptr,
+                             uint64_t *max_entries = nullptr);
 
   class Iterable {
    public:
@@ -197,7 +235,12 @@ class LabelPropertyIndex {
     Iterator end();
 
    private:
+    friend class LabelPropertyIndex;
+
     utils::SkipList<Entry>::Accessor index_accessor_;
+    // Set when the iterable is a part of the index returned by
+    // `PartitionVertices`.
+    std::optional<utils::SkipList<Entry>::Iterator> begin_;
     LabelId label_;
     PropertyId property_;
     std::optional<utils::Bound<PropertyValue>> lower_bound_;
@@ -220,6 +263,15 @@ class LabelPropertyIndex {
                     constraints_, config_);
   }
 
+  /// Returns at most `num_parts` iterables over the vertices visible from the
+  /// given transaction, split into consecutive parts of about the same size.
+  /// The parts can be iterated concurrently and together yield the same
+  /// vertices as `Vertices`.
+  std::vector<Iterable> PartitionVertices(LabelId label, PropertyId property,
+                                          const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                          const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                                          Transaction *transaction, uint64_t num_parts);
+
   int64_t ApproximateVertexCount(LabelId label, PropertyId property) const {
     auto it = index_.find({label, property});
     MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(),
@@ -243,6 +295,8 @@ class LabelPropertyIndex {
 
  private:
   std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
+  // See `LabelIndex::cleanup_cursor_`.
+  std::optional<std::pair<std::pair<LabelId, PropertyId>, std::optional<Entry>>> cleanup_cursor_;
   Indices *indices_;
   Constraints *constraints_;
   Config::Items config_;
@@ -250,7 +304,9 @@ class LabelPropertyIndex {
 
 struct Indices {
   Indices(Constraints *constraints, Config::Items config)
-      : label_index(this, constraints, config), label_property_index(this, constraints, config) {}
+      : label_index(this, constraints, config),
+        label_property_index(this, constraints, config),
+        property_columns(config.string_dictionary) {}
 
   // Disable copy and move because members hold pointer to `this`.
   Indices(const Indices &) = delete;
@@ -261,6 +317,7 @@ struct Indices {
 
   LabelIndex label_index;
   LabelPropertyIndex label_property_index;
+  PropertyColumns property_columns;
 };
 
 /// This function should be called from garbage collection to clean-up the
@@ -0,0 +1,358 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/property_column.hpp"
+
+#include <bit>
+
+#include "storage/v2/mvcc.hpp"
+#include "utils/algorithm.hpp"
+#include "utils/logging.hpp"
+#include "utils/memory_tracker.hpp"
+
+namespace memgraph::storage {
+
+PropertyColumn::PropertyColumn(LabelId label, PropertyId property)
+    : label_(label), property_(property), chunks_(std::make_unique<std::atomic<Chunk *>[]>(kMaxChunks)) {}
+
+PropertyColumn::~PropertyColumn() {
+  for (uint64_t i = 0; i < kMaxChunks; ++i) delete chunks_[i].load(std::memory_order_relaxed);
+}
+
+uint64_t PropertyColumn::AllocateSlot() {
+  std::lock_guard<std::mutex> guard(slots_lock_);
+  if (!free_slots_.empty()) {
+    auto slot = free_slots_.back();
+    free_slots_.pop_back();
+    return slot;
+  }
+  auto slot = slot_count_.load(std::memory_order_relaxed);
+  auto chunk = slot / kChunkSize;
+  MG_ASSERT(chunk < kMaxChunks, "Property column of label {} and property {} is full!", label_.AsUint(),
+            property_.AsUint());
+  if (slot % kChunkSize == 0) chunks_[chunk].store(new Chunk(), std::memory_order_release);
+  // Readers scan the slots up to `slot_count_`, so the chunk has to be
+  // published before it.
+  slot_count_.store(slot + 1, std::memory_order_release);
+  return slot;
+}
+
+void PropertyColumn::MarkPending(uint64_t slot) {
+  auto &state = chunks_[slot / kChunkSize].load(std::memory_order_acquire)->states[slot % kChunkSize];
+  state.store((state.load(std::memory_order_relaxed) + kWrite) | kPending, std::memory_order_relaxed);
+  // Readers of the committed slot have to see the new state if they see any
+  // of the values stored after it.
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void PropertyColumn::Store(uint64_t slot, const PropertyValue &value) {
+  auto *chunk = chunks_[slot / kChunkSize].load(std::memory_order_acquire);
+  auto pos = slot % kChunkSize;
+  switch (value.type()) {
+    case PropertyValue::Type::Null:
+      chunk->types[pos].store(Type::NONE, std::memory_order_relaxed);
+      break;
+    case PropertyValue::Type::Int:
+      chunk->types[pos].store(Type::INT, std::memory_order_relaxed);
+      chunk->values[pos].store(static_cast<uint64_t>(value.ValueInt()), std::memory_order_relaxed);
+      break;
+    case PropertyValue::Type::Double:
+      chunk->types[pos].store(Type::DOUBLE, std::memory_order_relaxed);
+      chunk->values[pos].store(std::bit_cast<uint64_t>(value.ValueDouble()), std::memory_order_relaxed);
+      break;
+    case PropertyValue::Type::Bool:
+    case PropertyValue::Type::String:
+    case PropertyValue::Type::List:
+    case PropertyValue::Type::Map:
+    case PropertyValue::Type::TemporalData:
+      chunk->types[pos].store(Type::OTHER, std::memory_order_relaxed);
+      break;
+  }
+}
+
+void PropertyColumn::Insert(Vertex *vertex, const PropertyValue &value, bool pending) {
+  auto acc = slots_.access();
+  auto slot = AllocateSlot();
+  auto *chunk = chunks_[slot / kChunkSize].load(std::memory_order_acquire);
+  MarkPending(slot);
+  Store(slot, value);
+  chunk->vertices[slot % kChunkSize].store(vertex, std::memory_order_release);
+  if (!pending) {
+    auto &state = chunk->states[slot % kChunkSize];
+    state.store(state.load(std::memory_order_relaxed) & ~kPending, std::memory_order_release);
+  }
+  acc.insert(Entry{vertex, slot});
+}
+
+void PropertyColumn::UpdateOnAddLabel(Vertex *vertex, const StringDictionary *string_dictionary) {
+  if (slots_.access().contains(vertex)) return;
+  Insert(vertex, vertex->properties.GetProperty(property_, string_dictionary), true);
+}
+
+void PropertyColumn::AddVertex(Vertex *vertex, const StringDictionary *string_dictionary) {
+  if (slots_.access().contains(vertex)) return;
+  // Without deltas the vertex is the same for every transaction.
+  Insert(vertex, vertex->properties.GetProperty(property_, string_dictionary), vertex->delta != nullptr);
+}
+
+void PropertyColumn::UpdateOnSetProperty(Vertex *vertex, const PropertyValue &value) {
+  auto acc = slots_.access();
+  auto it = acc.find(vertex);
+  if (it != acc.end()) {
+    // The vertex may have lost the label, but older versions of it can still
+    // have it, so the slot has to follow the property store.
+    MarkPending(it->slot);
+    Store(it->slot, value);
+    return;
+  }
+  if (!utils::Contains(vertex->labels, label_)) return;
+  Insert(vertex, value, true);
+}
+
+void PropertyColumn::UpdateOnRemoveVertex(Vertex *vertex) {
+  auto acc = slots_.access();
+  auto it = acc.find(vertex);
+  if (it != acc.end()) MarkPending(it->slot);
+}
+
+void PropertyColumn::RemoveObsoleteEntries() {
+  auto acc = slots_.access();
+  for (auto it = acc.begin(); it != acc.end();) {
+    auto next_it = it;
+    ++next_it;
+
+    Vertex *vertex = it->vertex;
+    auto slot = it->slot;
+    auto *chunk = chunks_[slot / kChunkSize].load(std::memory_order_acquire);
+    auto &state = chunk->states[slot % kChunkSize];
+    std::lock_guard<utils::SpinLock> guard(vertex->lock);
+    // Without deltas every transaction sees the current version of the
+    // vertex, so the slot is no longer needed if that one doesn't have the
+    // label. The slot is freed while holding the lock of the vertex so that
+    // writers never see the vertex without its slot in between. Otherwise the
+    // slot holds the only version of the vertex and is committed.
+    if (vertex->delta == nullptr && (vertex->deleted || !utils::Contains(vertex->labels, label_))) {
+      chunk->vertices[slot % kChunkSize].store(nullptr, std::memory_order_release);
+      chunk->types[slot % kChunkSize].store(Type::NONE, std::memory_order_relaxed);
+      acc.remove(*it);
+      std::lock_guard<std::mutex> slots_guard(slots_lock_);
+      free_slots_.push_back(slot);
+    } else if (vertex->delta == nullptr) {
+      if (const auto current = state.load(std::memory_order_relaxed); current & kPending) {
+        state.store(current & ~kPending, std::memory_order_release);
+      }
+    }
+
+    it = next_it;
+  }
+}
+
+std::optional<std::pair<PropertyColumn::Type, uint64_t>> PropertyColumn::ReadPending(const Chunk &chunk,
+                                                                                      uint64_t pos,
+                                                                                      Transaction *transaction,
+                                                                                      View view) const {
+  Vertex *vertex = chunk.vertices[pos].load(std::memory_order_acquire);
+  if (vertex == nullptr) return std::nullopt;
+
+  bool exists = true;
+  bool deleted = false;
+  bool has_label = false;
+  Type type = Type::NONE;
+  uint64_t value = 0;
+  Delta *delta = nullptr;
+  {
+    std::lock_guard<utils::SpinLock> guard(vertex->lock);
+    // The slot could have been freed and given to another vertex before the
+    // lock was taken.
+    if (chunk.vertices[pos].load(std::memory_order_relaxed) != vertex) return std::nullopt;
+    deleted = vertex->deleted;
+    has_label = utils::Contains(vertex->labels, label_);
+    type = chunk.types[pos].load(std::memory_order_relaxed);
+    value = chunk.values[pos].load(std::memory_order_relaxed);
+    delta = vertex->delta;
+  }
+  if (delta != nullptr) {
+    ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
+      switch (delta.action) {
+        case Delta::Action::REMOVE_LABEL: {
+          if (delta.label == label_) has_label = false;
+          break;
+        }
+        case Delta::Action::ADD_LABEL: {
+          if (delta.label == label_) has_label = true;
+          break;
+        }
+        case Delta::Action::SET_PROPERTY: {
+          if (delta.property.key != property_) break;
+          const auto &old_value = delta.property.value;
+          if (old_value.IsNull()) {
+            type = Type::NONE;
+          } else if (old_value.IsInt()) {
+            type = Type::INT;
+            value = static_cast<uint64_t>(old_value.ValueInt());
+          } else if (old_value.IsDouble()) {
+            type = Type::DOUBLE;
+            value = std::bit_cast<uint64_t>(old_value.ValueDouble());
+          } else {
+            type = Type::OTHER;
+          }
+          break;
+        }
+        case Delta::Action::DELETE_OBJECT: {
+          exists = false;
+          break;
+        }
+        case Delta::Action::RECREATE_OBJECT: {
+          deleted = false;
+          break;
+        }
+        case Delta::Action::ADD_IN_EDGE:
+        case Delta::Action::ADD_OUT_EDGE:
+        case Delta::Action::REMOVE_IN_EDGE:
+        case Delta::Action::REMOVE_OUT_EDGE:
+          break;
+      }
+    });
+  }
+  if (!exists || deleted || !has_label) return std::nullopt;
+  return std::make_pair(type, value);
+}
+
+std::optional<PropertyColumnSummary> PropertyColumn::Summarize(Transaction *transaction, View view) const {
+  PropertyColumnSummary summary;
+  // Returns false if the value can't be summarized.
+  const auto add = [&summary](const Type type, const uint64_t value) {
+    ++summary.vertex_count;
+    switch (type) {
+      case Type::NONE:
+        break;
+      case Type::INT: {
+        auto int_value = static_cast<int64_t>(value);
+        if (__builtin_add_overflow(summary.int_sum, int_value, &summary.int_sum)) return false;
+        ++summary.int_count;
+        if (!summary.int_min || int_value < *summary.int_min) summary.int_min = int_value;
+        if (!summary.int_max || int_value > *summary.int_max) summary.int_max = int_value;
+        break;
+      }
+      case Type::DOUBLE: {
+        auto double_value = std::bit_cast<double>(value);
+        summary.double_sum += double_value;
+        ++summary.double_count;
+        if (!summary.double_min || double_value < *summary.double_min) summary.double_min = double_value;
+        if (!summary.double_max || double_value > *summary.double_max) summary.double_max = double_value;
+        break;
+      }
+      case Type::OTHER:
+        return false;
+    }
+    return true;
+  };
+
+  const auto slot_count = slot_count_.load(std::memory_order_acquire);
+  for (uint64_t chunk_begin = 0; chunk_begin < slot_count; chunk_begin += kChunkSize) {
+    const auto *chunk = chunks_[chunk_begin / kChunkSize].load(std::memory_order_acquire);
+    const auto chunk_size = std::min(kChunkSize, slot_count - chunk_begin);
+    for (uint64_t pos = 0; pos < chunk_size; ++pos) {
+      // A committed slot is read without the lock of its vertex, and is read
+      // again the slow way if it was written meanwhile.
+      const auto state = chunk->states[pos].load(std::memory_order_acquire);
+      if (!(state & kPending)) {
+        const auto type = chunk->types[pos].load(std::memory_order_relaxed);
+        const auto value = chunk->values[pos].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (chunk->states[pos].load(std::memory_order_relaxed) == state) {
+          if (!add(type, value)) return std::nullopt;
+          continue;
+        }
+      }
+      const auto version = ReadPending(*chunk, pos, transaction, view);
+      if (version && !add(version->first, version->second)) return std::nullopt;
+    }
+  }
+  summary.value_count = summary.int_count + summary.double_count;
+  return summary;
+}
+
+void PropertyColumns::UpdateOnAddLabel(LabelId label, Vertex *vertex) {
+  for (auto &[key, column] : columns_) {
+    if (key.first == label) column->UpdateOnAddLabel(vertex, string_dictionary_);
+  }
+}
+
+void PropertyColumns::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex) {
+  for (auto &[key, column] : columns_) {
+    if (key.second == property) column->UpdateOnSetProperty(vertex, value);
+  }
+}
+
+void PropertyColumns::UpdateOnRemoveLabel(LabelId label, Vertex *vertex) {
+  for (auto &[key, column] : columns_) {
+    if (key.first == label) column->UpdateOnRemoveVertex(vertex);
+  }
+}
+
+void PropertyColumns::UpdateOnDeleteVertex(Vertex *vertex) {
+  for (auto &[key, column] : columns_) {
+    if (utils::Contains(vertex->labels, key.first)) column->UpdateOnRemoveVertex(vertex);
+  }
+}
+
+bool PropertyColumns::CreateColumn(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices) {
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  auto [it, emplaced] = columns_.try_emplace({label, property});
+  if (!emplaced) return false;
+  try {
+    it->second = std::make_unique<PropertyColumn>(label, property);
+    for (Vertex &vertex : vertices) {
+      if (vertex.deleted || !utils::Contains(vertex.labels, label)) continue;
+      it->second->AddVertex(&vertex, string_dictionary_);
+    }
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    columns_.erase(it);
+    throw;
+  }
+  return true;
+}
+
+std::vector<std::pair<LabelId, PropertyId>> PropertyColumns::ListColumns() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  ret.reserve(columns_.size());
+  for (const auto &item : columns_) ret.push_back(item.first);
+  return ret;
+}
+
+void PropertyColumns::RemoveObsoleteEntries() {
+  for (auto &[key, column] : columns_) column->RemoveObsoleteEntries();
+}
+
+std::optional<PropertyColumnSummary> PropertyColumns::Summarize(LabelId label, PropertyId property,
+                                                                Transaction *transaction, View view) const {
+  auto it = columns_.find({label, property});
+  if (it == columns_.end()) return std::nullopt;
+  return it->second->Summarize(transaction, view);
+}
+
+void PropertyColumns::Clear() {
+  for (auto &[key, column] : columns_) column = std::make_unique<PropertyColumn>(key.first, key.second);
+}
+
+void PropertyColumns::RebuildColumns(utils::SkipList<Vertex>::Accessor vertices) {
+  Clear();
+  for (Vertex &vertex : vertices) {
+    if (vertex.deleted) continue;
+    for (auto &[key, column] : columns_) {
+      if (utils::Contains(vertex.labels, key.first)) column->AddVertex(&vertex, string_dictionary_);
+    }
+  }
+}
+
+}  // namespace memgraph::storage
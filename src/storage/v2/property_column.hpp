@@ -0,0 +1,222 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+/// Aggregates of the values in a property column which are visible to a
+/// transaction.
+struct PropertyColumnSummary {
+  /// Number of visible vertices with the label.
+  int64_t vertex_count{0};
+  /// Number of those vertices which have the property set.
+  int64_t value_count{0};
+
+  int64_t int_count{0};
+  int64_t int_sum{0};
+  std::optional<int64_t> int_min;
+  std::optional<int64_t> int_max;
+
+  int64_t double_count{0};
+  double double_sum{0.0};
+  std::optional<double> double_min;
+  std::optional<double> double_max;
+};
+
+/// Values of one property of all vertices with one label, kept in dense
+/// arrays next to the property stores of the vertices. Each vertex which has
+/// (or had) the label is assigned a slot, and the slot holds the current
+/// value of the property, the same one that is in the vertex's property
+/// store. Older versions are reconstructed from the SET_PROPERTY deltas of
+/// the vertex, so reading the column is as MVCC-correct as reading the
+/// property store.
+///
+/// The value of a slot is only written while holding the lock of the vertex
+/// which owns the slot. A write of the property, or a removal of the label or
+/// a deletion of the vertex, marks the slot as pending. The garbage collector
+/// clears the mark once the vertex has no deltas left, after which the slot
+/// holds the only version of a vertex with the label, the same for every
+/// transaction. Readers read such committed slots without taking the lock of
+/// the vertex, and only lock the vertices of pending slots to replay their
+/// deltas. Only integers and doubles are stored in the column, slots of other
+/// values are marked so that readers can fall back to the property store.
+class PropertyColumn {
+ public:
+  PropertyColumn(LabelId label, PropertyId property);
+
+  PropertyColumn(const PropertyColumn &) = delete;
+  PropertyColumn(PropertyColumn &&) = delete;
+  PropertyColumn &operator=(const PropertyColumn &) = delete;
+  PropertyColumn &operator=(PropertyColumn &&) = delete;
+  ~PropertyColumn();
+
+  LabelId label() const { return label_; }
+  PropertyId property() const { return property_; }
+
+  /// Must be called while holding the lock of the vertex.
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(Vertex *vertex, const StringDictionary *string_dictionary);
+
+  /// Must be called while holding the lock of the vertex.
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(Vertex *vertex, const PropertyValue &value);
+
+  /// Must be called while holding the lock of the vertex, when the vertex
+  /// loses the label or is deleted.
+  void UpdateOnRemoveVertex(Vertex *vertex);
+
+  /// Adds a vertex with the label while the storage is accessed exclusively.
+  /// @throw std::bad_alloc
+  void AddVertex(Vertex *vertex, const StringDictionary *string_dictionary);
+
+  /// Frees the slots of vertices which no longer have the label, or are
+  /// deleted, in every version that can still be seen.
+  void RemoveObsoleteEntries();
+
+  /// Aggregates the numeric values visible from the transaction. Returns
+  /// std::nullopt if some visible value isn't numeric or the sum of the
+  /// integers overflows.
+  std::optional<PropertyColumnSummary> Summarize(Transaction *transaction, View view) const;
+
+  /// Number of vertices which have a slot in the column.
+  uint64_t size() const { return slots_.size(); }
+
+ private:
+  enum class Type : uint8_t { NONE, INT, DOUBLE, OTHER };
+
+  static constexpr uint64_t kChunkSize = 1U << 16U;
+  static constexpr uint64_t kMaxChunks = 1U << 15U;
+
+  // The lowest bit of the state of a slot marks it as pending, the rest count
+  // the writes of the slot, so that readers which read a committed slot
+  // without the lock of the vertex can tell whether it changed meanwhile.
+  static constexpr uint32_t kPending = 1U;
+  static constexpr uint32_t kWrite = 2U;
+
+  struct Chunk {
+    Chunk() {
+      // Slots are pending until the garbage collector finds their vertices
+      // without deltas.
+      for (auto &state : states) state.store(kPending, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<Vertex *>, kChunkSize> vertices{};
+    std::array<std::atomic<uint32_t>, kChunkSize> states;
+    std::array<std::atomic<Type>, kChunkSize> types{};
+    std::array<std::atomic<uint64_t>, kChunkSize> values{};
+  };
+
+  struct Entry {
+    Vertex *vertex;
+    uint64_t slot;
+
+    bool operator<(const Entry &rhs) const { return vertex < rhs.vertex; }
+    bool operator==(const Entry &rhs) const { return vertex == rhs.vertex; }
+    bool operator<(const Vertex *rhs) const { return vertex < rhs; }
+    bool operator==(const Vertex *rhs) const { return vertex == rhs; }
+  };
+
+  uint64_t AllocateSlot();
+  void Insert(Vertex *vertex, const PropertyValue &value, bool pending);
+  void MarkPending(uint64_t slot);
+  void Store(uint64_t slot, const PropertyValue &value);
+
+  /// Returns the type and value of the slot in the version of the vertex
+  /// visible to the transaction, or std::nullopt if that version doesn't have
+  /// the label.
+  std::optional<std::pair<Type, uint64_t>> ReadPending(const Chunk &chunk, uint64_t pos, Transaction *transaction,
+                                                       View view) const;
+
+  LabelId label_;
+  PropertyId property_;
+
+  // Slots of the vertices, used by writers to find the slot of a vertex.
+  utils::SkipList<Entry> slots_;
+
+  // Chunks are never moved or freed while the column exists, so readers can
+  // access them without taking `slots_lock_`.
+  std::unique_ptr<std::atomic<Chunk *>[]> chunks_;
+  std::atomic<uint64_t> slot_count_{0};
+
+  std::mutex slots_lock_;
+  std::vector<uint64_t> free_slots_;
+};
+
+/// All property columns of the storage. Columns are created and dropped only
+/// while the storage is accessed exclusively, the same as indices.
+class PropertyColumns {
+ public:
+  /// The dictionary of the storage is used to read the property values.
+  explicit PropertyColumns(const StringDictionary *string_dictionary = nullptr)
+      : string_dictionary_(string_dictionary) {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId label, Vertex *vertex);
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex);
+
+  /// Must be called while holding the lock of the vertex.
+  void UpdateOnRemoveLabel(LabelId label, Vertex *vertex);
+
+  /// Must be called while holding the lock of the vertex.
+  void UpdateOnDeleteVertex(Vertex *vertex);
+
+  /// Returns false if the column already exists.
+  /// @throw std::bad_alloc
+  bool CreateColumn(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+
+  /// Returns false if there was no column to drop.
+  bool DropColumn(LabelId label, PropertyId property) { return columns_.erase({label, property}) > 0; }
+
+  bool ColumnExists(LabelId label, PropertyId property) const {
+    return columns_.find({label, property}) != columns_.end();
+  }
+
+  std::vector<std::pair<LabelId, PropertyId>> ListColumns() const;
+
+  void RemoveObsoleteEntries();
+
+  /// Returns std::nullopt if there is no such column or its values can't be
+  /// summarized, see PropertyColumn::Summarize.
+  std::optional<PropertyColumnSummary> Summarize(LabelId label, PropertyId property, Transaction *transaction,
+                                                 View view) const;
+
+  /// Drops the slots of all columns. Columns stay declared and are filled
+  /// again with RebuildColumns.
+  void Clear();
+
+  /// @throw std::bad_alloc
+  void RebuildColumns(utils::SkipList<Vertex>::Accessor vertices);
+
+ private:
+  std::map<std::pair<LabelId, PropertyId>, std::unique_ptr<PropertyColumn>> columns_;
+  const StringDictionary *string_dictionary_;
+};
+
+}  // namespace memgraph::storage
@@ -11,13 +11,17 @@
 
 #include "storage/v2/property_store.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <limits>
 #include <optional>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
 #include "utils/logging.hpp"
@@ -82,6 +86,12 @@ namespace {
 // each and every ID to value mapping. That is why every possible bit is used
 // to store some useful information. Increasing the size of the metadata field
 // will increase memory usage for every stored ID to value mapping.
+//
+// Stores with many properties (see `kDirectoryMinProperties`) prefix the
+// encoded mappings with a directory of the sorted property IDs and the offsets
+// of their mappings. Lookups then binary search the directory and decode only
+// the mapping they need, which makes them O(log(n)) instead of O(n). The
+// directory is described in detail next to the `Directory` class below.
 
 enum class Size : uint8_t {
   INT8 = 0x00,
@@ -102,7 +112,8 @@ enum class Type : uint8_t {
   STRING = 0x50,
   LIST = 0x60,
   MAP = 0x70,
-  TEMPORAL_DATA = 0x80
+  TEMPORAL_DATA = 0x80,
+  STRING_ID = 0x90,
 };
 
 const uint8_t kMaskType = 0xf0;
@@ -164,6 +175,13 @@ const uint8_t kShiftIdSize = 2;
 //         or `uint64_t`
 //       + encoded temporal data type value
 //       + encoded microseconds value
+//   * STRING_ID
+//     - type; payload size is used to indicate whether the id is encoded as
+//       `uint8_t`, `uint16_t`, `uint32_t` or `uint64_t`
+//     - encoded property ID
+//     - encoded id of the string in the `StringDictionary`
+//     Only used for top-level values of dictionary encoded properties, never
+//     inside of lists and maps.
 
 struct Metadata {
   Type type{Type::EMPTY};
@@ -270,7 +288,11 @@ class Writer {
 // Helper class used to read data from the binary stream.
 class Reader {
  public:
-  Reader(const uint8_t *data, uint64_t size) : data_(data), size_(size), pos_(0) {}
+  Reader(const uint8_t *data, uint64_t size, const StringDictionary *dictionary = nullptr)
+      : data_(data), size_(size), pos_(0), dictionary_(dictionary) {}
+
+  // Dictionary of the dictionary encoded strings in the stream.
+  const StringDictionary *dictionary() const { return dictionary_; }
 
   std::optional<Metadata> ReadMetadata() {
     if (pos_ + 1 > size_) return std::nullopt;
@@ -391,6 +413,7 @@ class Reader {
   const uint8_t *data_;
   uint64_t size_;
   uint64_t pos_;
+  const StringDictionary *dictionary_;
 };
 
 // Function used to encode a PropertyValue into a byte stream.
@@ -603,6 +626,15 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 
       return true;
     }
+    case Type::STRING_ID: {
+      auto id = reader->ReadUint(payload_size);
+      if (!id) return false;
+      if (value) {
+        MG_ASSERT(reader->dictionary(), "A dictionary encoded string is read without its dictionary!");
+        *value = PropertyValue(std::string(reader->dictionary()->Value(*id)));
+      }
+      return true;
+    }
   }
 }
 
@@ -703,18 +735,36 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 
       return *maybe_temporal_data == value.ValueTemporalData();
     }
+    case Type::STRING_ID: {
+      // Equal strings have the same id, so only the id of the compared string
+      // is looked up.
+      if (!value.IsString()) return false;
+      auto id = reader->ReadUint(payload_size);
+      if (!id) return false;
+      MG_ASSERT(reader->dictionary(), "A dictionary encoded string is read without its dictionary!");
+      return reader->dictionary()->Find(value.ValueString()) == *id;
+    }
   }
 }
 
 // Function used to encode a property (PropertyId, PropertyValue) into a byte
-// stream.
-bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value) {
+// stream. If `string_id` is given, the string `value` is encoded as that id of
+// the `StringDictionary`.
+bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value,
+                    std::optional<uint64_t> string_id = std::nullopt) {
   auto metadata = writer->WriteMetadata();
   if (!metadata) return false;
 
   auto id_size = writer->WriteUint(property.AsUint());
   if (!id_size) return false;
 
+  if (string_id) {
+    auto size = writer->WriteUint(*string_id);
+    if (!size) return false;
+    metadata->Set({Type::STRING_ID, *id_size, *size});
+    return true;
+  }
+
   auto type_property_size = EncodePropertyValue(writer, value);
   if (!type_property_size) return false;
 
@@ -836,6 +886,7 @@ struct SpecificPropertyAndBufferInfo {
   uint64_t all_begin;
   uint64_t all_end;
   uint64_t all_size;
+  uint64_t count;
 };
 
 // Function used to find the position where the property should be in the data
@@ -854,11 +905,14 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
   uint64_t property_end = reader->GetPosition();
   uint64_t all_begin = reader->GetPosition();
   uint64_t all_end = reader->GetPosition();
+  uint64_t count = 0;
   while (true) {
     auto ret = DecodeExpectedProperty(reader, property, nullptr);
     if (ret == DecodeExpectedPropertyStatus::MISSING_DATA) {
       break;
-    } else if (ret == DecodeExpectedPropertyStatus::SMALLER) {
+    }
+    ++count;
+    if (ret == DecodeExpectedPropertyStatus::SMALLER) {
       property_begin = reader->GetPosition();
       property_end = reader->GetPosition();
     } else if (ret == DecodeExpectedPropertyStatus::EQUAL) {
@@ -866,7 +920,7 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
     }
     all_end = reader->GetPosition();
   }
-  return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin};
+  return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin, count};
 }
 
 // All data buffers will be allocated to a power of 8 size.
@@ -922,6 +976,289 @@ void SetSizeData(uint8_t *buffer, uint64_t size, uint8_t *data) {
   memcpy(buffer + sizeof(uint64_t), &data, sizeof(uint8_t *));
 }
 
+// Stores with at least this many properties are encoded with a directory.
+// Below it a sequential scan is just as fast and the directory only costs
+// memory.
+const uint64_t kDirectoryMinProperties = 16;
+
+// Buffers with a directory are allocated with about 1/`kDirectorySlackDivisor`
+// of their size free, so that values can grow and properties can be added
+// without reallocating the buffer, see `UpdateDirectoryInPlace`.
+const uint64_t kDirectorySlackDivisor = 8;
+
+// The first byte of a data buffer that starts with a directory. It can't be
+// mistaken for the metadata of an encoded mapping because no `Type` has this
+// value. The local buffer never holds a directory.
+const uint8_t kDirectoryMarker = 0xf0;
+
+uint32_t ReadUint32(const uint8_t *data) {
+  uint32_t value;
+  memcpy(&value, data, sizeof(uint32_t));
+  return value;
+}
+
+void WriteUint32(uint8_t *data, uint64_t value) {
+  auto value32 = static_cast<uint32_t>(value);
+  memcpy(data, &value32, sizeof(uint32_t));
+}
+
+// The directory is laid out as follows:
+//   * `kDirectoryMarker`
+//   * number of properties, `uint32_t`
+//   * size of the encoded mappings, `uint32_t`
+//   * property IDs in ascending order, `uint32_t` each
+//   * offsets of the mappings from the start of the encoded mappings,
+//     `uint32_t` each
+//   * encoded mappings, the same as in a buffer without a directory, but
+//     without the tombstone
+// Stores whose property IDs or mappings don't fit into 32 bits are always
+// encoded without a directory. The rest of the buffer after the mappings is
+// unused.
+class Directory {
+ public:
+  static constexpr uint64_t kHeaderSize = 1 + 2 * sizeof(uint32_t);
+  static constexpr uint64_t kEntrySize = 2 * sizeof(uint32_t);
+
+  static uint64_t SizeOf(uint64_t count) { return kHeaderSize + count * kEntrySize; }
+
+  // Returns the directory at the start of the data buffer, if there is one.
+  static std::optional<Directory> Read(const uint8_t *data, uint64_t size) {
+    // The local buffer is never a multiple of 8 in size.
+    if (size % 8 != 0 || size < kHeaderSize || data[0] != kDirectoryMarker) return std::nullopt;
+    return Directory(data);
+  }
+
+  uint32_t count() const { return ReadUint32(data_ + 1); }
+
+  const uint8_t *mappings() const { return data_ + SizeOf(count()); }
+  uint8_t *mappings() { return const_cast<uint8_t *>(data_) + SizeOf(count()); }
+  uint32_t mappings_size() const { return ReadUint32(data_ + 1 + sizeof(uint32_t)); }
+
+  uint32_t Id(uint32_t index) const { return ReadUint32(data_ + kHeaderSize + index * sizeof(uint32_t)); }
+
+  uint32_t Begin(uint32_t index) const {
+    return ReadUint32(data_ + kHeaderSize + (count() + index) * sizeof(uint32_t));
+  }
+
+  uint32_t End(uint32_t index) const { return index + 1 < count() ? Begin(index + 1) : mappings_size(); }
+
+  // Returns the index of the first property whose ID isn't smaller than
+  // `property`.
+  uint32_t LowerBound(PropertyId property) const {
+    uint32_t begin = 0;
+    uint32_t size = count();
+    while (size > 0) {
+      auto half = size / 2;
+      if (Id(begin + half) < property.AsUint()) {
+        begin += half + 1;
+        size -= half + 1;
+      } else {
+        size = half;
+      }
+    }
+    return begin;
+  }
+
+  std::optional<uint32_t> Find(PropertyId property) const {
+    auto index = LowerBound(property);
+    if (index == count() || Id(index) != property.AsUint()) return std::nullopt;
+    return index;
+  }
+
+ private:
+  explicit Directory(const uint8_t *data) : data_(data) {}
+
+  const uint8_t *data_;
+};
+
+// Returns the dictionary id of the string encoded in the mapping at the start
+// of `data`, if the mapping holds one.
+std::optional<uint64_t> ReadStringId(const uint8_t *data, uint64_t size) {
+  Reader reader(data, size);
+  auto metadata = reader.ReadMetadata();
+  if (!metadata || metadata->type != Type::STRING_ID) return std::nullopt;
+  if (!reader.ReadUint(metadata->id_size)) return std::nullopt;
+  return reader.ReadUint(metadata->payload_size);
+}
+
+// Releases the dictionary ids of all strings encoded in the data buffer of the
+// store. Must be called before the buffer is cleared.
+void ReleaseStringIds(const uint8_t *buffer, StringDictionary *dictionary) {
+  if (dictionary == nullptr || !dictionary->InUse()) return;
+  auto [size, data] = GetSizeData(buffer);
+  if (size % 8 != 0) {
+    // We are storing the data in the local buffer.
+    size = sizeof(uint64_t) + sizeof(uint8_t *) - 1;
+    data = const_cast<uint8_t *>(&buffer[1]);
+  }
+  if (auto directory = Directory::Read(data, size)) {
+    data = directory->mappings();
+    size = directory->mappings_size();
+  }
+  Reader reader(data, size);
+  while (true) {
+    auto metadata = reader.ReadMetadata();
+    if (!metadata || !reader.ReadUint(metadata->id_size)) break;
+    if (metadata->type == Type::STRING_ID) {
+      auto id = reader.ReadUint(metadata->payload_size);
+      if (!id) break;
+      dictionary->Release(*id);
+    } else if (!DecodePropertyValue(&reader, metadata->type, metadata->payload_size, nullptr)) {
+      break;
+    }
+  }
+}
+
+// Replaces the data of the store with a new buffer holding the encoded
+// mappings in `before`, the mapping of `property` to `value` (unless `value`
+// is Null) and the encoded mappings in `after`, which must all be sorted by
+// property ID. The buffer gets a directory if there are enough properties. The
+// previous data buffer isn't freed, since `before` and `after` point into it.
+void RebuildData(uint8_t *buffer, std::span<const uint8_t> before, PropertyId property, const PropertyValue &value,
+                 uint64_t property_size, std::span<const uint8_t> after,
+                 std::optional<uint64_t> string_id = std::nullopt) {
+  // Count the properties without decoding their values.
+  uint64_t count = value.IsNull() ? 0 : 1;
+  uint64_t max_id = value.IsNull() ? 0 : property.AsUint();
+  for (auto part : {before, after}) {
+    Reader reader(part.data(), part.size());
+    while (true) {
+      auto metadata = reader.ReadMetadata();
+      if (!metadata || metadata->type == Type::EMPTY) break;
+      auto id = reader.ReadUint(metadata->id_size);
+      MG_ASSERT(id && DecodePropertyValue(&reader, metadata->type, metadata->payload_size, nullptr),
+                "Invalid database state!");
+      max_id = std::max<uint64_t>(max_id, *id);
+      ++count;
+    }
+  }
+
+  const uint64_t mappings_size = before.size() + property_size + after.size();
+  if (mappings_size == 0) {
+    SetSizeData(buffer, 0, nullptr);
+    return;
+  }
+  const bool use_directory = count >= kDirectoryMinProperties && max_id <= std::numeric_limits<uint32_t>::max() &&
+                             mappings_size <= std::numeric_limits<uint32_t>::max();
+
+  uint8_t *data = nullptr;
+  uint64_t size = 0;
+  uint64_t mappings_begin = 0;
+  if (use_directory) {
+    mappings_begin = Directory::SizeOf(count);
+    size = ToPowerOf8(mappings_begin + mappings_size + (mappings_begin + mappings_size) / kDirectorySlackDivisor);
+    data = new uint8_t[size];
+    SetSizeData(buffer, size, data);
+  } else if (mappings_size <= sizeof(uint64_t) + sizeof(uint8_t *) - 1) {
+    // Use the local buffer.
+    buffer[0] = kUseLocalBuffer;
+    size = sizeof(uint64_t) + sizeof(uint8_t *) - 1;
+    data = &buffer[1];
+  } else {
+    size = ToPowerOf8(mappings_size);
+    data = new uint8_t[size];
+    SetSizeData(buffer, size, data);
+  }
+
+  uint8_t *mappings = data + mappings_begin;
+  std::copy(before.begin(), before.end(), mappings);
+  if (!value.IsNull()) {
+    Writer writer(mappings + before.size(), property_size);
+    MG_ASSERT(EncodeProperty(&writer, property, value, string_id), "Invalid database state!");
+  }
+  std::copy(after.begin(), after.end(), mappings + before.size() + property_size);
+
+  if (!use_directory) {
+    // If there is any space left in the buffer we add a tombstone to indicate
+    // that there are no more properties to be decoded.
+    Writer writer(data + mappings_size, size - mappings_size);
+    auto metadata = writer.WriteMetadata();
+    if (metadata) metadata->Set({Type::EMPTY});
+    return;
+  }
+
+  data[0] = kDirectoryMarker;
+  WriteUint32(data + 1, count);
+  WriteUint32(data + 1 + sizeof(uint32_t), mappings_size);
+  Reader reader(mappings, mappings_size);
+  for (uint64_t index = 0; index < count; ++index) {
+    auto begin = reader.GetPosition();
+    auto metadata = reader.ReadMetadata();
+    auto id = metadata ? reader.ReadUint(metadata->id_size) : std::nullopt;
+    MG_ASSERT(id && DecodePropertyValue(&reader, metadata->type, metadata->payload_size, nullptr),
+              "Invalid database state!");
+    WriteUint32(data + Directory::kHeaderSize + index * sizeof(uint32_t), *id);
+    WriteUint32(data + Directory::kHeaderSize + (count + index) * sizeof(uint32_t), begin);
+  }
+}
+
+// Sets the mapping of `property` to `value` (or removes it if `value` is Null)
+// in the `size` bytes long data buffer that starts with `directory`, without
+// reallocating it. `index` is the position of the property in the directory,
+// as returned by `Directory::LowerBound`. Returns false without changing the
+// buffer if the result doesn't fit into it, leaves too much of it unused or
+// shouldn't have a directory, in which case the data must be rebuilt.
+bool UpdateDirectoryInPlace(uint8_t *data, uint64_t size, const Directory &directory, uint32_t index, bool existed,
+                            PropertyId property, const PropertyValue &value, uint64_t property_size,
+                            std::optional<uint64_t> string_id) {
+  const uint64_t count = directory.count();
+  const uint64_t mappings_size = directory.mappings_size();
+  const uint64_t property_begin = index < count ? directory.Begin(index) : mappings_size;
+  const uint64_t property_end = existed ? directory.End(index) : property_begin;
+  const uint64_t new_count = count + (existed ? 0 : 1) - (value.IsNull() ? 1 : 0);
+  const uint64_t new_mappings_size = mappings_size - (property_end - property_begin) + property_size;
+  const uint64_t new_size = Directory::SizeOf(new_count) + new_mappings_size;
+  if (new_count < kDirectoryMinProperties || property.AsUint() > std::numeric_limits<uint32_t>::max() ||
+      new_mappings_size > std::numeric_limits<uint32_t>::max() || new_size > size ||
+      ToPowerOf8(new_size) <= size * 2 / 3) {
+    return false;
+  }
+
+  // The directory entries and the mappings after the property move by the
+  // change of the directory and the property size, the ones before it only by
+  // the change of the directory. The parts are moved starting from the end of
+  // the buffer if it grows and from its start otherwise, so that none of them
+  // is overwritten before it's moved.
+  auto *ids = data + Directory::kHeaderSize;
+  auto *begins = ids + count * sizeof(uint32_t);
+  auto *new_begins = ids + new_count * sizeof(uint32_t);
+  auto *mappings = data + Directory::SizeOf(count);
+  auto *new_mappings = data + Directory::SizeOf(new_count);
+  const uint64_t next = index + (existed ? 1 : 0);
+  const uint64_t new_next = index + (value.IsNull() ? 0 : 1);
+  const uint64_t num_next = count - next;
+  const std::array<std::tuple<uint8_t *, const uint8_t *, uint64_t>, 5> parts{{
+      {ids + new_next * sizeof(uint32_t), ids + next * sizeof(uint32_t), num_next * sizeof(uint32_t)},
+      {new_begins, begins, index * sizeof(uint32_t)},
+      {new_begins + new_next * sizeof(uint32_t), begins + next * sizeof(uint32_t), num_next * sizeof(uint32_t)},
+      {new_mappings, mappings, property_begin},
+      {new_mappings + property_begin + property_size, mappings + property_end, mappings_size - property_end},
+  }};
+  auto move_part = [](const auto &part) {
+    const auto &[destination, source, part_size] = part;
+    memmove(destination, source, part_size);
+  };
+  if (new_count > count) {
+    std::for_each(parts.rbegin(), parts.rend(), move_part);
+  } else {
+    std::for_each(parts.begin(), parts.end(), move_part);
+  }
+
+  if (!value.IsNull()) {
+    WriteUint32(ids + index * sizeof(uint32_t), property.AsUint());
+    WriteUint32(new_begins + index * sizeof(uint32_t), property_begin);
+    Writer writer(new_mappings + property_begin, property_size);
+    MG_ASSERT(EncodeProperty(&writer, property, value, string_id), "Invalid database state!");
+  }
+  for (uint64_t i = new_next; i < new_count; ++i) {
+    auto *begin = new_begins + i * sizeof(uint32_t);
+    WriteUint32(begin, ReadUint32(begin) + property_size - (property_end - property_begin));
+  }
+  WriteUint32(data + 1, new_count);
+  WriteUint32(data + 1 + sizeof(uint32_t), new_mappings_size);
+  return true;
+}
+
 }  // namespace
 
 PropertyStore::PropertyStore() { memset(buffer_, 0, sizeof(buffer_)); }
@@ -956,7 +1293,7 @@ PropertyStore::~PropertyStore() {
   }
 }
 
-PropertyValue PropertyStore::GetProperty(PropertyId property) const {
+PropertyValue PropertyStore::GetProperty(PropertyId property, const StringDictionary *dictionary) const {
   uint64_t size;
   const uint8_t *data;
   std::tie(size, data) = GetSizeData(buffer_);
@@ -965,12 +1302,62 @@ PropertyValue PropertyStore::GetProperty(PropertyId property) const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
+  if (auto directory = Directory::Read(data, size)) {
+    auto index = directory->Find(property);
+    if (!index) return PropertyValue();
+    data = directory->mappings() + directory->Begin(*index);
+    size = directory->End(*index) - directory->Begin(*index);
+  }
+  Reader reader(data, size, dictionary);
   PropertyValue value;
   if (FindSpecificProperty(&reader, property, &value) != DecodeExpectedPropertyStatus::EQUAL) return PropertyValue();
   return value;
 }
 
+std::vector<PropertyValue> PropertyStore::GetProperties(std::span<const PropertyId> properties,
+                                                        const StringDictionary *dictionary) const {
+  uint64_t size;
+  const uint8_t *data;
+  std::tie(size, data) = GetSizeData(buffer_);
+  if (size % 8 != 0) {
+    // We are storing the data in the local buffer.
+    size = sizeof(buffer_) - 1;
+    data = &buffer_[1];
+  }
+  std::vector<PropertyValue> values(properties.size());
+  if (auto directory = Directory::Read(data, size)) {
+    for (size_t i = 0; i < properties.size(); ++i) {
+      auto index = directory->Find(properties[i]);
+      if (!index) continue;
+      Reader reader(directory->mappings() + directory->Begin(*index), directory->End(*index) - directory->Begin(*index),
+                    dictionary);
+      if (FindSpecificProperty(&reader, properties[i], &values[i]) != DecodeExpectedPropertyStatus::EQUAL) {
+        values[i] = PropertyValue();
+      }
+    }
+    return values;
+  }
+  Reader reader(data, size, dictionary);
+  // Both the requested and the stored properties are sorted by ID, so they
+  // are matched in a single pass and the values of other properties are only
+  // skipped over.
+  size_t next = 0;
+  while (next < properties.size()) {
+    auto metadata = reader.ReadMetadata();
+    if (!metadata) break;
+    auto property_id = reader.ReadUint(metadata->id_size);
+    if (!property_id) break;
+    while (next < properties.size() && properties[next].AsUint() < *property_id) ++next;
+    PropertyValue *value = nullptr;
+    if (next < properties.size() && properties[next].AsUint() == *property_id) value = &values[next];
+    if (!DecodePropertyValue(&reader, metadata->type, metadata->payload_size, value)) {
+      if (value) *value = PropertyValue();
+      break;
+    }
+  }
+  return values;
+}
+
 bool PropertyStore::HasProperty(PropertyId property) const {
   uint64_t size;
   const uint8_t *data;
@@ -980,11 +1367,13 @@ bool PropertyStore::HasProperty(PropertyId property) const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
+  if (auto directory = Directory::Read(data, size)) return directory->Find(property).has_value();
   Reader reader(data, size);
   return FindSpecificProperty(&reader, property, nullptr) == DecodeExpectedPropertyStatus::EQUAL;
 }
 
-bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &value) const {
+bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &value,
+                                    const StringDictionary *dictionary) const {
   uint64_t size;
   const uint8_t *data;
   std::tie(size, data) = GetSizeData(buffer_);
@@ -993,15 +1382,23 @@ bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &va
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
+  if (auto directory = Directory::Read(data, size)) {
+    auto index = directory->Find(property);
+    if (!index) return value.IsNull();
+    auto property_size = directory->End(*index) - directory->Begin(*index);
+    Reader prop_reader(directory->mappings() + directory->Begin(*index), property_size, dictionary);
+    if (!CompareExpectedProperty(&prop_reader, property, value)) return false;
+    return prop_reader.GetPosition() == property_size;
+  }
   Reader reader(data, size);
   auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
   if (info.property_size == 0) return value.IsNull();
-  Reader prop_reader(data + info.property_begin, info.property_size);
+  Reader prop_reader(data + info.property_begin, info.property_size, dictionary);
   if (!CompareExpectedProperty(&prop_reader, property, value)) return false;
   return prop_reader.GetPosition() == info.property_size;
 }
 
-std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
+std::map<PropertyId, PropertyValue> PropertyStore::Properties(const StringDictionary *dictionary) const {
   uint64_t size;
   const uint8_t *data;
   std::tie(size, data) = GetSizeData(buffer_);
@@ -1010,7 +1407,11 @@ std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
+  if (auto directory = Directory::Read(data, size)) {
+    data = directory->mappings();
+    size = directory->mappings_size();
+  }
+  Reader reader(data, size, dictionary);
   std::map<PropertyId, PropertyValue> props;
   while (true) {
     PropertyValue value;
@@ -1021,11 +1422,26 @@ std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
   return props;
 }
 
-bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value) {
+bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value, StringDictionary *dictionary) {
+  // The string is acquired before the size of the mapping is computed, since
+  // the size of the encoded id depends on its value.
+  std::optional<uint64_t> string_id;
+  if (dictionary && value.IsString() && dictionary->IsEncoded(property)) {
+    string_id = dictionary->Acquire(value.ValueString());
+  }
+  // The id held by the old value is released only once the new value is in
+  // place, so that setting the same string doesn't free its entry.
+  std::optional<uint64_t> old_string_id;
+  auto release_old_string_id = [&old_string_id, dictionary] {
+    if (!old_string_id) return;
+    MG_ASSERT(dictionary, "A dictionary encoded string is released without its dictionary!");
+    dictionary->Release(*old_string_id);
+  };
+
   uint64_t property_size = 0;
   if (!value.IsNull()) {
     Writer writer;
-    EncodeProperty(&writer, property, value);
+    EncodeProperty(&writer, property, value, string_id);
     property_size = writer.Written();
   }
 
@@ -1040,6 +1456,25 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     in_local_buffer = true;
   }
 
+  if (auto directory = Directory::Read(data, size)) {
+    auto index = directory->LowerBound(property);
+    const bool existed = index < directory->count() && directory->Id(index) == property.AsUint();
+    const auto property_begin = index < directory->count() ? directory->Begin(index) : directory->mappings_size();
+    const auto property_end = existed ? directory->End(index) : property_begin;
+    if (!existed && value.IsNull()) return true;
+    auto *mappings = directory->mappings();
+    if (existed) old_string_id = ReadStringId(mappings + property_begin, property_end - property_begin);
+    if (UpdateDirectoryInPlace(data, size, *directory, index, existed, property, value, property_size, string_id)) {
+      release_old_string_id();
+      return !existed;
+    }
+    RebuildData(buffer_, std::span(mappings, property_begin), property, value, property_size,
+                std::span(mappings + property_end, directory->mappings_size() - property_end), string_id);
+    delete[] data;
+    release_old_string_id();
+    return !existed;
+  }
+
   bool existed = false;
   if (!size) {
     if (!value.IsNull()) {
@@ -1065,7 +1500,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
 
       // Encode the property into the data buffer.
       Writer writer(data, size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(EncodeProperty(&writer, property, value, string_id), "Invalid database state!");
       auto metadata = writer.WriteMetadata();
       if (metadata) {
         // If there is any space left in the buffer we add a tombstone to
@@ -1080,6 +1515,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     Reader reader(data, size);
     auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
     existed = info.property_size != 0;
+    if (existed) old_string_id = ReadStringId(data + info.property_begin, info.property_size);
     auto new_size = info.all_size - info.property_size + property_size;
     auto new_size_to_power_of_8 = ToPowerOf8(new_size);
     if (new_size_to_power_of_8 == 0) {
@@ -1130,7 +1566,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     if (!value.IsNull()) {
       // We need to encode the new value.
       Writer writer(data + info.property_begin, property_size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(EncodeProperty(&writer, property, value, string_id), "Invalid database state!");
     }
 
     // We need to recreate the tombstone (if possible).
@@ -1139,12 +1575,20 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     if (metadata) {
       metadata->Set({Type::EMPTY});
     }
+
+    if (!existed && !value.IsNull() && info.count + 1 >= kDirectoryMinProperties) {
+      // The store has just outgrown the sequential encoding.
+      RebuildData(buffer_, std::span(data, new_size), PropertyId(), PropertyValue(), 0, {});
+      if (!in_local_buffer) delete[] data;
+    }
   }
 
+  release_old_string_id();
   return !existed;
 }
 
-bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
+bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties,
+                                   StringDictionary *dictionary) {
   uint64_t size = 0;
   uint8_t *data = nullptr;
   std::tie(size, data) = GetSizeData(buffer_);
@@ -1152,15 +1596,36 @@ bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::
     return false;
   }
 
+  // Strings of dictionary encoded properties are acquired once, the same ids
+  // are used to compute the size and to encode the properties.
+  std::vector<std::optional<uint64_t>> string_ids;
+  if (dictionary && dictionary->InUse()) {
+    string_ids.reserve(properties.size());
+    for (const auto &[property, value] : properties) {
+      if (value.IsString() && dictionary->IsEncoded(property)) {
+        string_ids.emplace_back(dictionary->Acquire(value.ValueString()));
+      } else {
+        string_ids.emplace_back(std::nullopt);
+      }
+    }
+  }
+  auto string_id = [&string_ids](size_t index) {
+    return string_ids.empty() ? std::nullopt : string_ids[index];
+  };
+
   uint64_t property_size = 0;
+  uint64_t count = 0;
   {
     Writer writer;
+    size_t index = 0;
     for (const auto &[property, value] : properties) {
       if (value.IsNull()) {
+        ++index;
         continue;
       }
-      EncodeProperty(&writer, property, value);
+      EncodeProperty(&writer, property, value, string_id(index++));
       property_size = writer.Written();
+      ++count;
     }
   }
 
@@ -1184,11 +1649,13 @@ bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::
   // Encode the property into the data buffer.
   Writer writer(data, size);
 
+  size_t index = 0;
   for (const auto &[property, value] : properties) {
     if (value.IsNull()) {
+      ++index;
       continue;
     }
-    MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+    MG_ASSERT(EncodeProperty(&writer, property, value, string_id(index++)), "Invalid database state!");
     writer.Written();
   }
 
@@ -1199,10 +1666,15 @@ bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::
     metadata->Set({Type::EMPTY});
   }
 
+  if (count >= kDirectoryMinProperties) {
+    RebuildData(buffer_, std::span(data, property_size), PropertyId(), PropertyValue(), 0, {});
+    if (size % 8 == 0) delete[] data;
+  }
+
   return true;
 }
 
-bool PropertyStore::ClearProperties() {
+bool PropertyStore::ClearProperties(StringDictionary *dictionary) {
   bool in_local_buffer = false;
   uint64_t size;
   uint8_t *data;
@@ -1214,6 +1686,7 @@ bool PropertyStore::ClearProperties() {
     in_local_buffer = true;
   }
   if (!size) return false;
+  ReleaseStringIds(buffer_, dictionary);
   if (!in_local_buffer) delete[] data;
   SetSizeData(buffer_, 0, nullptr);
   return true;
@@ -12,12 +12,21 @@
 #pragma once
 
 #include <map>
+#include <span>
+#include <vector>
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
 
 namespace memgraph::storage {
 
+class StringDictionary;
+
+/// String values of dictionary encoded properties are kept as ids into the
+/// `StringDictionary` of the storage. The functions that read or write values
+/// require that dictionary, so a caller can't forget to pass it and encode or
+/// read strings without it. It can be null only for stores that never hold
+/// values of encoded properties.
 class PropertyStore {
   static_assert(std::endian::native == std::endian::little,
                 "PropertyStore supports only architectures using little-endian.");
@@ -28,48 +37,65 @@ class PropertyStore {
   PropertyStore(const PropertyStore &) = delete;
   PropertyStore(PropertyStore &&other) noexcept;
   PropertyStore &operator=(const PropertyStore &) = delete;
+  /// The dictionary ids held by this store before the assignment aren't
+  /// released, see the destructor.
   PropertyStore &operator=(PropertyStore &&other) noexcept;
 
+  /// The store doesn't know its dictionary, so the ids it holds aren't
+  /// released. Stores which can hold ids have to be cleared with
+  /// `ClearProperties` first, unless the whole dictionary is freed with them.
   ~PropertyStore();
 
   /// Returns the currently stored value for property `property`. If the
   /// property doesn't exist a Null value is returned. The time complexity of
-  /// this function is O(n).
+  /// this function is O(n), or O(log(n)) for stores with many properties.
+  /// @throw std::bad_alloc
+  PropertyValue GetProperty(PropertyId property, const StringDictionary *dictionary) const;
+
+  /// Returns the currently stored values for all of the `properties`, which
+  /// must be sorted by their IDs, decoding the store only once. Null values
+  /// are returned for properties that don't exist. The time complexity of this
+  /// function is O(n + m), or O(m * log(n)) for stores with many properties.
   /// @throw std::bad_alloc
-  PropertyValue GetProperty(PropertyId property) const;
+  std::vector<PropertyValue> GetProperties(std::span<const PropertyId> properties,
+                                           const StringDictionary *dictionary) const;
 
   /// Checks whether the property `property` exists in the store. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(n), or O(log(n)) for stores with many
+  /// properties.
   bool HasProperty(PropertyId property) const;
 
   /// Checks whether the property `property` is equal to the specified value
   /// `value`. This function doesn't perform any memory allocations while
-  /// performing the equality check. The time complexity of this function is
-  /// O(n).
-  bool IsPropertyEqual(PropertyId property, const PropertyValue &value) const;
+  /// performing the equality check, dictionary encoded strings are compared
+  /// by their ids. The time complexity of this function is O(n), or O(log(n))
+  /// for stores with many properties.
+  bool IsPropertyEqual(PropertyId property, const PropertyValue &value,
+                       const StringDictionary *dictionary) const;
 
   /// Returns all properties currently stored in the store. The time complexity
   /// of this function is O(n).
   /// @throw std::bad_alloc
-  std::map<PropertyId, PropertyValue> Properties() const;
+  std::map<PropertyId, PropertyValue> Properties(const StringDictionary *dictionary) const;
 
   /// Set a property value and return `true` if insertion took place. `false` is
   /// returned if assignment took place. The time complexity of this function is
   /// O(n).
   /// @throw std::bad_alloc
-  bool SetProperty(PropertyId property, const PropertyValue &value);
+  bool SetProperty(PropertyId property, const PropertyValue &value, StringDictionary *dictionary);
 
   /// Init property values and return `true` if insertion took place. `false` is
   /// returned if there exists property in property store and insertion couldn't take place. The time complexity of this
   /// function is O(n).
   /// @throw std::bad_alloc
-  bool InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties);
+  bool InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties,
+                      StringDictionary *dictionary);
 
   /// Remove all properties and return `true` if any removal took place.
   /// `false` is returned if there were no properties to remove. The time
   /// complexity of this function is O(1).
   /// @throw std::bad_alloc
-  bool ClearProperties();
+  bool ClearProperties(StringDictionary *dictionary);
 
  private:
   uint8_t buffer_[sizeof(uint64_t) + sizeof(uint8_t *)];
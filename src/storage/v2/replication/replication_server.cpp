@@ -162,10 +162,13 @@ void Storage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::B
 
   std::unique_lock<utils::RWLock> storage_guard(storage_->main_lock_);
   // Clear the database
+  storage_->indices_.property_columns.Clear();
+  storage_->vertex_numbering_cache_.WithLock([](auto &cache) { cache = {}; });
   storage_->vertices_.clear();
   storage_->edges_.clear();
+  storage_->string_dictionary_.Clear();
 
-  storage_->constraints_ = Constraints();
+  storage_->constraints_ = Constraints(&storage_->string_dictionary_);
   storage_->indices_.label_index = LabelIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
   storage_->indices_.label_property_index =
       LabelPropertyIndex(&storage_->indices_, &storage_->constraints_, storage_->config_.items);
@@ -183,9 +186,11 @@ void Storage::ReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::B
     storage_->vertex_id_ = recovery_info.next_vertex_id;
     storage_->edge_id_ = recovery_info.next_edge_id;
     storage_->timestamp_ = std::max(storage_->timestamp_, recovery_info.next_timestamp);
+    ++storage_->vertex_set_version_;
 
     durability::RecoverIndicesAndConstraints(recovered_snapshot.indices_constraints, &storage_->indices_,
-                                             &storage_->constraints_, &storage_->vertices_);
+                                             &storage_->constraints_, &storage_->vertices_, storage_->gc_pool_.get());
+    storage_->indices_.property_columns.RebuildColumns(storage_->vertices_.access());
   } catch (const durability::RecoveryFailure &e) {
     LOG_FATAL("Couldn't load the snapshot because of: {}", e.what());
   }
@@ -31,6 +31,7 @@
 #include "storage/v2/replication/config.hpp"
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/replication_persistence_helper.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/file.hpp"
@@ -40,6 +41,8 @@
 #include "utils/rw_lock.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/stat.hpp"
+#include "utils/thread_pool.hpp"
+#include "utils/timer.hpp"
 #include "utils/uuid.hpp"
 
 /// REPLICATION ///
@@ -67,6 +70,21 @@ std::string RegisterReplicaErrorToString(Storage::RegisterReplicaError error) {
       return "COULD_NOT_BE_PERSISTED";
   }
 }
+
+Config::Items WithStringDictionary(Config::Items items, StringDictionary *string_dictionary) {
+  items.string_dictionary = string_dictionary;
+  return items;
+}
+
+// Property stores don't release the dictionary ids of their strings when they
+// are freed, so that is done before the object is removed.
+void ReleaseStringIds(auto &objects_accessor, Gid gid, StringDictionary *string_dictionary) {
+  if (!string_dictionary->InUse()) return;
+  auto it = objects_accessor.find(gid);
+  if (it == objects_accessor.end()) return;
+  std::lock_guard<utils::SpinLock> guard(it->lock);
+  it->properties.ClearProperties(string_dictionary);
+}
 }  // namespace
 
 auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipList<Vertex>::Iterator end,
@@ -314,7 +332,8 @@ bool VerticesIterable::Iterator::operator==(const Iterator &other) const {
 }
 
 Storage::Storage(Config config)
-    : indices_(&constraints_, config.items),
+    : constraints_(&string_dictionary_),
+      indices_(&constraints_, WithStringDictionary(config.items, &string_dictionary_)),
       isolation_level_(config.transaction.isolation_level),
       config_(config),
       snapshot_directory_(config_.durability.storage_directory / durability::kSnapshotDirectory),
@@ -323,6 +342,7 @@ Storage::Storage(Config config)
       uuid_(utils::GenerateUUID()),
       epoch_id_(utils::GenerateUUID()),
       global_locker_(file_retainer_.AddLocker()) {
+  config_.items.string_dictionary = &string_dictionary_;
   if (config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::DISABLED &&
       replication_role_ == ReplicationRole::MAIN) {
     spdlog::warn(
@@ -355,10 +375,20 @@ Storage::Storage(Config config)
               "process!",
               config_.durability.storage_directory);
   }
+  if (config_.gc.parallel_workers > 1) {
+    // The GC thread works on a part of the collection as well. The pool is
+    // created before the recovery, which builds the indices on it.
+    gc_pool_ = std::make_unique<utils::ThreadPool>(config_.gc.parallel_workers - 1);
+  }
+  // Properties are marked before the recovery so that the recovered strings
+  // are encoded as well.
+  for (const auto &name : config_.dictionary.properties) {
+    string_dictionary_.EncodeProperty(NameToProperty(name));
+  }
   if (config_.durability.recover_on_startup) {
     auto info = durability::RecoverData(snapshot_directory_, wal_directory_, &uuid_, &epoch_id_, &epoch_history_,
                                         &vertices_, &edges_, &edge_count_, &name_id_mapper_, &indices_, &constraints_,
-                                        config_.items, &wal_seq_num_);
+                                        config_.items, &wal_seq_num_, gc_pool_.get());
     if (info) {
       vertex_id_ = info->next_vertex_id;
       edge_id_ = info->next_edge_id;
@@ -495,6 +525,7 @@ VertexAccessor Storage::Accessor::CreateVertex() {
   MG_ASSERT(inserted, "The vertex must be inserted here!");
   MG_ASSERT(it != acc.end(), "Invalid Vertex accessor!");
   delta->prev.Set(&*it);
+  transaction_.changed_vertex_set = true;
   return VertexAccessor(&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_);
 }
 
@@ -514,6 +545,7 @@ VertexAccessor Storage::Accessor::CreateVertex(storage::Gid gid) {
   MG_ASSERT(inserted, "The vertex must be inserted here!");
   MG_ASSERT(it != acc.end(), "Invalid Vertex accessor!");
   delta->prev.Set(&*it);
+  transaction_.changed_vertex_set = true;
   return VertexAccessor(&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_);
 }
 
@@ -524,6 +556,21 @@ std::optional<VertexAccessor> Storage::Accessor::FindVertex(Gid gid, View view)
   return VertexAccessor::Create(&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_, view);
 }
 
+std::optional<EdgeAccessor> Storage::Accessor::FindEdge(Gid gid, EdgeTypeId edge_type, const VertexAccessor &from,
+                                                        const VertexAccessor &to, View view) {
+  EdgeRef edge_ref(gid);
+  if (config_.properties_on_edges) {
+    auto acc = storage_->edges_.access();
+    auto it = acc.find(gid);
+    if (it == acc.end()) return std::nullopt;
+    edge_ref = EdgeRef(&*it);
+  }
+  EdgeAccessor edge(edge_ref, edge_type, from.vertex_, to.vertex_, &transaction_, &storage_->indices_,
+                    &storage_->constraints_, config_);
+  if (!edge.IsVisible(view)) return std::nullopt;
+  return edge;
+}
+
 Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAccessor *vertex) {
   MG_ASSERT(vertex->transaction_ == &transaction_,
             "VertexAccessor must be from the same transaction as the storage "
@@ -542,6 +589,8 @@ Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAcce
 
   CreateAndLinkDelta(&transaction_, vertex_ptr, Delta::RecreateObjectTag());
   vertex_ptr->deleted = true;
+  transaction_.changed_vertex_set = true;
+  storage_->indices_.property_columns.UpdateOnDeleteVertex(vertex_ptr);
 
   return std::make_optional<VertexAccessor>(vertex_ptr, &transaction_, &storage_->indices_, &storage_->constraints_,
                                             config_, true);
@@ -612,6 +661,8 @@ Result<std::optional<std::pair<VertexAccessor, std::vector<EdgeAccessor>>>> Stor
 
   CreateAndLinkDelta(&transaction_, vertex_ptr, Delta::RecreateObjectTag());
   vertex_ptr->deleted = true;
+  transaction_.changed_vertex_set = true;
+  storage_->indices_.property_columns.UpdateOnDeleteVertex(vertex_ptr);
 
   return std::make_optional<ReturnType>(
       VertexAccessor{vertex_ptr, &transaction_, &storage_->indices_, &storage_->constraints_, config_, true},
@@ -887,6 +938,9 @@ utils::BasicResult<StorageDataManipulationError, void> Storage::Accessor::Commit
     {
       std::unique_lock<utils::SpinLock> engine_guard(storage_->engine_lock_);
       commit_timestamp_.emplace(storage_->CommitTimestamp(desired_commit_timestamp));
+      // Transactions that start after this one commits see other vertices,
+      // so they can't share the numbering of the earlier ones.
+      if (transaction_.changed_vertex_set) ++storage_->vertex_set_version_;
 
       // Before committing and validating vertices against unique constraints,
       // we have to update unique constraints with the vertices that are going
@@ -1002,7 +1056,10 @@ void Storage::Accessor::Abort() {
               break;
             }
             case Delta::Action::SET_PROPERTY: {
-              vertex->properties.SetProperty(current->property.key, current->property.value);
+              vertex->properties.SetProperty(current->property.key, current->property.value,
+                                             &storage_->string_dictionary_);
+              storage_->indices_.property_columns.UpdateOnSetProperty(current->property.key, current->property.value,
+                                                                      vertex);
               break;
             }
             case Delta::Action::ADD_IN_EDGE: {
@@ -1076,7 +1133,8 @@ void Storage::Accessor::Abort() {
                current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
           switch (current->action) {
             case Delta::Action::SET_PROPERTY: {
-              edge->properties.SetProperty(current->property.key, current->property.value);
+              edge->properties.SetProperty(current->property.key, current->property.value,
+                                           &storage_->string_dictionary_);
               break;
             }
             case Delta::Action::DELETE_OBJECT: {
@@ -1167,7 +1225,7 @@ EdgeTypeId Storage::NameToEdgeType(const std::string_view name) {
 utils::BasicResult<StorageIndexDefinitionError, void> Storage::CreateIndex(
     LabelId label, const std::optional<uint64_t> desired_commit_timestamp) {
   std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  if (!indices_.label_index.CreateIndex(label, vertices_.access())) {
+  if (!indices_.label_index.CreateIndex(label, vertices_.access(), gc_pool_.get())) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
@@ -1186,7 +1244,7 @@ utils::BasicResult<StorageIndexDefinitionError, void> Storage::CreateIndex(
 utils::BasicResult<StorageIndexDefinitionError, void> Storage::CreateIndex(
     LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
   std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  if (!indices_.label_property_index.CreateIndex(label, property, vertices_.access())) {
+  if (!indices_.label_property_index.CreateIndex(label, property, vertices_.access(), gc_pool_.get())) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
@@ -1247,6 +1305,21 @@ IndicesInfo Storage::ListAllIndices() const {
   return {indices_.label_index.ListIndices(), indices_.label_property_index.ListIndices()};
 }
 
+bool Storage::CreatePropertyColumn(LabelId label, PropertyId property) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  return indices_.property_columns.CreateColumn(label, property, vertices_.access());
+}
+
+bool Storage::DropPropertyColumn(LabelId label, PropertyId property) {
+  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  return indices_.property_columns.DropColumn(label, property);
+}
+
+std::vector<std::pair<LabelId, PropertyId>> Storage::ListAllPropertyColumns() const {
+  std::shared_lock<utils::RWLock> storage_guard_(main_lock_);
+  return indices_.property_columns.ListColumns();
+}
+
 utils::BasicResult<StorageExistenceConstraintDefinitionError, void> Storage::CreateExistenceConstraint(
     LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
   std::unique_lock<utils::RWLock> storage_guard(main_lock_);
@@ -1373,15 +1446,94 @@ VerticesIterable Storage::Accessor::Vertices(LabelId label, PropertyId property,
       storage_->indices_.label_property_index.Vertices(label, property, lower_bound, upper_bound, view, &transaction_));
 }
 
+VertexOrdinals Storage::Accessor::GetVertexOrdinals(View view, utils::ThreadPool *pool) {
+  const auto shared = transaction_.isolation_level == IsolationLevel::SNAPSHOT_ISOLATION &&
+                      !transaction_.changed_vertex_set;
+  std::shared_ptr<const VertexNumbering> numbering;
+  if (shared) {
+    numbering = storage_->vertex_numbering_cache_.WithLock([this](const auto &cache) {
+      return cache.vertex_set_version == transaction_.vertex_set_version ? cache.numbering : nullptr;
+    });
+  }
+  if (!numbering) {
+    auto new_numbering = std::make_shared<VertexNumbering>(VertexGidUpperBound());
+    if (pool) {
+      // The visibility of the vertices is checked by the workers, the
+      // numbering itself is filled in the order of the parts.
+      auto parts = PartitionVertices(view, pool->Size() + 1);
+      std::vector<std::vector<Vertex *>> part_vertices(parts.size());
+      utils::ParallelFor(pool, parts.size(), [&](size_t part) {
+        // The enabler is per thread, so each worker has to set it up as well.
+        utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+        for (auto vertex : parts[part]) part_vertices[part].push_back(vertex.vertex_);
+      });
+      for (const auto &vertices : part_vertices) {
+        for (auto *vertex : vertices) new_numbering->Add(vertex);
+      }
+    } else {
+      for (auto vertex : Vertices(view)) new_numbering->Add(vertex.vertex_);
+    }
+    numbering = std::move(new_numbering);
+    if (shared) {
+      storage_->vertex_numbering_cache_.WithLock([this, &numbering](auto &cache) {
+        // Keep the numbering of the newest transactions, which are the most
+        // likely to be followed by others with the same version.
+        if (!cache.numbering || cache.vertex_set_version <= transaction_.vertex_set_version) {
+          cache = {transaction_.vertex_set_version, numbering};
+        }
+      });
+    }
+  }
+  return {std::move(numbering), &transaction_, &storage_->indices_, &storage_->constraints_, config_};
+}
+
+std::vector<VerticesIterable> Storage::Accessor::PartitionVertices(View view, uint64_t num_parts) {
+  // All of the accessors are taken before the vertices are partitioned so that
+  // the vertices at which the parts begin can't be freed while the parts are
+  // alive.
+  std::vector<utils::SkipList<Vertex>::Accessor> accessors;
+  accessors.reserve(num_parts);
+  for (uint64_t i = 0; i < num_parts; ++i) accessors.push_back(storage_->vertices_.access());
+  auto begins = accessors.front().partition(num_parts);
+  std::vector<VerticesIterable> parts;
+  parts.reserve(begins.size());
+  for (size_t i = 0; i < begins.size(); ++i) {
+    parts.emplace_back(AllVerticesIterable(std::move(accessors[i]), begins[i], &transaction_, view,
+                                           &storage_->indices_, &storage_->constraints_, storage_->config_.items));
+  }
+  return parts;
+}
+
+std::vector<VerticesIterable> Storage::Accessor::PartitionVertices(LabelId label, View view, uint64_t num_parts) {
+  auto iterables = storage_->indices_.label_index.PartitionVertices(label, view, &transaction_, num_parts);
+  std::vector<VerticesIterable> parts;
+  parts.reserve(iterables.size());
+  for (auto &iterable : iterables) parts.emplace_back(std::move(iterable));
+  return parts;
+}
+
+std::vector<VerticesIterable> Storage::Accessor::PartitionVertices(
+    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, uint64_t num_parts) {
+  auto iterables = storage_->indices_.label_property_index.PartitionVertices(label, property, lower_bound, upper_bound,
+                                                                             view, &transaction_, num_parts);
+  std::vector<VerticesIterable> parts;
+  parts.reserve(iterables.size());
+  for (auto &iterable : iterables) parts.emplace_back(std::move(iterable));
+  return parts;
+}
+
 Transaction Storage::CreateTransaction(IsolationLevel isolation_level) {
   // We acquire the transaction engine lock here because we access (and
   // modify) the transaction engine variables (`transaction_id` and
   // `timestamp`) below.
   uint64_t transaction_id;
   uint64_t start_timestamp;
+  uint64_t vertex_set_version;
   {
     std::lock_guard<utils::SpinLock> guard(engine_lock_);
     transaction_id = transaction_id_++;
+    vertex_set_version = vertex_set_version_;
     // Replica should have only read queries and the write queries
     // can come from main instance with any past timestamp.
     // To preserve snapshot isolation we set the start timestamp
@@ -1394,17 +1546,32 @@ Transaction Storage::CreateTransaction(IsolationLevel isolation_level) {
       start_timestamp = timestamp_++;
     }
   }
-  return {transaction_id, start_timestamp, isolation_level};
+  Transaction transaction{transaction_id, start_timestamp, isolation_level};
+  transaction.vertex_set_version = vertex_set_version;
+  return transaction;
 }
 
 template <bool force>
 void Storage::CollectGarbage() {
+  if constexpr (force) {
+    CollectGarbageStep<true>();
+  } else {
+    // Each step holds the main lock for a bounded amount of work, so that
+    // operations waiting for the unique lock (and the accessors queued behind
+    // them) aren't blocked for the whole collection after a large delete.
+    while (CollectGarbageStep<false>()) {
+    }
+  }
+}
+
+template <bool force>
+bool Storage::CollectGarbageStep() {
   if constexpr (force) {
     // We take the unique lock on the main storage lock so we can forcefully clean
     // everything we can
     if (!main_lock_.try_lock()) {
       CollectGarbage<false>();
-      return;
+      return false;
     }
   } else {
     // Because the garbage collector iterates through the indices and constraints
@@ -1430,30 +1597,51 @@ void Storage::CollectGarbage() {
   // ones.
   std::unique_lock<std::mutex> gc_guard(gc_lock_, std::try_to_lock);
   if (!gc_guard.owns_lock()) {
-    return;
+    return false;
   }
+  utils::Timer step_timer;
 
   uint64_t oldest_active_start_timestamp = commit_log_->OldestActive();
   // We don't move undo buffers of unlinked transactions to garbage_undo_buffers
   // list immediately, because we would have to repeatedly take
   // garbage_undo_buffers lock.
-  std::list<std::pair<uint64_t, std::list<Delta>>> unlinked_undo_buffers;
+  std::list<std::pair<uint64_t, UndoBuffer>> unlinked_undo_buffers;
 
   // We will only free vertices deleted up until now in this GC cycle, and we
   // will do it after cleaning-up the indices. That way we are sure that all
-  // vertices that appear in an index also exist in main storage.
-  std::list<Gid> current_deleted_edges;
-  std::list<Gid> current_deleted_vertices;
-  deleted_vertices_->swap(current_deleted_vertices);
-  deleted_edges_->swap(current_deleted_edges);
+  // vertices that appear in an index also exist in main storage. The deleted
+  // objects are kept in `gc_deleted_vertices_` and `gc_deleted_edges_` until
+  // the step that finishes the index cleanup.
+  //
+  // An index cleanup that is split into several steps must not see vertices
+  // deleted after it started, because their entries might be in the part of
+  // the indices it already cleaned up. So while it's in progress, the steps
+  // only continue it, without unlinking deltas. A forced collection cleans up
+  // the indices in one step, so it starts over.
+  const bool continue_index_cleanup = !force && gc_index_cleanup_in_progress_;
+  if (!continue_index_cleanup) {
+    deleted_vertices_.WithLock(
+        [&](auto &deleted_vertices) { gc_deleted_vertices_.splice(gc_deleted_vertices_.end(), deleted_vertices); });
+    deleted_edges_.WithLock(
+        [&](auto &deleted_edges) { gc_deleted_edges_.splice(gc_deleted_edges_.end(), deleted_edges); });
+  }
 
   // Flag that will be used to determine whether the Index GC should be run. It
   // should be run when there were any items that were cleaned up (there were
   // updates between this run of the GC and the previous run of the GC). This
   // eliminates high CPU usage when the GC doesn't have to clean up anything.
-  bool run_index_cleanup = !committed_transactions_->empty() || !garbage_undo_buffers_->empty();
-
-  while (true) {
+  bool run_index_cleanup =
+      gc_index_cleanup_pending_ || !committed_transactions_->empty() || !garbage_undo_buffers_->empty();
+
+  // The unlinking stops after this many deltas and continues in the next
+  // step, from the delta saved in `gc_delta_cursor_`. The index cleanup stops
+  // after checking about as many index entries.
+  const uint64_t max_deltas = force ? 0 : config_.gc.max_deltas_per_step;
+  uint64_t unlinked_deltas = 0;
+  bool step_limit_reached = false;
+
+  utils::Timer phase_timer;
+  while (!continue_index_cleanup) {
     // We don't want to hold the lock on commited transactions for too long,
     // because that prevents other transactions from committing.
     Transaction *transaction;
@@ -1501,7 +1689,16 @@ void Storage::CollectGarbage() {
     // chain in a broken state.
     // The chain can be only read without taking any locks.
 
-    for (Delta &delta : transaction->deltas) {
+    auto delta_it = gc_delta_cursor_ ? *gc_delta_cursor_ : transaction->deltas.begin();
+    gc_delta_cursor_.reset();
+    for (; delta_it != transaction->deltas.end(); ++delta_it) {
+      if (max_deltas != 0 && unlinked_deltas >= max_deltas) {
+        gc_delta_cursor_ = delta_it;
+        step_limit_reached = true;
+        break;
+      }
+      Delta &delta = *delta_it;
+      ++unlinked_deltas;
       while (true) {
         auto prev = delta.prev.Get();
         switch (prev.type) {
@@ -1515,7 +1712,7 @@ void Storage::CollectGarbage() {
             }
             vertex->delta = nullptr;
             if (vertex->deleted) {
-              current_deleted_vertices.push_back(vertex->gid);
+              gc_deleted_vertices_.push_back(vertex->gid);
             }
             break;
           }
@@ -1529,7 +1726,7 @@ void Storage::CollectGarbage() {
             }
             edge->delta = nullptr;
             if (edge->deleted) {
-              current_deleted_edges.push_back(edge->gid);
+              gc_deleted_edges_.push_back(edge->gid);
             }
             break;
           }
@@ -1577,21 +1774,64 @@ void Storage::CollectGarbage() {
       }
     }
 
+    if (step_limit_reached) break;
+
     committed_transactions_.WithLock([&](auto &committed_transactions) {
       unlinked_undo_buffers.emplace_back(0, std::move(transaction->deltas));
       committed_transactions.pop_front();
     });
   }
+  const auto unlink_duration = phase_timer.Elapsed<std::chrono::microseconds>();
+
+  if (step_limit_reached) {
+    // The indices are cleaned up once all of the deltas are unlinked, because
+    // that traverses all of them. Deleted objects must stay around until then.
+    gc_index_cleanup_pending_ = true;
+    run_index_cleanup = false;
+  }
 
   // After unlinking deltas from vertices, we refresh the indices. That way
-  // we're sure that none of the vertices from `current_deleted_vertices`
-  // appears in an index, and we can safely remove the from the main storage
-  // after the last currently active transaction is finished.
+  // we're sure that none of the vertices from `gc_deleted_vertices_` appears
+  // in an index, and we can safely remove the from the main storage after the
+  // last currently active transaction is finished.
+  phase_timer = utils::Timer();
   if (run_index_cleanup) {
+    gc_index_cleanup_pending_ = true;
+    gc_index_cleanup_in_progress_ = true;
     // This operation is very expensive as it traverses through all of the items
-    // in every index every time.
-    RemoveObsoleteEntries(&indices_, oldest_active_start_timestamp);
-    constraints_.unique_constraints.RemoveObsoleteEntries(oldest_active_start_timestamp);
+    // in every index. The label and label-property indices are partitioned
+    // between the workers and cleaned up in steps of about `max_deltas`
+    // entries, the rest is cleaned up in parallel with each other in the step
+    // that finishes them.
+    uint64_t max_entries = max_deltas;
+    uint64_t *limit = max_deltas != 0 ? &max_entries : nullptr;
+    gc_label_index_cleaned_ =
+        (!force && gc_label_index_cleaned_) ||
+        indices_.label_index.RemoveObsoleteEntries(oldest_active_start_timestamp, gc_pool_.get(), limit);
+    if (gc_label_index_cleaned_ &&
+        indices_.label_property_index.RemoveObsoleteEntries(oldest_active_start_timestamp, gc_pool_.get(), limit)) {
+      utils::ParallelFor(gc_pool_.get(), 2, [&](size_t task) {
+        if (task == 0) {
+          indices_.property_columns.RemoveObsoleteEntries();
+        } else {
+          constraints_.unique_constraints.RemoveObsoleteEntries(oldest_active_start_timestamp);
+        }
+      });
+      gc_index_cleanup_pending_ = false;
+      gc_index_cleanup_in_progress_ = false;
+      gc_label_index_cleaned_ = false;
+    } else {
+      step_limit_reached = true;
+    }
+  }
+  const auto index_cleanup_duration = phase_timer.Elapsed<std::chrono::microseconds>();
+
+  // The deleted objects are freed only after the index cleanup is finished.
+  std::list<Gid> current_deleted_vertices;
+  std::list<Gid> current_deleted_edges;
+  if (!step_limit_reached) {
+    current_deleted_vertices.swap(gc_deleted_vertices_);
+    current_deleted_edges.swap(gc_deleted_edges_);
   }
 
   {
@@ -1616,38 +1856,81 @@ void Storage::CollectGarbage() {
     }
   }
 
+  phase_timer = utils::Timer();
+  // The undo buffers are freed after releasing the lock, which aborting
+  // transactions need as well.
+  std::list<std::pair<uint64_t, UndoBuffer>> freed_undo_buffers;
   garbage_undo_buffers_.WithLock([&](auto &undo_buffers) {
     // if force is set to true we can simply delete all the leftover undos because
     // no transaction is active
     if constexpr (force) {
-      undo_buffers.clear();
+      freed_undo_buffers.swap(undo_buffers);
     } else {
-      while (!undo_buffers.empty() && undo_buffers.front().first <= oldest_active_start_timestamp) {
-        undo_buffers.pop_front();
-      }
+      auto end = undo_buffers.begin();
+      while (end != undo_buffers.end() && end->first <= oldest_active_start_timestamp) ++end;
+      freed_undo_buffers.splice(freed_undo_buffers.end(), undo_buffers, undo_buffers.begin(), end);
     }
   });
 
-  {
-    auto vertex_acc = vertices_.access();
-    if constexpr (force) {
-      // if force is set to true, then we have unique_lock and no transactions are active
-      // so we can clean all of the deleted vertices
-      while (!garbage_vertices_.empty()) {
-        MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
-        garbage_vertices_.pop_front();
-      }
+  // Undo buffers, vertices and edges are freed in parallel.
+  utils::ParallelFor(gc_pool_.get(), 3, [&](size_t task) {
+    if (task == 0) {
+      freed_undo_buffers.clear();
+    } else if (task == 1) {
+      FreeGarbageVertices<force>(oldest_active_start_timestamp);
     } else {
-      while (!garbage_vertices_.empty() && garbage_vertices_.front().first < oldest_active_start_timestamp) {
-        MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
-        garbage_vertices_.pop_front();
+      auto edge_acc = edges_.access();
+      for (auto edge : current_deleted_edges) {
+        ReleaseStringIds(edge_acc, edge, &string_dictionary_);
+        MG_ASSERT(edge_acc.remove(edge), "Invalid database state!");
       }
     }
+  });
+  const auto free_duration = phase_timer.Elapsed<std::chrono::microseconds>();
+
+  gc_run_info_.steps += 1;
+  gc_run_info_.unlinked_deltas += unlinked_deltas;
+  gc_run_info_.last_unlink += unlink_duration;
+  gc_run_info_.last_index_cleanup += index_cleanup_duration;
+  gc_run_info_.last_free += free_duration;
+  gc_run_info_.max_step = std::max(gc_run_info_.max_step, step_timer.Elapsed<std::chrono::microseconds>());
+  if (!step_limit_reached) {
+    gc_info_.WithLock([&](auto &info) {
+      info.runs += 1;
+      info.steps += gc_run_info_.steps;
+      info.unlinked_deltas += gc_run_info_.unlinked_deltas;
+      info.last_steps = gc_run_info_.steps;
+      info.last_unlink = gc_run_info_.last_unlink;
+      info.last_index_cleanup = gc_run_info_.last_index_cleanup;
+      info.last_free = gc_run_info_.last_free;
+      info.max_step = std::max(info.max_step, gc_run_info_.max_step);
+    });
+    gc_run_info_ = GcInfo();
   }
-  {
-    auto edge_acc = edges_.access();
-    for (auto edge : current_deleted_edges) {
-      MG_ASSERT(edge_acc.remove(edge), "Invalid database state!");
+  return step_limit_reached;
+}
+
+template <bool force>
+void Storage::FreeGarbageVertices(uint64_t oldest_active_start_timestamp) {
+  auto vertex_acc = vertices_.access();
+  // A numbering that is still in use can't contain the freed vertices because
+  // they are visible to no active transaction, but an outdated one might.
+  const auto can_free =
+      !garbage_vertices_.empty() && (force || garbage_vertices_.front().first < oldest_active_start_timestamp);
+  if (can_free) vertex_numbering_cache_.WithLock([](auto &cache) { cache = {}; });
+  if constexpr (force) {
+    // if force is set to true, then we have unique_lock and no transactions are active
+    // so we can clean all of the deleted vertices
+    while (!garbage_vertices_.empty()) {
+      ReleaseStringIds(vertex_acc, garbage_vertices_.front().second, &string_dictionary_);
+      MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
+      garbage_vertices_.pop_front();
+    }
+  } else {
+    while (!garbage_vertices_.empty() && garbage_vertices_.front().first < oldest_active_start_timestamp) {
+      ReleaseStringIds(vertex_acc, garbage_vertices_.front().second, &string_dictionary_);
+      MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
+      garbage_vertices_.pop_front();
     }
   }
 }
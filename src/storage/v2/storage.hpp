@@ -12,7 +12,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <list>
 #include <optional>
 #include <shared_mutex>
 #include <variant>
@@ -31,15 +33,18 @@
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/name_id_mapper.hpp"
 #include "storage/v2/result.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/vertex_ordinals.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/on_scope_exit.hpp"
 #include "utils/rw_lock.hpp"
 #include "utils/scheduler.hpp"
 #include "utils/skip_list.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/uuid.hpp"
 
 /// REPLICATION ///
@@ -63,6 +68,9 @@ namespace memgraph::storage {
 /// generic, public use.
 class AllVerticesIterable final {
   utils::SkipList<Vertex>::Accessor vertices_accessor_;
+  // Set when the iterable is a part of the vertices returned by
+  // `Storage::Accessor::PartitionVertices`.
+  std::optional<utils::SkipList<Vertex>::Iterator> begin_;
   Transaction *transaction_;
   View view_;
   Indices *indices_;
@@ -96,7 +104,18 @@ class AllVerticesIterable final {
         constraints_(constraints),
         config_(config) {}
 
-  Iterator begin() { return Iterator(this, vertices_accessor_.begin()); }
+  AllVerticesIterable(utils::SkipList<Vertex>::Accessor vertices_accessor, utils::SkipList<Vertex>::Iterator begin,
+                      Transaction *transaction, View view, Indices *indices, Constraints *constraints,
+                      Config::Items config)
+      : vertices_accessor_(std::move(vertices_accessor)),
+        begin_(begin),
+        transaction_(transaction),
+        view_(view),
+        indices_(indices),
+        constraints_(constraints),
+        config_(config) {}
+
+  Iterator begin() { return Iterator(this, begin_ ? *begin_ : vertices_accessor_.begin()); }
   Iterator end() { return Iterator(this, vertices_accessor_.end()); }
 };
 
@@ -184,6 +203,22 @@ struct StorageInfo {
   uint64_t disk_usage;
 };
 
+/// Statistics of the garbage collector. A collection is done in one or more
+/// steps, each of which holds the main lock for a bounded amount of work.
+struct GcInfo {
+  uint64_t runs{0};
+  uint64_t steps{0};
+  uint64_t unlinked_deltas{0};
+  /// Number of steps of the last collection.
+  uint64_t last_steps{0};
+  /// Time spent in each phase of the last collection, summed over its steps.
+  std::chrono::microseconds last_unlink{0};
+  std::chrono::microseconds last_index_cleanup{0};
+  std::chrono::microseconds last_free{0};
+  /// The longest time the main lock was held by a single step.
+  std::chrono::microseconds max_step{0};
+};
+
 enum class ReplicationRole : uint8_t { MAIN, REPLICA };
 
 class Storage final {
@@ -216,6 +251,12 @@ class Storage final {
 
     std::optional<VertexAccessor> FindVertex(Gid gid, View view);
 
+    /// Return the edge with the given Gid, which must have the given type and
+    /// connect `from` to `to`, if it is visible in the view. Finding the edge
+    /// doesn't scan the edges of its vertices when edges have properties.
+    std::optional<EdgeAccessor> FindEdge(Gid gid, EdgeTypeId edge_type, const VertexAccessor &from,
+                                         const VertexAccessor &to, View view);
+
     VerticesIterable Vertices(View view) {
       return VerticesIterable(AllVerticesIterable(storage_->vertices_.access(), &transaction_, view,
                                                   &storage_->indices_, &storage_->constraints_,
@@ -232,10 +273,41 @@ class Storage final {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view);
 
+    /// Return the vertices as at most `num_parts` iterables over consecutive
+    /// parts of about the same size. The parts can be iterated concurrently,
+    /// e.g. by a thread each, while the transaction isn't modified.
+    std::vector<VerticesIterable> PartitionVertices(View view, uint64_t num_parts);
+
+    std::vector<VerticesIterable> PartitionVertices(LabelId label, View view, uint64_t num_parts);
+
+    std::vector<VerticesIterable> PartitionVertices(LabelId label, PropertyId property,
+                                                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                    const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                                    View view, uint64_t num_parts);
+
     /// Return approximate number of all vertices in the database.
     /// Note that this is always an over-estimate and never an under-estimate.
     int64_t ApproximateVertexCount() const { return storage_->vertices_.size(); }
 
+    /// Return an upper bound on the Gids of all vertices in the database. Gids
+    /// are allocated sequentially, so the bound is close to the number of
+    /// vertices ever created and a Gid can be used as an index into dense
+    /// arrays. Vertices created after the call may have larger Gids.
+    uint64_t VertexGidUpperBound() const { return storage_->vertex_id_.load(std::memory_order_acquire); }
+
+    /// Number the vertices visible in the given view densely, see
+    /// `VertexOrdinals`. Snapshot isolation transactions that don't create or
+    /// delete vertices see the same vertices as long as no such transaction
+    /// commits, so they share the numbering instead of building it each time.
+    /// The numbering is allocated from the default memory resource. A new
+    /// numbering is built from `PartitionVertices` on the workers of the pool
+    /// and the calling thread, or only on the calling thread without a pool.
+    /// @throw std::bad_alloc
+    storage::VertexOrdinals GetVertexOrdinals(View view, utils::ThreadPool *pool = nullptr);
+
+    /// Return the UUID which identifies the storage.
+    const std::string &StorageUuid() const { return storage_->uuid_; }
+
     /// Return approximate number of vertices with the given label.
     /// Note that this is always an over-estimate and never an under-estimate.
     int64_t ApproximateVertexCount(LabelId label) const {
@@ -303,6 +375,17 @@ class Storage final {
       return {storage_->indices_.label_index.ListIndices(), storage_->indices_.label_property_index.ListIndices()};
     }
 
+    bool PropertyColumnExists(LabelId label, PropertyId property) const {
+      return storage_->indices_.property_columns.ColumnExists(label, property);
+    }
+
+    /// Aggregates the values in the property column of the label and property
+    /// which are visible from this transaction. Returns std::nullopt if there
+    /// is no such column or some of its values aren't numeric.
+    std::optional<PropertyColumnSummary> SummarizePropertyColumn(LabelId label, PropertyId property, View view) {
+      return storage_->indices_.property_columns.Summarize(label, property, &transaction_, view);
+    }
+
     ConstraintsInfo ListAllConstraints() const {
       return {ListExistenceConstraints(storage_->constraints_),
               storage_->constraints_.unique_constraints.ListConstraints()};
@@ -392,6 +475,20 @@ class Storage final {
 
   IndicesInfo ListAllIndices() const;
 
+  /// Create a property column of the label and property. The values of the
+  /// property on vertices with the label are then also kept in dense arrays,
+  /// which aggregations over all vertices with the label read directly.
+  /// Columns aren't persisted, they are derived from the data and have to be
+  /// created again after a restart.
+  /// Returns false if the column already exists.
+  /// @throw std::bad_alloc
+  bool CreatePropertyColumn(LabelId label, PropertyId property);
+
+  /// Returns false if the column doesn't exist.
+  bool DropPropertyColumn(LabelId label, PropertyId property);
+
+  std::vector<std::pair<LabelId, PropertyId>> ListAllPropertyColumns() const;
+
   /// Returns void if the existence constraint has been created.
   /// Returns `StorageExistenceConstraintDefinitionError` if an error occures. Error can be:
   /// * `ReplicationError`: there is at least one SYNC replica that has not confirmed receiving the transaction.
@@ -438,6 +535,8 @@ class Storage final {
 
   StorageInfo GetInfo() const;
 
+  GcInfo GetGcInfo() const { return *gc_info_.Lock(); }
+
   bool LockPath();
   bool UnlockPath();
 
@@ -504,6 +603,14 @@ class Storage final {
   template <bool force>
   void CollectGarbage();
 
+  /// Does a bounded part of the collection, see `Config::Gc`. Returns true if
+  /// there is more garbage which can be collected right away.
+  template <bool force>
+  bool CollectGarbageStep();
+
+  template <bool force>
+  void FreeGarbageVertices(uint64_t oldest_active_start_timestamp);
+
   bool InitializeWalFile();
   void FinalizeWalFile();
 
@@ -527,6 +634,10 @@ class Storage final {
   // creation.
   mutable utils::RWLock main_lock_{utils::RWLock::Priority::WRITE};
 
+  // Declared before the objects, whose property stores hold ids of its
+  // strings.
+  StringDictionary string_dictionary_;
+
   // Main object storage
   utils::SkipList<storage::Vertex> vertices_;
   utils::SkipList<storage::Edge> edges_;
@@ -546,6 +657,8 @@ class Storage final {
   utils::SpinLock engine_lock_;
   uint64_t timestamp_{kTimestampInitialId};
   uint64_t transaction_id_{kTransactionInitialId};
+  // Number of commits that created or deleted vertices.
+  uint64_t vertex_set_version_{0};
   // TODO: This isn't really a commit log, it doesn't even care if a
   // transaction commited or aborted. We could probably combine this with
   // `timestamp_` in a sensible unit, something like TransactionClock or
@@ -558,9 +671,27 @@ class Storage final {
   Config config_;
   utils::Scheduler gc_runner_;
   std::mutex gc_lock_;
+  // Workers that clean up the indices and free garbage in parallel, null if
+  // the GC runs on a single thread. Indices are built on them as well, which
+  // is done while holding `main_lock_` uniquely, so the GC can't use them at
+  // the same time.
+  std::unique_ptr<utils::ThreadPool> gc_pool_;
+  // State of a collection that is done in several steps, protected by
+  // `gc_lock_`.
+  std::optional<UndoBuffer::iterator> gc_delta_cursor_;
+  bool gc_index_cleanup_pending_{false};
+  // The cleanup of the indices is split into steps as well, it continues from
+  // the cursors kept in the indices.
+  bool gc_index_cleanup_in_progress_{false};
+  bool gc_label_index_cleaned_{false};
+  // Deleted objects that are freed once the index cleanup is finished.
+  std::list<Gid> gc_deleted_vertices_;
+  std::list<Gid> gc_deleted_edges_;
+  GcInfo gc_run_info_;
+  mutable utils::Synchronized<GcInfo, utils::SpinLock> gc_info_;
 
   // Undo buffers that were unlinked and now are waiting to be freed.
-  utils::Synchronized<std::list<std::pair<uint64_t, std::list<Delta>>>, utils::SpinLock> garbage_undo_buffers_;
+  utils::Synchronized<std::list<std::pair<uint64_t, UndoBuffer>>, utils::SpinLock> garbage_undo_buffers_;
 
   // Vertices that are logically deleted but still have to be removed from
   // indices before removing them from the main storage.
@@ -570,6 +701,16 @@ class Storage final {
   // to be removed from the main storage.
   std::list<std::pair<uint64_t, Gid>> garbage_vertices_;
 
+  // Numbering of the vertices shared by the transactions which started with
+  // the same `vertex_set_version_`, see `Accessor::GetVertexOrdinals`. It is
+  // dropped when the GC frees vertices, which an outdated numbering may point
+  // to.
+  struct VertexNumberingCache {
+    uint64_t vertex_set_version{0};
+    std::shared_ptr<const VertexNumbering> numbering;
+  };
+  utils::Synchronized<VertexNumberingCache, utils::SpinLock> vertex_numbering_cache_;
+
   // Edges that are logically deleted and wait to be removed from the main
   // storage.
   utils::Synchronized<std::list<Gid>, utils::SpinLock> deleted_edges_;
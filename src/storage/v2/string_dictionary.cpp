@@ -0,0 +1,113 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/string_dictionary.hpp"
+
+#include <mutex>
+
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+StringDictionary::StringDictionary() : chunks_(std::make_unique<std::atomic<Chunk *>[]>(kMaxChunks)) {}
+
+StringDictionary::~StringDictionary() {
+  for (uint64_t i = 0; i < kMaxChunks; ++i) delete chunks_[i].load(std::memory_order_relaxed);
+}
+
+void StringDictionary::EncodeProperty(PropertyId property) {
+  auto acc = encoded_properties_.access();
+  if (acc.insert(property).second) encoded_count_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+uint64_t StringDictionary::Acquire(std::string_view value) {
+  {
+    std::shared_lock<std::shared_mutex> guard(lock_);
+    auto found = ids_.find(value);
+    if (found != ids_.end()) {
+      auto &entry = EntryAt(found->second);
+      // An entry without references is being freed, it can only be taken
+      // back while holding the lock exclusively.
+      auto refs = entry.refs.load(std::memory_order_acquire);
+      while (refs != 0) {
+        if (entry.refs.compare_exchange_weak(refs, refs + 1, std::memory_order_acq_rel)) return found->second;
+      }
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> guard(lock_);
+  auto found = ids_.find(value);
+  if (found != ids_.end()) {
+    EntryAt(found->second).refs.fetch_add(1, std::memory_order_acq_rel);
+    return found->second;
+  }
+  uint64_t id = 0;
+  if (!free_ids_.empty()) {
+    id = free_ids_.back();
+    free_ids_.pop_back();
+  } else {
+    id = next_id_;
+    MG_ASSERT(id / kChunkSize < kMaxChunks, "The string dictionary is full!");
+    // Chunks of a cleared dictionary are reused.
+    if (id % kChunkSize == 0 && chunks_[id / kChunkSize].load(std::memory_order_acquire) == nullptr) {
+      chunks_[id / kChunkSize].store(new Chunk(), std::memory_order_release);
+    }
+    ++next_id_;
+  }
+  ids_.emplace(value, id);
+  auto &entry = EntryAt(id);
+  entry.value = value;
+  entry.live = true;
+  entry.refs.store(1, std::memory_order_release);
+  return id;
+}
+
+void StringDictionary::Release(uint64_t id) {
+  auto &entry = EntryAt(id);
+  if (entry.refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+  std::unique_lock<std::shared_mutex> guard(lock_);
+  // The entry could have been acquired again, or freed by another release
+  // which dropped the last reference of the acquired entry, before the lock
+  // was taken.
+  if (!entry.live || entry.refs.load(std::memory_order_acquire) != 0) return;
+  ids_.erase(entry.value);
+  entry.live = false;
+  entry.value = std::string();
+  free_ids_.push_back(id);
+}
+
+std::optional<uint64_t> StringDictionary::Find(std::string_view value) const {
+  std::shared_lock<std::shared_mutex> guard(lock_);
+  auto found = ids_.find(value);
+  if (found == ids_.end()) return std::nullopt;
+  return found->second;
+}
+
+uint64_t StringDictionary::size() const {
+  std::shared_lock<std::shared_mutex> guard(lock_);
+  return ids_.size();
+}
+
+void StringDictionary::Clear() {
+  std::unique_lock<std::shared_mutex> guard(lock_);
+  for (const auto &[value, id] : ids_) {
+    auto &entry = EntryAt(id);
+    entry.live = false;
+    entry.value = std::string();
+    entry.refs.store(0, std::memory_order_release);
+  }
+  ids_.clear();
+  free_ids_.clear();
+  next_id_ = 0;
+}
+
+}  // namespace memgraph::storage
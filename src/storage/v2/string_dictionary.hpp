@@ -0,0 +1,120 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+/// Dictionary of the string values of dictionary encoded properties. The
+/// `PropertyStore` keeps the values of those properties as ids into the
+/// dictionary, so each distinct string is stored only once no matter how many
+/// vertices and edges have it.
+///
+/// Unlike `NameIdMapper`, entries are reference counted. Each encoded value in
+/// a property store holds one reference and the entry is freed (and its id
+/// reused) when the last one is released. The string of an id can be read
+/// without locking for as long as the caller holds a reference to it, which
+/// is the case for any id read from a property store under the lock of its
+/// object.
+///
+/// Each storage has its own dictionary, since property ids are only unique
+/// within a storage. A `PropertyStore` doesn't know which storage it belongs
+/// to, so the dictionary is passed to it by its callers.
+class StringDictionary final {
+ public:
+  StringDictionary();
+  StringDictionary(const StringDictionary &) = delete;
+  StringDictionary(StringDictionary &&) = delete;
+  StringDictionary &operator=(const StringDictionary &) = delete;
+  StringDictionary &operator=(StringDictionary &&) = delete;
+  ~StringDictionary();
+
+  /// Marks the string values of the property to be dictionary encoded. Values
+  /// that are already stored stay as they are until they are set again.
+  void EncodeProperty(PropertyId property);
+
+  bool IsEncoded(PropertyId property) const {
+    // Checked on every write of a string property, so the skip list is only
+    // accessed if some property is encoded at all.
+    if (encoded_count_.load(std::memory_order_acquire) == 0) return false;
+    return encoded_properties_.access().contains(property);
+  }
+
+  /// Whether any value could have been encoded, used to skip looking for
+  /// encoded values in stores that are being freed.
+  bool InUse() const { return encoded_count_.load(std::memory_order_acquire) != 0; }
+
+  /// Returns the id of the string and takes a reference to it.
+  /// @throw std::bad_alloc
+  uint64_t Acquire(std::string_view value);
+
+  /// Releases a reference taken by `Acquire`.
+  void Release(uint64_t id);
+
+  /// Returns the string of an id the caller holds a reference to.
+  std::string_view Value(uint64_t id) const { return EntryAt(id).value; }
+
+  /// Returns the id of the string if it is in the dictionary.
+  std::optional<uint64_t> Find(std::string_view value) const;
+
+  /// Number of distinct strings in the dictionary.
+  uint64_t size() const;
+
+  /// Removes all strings, but keeps the encoded properties. Must only be
+  /// called once no property store holds an id of the dictionary.
+  void Clear();
+
+ private:
+  static constexpr uint64_t kChunkSize = 1U << 12U;
+  static constexpr uint64_t kMaxChunks = 1U << 16U;
+
+  struct Entry {
+    std::string value;
+    std::atomic<uint64_t> refs{0};
+    // Set while the entry is mapped in `ids_`, so that a release which raced
+    // with another one frees the entry only once.
+    bool live{false};
+  };
+
+  struct Chunk {
+    std::array<Entry, kChunkSize> entries;
+  };
+
+  Entry &EntryAt(uint64_t id) const {
+    return chunks_[id / kChunkSize].load(std::memory_order_acquire)->entries[id % kChunkSize];
+  }
+
+  utils::SkipList<PropertyId> encoded_properties_;
+  std::atomic<uint64_t> encoded_count_{0};
+
+  mutable std::shared_mutex lock_;
+  std::map<std::string, uint64_t, std::less<>> ids_;
+  std::vector<uint64_t> free_ids_;
+  uint64_t next_id_{0};
+  // Chunks are never moved or freed, so entries can be read without the lock.
+  std::unique_ptr<std::atomic<Chunk *>[]> chunks_;
+};
+
+}  // namespace memgraph::storage
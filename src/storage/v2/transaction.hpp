@@ -13,7 +13,6 @@
 
 #include <atomic>
 #include <limits>
-#include <list>
 #include <memory>
 
 #include "utils/skip_list.hpp"
@@ -22,6 +21,7 @@
 #include "storage/v2/edge.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/undo_buffer.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/view.hpp"
 
@@ -45,7 +45,9 @@ struct Transaction {
         command_id(other.command_id),
         deltas(std::move(other.deltas)),
         must_abort(other.must_abort),
-        isolation_level(other.isolation_level) {}
+        isolation_level(other.isolation_level),
+        vertex_set_version(other.vertex_set_version),
+        changed_vertex_set(other.changed_vertex_set) {}
 
   Transaction(const Transaction &) = delete;
   Transaction &operator=(const Transaction &) = delete;
@@ -67,9 +69,14 @@ struct Transaction {
   // `commited_transactions_` list for GC.
   std::unique_ptr<std::atomic<uint64_t>> commit_timestamp;
   uint64_t command_id;
-  std::list<Delta> deltas;
+  UndoBuffer deltas;
   bool must_abort;
   IsolationLevel isolation_level;
+  // Number of commits that created or deleted vertices before the transaction
+  // started.
+  uint64_t vertex_set_version{0};
+  // Set when the transaction creates or deletes a vertex.
+  bool changed_vertex_set{false};
 };
 
 inline bool operator==(const Transaction &first, const Transaction &second) {
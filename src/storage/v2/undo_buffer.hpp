@@ -0,0 +1,188 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "storage/v2/delta.hpp"
+
+namespace memgraph::storage {
+
+/// Deltas created by a transaction, in the order in which they were created.
+///
+/// Deltas are linked into version chains by pointers, so they must never move.
+/// Instead of allocating each delta separately, they are constructed in place
+/// in blocks which are allocated as needed and freed all at once when the
+/// buffer is cleared or destroyed. Blocks grow from `kMinBlockSize` deltas up
+/// to `kMaxBlockSize` deltas, so that the many small transactions waiting for
+/// garbage collection don't hold on to large blocks, while bulk writes need
+/// only a few allocations.
+class UndoBuffer final {
+  struct Block {
+    Block *next{nullptr};
+    uint32_t size{0};
+    uint32_t capacity;
+
+    explicit Block(uint32_t capacity) : capacity(capacity) {}
+
+    Delta *deltas() { return reinterpret_cast<Delta *>(reinterpret_cast<std::byte *>(this) + kHeaderSize); }
+  };
+
+  static constexpr size_t kHeaderSize = (sizeof(Block) + alignof(Delta) - 1) / alignof(Delta) * alignof(Delta);
+  static_assert(alignof(Delta) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Blocks can't be aligned for the Delta!");
+
+  template <bool IsConst>
+  class IteratorBase {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Delta;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const Delta *, Delta *>;
+    using reference = std::conditional_t<IsConst, const Delta &, Delta &>;
+
+    IteratorBase() = default;
+
+    reference operator*() const { return block_->deltas()[index_]; }
+    pointer operator->() const { return &block_->deltas()[index_]; }
+
+    IteratorBase &operator++() {
+      if (++index_ == block_->size) {
+        block_ = block_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    IteratorBase operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const IteratorBase &other) const { return block_ == other.block_ && index_ == other.index_; }
+    bool operator!=(const IteratorBase &other) const { return !(*this == other); }
+
+   private:
+    friend class UndoBuffer;
+
+    IteratorBase(Block *block, uint32_t index) : block_(block), index_(index) {}
+
+    Block *block_{nullptr};
+    uint32_t index_{0};
+  };
+
+ public:
+  using iterator = IteratorBase<false>;
+  using const_iterator = IteratorBase<true>;
+
+  static constexpr uint32_t kMinBlockSize = 4;
+  static constexpr uint32_t kMaxBlockSize = 1024;
+
+  UndoBuffer() = default;
+
+  UndoBuffer(UndoBuffer &&other) noexcept
+      : head_(std::exchange(other.head_, nullptr)),
+        tail_(std::exchange(other.tail_, nullptr)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  UndoBuffer &operator=(UndoBuffer &&other) noexcept {
+    if (this == &other) return *this;
+    clear();
+    head_ = std::exchange(other.head_, nullptr);
+    tail_ = std::exchange(other.tail_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    return *this;
+  }
+
+  UndoBuffer(const UndoBuffer &) = delete;
+  UndoBuffer &operator=(const UndoBuffer &) = delete;
+
+  ~UndoBuffer() { clear(); }
+
+  /// Constructs a new delta at the end of the buffer. The returned reference
+  /// stays valid until the buffer is cleared or destroyed.
+  /// @throw std::bad_alloc
+  template <class... Args>
+  Delta &emplace_back(Args &&...args) {
+    if (tail_ != nullptr && tail_->size < tail_->capacity) {
+      auto *delta = new (tail_->deltas() + tail_->size) Delta(std::forward<Args>(args)...);
+      ++tail_->size;
+      ++size_;
+      return *delta;
+    }
+    // The new block is linked only once it holds the delta, so that the buffer
+    // never contains empty blocks.
+    auto *block = AllocateBlock(tail_ == nullptr ? kMinBlockSize : std::min(tail_->capacity * 2, kMaxBlockSize));
+    Delta *delta = nullptr;
+    try {
+      delta = new (block->deltas()) Delta(std::forward<Args>(args)...);
+    } catch (...) {
+      FreeBlock(block);
+      throw;
+    }
+    block->size = 1;
+    if (tail_ == nullptr) {
+      head_ = block;
+    } else {
+      tail_->next = block;
+    }
+    tail_ = block;
+    ++size_;
+    return *delta;
+  }
+
+  /// Destroys all deltas and frees their blocks.
+  void clear() noexcept {
+    while (head_ != nullptr) {
+      auto *block = head_;
+      head_ = block->next;
+      FreeBlock(block);
+    }
+    tail_ = nullptr;
+    size_ = 0;
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  // Empty blocks are never linked, so the first delta is always at the start of
+  // the first block.
+  iterator begin() { return iterator(head_, 0); }
+  iterator end() { return iterator(); }
+  const_iterator begin() const { return const_iterator(head_, 0); }
+  const_iterator end() const { return const_iterator(); }
+
+ private:
+  static Block *AllocateBlock(uint32_t capacity) {
+    auto *memory = ::operator new(kHeaderSize + capacity * sizeof(Delta));
+    return new (memory) Block(capacity);
+  }
+
+  static void FreeBlock(Block *block) noexcept {
+    auto *deltas = block->deltas();
+    for (uint32_t i = 0; i < block->size; ++i) deltas[i].~Delta();
+    block->~Block();
+    ::operator delete(block);
+  }
+
+  Block *head_{nullptr};
+  Block *tail_{nullptr};
+  size_t size_{0};
+};
+
+}  // namespace memgraph::storage
@@ -11,6 +11,7 @@
 
 #include "storage/v2/vertex_accessor.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "storage/v2/edge_accessor.hpp"
@@ -107,6 +108,8 @@ Result<bool> VertexAccessor::RemoveLabel(LabelId label) {
 
   std::swap(*it, *vertex_->labels.rbegin());
   vertex_->labels.pop_back();
+
+  indices_->property_columns.UpdateOnRemoveLabel(label, vertex_);
   return true;
 }
 
@@ -215,7 +218,7 @@ Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const Pro
 
   if (vertex_->deleted) return Error::DELETED_OBJECT;
 
-  auto current_value = vertex_->properties.GetProperty(property);
+  auto current_value = vertex_->properties.GetProperty(property, config_.string_dictionary);
   // We could skip setting the value if the previous one is the same to the new
   // one. This would save some memory as a delta would not be created as well as
   // avoid copying the value. The reason we are not doing that is because the
@@ -223,7 +226,7 @@ Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const Pro
   // "modify in-place". Additionally, the created delta will make other
   // transactions get a SERIALIZATION_ERROR.
   CreateAndLinkDelta(transaction_, vertex_, Delta::SetPropertyTag(), property, current_value);
-  vertex_->properties.SetProperty(property, value);
+  vertex_->properties.SetProperty(property, value, config_.string_dictionary);
 
   UpdateOnSetProperty(indices_, property, value, vertex_, *transaction_);
 
@@ -238,7 +241,7 @@ Result<bool> VertexAccessor::InitProperties(const std::map<storage::PropertyId,
 
   if (vertex_->deleted) return Error::DELETED_OBJECT;
 
-  if (!vertex_->properties.InitProperties(properties)) return false;
+  if (!vertex_->properties.InitProperties(properties, config_.string_dictionary)) return false;
   for (const auto &[property, value] : properties) {
     CreateAndLinkDelta(transaction_, vertex_, Delta::SetPropertyTag(), property, PropertyValue());
     UpdateOnSetProperty(indices_, property, value, vertex_, *transaction_);
@@ -254,13 +257,13 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::ClearProperties() {
 
   if (vertex_->deleted) return Error::DELETED_OBJECT;
 
-  auto properties = vertex_->properties.Properties();
+  auto properties = vertex_->properties.Properties(config_.string_dictionary);
   for (const auto &property : properties) {
     CreateAndLinkDelta(transaction_, vertex_, Delta::SetPropertyTag(), property.first, property.second);
     UpdateOnSetProperty(indices_, property.first, PropertyValue(), vertex_, *transaction_);
   }
 
-  vertex_->properties.ClearProperties();
+  vertex_->properties.ClearProperties(config_.string_dictionary);
 
   return std::move(properties);
 }
@@ -273,7 +276,7 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   {
     std::lock_guard<utils::SpinLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    value = vertex_->properties.GetProperty(property);
+    value = vertex_->properties.GetProperty(property, config_.string_dictionary);
     delta = vertex_->delta;
   }
   ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &value, property](const Delta &delta) {
@@ -306,6 +309,97 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   return std::move(value);
 }
 
+Result<std::optional<bool>> VertexAccessor::IsPropertyEqual(PropertyId property, const PropertyValue &value,
+                                                            View view) const {
+  MG_ASSERT(!value.IsNull(), "The property can't be compared with null!");
+  bool exists = true;
+  bool deleted = false;
+  bool is_equal = false;
+  bool has_property = false;
+  Delta *delta = nullptr;
+  {
+    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+    deleted = vertex_->deleted;
+    is_equal = vertex_->properties.IsPropertyEqual(property, value, config_.string_dictionary);
+    has_property = is_equal || vertex_->properties.HasProperty(property);
+    delta = vertex_->delta;
+  }
+  ApplyDeltasForRead(transaction_, delta, view,
+                     [&exists, &deleted, &is_equal, &has_property, property, &value](const Delta &delta) {
+                       switch (delta.action) {
+                         case Delta::Action::SET_PROPERTY: {
+                           if (delta.property.key == property) {
+                             is_equal = delta.property.value == value;
+                             has_property = !delta.property.value.IsNull();
+                           }
+                           break;
+                         }
+                         case Delta::Action::DELETE_OBJECT: {
+                           exists = false;
+                           break;
+                         }
+                         case Delta::Action::RECREATE_OBJECT: {
+                           deleted = false;
+                           break;
+                         }
+                         case Delta::Action::ADD_LABEL:
+                         case Delta::Action::REMOVE_LABEL:
+                         case Delta::Action::ADD_IN_EDGE:
+                         case Delta::Action::ADD_OUT_EDGE:
+                         case Delta::Action::REMOVE_IN_EDGE:
+                         case Delta::Action::REMOVE_OUT_EDGE:
+                           break;
+                       }
+                     });
+  if (!exists) return Error::NONEXISTENT_OBJECT;
+  if (!for_deleted_ && deleted) return Error::DELETED_OBJECT;
+  if (!has_property) return std::optional<bool>{};
+  return std::optional<bool>{is_equal};
+}
+
+Result<std::vector<PropertyValue>> VertexAccessor::GetProperties(std::span<const PropertyId> properties,
+                                                                 View view) const {
+  bool exists = true;
+  bool deleted = false;
+  std::vector<PropertyValue> values;
+  Delta *delta = nullptr;
+  {
+    std::lock_guard<utils::SpinLock> guard(vertex_->lock);
+    deleted = vertex_->deleted;
+    values = vertex_->properties.GetProperties(properties, config_.string_dictionary);
+    delta = vertex_->delta;
+  }
+  ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &values, properties](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::SET_PROPERTY: {
+        auto found = std::lower_bound(properties.begin(), properties.end(), delta.property.key);
+        if (found != properties.end() && *found == delta.property.key) {
+          values[found - properties.begin()] = delta.property.value;
+        }
+        break;
+      }
+      case Delta::Action::DELETE_OBJECT: {
+        exists = false;
+        break;
+      }
+      case Delta::Action::RECREATE_OBJECT: {
+        deleted = false;
+        break;
+      }
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+  });
+  if (!exists) return Error::NONEXISTENT_OBJECT;
+  if (!for_deleted_ && deleted) return Error::DELETED_OBJECT;
+  return std::move(values);
+}
+
 Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view) const {
   bool exists = true;
   bool deleted = false;
@@ -314,7 +408,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
   {
     std::lock_guard<utils::SpinLock> guard(vertex_->lock);
     deleted = vertex_->deleted;
-    properties = vertex_->properties.Properties();
+    properties = vertex_->properties.Properties(config_.string_dictionary);
     delta = vertex_->delta;
   }
   ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &properties](const Delta &delta) {
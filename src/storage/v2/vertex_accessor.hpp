@@ -12,6 +12,7 @@
 #pragma once
 
 #include <optional>
+#include <span>
 
 #include "storage/v2/vertex.hpp"
 
@@ -24,12 +25,14 @@ namespace memgraph::storage {
 
 class EdgeAccessor;
 class Storage;
+class VertexOrdinals;
 struct Indices;
 struct Constraints;
 
 class VertexAccessor final {
  private:
   friend class Storage;
+  friend class VertexOrdinals;
 
  public:
   VertexAccessor(Vertex *vertex, Transaction *transaction, Indices *indices, Constraints *constraints,
@@ -80,6 +83,16 @@ class VertexAccessor final {
   /// @throw std::bad_alloc
   Result<PropertyValue> GetProperty(PropertyId property, View view) const;
 
+  /// Checks whether the property `property` is equal to the non-null `value`,
+  /// without reading the stored value, so dictionary encoded strings are
+  /// compared by their ids. Returns `std::nullopt` if the property is null.
+  Result<std::optional<bool>> IsPropertyEqual(PropertyId property, const PropertyValue &value, View view) const;
+
+  /// Returns the values of all of the `properties`, which must be sorted by
+  /// their IDs, reading the properties only once.
+  /// @throw std::bad_alloc
+  Result<std::vector<PropertyValue>> GetProperties(std::span<const PropertyId> properties, View view) const;
+
   /// @throw std::bad_alloc
   Result<std::map<PropertyId, PropertyValue>> Properties(View view) const;
 
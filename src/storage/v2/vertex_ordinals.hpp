@@ -0,0 +1,141 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/memory.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::storage {
+
+/// Dense numbering of a set of vertices, usually of all vertices visible to a
+/// transaction. Vertices are numbered from 0 to `size() - 1` in the order in
+/// which they are added, so that algorithms can keep per-vertex state in flat
+/// arrays instead of maps keyed by vertex.
+///
+/// The ordinal of a vertex is found by indexing an array with its `Gid`, which
+/// works because Gids are allocated sequentially. The numbering is a snapshot:
+/// vertices created after it was built don't have an ordinal. It doesn't
+/// belong to a transaction, so transactions which see the same vertices can
+/// share it through `VertexOrdinals`.
+class VertexNumbering final {
+ public:
+  static constexpr uint64_t kNoOrdinal = std::numeric_limits<uint64_t>::max();
+
+  /// @param gid_bound upper bound of the Gids of the vertices that will be
+  ///                  added, used to allocate the lookup array up front
+  /// @throw std::bad_alloc
+  explicit VertexNumbering(uint64_t gid_bound = 0, utils::MemoryResource *memory = utils::NewDeleteResource())
+      : vertices_(memory), ordinals_(gid_bound, kNoOrdinal, memory) {}
+
+  /// Adds the vertex if it wasn't added yet and returns its ordinal.
+  /// @throw std::bad_alloc
+  uint64_t Add(storage::Vertex *vertex) {
+    const auto gid = vertex->gid.AsUint();
+    if (gid >= ordinals_.size()) {
+      ordinals_.resize(std::max(gid + 1, ordinals_.size() + ordinals_.size() / 2), kNoOrdinal);
+    }
+    if (ordinals_[gid] != kNoOrdinal) return ordinals_[gid];
+    ordinals_[gid] = vertices_.size();
+    vertices_.push_back(vertex);
+    return ordinals_[gid];
+  }
+
+  /// Number of numbered vertices.
+  uint64_t size() const { return vertices_.size(); }
+
+  /// Returns the ordinal of the vertex with the given Gid, or `std::nullopt` if
+  /// it wasn't added.
+  std::optional<uint64_t> Ordinal(Gid gid) const {
+    const auto index = gid.AsUint();
+    if (index >= ordinals_.size() || ordinals_[index] == kNoOrdinal) return std::nullopt;
+    return ordinals_[index];
+  }
+
+  /// Returns the vertex with the given ordinal, which must be less than
+  /// `size()`.
+  storage::Vertex *vertex(uint64_t ordinal) const { return vertices_[ordinal]; }
+
+  /// Bytes allocated for the numbering.
+  size_t GetAllocatedBytes() const {
+    return vertices_.capacity() * sizeof(storage::Vertex *) + ordinals_.capacity() * sizeof(uint64_t);
+  }
+
+ private:
+  utils::pmr::vector<storage::Vertex *> vertices_;
+  // Ordinals of the vertices indexed by their Gids.
+  utils::pmr::vector<uint64_t> ordinals_;
+};
+
+/// Numbering of the vertices visible to a transaction, see `VertexNumbering`.
+/// Accessors returned by `Vertex` belong to that transaction. Copies share the
+/// numbering.
+class VertexOrdinals final {
+ public:
+  VertexOrdinals() : numbering_(std::make_shared<const VertexNumbering>()) {}
+
+  VertexOrdinals(std::shared_ptr<const VertexNumbering> numbering, Transaction *transaction, Indices *indices,
+                 Constraints *constraints, Config::Items config)
+      : numbering_(std::move(numbering)),
+        transaction_(transaction),
+        indices_(indices),
+        constraints_(constraints),
+        config_(config) {}
+
+  /// Numbers the vertices accessed through the given accessors, which must
+  /// belong to the same transaction.
+  /// @throw std::bad_alloc
+  template <typename TVertices>
+  static VertexOrdinals Build(TVertices &&vertices, uint64_t gid_bound) {
+    auto numbering = std::make_shared<VertexNumbering>(gid_bound);
+    VertexOrdinals ordinals;
+    for (const VertexAccessor &vertex : vertices) {
+      if (numbering->size() == 0) {
+        ordinals = VertexOrdinals({}, vertex.transaction_, vertex.indices_, vertex.constraints_, vertex.config_);
+      }
+      numbering->Add(vertex.vertex_);
+    }
+    ordinals.numbering_ = std::move(numbering);
+    return ordinals;
+  }
+
+  /// Number of numbered vertices.
+  uint64_t size() const { return numbering_->size(); }
+
+  /// Returns the ordinal of the vertex with the given Gid, or `std::nullopt` if
+  /// it isn't numbered.
+  std::optional<uint64_t> Ordinal(Gid gid) const { return numbering_->Ordinal(gid); }
+
+  /// Returns the vertex with the given ordinal, which must be less than
+  /// `size()`.
+  VertexAccessor Vertex(uint64_t ordinal) const {
+    return VertexAccessor(numbering_->vertex(ordinal), transaction_, indices_, constraints_, config_);
+  }
+
+  const VertexNumbering &numbering() const { return *numbering_; }
+
+ private:
+  std::shared_ptr<const VertexNumbering> numbering_;
+  Transaction *transaction_{nullptr};
+  Indices *indices_{nullptr};
+  Constraints *constraints_{nullptr};
+  Config::Items config_;
+};
+
+}  // namespace memgraph::storage
@@ -15,10 +15,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <new>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -539,27 +543,127 @@ class SynchronizedPoolResource final : public MemoryResource {
   bool DoIsEqual(const MemoryResource &other) const noexcept override { return this == &other; }
 };
 
+/// Number of bytes that may be allocated through the LimitedMemoryResources
+/// which share it. The bytes are counted atomically, so the resources may be
+/// used from different threads, e.g. by the workers of a single query.
+class MemoryLimit final {
+ public:
+  explicit MemoryLimit(size_t max_allocated_bytes)
+      : max_allocated_bytes_(max_allocated_bytes), available_bytes_(max_allocated_bytes) {}
+
+  size_t GetMaxAllocatedBytes() const noexcept { return max_allocated_bytes_; }
+
+  size_t GetAllocatedBytes() const noexcept {
+    return max_allocated_bytes_ - available_bytes_.load(std::memory_order_acquire);
+  }
+
+  /// Takes the bytes from the limit, or nothing if there aren't enough.
+  bool Take(size_t bytes) noexcept {
+    auto available = available_bytes_.load(std::memory_order_acquire);
+    while (true) {
+      if (bytes > available) return false;
+      if (available_bytes_.compare_exchange_weak(available, available - bytes, std::memory_order_acq_rel)) return true;
+    }
+  }
+
+  /// Takes as many of the bytes as are left in the limit and returns how many
+  /// it took.
+  size_t TakeUpTo(size_t bytes) noexcept {
+    auto available = available_bytes_.load(std::memory_order_acquire);
+    while (true) {
+      const auto taken = std::min(bytes, available);
+      if (available_bytes_.compare_exchange_weak(available, available - taken, std::memory_order_acq_rel)) return taken;
+    }
+  }
+
+  void Give(size_t bytes) noexcept {
+    const auto available = available_bytes_.fetch_add(bytes, std::memory_order_acq_rel);
+    MG_ASSERT(available + bytes > available, "Failed deallocation");
+  }
+
+ private:
+  size_t max_allocated_bytes_;
+  std::atomic<size_t> available_bytes_;
+};
+
+/// Counts memory that was allocated elsewhere, e.g. for a structure that is
+/// shared with other users, against a limit for as long as the charge lives.
+class MemoryLimitCharge final {
+ public:
+  /// Without a limit, nothing is counted.
+  /// @throw BadAlloc if the limit doesn't have enough bytes left
+  MemoryLimitCharge(MemoryLimit *limit, size_t bytes) : limit_(limit), bytes_(limit ? bytes : 0) {
+    if (bytes_ > 0 && !limit_->Take(bytes_)) throw BadAlloc("Memory allocation limit exceeded!");
+  }
+
+  MemoryLimitCharge(const MemoryLimitCharge &) = delete;
+  MemoryLimitCharge &operator=(const MemoryLimitCharge &) = delete;
+  MemoryLimitCharge(MemoryLimitCharge &&) = delete;
+  MemoryLimitCharge &operator=(MemoryLimitCharge &&) = delete;
+
+  ~MemoryLimitCharge() {
+    if (bytes_ > 0) limit_->Give(bytes_);
+  }
+
+ private:
+  MemoryLimit *limit_;
+  size_t bytes_;
+};
+
 class LimitedMemoryResource final : public utils::MemoryResource {
  public:
   explicit LimitedMemoryResource(utils::MemoryResource *memory, size_t max_allocated_bytes)
-      : memory_(memory), max_allocated_bytes_(max_allocated_bytes) {}
+      : memory_(memory), own_limit_(std::in_place, max_allocated_bytes), limit_(&*own_limit_) {}
+
+  /// The allocations are counted against a limit shared with other
+  /// resources, which must outlive this one. Without a limit, the allocations
+  /// are only counted. If the resource is destroyed before everything
+  /// allocated through it is deallocated, e.g. because its upstream is
+  /// released as a whole, the remaining bytes are given back to the limit.
+  LimitedMemoryResource(utils::MemoryResource *memory, MemoryLimit *limit)
+      : memory_(memory),
+        limit_(limit ? limit : &own_limit_.emplace(std::numeric_limits<size_t>::max())) {}
+
+  LimitedMemoryResource(const LimitedMemoryResource &) = delete;
+  LimitedMemoryResource &operator=(const LimitedMemoryResource &) = delete;
+  LimitedMemoryResource(LimitedMemoryResource &&) = delete;
+  LimitedMemoryResource &operator=(LimitedMemoryResource &&) = delete;
+
+  ~LimitedMemoryResource() override {
+    if (own_limit_) return;
+    if (const auto bytes = own_allocated_bytes_.load(std::memory_order_acquire); bytes > 0) limit_->Give(bytes);
+  }
+
+  /// Returns the bytes allocated through all of the resources which share the
+  /// limit.
+  size_t GetAllocatedBytes() const noexcept { return limit_->GetAllocatedBytes(); }
 
-  size_t GetAllocatedBytes() const noexcept { return max_allocated_bytes_ - available_bytes_; }
+  /// Returns the bytes allocated through this resource only.
+  size_t GetOwnAllocatedBytes() const noexcept { return own_allocated_bytes_.load(std::memory_order_acquire); }
+
+  MemoryLimit *GetLimit() const noexcept { return limit_; }
 
  private:
   utils::MemoryResource *memory_;
-  size_t max_allocated_bytes_;
-  size_t available_bytes_{max_allocated_bytes_};
+  std::optional<MemoryLimit> own_limit_;
+  MemoryLimit *limit_;
+  std::atomic<size_t> own_allocated_bytes_{0};
 
   void *DoAllocate(size_t bytes, size_t alignment) override {
-    if (bytes > available_bytes_) throw utils::BadAlloc("Memory allocation limit exceeded!");
-    available_bytes_ -= bytes;
-    return memory_->Allocate(bytes, alignment);
+    if (!limit_->Take(bytes)) throw utils::BadAlloc("Memory allocation limit exceeded!");
+    try {
+      auto *ptr = memory_->Allocate(bytes, alignment);
+      own_allocated_bytes_.fetch_add(bytes, std::memory_order_acq_rel);
+      return ptr;
+    } catch (...) {
+      limit_->Give(bytes);
+      throw;
+    }
   }
 
   void DoDeallocate(void *p, size_t bytes, size_t alignment) override {
-    MG_ASSERT(available_bytes_ + bytes > available_bytes_, "Failed deallocation");
-    available_bytes_ += bytes;
+    own_allocated_bytes_.fetch_sub(bytes, std::memory_order_acq_rel);
+    limit_->Give(bytes);
     return memory_->Deallocate(p, bytes, alignment);
   }
 
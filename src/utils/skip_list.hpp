@@ -20,6 +20,7 @@
 #include <optional>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "utils/bound.hpp"
 #include "utils/linux.hpp"
@@ -59,6 +60,12 @@ const uint64_t kSkipListGcHeightTrigger = 16;
 /// elements.
 const int kSkipListCountEstimateDefaultLayer = 10;
 
+/// This is the number of nodes that are sampled for each range when the list is
+/// partitioned into ranges. The nodes are sampled from the highest layer that
+/// is expected to have enough of them, so a larger number gives ranges of more
+/// equal sizes at the cost of a longer walk over the sampled layer.
+const uint64_t kSkipListPartitionSamplesPerRange = 32;
+
 /// These variables define the storage sizes for the SkipListGc. The internal
 /// storage of the GC and the Stack storage used within the GC are all
 /// optimized to have block sizes that are a whole multiple of the memory page
@@ -563,7 +570,7 @@ class SkipList final {
     friend class SkipList;
     friend class ConstIterator;
 
-    Iterator(TNode *node) : node_(node) {}
+    Iterator(TNode *node, TNode *bound = nullptr) : node_(node), bound_(bound) {}
 
    public:
     TObj &operator*() const { return node_->obj; }
@@ -577,6 +584,10 @@ class SkipList final {
     Iterator &operator++() {
       while (true) {
         node_ = node_->nexts[0].load(std::memory_order_acquire);
+        if (bound_ != nullptr && node_ != nullptr && reached_bound(node_, bound_)) {
+          node_ = nullptr;
+          return *this;
+        }
         if (node_ != nullptr && node_->marked.load(std::memory_order_acquire)) {
           continue;
         } else {
@@ -587,16 +598,19 @@ class SkipList final {
 
    private:
     TNode *node_;
+    // The first node of the next range when the iterator was returned by
+    // `partition`, the iterator reaches the end when it gets to it.
+    TNode *bound_;
   };
 
   class ConstIterator final {
    private:
     friend class SkipList;
 
-    ConstIterator(TNode *node) : node_(node) {}
+    ConstIterator(TNode *node, TNode *bound = nullptr) : node_(node), bound_(bound) {}
 
    public:
-    ConstIterator(const Iterator &it) : node_(it.node_) {}
+    ConstIterator(const Iterator &it) : node_(it.node_), bound_(it.bound_) {}
 
     const TObj &operator*() const { return node_->obj; }
 
@@ -609,6 +623,10 @@ class SkipList final {
     ConstIterator &operator++() {
       while (true) {
         node_ = node_->nexts[0].load(std::memory_order_acquire);
+        if (bound_ != nullptr && node_ != nullptr && reached_bound(node_, bound_)) {
+          node_ = nullptr;
+          return *this;
+        }
         if (node_ != nullptr && node_->marked.load(std::memory_order_acquire)) {
           continue;
         } else {
@@ -619,6 +637,9 @@ class SkipList final {
 
    private:
     TNode *node_;
+    // The first node of the next range when the iterator was returned by
+    // `partition`, the iterator reaches the end when it gets to it.
+    TNode *bound_;
   };
 
   class Accessor final {
@@ -736,6 +757,29 @@ class SkipList final {
       return skiplist_->template estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    /// Splits the list into at most `num_ranges` consecutive ranges that can be
+    /// iterated concurrently, e.g. by a thread each. The ranges are split at
+    /// nodes sampled from an upper layer of the list, so they are only
+    /// approximately of equal size.
+    ///
+    /// @return Iterators to the first items of the ranges, in order. Iterating
+    ///         from one of them reaches `end()` at the first item of the next
+    ///         range. At least one range is always returned, it begins at
+    ///         `end()` when the list is empty.
+    std::vector<Iterator> partition(uint64_t num_ranges) const { return skiplist_->partition(num_ranges); }
+
+    /// Splits the items between the lower and upper bounds into at most
+    /// `num_ranges` ranges. The first range begins at the first item that isn't
+    /// less than the lower bound. The last range doesn't end at the upper bound,
+    /// so the caller has to stop iterating it there.
+    ///
+    /// @return Iterators to the first items of the ranges, see above
+    template <typename TKey>
+    std::vector<Iterator> partition(uint64_t num_ranges, const std::optional<utils::Bound<TKey>> &lower,
+                                    const std::optional<utils::Bound<TKey>> &upper) const {
+      return skiplist_->template partition(num_ranges, lower, upper);
+    }
+
     /// Removes the key from the list.
     ///
     /// @return bool indicating whether the removal was successful
@@ -816,6 +860,18 @@ class SkipList final {
       return skiplist_->template estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    std::vector<ConstIterator> partition(uint64_t num_ranges) const {
+      auto ranges = skiplist_->partition(num_ranges);
+      return {ranges.begin(), ranges.end()};
+    }
+
+    template <typename TKey>
+    std::vector<ConstIterator> partition(uint64_t num_ranges, const std::optional<utils::Bound<TKey>> &lower,
+                                         const std::optional<utils::Bound<TKey>> &upper) const {
+      auto ranges = skiplist_->template partition(num_ranges, lower, upper);
+      return {ranges.begin(), ranges.end()};
+    }
+
     uint64_t size() const { return skiplist_->size(); }
 
    private:
@@ -1192,6 +1248,79 @@ class SkipList final {
     return nodes_traversed / unique_count;
   }
 
+  std::vector<Iterator> partition(uint64_t num_ranges) const {
+    return partition<TObj>(num_ranges, nullptr, nullptr, size_.load(std::memory_order_acquire));
+  }
+
+  template <typename TKey>
+  std::vector<Iterator> partition(uint64_t num_ranges, const std::optional<utils::Bound<TKey>> &lower,
+                                  const std::optional<utils::Bound<TKey>> &upper) const {
+    return partition<TKey>(num_ranges, lower ? &lower->value() : nullptr, upper ? &upper->value() : nullptr,
+                           estimate_range_count(lower, upper, kSkipListCountEstimateDefaultLayer));
+  }
+
+  template <typename TKey>
+  std::vector<Iterator> partition(uint64_t num_ranges, const TKey *lower, const TKey *upper, uint64_t count) const {
+    MG_ASSERT(num_ranges >= 1, "A SkipList can't be partitioned into zero ranges!");
+
+    // Each layer is expected to have half of the nodes of the layer below it,
+    // so the nodes are sampled from the highest layer that is expected to have
+    // enough of them for all of the ranges.
+    int layer = 0;
+    while (layer + 1 < kSkipListMaxHeight &&
+           (count >> static_cast<uint64_t>(layer + 1)) >= num_ranges * kSkipListPartitionSamplesPerRange) {
+      ++layer;
+    }
+
+    TNode *first = nullptr;
+    TNode *curr = nullptr;
+    if (lower != nullptr) {
+      TNode *preds[kSkipListMaxHeight], *succs[kSkipListMaxHeight];
+      find_node(*lower, preds, succs);
+      first = succs[0];
+      curr = succs[layer];
+    } else {
+      first = head_->nexts[0].load(std::memory_order_acquire);
+      curr = head_->nexts[layer].load(std::memory_order_acquire);
+    }
+    while (first != nullptr && first->marked.load(std::memory_order_acquire)) {
+      first = first->nexts[0].load(std::memory_order_acquire);
+    }
+    if (first == nullptr) return {Iterator{nullptr}};
+
+    // Nodes inserted concurrently could be sampled even though they are before
+    // the first node, so only nodes after it are taken.
+    std::vector<TNode *> samples;
+    while (curr != nullptr && (upper == nullptr || curr->obj < *upper)) {
+      if (first->obj < curr->obj && !curr->marked.load(std::memory_order_acquire)) samples.push_back(curr);
+      curr = curr->nexts[layer].load(std::memory_order_acquire);
+    }
+
+    // The sampled nodes split the list into `samples.size() + 1` parts of
+    // about the same size, which are divided evenly between the ranges.
+    const uint64_t num_splits = std::min(num_ranges - 1, static_cast<uint64_t>(samples.size()));
+    std::vector<Iterator> ranges;
+    ranges.reserve(num_splits + 1);
+    TNode *begin = first;
+    for (uint64_t i = 1; i <= num_splits; ++i) {
+      TNode *split = samples[i * (samples.size() + 1) / (num_splits + 1) - 1];
+      ranges.push_back(Iterator{begin, split});
+      begin = split;
+    }
+    ranges.push_back(Iterator{begin});
+    return ranges;
+  }
+
+  // An iterator over a range ends when it gets to the first node of the next
+  // range. If that node was removed and unlinked in the meantime the iterator
+  // could pass it, so the objects have to be compared. A node is marked before
+  // it is unlinked, so while the bound isn't marked the iterator can't pass it.
+  static bool reached_bound(TNode *node, TNode *bound) {
+    if (node == bound) return true;
+    if (!bound->marked.load(std::memory_order_acquire)) return false;
+    return !(node->obj < bound->obj);
+  }
+
   bool ok_to_delete(TNode *candidate, int layer_found) {
     // The paper has an incorrect check here. It expects the `layer_found`
     // variable to be 1-indexed, but in fact it is 0-indexed.
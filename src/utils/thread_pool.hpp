@@ -10,9 +10,12 @@
 // licenses/APL.txt.
 
 #pragma once
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -42,6 +45,9 @@ class ThreadPool {
 
   size_t UnfinishedTasksNum() const;
 
+  /// Number of threads of the pool, 0 once it is shut down.
+  size_t Size() const { return thread_pool_.size(); }
+
  private:
   std::unique_ptr<TaskSignature> PopTask();
 
@@ -57,4 +63,49 @@ class ThreadPool {
   std::condition_variable queue_cv_;
 };
 
+// Calls `func` for each task index in [0, num_tasks). The calling thread and
+// up to one helper task per thread of the pool take the task indices one by
+// one until none are left, so all tasks are run on the calling thread if no
+// pool thread gets to them, e.g. because the pool is busy or shut down.
+// Without a pool, all tasks are run on the calling thread. The first
+// exception thrown by any task is rethrown.
+template <typename TFunc>
+void ParallelFor(ThreadPool *pool, size_t num_tasks, const TFunc &func) {
+  const size_t num_helpers = pool && num_tasks > 1 ? std::min(pool->Size(), num_tasks - 1) : 0;
+  if (num_helpers == 0) {
+    for (size_t i = 0; i < num_tasks; ++i) func(i);
+    return;
+  }
+  // Helpers may start after all tasks are done and the call has returned, so
+  // they share the state and use `func` only for the tasks they take.
+  struct State {
+    std::atomic<size_t> next_task{0};
+    std::mutex mutex;
+    std::condition_variable done;
+    size_t finished_tasks{0};
+    std::exception_ptr error;
+  };
+  auto state = std::make_shared<State>();
+  auto run_tasks = [num_tasks, &func](State &state) {
+    for (auto task = state.next_task.fetch_add(1); task < num_tasks; task = state.next_task.fetch_add(1)) {
+      std::exception_ptr task_error;
+      try {
+        func(task);
+      } catch (...) {
+        task_error = std::current_exception();
+      }
+      std::lock_guard guard(state.mutex);
+      if (task_error && !state.error) state.error = task_error;
+      if (++state.finished_tasks == num_tasks) state.done.notify_one();
+    }
+  };
+  for (size_t i = 0; i < num_helpers; ++i) {
+    pool->AddTask([state, run_tasks] { run_tasks(*state); });
+  }
+  run_tasks(*state);
+  std::unique_lock guard(state->mutex);
+  state->done.wait(guard, [&] { return state->finished_tasks == num_tasks; });
+  if (state->error) std::rethrow_exception(state->error);
+}
+
 }  // namespace memgraph::utils
@@ -0,0 +1,133 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "utils/logging.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/timer.hpp"
+
+DEFINE_int32(num_elements, 10000000, "Number of elements in the list");
+DEFINE_int32(num_threads, 8, "Number of threads that scan the list");
+DEFINE_int32(num_iterations, 5, "Number of times each scan is repeated");
+DEFINE_bool(concurrent_writes, false, "Insert and remove elements while the list is scanned");
+
+namespace {
+
+uint64_t ScanSequential(memgraph::utils::SkipList<uint64_t> *list) {
+  auto acc = list->access();
+  uint64_t sum = 0;
+  for (auto item : acc) sum += item;
+  return sum;
+}
+
+uint64_t ScanPartitioned(memgraph::utils::SkipList<uint64_t> *list, uint64_t *min_range, uint64_t *max_range) {
+  auto acc = list->access();
+  auto ranges = acc.partition(FLAGS_num_threads);
+  std::vector<uint64_t> sums(ranges.size(), 0);
+  std::vector<uint64_t> sizes(ranges.size(), 0);
+  std::vector<std::thread> threads;
+  threads.reserve(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    threads.emplace_back([&, i] {
+      for (auto it = ranges[i]; it != acc.end(); ++it) {
+        sums[i] += *it;
+        ++sizes[i];
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  *min_range = *std::min_element(sizes.begin(), sizes.end());
+  *max_range = *std::max_element(sizes.begin(), sizes.end());
+  uint64_t sum = 0;
+  for (auto range_sum : sums) sum += range_sum;
+  return sum;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  memgraph::utils::SkipList<uint64_t> list;
+  {
+    auto acc = list.access();
+    for (uint64_t i = 0; i < FLAGS_num_elements; ++i) {
+      MG_ASSERT(acc.insert(i).second);
+    }
+  }
+
+  // The writer only touches elements outside of the initial ones, so the sums
+  // of the scans stay the same.
+  std::atomic<bool> run{true};
+  std::thread writer;
+  if (FLAGS_concurrent_writes) {
+    writer = std::thread([&list, &run] {
+      uint64_t item = FLAGS_num_elements;
+      while (run.load(std::memory_order_relaxed)) {
+        auto acc = list.access();
+        acc.insert(item);
+        acc.remove(item);
+        ++item;
+      }
+    });
+  }
+
+  const uint64_t expected = static_cast<uint64_t>(FLAGS_num_elements) * (FLAGS_num_elements - 1) / 2;
+
+  {
+    memgraph::utils::Timer timer;
+    for (int i = 0; i < FLAGS_num_iterations; ++i) {
+      MG_ASSERT(ScanSequential(&list) == expected);
+    }
+    std::cout << "Sequential scan: " << timer.Elapsed().count() / FLAGS_num_iterations << " s" << std::endl;
+  }
+
+  {
+    memgraph::utils::Timer timer;
+    for (int i = 0; i < FLAGS_num_iterations; ++i) {
+      auto acc = list.access();
+      MG_ASSERT(acc.partition(FLAGS_num_threads).size() <= FLAGS_num_threads);
+    }
+    std::cout << "Partitioning: " << timer.Elapsed<std::chrono::microseconds>().count() / FLAGS_num_iterations
+              << " us" << std::endl;
+  }
+
+  {
+    uint64_t min_range = std::numeric_limits<uint64_t>::max();
+    uint64_t max_range = 0;
+    memgraph::utils::Timer timer;
+    for (int i = 0; i < FLAGS_num_iterations; ++i) {
+      uint64_t iteration_min = 0;
+      uint64_t iteration_max = 0;
+      MG_ASSERT(ScanPartitioned(&list, &iteration_min, &iteration_max) == expected);
+      min_range = std::min(min_range, iteration_min);
+      max_range = std::max(max_range, iteration_max);
+    }
+    std::cout << "Partitioned scan (" << FLAGS_num_threads
+              << " threads): " << timer.Elapsed().count() / FLAGS_num_iterations << " s" << std::endl;
+    std::cout << "Range sizes: min " << min_range << ", max " << max_range << ", ideal "
+              << FLAGS_num_elements / FLAGS_num_threads << std::endl;
+  }
+
+  run.store(false, std::memory_order_relaxed);
+  if (writer.joinable()) writer.join();
+
+  return 0;
+}
@@ -30,7 +30,7 @@ static void PropertyStoreSet(benchmark::State &state) {
   uint64_t counter = 0;
   while (state.KeepRunning()) {
     auto prop = memgraph::storage::PropertyId::FromUint(dist(gen));
-    store.SetProperty(prop, memgraph::storage::PropertyValue(42));
+    store.SetProperty(prop, memgraph::storage::PropertyValue(42), nullptr);
     ++counter;
   }
   state.SetItemsProcessed(counter);
@@ -67,14 +67,14 @@ static void PropertyStoreGet(benchmark::State &state) {
   memgraph::storage::PropertyStore store;
   for (uint64_t i = 0; i < state.range(0); ++i) {
     auto prop = memgraph::storage::PropertyId::FromUint(i);
-    store.SetProperty(prop, memgraph::storage::PropertyValue(0));
+    store.SetProperty(prop, memgraph::storage::PropertyValue(0), nullptr);
   }
   std::mt19937 gen(state.thread_index());
   std::uniform_int_distribution<uint64_t> dist(0, state.range(0) - 1);
   uint64_t counter = 0;
   while (state.KeepRunning()) {
     auto prop = memgraph::storage::PropertyId::FromUint(dist(gen));
-    store.GetProperty(prop);
+    store.GetProperty(prop, nullptr);
     ++counter;
   }
   state.SetItemsProcessed(counter);
@@ -106,4 +106,49 @@ static void StdMapGet(benchmark::State &state) {
 
 BENCHMARK(StdMapGet)->RangeMultiplier(2)->Range(1, 1024)->Unit(benchmark::kNanosecond)->UseRealTime();
 
+///////////////////////////////////////////////////////////////////////////////
+// PropertyStore Has
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreHas(benchmark::State &state) {
+  memgraph::storage::PropertyStore store;
+  for (uint64_t i = 0; i < state.range(0); ++i) {
+    auto prop = memgraph::storage::PropertyId::FromUint(i);
+    store.SetProperty(prop, memgraph::storage::PropertyValue(std::string(i % 32, 'x')), nullptr);
+  }
+  std::mt19937 gen(state.thread_index());
+  std::uniform_int_distribution<uint64_t> dist(0, state.range(0) - 1);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    auto prop = memgraph::storage::PropertyId::FromUint(dist(gen));
+    benchmark::DoNotOptimize(store.HasProperty(prop));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreHas)->RangeMultiplier(2)->Range(1, 1024)->Unit(benchmark::kNanosecond)->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// PropertyStore Init
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreInit(benchmark::State &state) {
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> properties;
+  for (uint64_t i = 0; i < state.range(0); ++i) {
+    properties.emplace(memgraph::storage::PropertyId::FromUint(i), memgraph::storage::PropertyValue(0));
+  }
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    memgraph::storage::PropertyStore store;
+    store.InitProperties(properties, nullptr);
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreInit)->RangeMultiplier(2)->Range(1, 1024)->Unit(benchmark::kNanosecond)->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -14,6 +14,21 @@
 # If you wish to modify these, update the startup_config_dict and workloads.yaml !
 
 startup_config_dict = {
+    "after_commit_trigger_max_coalesced_transactions": (
+        "1",
+        "1",
+        "Maximum number of committed transactions whose events are handled by a single execution of an AFTER COMMIT trigger. Transactions waiting for the same trigger thread are coalesced, which keeps the trigger backlog short under heavy write load.",
+    ),
+    "after_commit_trigger_queue_size": (
+        "1024",
+        "1024",
+        "Maximum number of groups of coalesced transactions waiting for an AFTER COMMIT trigger thread. Committing transactions wait for the triggers to catch up once it is reached.",
+    ),
+    "after_commit_trigger_threads": (
+        "1",
+        "1",
+        "Number of threads executing AFTER COMMIT triggers. Each trigger is always executed by the same thread, so its executions keep the commit order.",
+    ),
     "auth_module_create_missing_role": ("true", "true", "Set to false to disable creation of missing roles."),
     "auth_module_create_missing_user": ("true", "true", "Set to false to disable creation of missing users."),
     "auth_module_executable": ("", "", "Absolute path to the auth module executable that should be used."),
@@ -114,8 +129,28 @@ startup_config_dict = {
         "1",
         "The time duration between two replica checks/pings. If < 1, replicas will NOT be checked at all. NOTE: The MAIN instance allocates a new thread for each REPLICA.",
     ),
+    "storage_dictionary_properties": (
+        "",
+        "",
+        "Comma-separated list of properties whose string values are dictionary encoded. Each distinct string is stored once and shared by all vertices and edges with it.",
+    ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
+    "storage_gc_max_deltas_per_step": (
+        "100000",
+        "100000",
+        "Maximum number of deltas the storage garbage collector unlinks, or index entries it checks, while holding the storage lock. Larger collections are done in several steps. Set to 0 to do each collection in a single step.",
+    ),
+    "storage_gc_parallel_workers": (
+        "1",
+        "1",
+        "Number of threads the storage garbage collector uses to clean up indices and free memory.",
+    ),
     "storage_properties_on_edges": ("false", "true", "Controls whether edges have properties."),
+    "storage_property_columns": (
+        "",
+        "",
+        "Comma-separated list of Label.property pairs whose values are also kept in dense columns. Aggregations over all vertices with the label read the values from the column.",
+    ),
     "storage_recover_on_startup": (
         "false",
         "false",
@@ -154,7 +189,37 @@ startup_config_dict = {
         "false",
         "Set to true to enable telemetry. We collect information about the running system (CPU and memory information) and information about the database runtime (vertex and edge counts and resource usage) to allow for easier improvement of the product.",
     ),
+    "trigger_context_max_objects": (
+        "0",
+        "0",
+        "Maximum number of created, deleted and updated objects a single transaction registers for the triggers. The changes over the limit are not visible to the triggers. Set to 0 to disable the limit.",
+    ),
+    "query_aggregation_parallel_workers": (
+        "0",
+        "0",
+        "Number of worker threads used by aggregations with grouping keys. Input rows are split by the hash of their grouping key and each part is aggregated by a single worker. 0 or 1 aggregates all rows on the query thread.",
+    ),
+    "query_bfs_parallel_workers": (
+        "0",
+        "0",
+        "Number of worker threads used by single source breadth-first expansions without a filter lambda. Such expansions are then done one level at a time, with large levels split across the workers. 0 or 1 keeps the sequential expansion.",
+    ),
     "query_cost_planner": ("true", "true", "Use the cost-estimating query planner."),
+    "query_graph_projection_memory_limit": (
+        "1024",
+        "1024",
+        "Memory limit in MiB of all graph projections cached with mg.project_graph. The least recently used projections are evicted to make room for new ones. Set to 0 for no limit.",
+    ),
+    "query_procedure_batch_size": (
+        "1000",
+        "1000",
+        "Number of records batched query procedures are asked to produce at once. Larger batches need more memory, while smaller ones call the procedure more often.",
+    ),
+    "query_procedure_parallel_workers": (
+        "12",
+        "12",
+        "Number of worker threads on which query procedures can process vertices in parallel, see mgp_graph_parallel_for_vertices. By default, this will be the number of processing units available on the machine. 0 or 1 processes the vertices on the query thread.",
+    ),
     "query_plan_cache_ttl": ("60", "60", "Time to live for cached query plans, in seconds."),
     "query_vertex_count_to_expand_existing": (
         "10",
@@ -162,6 +227,16 @@ startup_config_dict = {
         "Maximum count of indexed vertices which provoke indexed lookup and then expand to existing, instead of a regular expand. Default is 10, to turn off use -1.",
     ),
     "query_max_plans": ("1000", "1000", "Maximum number of generated plans for a query."),
+    "query_plan_join_order_min_expansions": (
+        "6",
+        "6",
+        "Minimum number of expansions in a pattern for which the expansion order is chosen by cost based enumeration instead of chaining expansions in the order they appear in the pattern.",
+    ),
+    "query_plan_join_order_budget_ms": (
+        "20",
+        "20",
+        "Maximum time in milliseconds spent on dynamic programming over expansion orders for a single starting node. When exceeded, the greedy expansion ordering is used instead.",
+    ),
     "flag_file": ("", "", "load flags from file"),
     "init_file": (
         "",
@@ -0,0 +1,134 @@
+# Copyright 2022 Memgraph Ltd.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+# License, and you may not use this file except in compliance with the Business Source License.
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0, included in the file
+# licenses/APL.txt.
+
+import sys
+
+import pytest
+from common import execute_and_fetch_all
+
+
+def create_graph(cursor, node_count, relationships):
+    execute_and_fetch_all(cursor, f"UNWIND range(1, {node_count}) AS id CREATE (:Node {{id: id}})")
+    for source, target in relationships:
+        execute_and_fetch_all(
+            cursor, f"MATCH (a:Node {{id: {source}}}), (b:Node {{id: {target}}}) CREATE (a)-[:REL]->(b)"
+        )
+
+
+def call(cursor, procedure, field, arguments=""):
+    return execute_and_fetch_all(
+        cursor,
+        f"CALL graph_algorithms.{procedure}({arguments}) YIELD node, {field} "
+        f"RETURN node.id AS id, {field} ORDER BY id",
+    )
+
+
+def groups(results):
+    """Returns the sets of node ids which have the same value."""
+    by_value = {}
+    for node_id, value in results:
+        by_value.setdefault(value, set()).add(node_id)
+    return sorted(by_value.values(), key=min)
+
+
+def test_pagerank_of_a_cycle_is_uniform(connection):
+    cursor = connection.cursor()
+    create_graph(cursor, 4, [(1, 2), (2, 3), (3, 4), (4, 1)])
+    results = call(cursor, "pagerank", "rank")
+    assert [node_id for node_id, _ in results] == [1, 2, 3, 4]
+    for _, rank in results:
+        assert rank == pytest.approx(0.25)
+
+
+def test_pagerank_of_a_star(connection):
+    cursor = connection.cursor()
+    # Nodes 2 to 4 point to node 1, which has no outgoing relationships, so
+    # its rank is spread evenly over all nodes.
+    create_graph(cursor, 4, [(2, 1), (3, 1), (4, 1)])
+    results = dict(call(cursor, "pagerank", "rank", "0.85, 100, 1e-9"))
+    # Every leaf only gets the base rank (0.15 + 0.85 * r1) / 4, and the ranks
+    # sum up to 1, so a leaf has the rank 1 / 6.55.
+    leaf_rank = 1 / 6.55
+    assert results == pytest.approx({1: 1 - 3 * leaf_rank, 2: leaf_rank, 3: leaf_rank, 4: leaf_rank})
+
+
+def test_weakly_connected_components(connection):
+    cursor = connection.cursor()
+    create_graph(cursor, 6, [(1, 2), (3, 2), (4, 5)])
+    results = call(cursor, "weakly_connected_components", "component_id", '"", 2')
+    assert groups(results) == [{1, 2, 3}, {4, 5}, {6}]
+
+
+def test_strongly_connected_components(connection):
+    cursor = connection.cursor()
+    create_graph(cursor, 5, [(1, 2), (2, 3), (3, 1), (3, 4), (4, 5)])
+    results = call(cursor, "strongly_connected_components", "component_id")
+    assert groups(results) == [{1, 2, 3}, {4}, {5}]
+
+
+def test_louvain_splits_two_triangles(connection):
+    cursor = connection.cursor()
+    create_graph(cursor, 6, [(1, 2), (2, 3), (3, 1), (4, 5), (5, 6), (6, 4), (3, 4)])
+    results = call(cursor, "louvain", "community_id")
+    assert groups(results) == [{1, 2, 3}, {4, 5, 6}]
+
+
+def test_betweenness_centrality_of_a_path(connection):
+    cursor = connection.cursor()
+    create_graph(cursor, 4, [(1, 2), (2, 3), (3, 4)])
+    # Node 2 is on the shortest paths 1-3 and 1-4, node 3 on 1-4 and 2-4.
+    assert call(cursor, "betweenness_centrality", "betweenness", "false") == [(1, 0.0), (2, 2.0), (3, 2.0), (4, 0.0)]
+    normalized = call(cursor, "betweenness_centrality", "betweenness", "true")
+    assert [value for _, value in normalized] == pytest.approx([0.0, 2.0 / 6, 2.0 / 6, 0.0])
+
+
+def test_betweenness_centrality_state_counts_against_the_procedure_limit(connection):
+    cursor = connection.cursor()
+    execute_and_fetch_all(cursor, "UNWIND range(1, 20000) AS id CREATE (:Node {id: id})")
+    # Every worker keeps a few arrays with a value for each node, which don't
+    # fit into the limit.
+    with pytest.raises(Exception):
+        execute_and_fetch_all(
+            cursor,
+            "CALL graph_algorithms.betweenness_centrality(false) PROCEDURE MEMORY LIMIT 100 KB "
+            "YIELD node, betweenness RETURN count(*)",
+        )
+    assert execute_and_fetch_all(
+        cursor,
+        "CALL graph_algorithms.betweenness_centrality(false) YIELD node, betweenness "
+        "RETURN count(*), sum(betweenness)",
+    ) == [(20000, 0.0)]
+
+
+def test_triangle_count(connection):
+    cursor = connection.cursor()
+    # Two triangles sharing the relationship between nodes 2 and 3, a parallel
+    # relationship and a self-loop which aren't counted, and a dangling node.
+    create_graph(cursor, 5, [(1, 2), (2, 3), (3, 1), (2, 4), (4, 3), (1, 2), (1, 1), (4, 5)])
+    assert call(cursor, "triangle_count", "triangles", '"", 3') == [(1, 1), (2, 2), (3, 2), (4, 1), (5, 0)]
+
+
+def test_algorithms_on_a_projection(connection):
+    cursor = connection.cursor()
+    create_graph(cursor, 4, [(1, 2), (3, 4)])
+    execute_and_fetch_all(cursor, "CREATE (:Other {id: 5})")
+    execute_and_fetch_all(cursor, 'CALL mg.project_graph("nodes", ["Node"], [], null) YIELD name RETURN name')
+    try:
+        results = call(cursor, "weakly_connected_components", "component_id", '"nodes"')
+        assert groups(results) == [{1, 2}, {3, 4}]
+        with pytest.raises(Exception):
+            call(cursor, "weakly_connected_components", "component_id", '"missing"')
+    finally:
+        execute_and_fetch_all(cursor, 'CALL mg.drop_graph_projection("nodes")')
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main([__file__, "-rA"]))
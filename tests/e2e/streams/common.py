@@ -25,6 +25,8 @@ BATCH_SIZE = 3
 TRANSFORM = 4
 OWNER = 5
 IS_RUNNING = 6
+TRANSFORMATION_LATENCY = 7
+EXECUTION_LATENCY = 8
 
 # These are the indices of the query and parameters in the result of CHECK
 # STREAM query
@@ -141,7 +143,8 @@ def validate_info(actual_stream_info, expected_stream_info):
 
 def check_stream_info(cursor, stream_name, expected_stream_info):
     stream_info = get_stream_info(cursor, stream_name)
-    validate_info(stream_info, expected_stream_info)
+    # The latencies depend on the load of the machine, so they cannot be checked here
+    validate_info(stream_info[:TRANSFORMATION_LATENCY], expected_stream_info)
 
 
 def kafka_check_vertex_exists_with_topic_and_payload(cursor, topic, payload_bytes):
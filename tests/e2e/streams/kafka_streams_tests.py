@@ -19,7 +19,11 @@ from mg_utils import mg_sleep_and_assert
 from multiprocessing import Process, Value
 import common
 
-TRANSFORMATIONS_TO_CHECK_C = ["c_transformations.empty_transformation"]
+TRANSFORMATIONS_TO_CHECK_C = [
+    "c_transformations.empty_transformation",
+    "json_to_graph.create_nodes",
+    "json_to_graph.merge_nodes",
+]
 
 TRANSFORMATIONS_TO_CHECK_PY = ["kafka_transform.simple", "kafka_transform.with_parameters"]
 
@@ -68,6 +72,61 @@ def test_separate_consumers(kafka_producer, kafka_topics, connection, transforma
         common.kafka_check_vertex_exists_with_topic_and_payload(cursor, topic, common.SIMPLE_MSG)
 
 
+@pytest.mark.parametrize("transformation", TRANSFORMATIONS_TO_CHECK_PY)
+def test_pipelined(kafka_producer, kafka_topics, connection, transformation):
+    assert len(kafka_topics) > 0
+    cursor = connection.cursor()
+    common.execute_and_fetch_all(
+        cursor,
+        f"CREATE KAFKA STREAM test TOPICS {','.join(kafka_topics)} TRANSFORM {transformation} PIPELINE_DEPTH 2",
+    )
+    stream_info = common.get_stream_info(cursor, "test")
+    assert stream_info[common.TRANSFORMATION_LATENCY] is None
+    assert stream_info[common.EXECUTION_LATENCY] is None
+
+    common.start_stream(cursor, "test")
+    time.sleep(5)
+
+    for topic in kafka_topics:
+        kafka_producer.send(topic, common.SIMPLE_MSG).get(timeout=60)
+
+    for topic in kafka_topics:
+        common.kafka_check_vertex_exists_with_topic_and_payload(cursor, topic, common.SIMPLE_MSG)
+
+    def latencies_are_measured():
+        stream_info = common.get_stream_info(cursor, "test")
+        return (
+            stream_info[common.TRANSFORMATION_LATENCY] is not None and stream_info[common.EXECUTION_LATENCY] is not None
+        )
+
+    assert mg_sleep_and_assert(True, latencies_are_measured)
+
+
+def test_json_to_graph(kafka_producer, kafka_topics, connection):
+    assert len(kafka_topics) > 0
+    cursor = connection.cursor()
+    common.execute_and_fetch_all(
+        cursor,
+        f"CREATE KAFKA STREAM test TOPICS {kafka_topics[0]} TRANSFORM json_to_graph.merge_nodes",
+    )
+    common.start_stream(cursor, "test")
+    time.sleep(5)
+
+    messages = [
+        b'{"$label": "Person", "id": 1, "name": "Alice", "tags": ["a", "b"]}',
+        b'[{"$label": "Person", "id": 2, "name": "Bob"}, {"$label": "Person", "id": 1, "age": 30}]',
+    ]
+    for message in messages:
+        kafka_producer.send(kafka_topics[0], message).get(timeout=60)
+
+    assert common.check_one_result_row(
+        cursor, "MATCH (n:Person {id: 1, name: 'Alice', tags: ['a', 'b'], age: 30}) RETURN n"
+    )
+    assert common.check_one_result_row(cursor, "MATCH (n:Person {id: 2, name: 'Bob'}) RETURN n")
+    assert common.execute_and_fetch_all(cursor, "MATCH (n:Person) RETURN count(n)") == [(2,)]
+    assert common.execute_and_fetch_all(cursor, "MATCH (n:Person) WHERE n.`$label` IS NOT NULL RETURN n") == []
+
+
 def test_start_from_last_committed_offset(kafka_producer, kafka_topics, connection):
     # This test creates a stream, consumes a message to have a committed
     # offset, then destroys the stream. A new message is sent before the
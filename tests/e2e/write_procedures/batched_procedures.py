@@ -0,0 +1,64 @@
+# Copyright 2022 Memgraph Ltd.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+# License, and you may not use this file except in compliance with the Business Source License.
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0, included in the file
+# licenses/APL.txt.
+
+import sys
+
+import mgclient
+import pytest
+from common import execute_and_fetch_all, has_n_result_row
+
+
+def test_records_spanning_multiple_batches(connection):
+    cursor = connection.cursor()
+    result = execute_and_fetch_all(cursor, "CALL read.stream_range(2500) YIELD value RETURN count(value), sum(value)")
+    assert result == [(2500, sum(range(2500)))]
+
+
+def test_limit_stops_the_generator(connection):
+    cursor = connection.cursor()
+    result = execute_and_fetch_all(cursor, "CALL read.stream_range(1000000000) YIELD value RETURN value LIMIT 3")
+    assert result == [(0,), (1,), (2,)]
+
+
+def test_call_per_input_row(connection):
+    cursor = connection.cursor()
+    result = execute_and_fetch_all(
+        cursor, "UNWIND range(1, 3) AS n CALL read.stream_range(n) YIELD value RETURN n, value ORDER BY n, value"
+    )
+    assert result == [(1, 0), (2, 0), (2, 1), (3, 0), (3, 1), (3, 2)]
+
+
+def test_empty_generator(connection):
+    cursor = connection.cursor()
+    assert has_n_result_row(cursor, "CALL read.stream_range(0) YIELD value RETURN value", 0)
+
+
+def test_graph_objects_across_batches(connection):
+    cursor = connection.cursor()
+    execute_and_fetch_all(cursor, "UNWIND range(1, 1500) AS id CREATE (:Node {id: id})")
+    result = execute_and_fetch_all(cursor, "CALL read.stream_vertices() YIELD node RETURN sum(node.id)")
+    assert result == [(sum(range(1, 1501)),)]
+
+
+def test_error_after_some_batches(connection):
+    cursor = connection.cursor()
+    with pytest.raises(mgclient.DatabaseError, match="stream_failing failed"):
+        execute_and_fetch_all(cursor, "CALL read.stream_failing(1500) YIELD value RETURN value")
+
+
+def test_batched_write_procedure(connection):
+    cursor = connection.cursor()
+    execute_and_fetch_all(cursor, "CALL write.stream_create_vertices(1200) YIELD v RETURN count(v)")
+    assert execute_and_fetch_all(cursor, "MATCH (n) RETURN count(n)") == [(1200,)]
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main([__file__, "-rA"]))
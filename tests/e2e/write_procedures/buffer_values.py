@@ -0,0 +1,79 @@
+# Copyright 2022 Memgraph Ltd.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+# License, and you may not use this file except in compliance with the Business Source License.
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0, included in the file
+# licenses/APL.txt.
+
+import math
+import sys
+from concurrent.futures import ThreadPoolExecutor
+
+import mgclient
+import pytest
+from common import connect, execute_and_fetch_all
+
+
+def test_buffers_are_converted_to_lists(connection):
+    cursor = connection.cursor()
+    result = execute_and_fetch_all(cursor, "CALL read.buffer_values(5) YIELD floats, ints RETURN floats, ints")
+    assert result == [([0.0, 0.5, 1.0, 1.5, 2.0], [0, 1, 2, 3, 4])]
+
+
+def test_empty_buffers(connection):
+    cursor = connection.cursor()
+    result = execute_and_fetch_all(cursor, "CALL read.buffer_values(0) YIELD floats, ints RETURN floats, ints")
+    assert result == [([], [])]
+
+
+def test_float_property_column(connection):
+    cursor = connection.cursor()
+    execute_and_fetch_all(cursor, "CREATE (:Node {id: 1, rank: 0.5}), (:Node {id: 2, rank: 3}), (:Node {id: 3})")
+    [(column, ids)] = execute_and_fetch_all(
+        cursor, "CALL read.property_column('rank', false) YIELD column, ids RETURN column, ids"
+    )
+    ranks = dict(zip(ids, column))
+    assert ranks[1] == 0.5
+    assert ranks[2] == 3.0
+    assert math.isnan(ranks[3])
+
+
+def test_int_property_column(connection):
+    cursor = connection.cursor()
+    execute_and_fetch_all(cursor, "CREATE (:Node {id: 1, rank: 7}), (:Node {id: 2})")
+    [(column, ids)] = execute_and_fetch_all(
+        cursor, "CALL read.property_column('rank', true) YIELD column, ids RETURN column, ids"
+    )
+    assert dict(zip(ids, column)) == {1: 7, 2: -1}
+
+
+def test_property_column_of_wrong_type(connection):
+    cursor = connection.cursor()
+    execute_and_fetch_all(cursor, "CREATE (:Node {id: 1, rank: 'high'})")
+    with pytest.raises(mgclient.DatabaseError):
+        execute_and_fetch_all(cursor, "CALL read.property_column('rank', false) YIELD column RETURN column")
+
+
+def test_concurrent_property_columns(connection):
+    cursor = connection.cursor()
+    execute_and_fetch_all(cursor, "UNWIND range(1, 1000) AS id CREATE (:Node {id: id, rank: id})")
+
+    def read_columns():
+        cursor = connect().cursor()
+        for _ in range(10):
+            [(column, ids)] = execute_and_fetch_all(
+                cursor, "CALL read.property_column('rank', true) YIELD column, ids RETURN column, ids"
+            )
+            assert column == ids
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        for future in [executor.submit(read_columns) for _ in range(4)]:
+            future.result()
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main([__file__, "-rA"]))
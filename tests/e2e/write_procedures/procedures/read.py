@@ -9,6 +9,8 @@
 # by the Apache License, Version 2.0, included in the file
 # licenses/APL.txt.
 
+import array
+
 import mgp
 
 
@@ -94,3 +96,37 @@ def log_message(ctx: mgp.ProcCtx, message: str) -> mgp.Record(success=bool):
     except RuntimeError:
         return mgp.Record(success=False)
     return mgp.Record(success=True)
+
+
+@mgp.read_proc
+def stream_range(ctx: mgp.ProcCtx, count: int) -> mgp.Record(value=int):
+    for value in range(count):
+        yield mgp.Record(value=value)
+
+
+@mgp.read_proc
+def stream_vertices(ctx: mgp.ProcCtx) -> mgp.Record(node=mgp.Vertex):
+    for vertex in ctx.graph.vertices:
+        yield mgp.Record(node=vertex)
+
+
+@mgp.read_proc
+def stream_failing(ctx: mgp.ProcCtx, fail_after: int) -> mgp.Record(value=int):
+    for value in range(fail_after):
+        yield mgp.Record(value=value)
+    raise RuntimeError("stream_failing failed")
+
+
+@mgp.read_proc
+def buffer_values(ctx: mgp.ProcCtx, count: int) -> mgp.Record(floats=mgp.List[float], ints=mgp.List[int]):
+    return mgp.Record(floats=array.array("d", [i / 2 for i in range(count)]), ints=array.array("q", range(count)))
+
+
+@mgp.read_proc
+def property_column(
+    ctx: mgp.ProcCtx, property_name: str, as_int: bool
+) -> mgp.Record(column=mgp.List[mgp.Number], ids=mgp.List[int]):
+    graph = ctx.graph
+    column = graph.vertex_property_column(property_name, int if as_int else float, -1 if as_int else None)
+    ids = [graph.get_vertex_by_ordinal(ordinal).properties.get("id") for ordinal in range(len(column))]
+    return mgp.Record(column=column, ids=ids)
@@ -110,3 +110,9 @@ def subgraph_remove_vertex_and_out_edges_get_vertices(
         ctx.graph.delete_edge(edge)
     ctx.graph.delete_vertex(vertex)
     return [mgp.Record(node=vertex) for vertex in ctx.graph.vertices]
+
+
+@mgp.write_proc
+def stream_create_vertices(ctx: mgp.ProcCtx, count: int) -> mgp.Record(v=mgp.Vertex):
+    for _ in range(count):
+        yield mgp.Record(v=ctx.graph.create_vertex())
@@ -476,3 +476,52 @@ class Pokec(Dataset):
             "MATCH (n:User {id: $id})-[e]->(m) " "RETURN m LIMIT 1",
             {"id": self._get_random_vertex()},
         )
+
+    # Graph algorithms, comparing the native `graph_algorithms` query module
+    # with the networkx based Python modules. Memgraph has to be started with
+    # both modules in its query modules directory.
+
+    def benchmark__algorithms__pagerank_native_analytical(self):
+        return ("CALL graph_algorithms.pagerank() YIELD rank RETURN sum(rank)", {})
+
+    def benchmark__algorithms__pagerank_networkx_analytical(self):
+        return ("CALL nxalg.pagerank() YIELD rank RETURN sum(rank)", {})
+
+    def benchmark__algorithms__weakly_connected_components_native_analytical(self):
+        return (
+            "CALL graph_algorithms.weakly_connected_components() YIELD component_id "
+            "RETURN count(DISTINCT component_id)",
+            {},
+        )
+
+    def benchmark__algorithms__weakly_connected_components_networkx_analytical(self):
+        return (
+            "MATCH (n)-[e]->() WITH collect(n) AS nodes, collect(e) AS edges "
+            "CALL wcc.get_components(nodes, edges) YIELD n_components RETURN n_components",
+            {},
+        )
+
+    def benchmark__algorithms__strongly_connected_components_native_analytical(self):
+        return (
+            "CALL graph_algorithms.strongly_connected_components() YIELD component_id "
+            "RETURN count(DISTINCT component_id)",
+            {},
+        )
+
+    def benchmark__algorithms__strongly_connected_components_networkx_analytical(self):
+        return ("CALL nxalg.strongly_connected_components() YIELD components RETURN size(components)", {})
+
+    def benchmark__algorithms__betweenness_centrality_native_analytical(self):
+        return ("CALL graph_algorithms.betweenness_centrality() YIELD betweenness RETURN max(betweenness)", {})
+
+    def benchmark__algorithms__betweenness_centrality_networkx_analytical(self):
+        return ("CALL nxalg.betweenness_centrality() YIELD betweenness RETURN max(betweenness)", {})
+
+    def benchmark__algorithms__louvain_native_analytical(self):
+        return (
+            "CALL graph_algorithms.louvain() YIELD community_id RETURN count(DISTINCT community_id)",
+            {},
+        )
+
+    def benchmark__algorithms__triangle_count_native_analytical(self):
+        return ("CALL graph_algorithms.triangle_count() YIELD triangles RETURN sum(triangles) / 3", {})
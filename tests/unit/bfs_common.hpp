@@ -292,11 +292,13 @@ std::vector<std::vector<int>> CheckPathsAndExtractDistances(
 }
 
 void BfsTest(Database *db, int lower_bound, int upper_bound, memgraph::query::EdgeAtom::Direction direction,
-             std::vector<std::string> edge_types, bool known_sink, FilterLambdaType filter_lambda_type) {
+             std::vector<std::string> edge_types, bool known_sink, FilterLambdaType filter_lambda_type,
+             memgraph::utils::ThreadPool *bfs_worker_pool = nullptr) {
   auto storage_dba = db->Access();
   memgraph::query::DbAccessor dba(&storage_dba);
   memgraph::query::AstStorage storage;
   memgraph::query::ExecutionContext context{&dba};
+  context.bfs_worker_pool = bfs_worker_pool;
   memgraph::query::Symbol blocked_sym = context.symbol_table.CreateSymbol("blocked", true);
   memgraph::query::Symbol source_sym = context.symbol_table.CreateSymbol("source", true);
   memgraph::query::Symbol sink_sym = context.symbol_table.CreateSymbol("sink", true);
@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include "bfs_common.hpp"
+#include "utils/thread_pool.hpp"
 
 using namespace memgraph::query;
 using namespace memgraph::query::plan;
@@ -111,3 +112,36 @@ INSTANTIATE_TEST_CASE_P(FilterLambda, SingleNodeBfsTest,
                                          testing::Values(FilterLambdaType::NONE, FilterLambdaType::USE_FRAME,
                                                          FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
                                                          FilterLambdaType::ERROR)));
+
+// Expansions without a filter lambda are done level by level when BFS workers
+// are enabled.
+class SingleNodeLevelSynchronousBfsTest : public SingleNodeBfsTest {
+ protected:
+  memgraph::utils::ThreadPool worker_pool_{4};
+};
+
+TEST_P(SingleNodeLevelSynchronousBfsTest, All) {
+  int lower_bound;
+  int upper_bound;
+  EdgeAtom::Direction direction;
+  std::vector<std::string> edge_types;
+  bool known_sink;
+  FilterLambdaType filter_lambda_type;
+  std::tie(lower_bound, upper_bound, direction, edge_types, known_sink, filter_lambda_type) = GetParam();
+  BfsTest(db_.get(), lower_bound, upper_bound, direction, edge_types, known_sink, filter_lambda_type, &worker_pool_);
+}
+
+INSTANTIATE_TEST_CASE_P(DirectionAndExpansionDepth, SingleNodeLevelSynchronousBfsTest,
+                        testing::Combine(testing::Range(-1, kVertexCount), testing::Range(-1, kVertexCount),
+                                         testing::Values(EdgeAtom::Direction::OUT, EdgeAtom::Direction::IN,
+                                                         EdgeAtom::Direction::BOTH),
+                                         testing::Values(std::vector<std::string>{}), testing::Values(false),
+                                         testing::Values(FilterLambdaType::NONE)));
+
+INSTANTIATE_TEST_CASE_P(
+    EdgeType, SingleNodeLevelSynchronousBfsTest,
+    testing::Combine(testing::Values(-1), testing::Values(-1),
+                     testing::Values(EdgeAtom::Direction::OUT, EdgeAtom::Direction::IN, EdgeAtom::Direction::BOTH),
+                     testing::Values(std::vector<std::string>{}, std::vector<std::string>{"a"},
+                                     std::vector<std::string>{"b"}, std::vector<std::string>{"a", "b"}),
+                     testing::Values(false), testing::Values(FilterLambdaType::NONE)));
@@ -3645,6 +3645,42 @@ TEST_P(CypherMainVisitorTest, CreateTriggers) {
   }
 }
 
+TEST_P(CypherMainVisitorTest, CreateScopedTriggers) {
+  auto &ast_generator = *GetParam();
+
+  TestInvalidQuery("CREATE TRIGGER trigger ON CREATE : AFTER COMMIT EXECUTE a", ast_generator);
+  TestInvalidQuery("CREATE TRIGGER trigger ON CREATE :Order() AFTER COMMIT EXECUTE a", ast_generator);
+  TestInvalidQuery("CREATE TRIGGER trigger ON UPDATE :Order(status, ) AFTER COMMIT EXECUTE a", ast_generator);
+  TestInvalidQuery("CREATE TRIGGER trigger ON :Order UPDATE AFTER COMMIT EXECUTE a", ast_generator);
+  TestInvalidQuery("CREATE TRIGGER trigger :Order AFTER COMMIT EXECUTE a", ast_generator);
+  TestInvalidQuery<SemanticException>("CREATE TRIGGER trigger ON CREATE :Order(status) AFTER COMMIT EXECUTE a",
+                                      ast_generator);
+  TestInvalidQuery<SemanticException>("CREATE TRIGGER trigger ON --> DELETE :PAYS(amount) AFTER COMMIT EXECUTE a",
+                                      ast_generator);
+
+  static constexpr std::string_view query_template = "CREATE TRIGGER trigger {} AFTER COMMIT EXECUTE a";
+
+  const auto validate_scope = [&](const auto &event_string, const auto event_type, const auto &scope_name,
+                                  const std::vector<std::string> &scope_properties) {
+    SCOPED_TRACE(event_string);
+    ValidateCreateQuery(ast_generator, fmt::format(query_template, event_string), "trigger", event_type, "AFTER",
+                        "a");
+    auto *parsed_query =
+        dynamic_cast<TriggerQuery *>(ast_generator.ParseQuery(fmt::format(query_template, event_string)));
+    EXPECT_EQ(parsed_query->scope_name_, scope_name);
+    EXPECT_EQ(parsed_query->scope_properties_, scope_properties);
+  };
+
+  validate_scope("ON CREATE", memgraph::query::TriggerQuery::EventType::CREATE, "", {});
+  validate_scope("ON CREATE :Order", memgraph::query::TriggerQuery::EventType::VERTEX_CREATE, "Order", {});
+  validate_scope("ON () DELETE :Order", memgraph::query::TriggerQuery::EventType::VERTEX_DELETE, "Order", {});
+  validate_scope("ON --> CREATE :PAYS", memgraph::query::TriggerQuery::EventType::EDGE_CREATE, "PAYS", {});
+  validate_scope("ON UPDATE :Order(status)", memgraph::query::TriggerQuery::EventType::VERTEX_UPDATE, "Order",
+                 {"status"});
+  validate_scope("ON --> UPDATE :PAYS(amount, currency)", memgraph::query::TriggerQuery::EventType::EDGE_UPDATE,
+                 "PAYS", {"amount", "currency"});
+}
+
 namespace {
 void ValidateSetIsolationLevelQuery(Base &ast_generator, const auto &query, const auto scope,
                                     const auto isolation_level) {
@@ -3876,6 +3912,23 @@ TEST_P(CypherMainVisitorTest, CreateKafkaStream) {
       "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform CREDENTIALS { symbolicname : 'string' }",
       ast_generator);
   TestInvalidQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform CREDENTIALS 2", ast_generator);
+  TestInvalidQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform PARALLELISM", ast_generator);
+  TestInvalidQuery<SemanticException>(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform PARALLELISM 'invalid parallelism'", ast_generator);
+  TestInvalidQuery<SemanticException>(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform PARALLELISM 2 PARALLELISM 3", ast_generator);
+  TestInvalidQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform PIPELINE_DEPTH", ast_generator);
+  TestInvalidQuery<SemanticException>(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform PIPELINE_DEPTH 'invalid depth'", ast_generator);
+  TestInvalidQuery<SemanticException>(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform PIPELINE_DEPTH 2 PIPELINE_DEPTH 3", ast_generator);
+  TestInvalidQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform TRANSFORM_CONFIG", ast_generator);
+  TestInvalidQuery(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform TRANSFORM_CONFIG { symbolicname : 'string' }",
+      ast_generator);
+  TestInvalidQuery<SemanticException>(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform TRANSFORM_CONFIG {} TRANSFORM_CONFIG {}",
+      ast_generator);
 
   const std::vector<std::string> topic_names{"topic1_name.with_dot", "topic1_name.with_multiple.dots",
                                              "topic-name.with-multiple.dots-and-dashes"};
@@ -4014,6 +4067,46 @@ TEST_P(CypherMainVisitorTest, CreateKafkaStream) {
   for (const auto &map_to_test : config_maps) {
     EXPECT_NO_FATAL_FAILURE(check_config_map(map_to_test));
   }
+
+  {
+    static constexpr int kParallelism = 4;
+    const auto query_string = fmt::format("CREATE KAFKA STREAM {} TOPICS topic1 PARALLELISM {} TRANSFORM {}",
+                                          kStreamName, kParallelism, kTransformName);
+    SCOPED_TRACE(query_string);
+    StreamQuery *parsed_query{nullptr};
+    ASSERT_NO_THROW(parsed_query = dynamic_cast<StreamQuery *>(ast_generator.ParseQuery(query_string)));
+    ASSERT_NE(parsed_query, nullptr);
+    EXPECT_NO_FATAL_FAILURE(
+        CheckOptionalExpression(ast_generator, parsed_query->parallelism_, TypedValue{kParallelism}));
+    EXPECT_EQ(parsed_query->pipeline_depth_, nullptr);
+  }
+
+  {
+    static constexpr int kPipelineDepth = 2;
+    const auto query_string = fmt::format("CREATE KAFKA STREAM {} TOPICS topic1 TRANSFORM {} PIPELINE_DEPTH {}",
+                                          kStreamName, kTransformName, kPipelineDepth);
+    SCOPED_TRACE(query_string);
+    StreamQuery *parsed_query{nullptr};
+    ASSERT_NO_THROW(parsed_query = dynamic_cast<StreamQuery *>(ast_generator.ParseQuery(query_string)));
+    ASSERT_NE(parsed_query, nullptr);
+    EXPECT_NO_FATAL_FAILURE(
+        CheckOptionalExpression(ast_generator, parsed_query->pipeline_depth_, TypedValue{kPipelineDepth}));
+  }
+
+  {
+    const auto query_string =
+        fmt::format("CREATE KAFKA STREAM {} TOPICS topic1 TRANSFORM {} TRANSFORM_CONFIG {{'id_field': 'key'}}",
+                    kStreamName, kTransformName);
+    SCOPED_TRACE(query_string);
+    StreamQuery *parsed_query{nullptr};
+    ASSERT_NO_THROW(parsed_query = dynamic_cast<StreamQuery *>(ast_generator.ParseQuery(query_string)));
+    ASSERT_NE(parsed_query, nullptr);
+    ASSERT_EQ(parsed_query->transform_config_.size(), 1);
+    const auto &[key, value] = *parsed_query->transform_config_.begin();
+    ast_generator.CheckLiteral(key, "id_field");
+    ast_generator.CheckLiteral(value, "key");
+    EXPECT_TRUE(parsed_query->configs_.empty());
+  }
 }
 
 void ValidateCreatePulsarStreamQuery(Base &ast_generator, const std::string &query_string,
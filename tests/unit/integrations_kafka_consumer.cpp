@@ -9,8 +9,16 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -110,11 +118,38 @@ struct ConsumerTest : public ::testing::Test {
     return consumer;
   }
 
-  void SeedTopicWithInt(const std::string &topic_name, int value) {
+  void SeedTopicWithInt(const std::string &topic_name, int value, int32_t partition = RD_KAFKA_PARTITION_UA) {
     std::array<char, sizeof(int)> int_as_char{};
     std::memcpy(int_as_char.data(), &value, int_as_char.size());
 
-    cluster.SeedTopic(topic_name, int_as_char);
+    cluster.SeedTopic(topic_name, int_as_char, partition);
+  }
+
+  // Reads the committed offsets of the consumer group without joining it.
+  std::vector<int64_t> CommittedOffsets(const std::string &consumer_group, const std::string &topic_name,
+                                        const int32_t partition_count) {
+    std::unique_ptr<RdKafka::Conf> conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+    std::string error;
+    EXPECT_EQ(conf->set("bootstrap.servers", cluster.Bootstraps(), error), RdKafka::Conf::CONF_OK) << error;
+    EXPECT_EQ(conf->set("group.id", consumer_group, error), RdKafka::Conf::CONF_OK) << error;
+    std::unique_ptr<RdKafka::KafkaConsumer> consumer(RdKafka::KafkaConsumer::create(conf.get(), error));
+    if (consumer == nullptr) {
+      ADD_FAILURE() << error;
+      return {};
+    }
+
+    std::vector<RdKafka::TopicPartition *> partitions;
+    for (int32_t partition = 0; partition < partition_count; ++partition) {
+      partitions.push_back(RdKafka::TopicPartition::create(topic_name, partition));
+    }
+    static constexpr int kTimeoutMs{5000};
+    EXPECT_EQ(consumer->committed(partitions, kTimeoutMs), RdKafka::ERR_NO_ERROR);
+    std::vector<int64_t> offsets;
+    std::transform(partitions.begin(), partitions.end(), std::back_inserter(offsets),
+                   [](const auto *partition) { return partition->offset(); });
+    RdKafka::TopicPartition::destroy(partitions);
+    consumer->close();
+    return offsets;
   }
 
   static const std::string kTopicName;
@@ -309,6 +344,253 @@ TEST_F(ConsumerTest, InvalidBatchSize) {
   EXPECT_NO_THROW(Consumer(info, kDummyConsumerFunction));
 }
 
+TEST_F(ConsumerTest, InvalidParallelism) {
+  auto info = CreateDefaultConsumerInfo();
+
+  info.parallelism = 0;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.parallelism = -1;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.parallelism = 2;
+  EXPECT_NO_THROW(Consumer(info, kDummyConsumerFunction));
+}
+
+TEST_F(ConsumerTest, InvalidPipelineDepth) {
+  auto info = CreateDefaultConsumerInfo();
+
+  info.pipeline_depth = -1;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.pipeline_depth = 2;
+  info.parallelism = 2;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.parallelism = 1;
+  EXPECT_NO_THROW(Consumer(info, kDummyConsumerFunction));
+}
+
+TEST_F(ConsumerTest, PipelinedConsumption) {
+  auto info = CreateDefaultConsumerInfo();
+  info.batch_size = 1;
+  info.pipeline_depth = 2;
+  std::atomic<int> last_processed_message{0};
+  std::atomic<bool> processed_in_order{true};
+  const PipelinedConsumerFunction consumer_function = [&](const std::vector<Message> &messages) {
+    EXPECT_EQ(messages.size(), 1);
+    return std::function<void()>{[&, value = SpanToInt(messages.back().Payload())] {
+      // Slow down the second stage, so the first stage of the next batches can run in the meantime.
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      if (last_processed_message.exchange(value) >= value) {
+        processed_in_order = false;
+      }
+    }};
+  };
+
+  Consumer consumer{std::move(info), consumer_function};
+  consumer.Start();
+  ASSERT_TRUE(consumer.IsRunning());
+
+  int sent_messages{1};
+  SeedTopicWithInt(kTopicName, sent_messages);
+  while (last_processed_message.load() == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    SeedTopicWithInt(kTopicName, ++sent_messages);
+  }
+
+  static constexpr auto kMessageCount = 20;
+  for (auto i = 0; i < kMessageCount; ++i) {
+    SeedTopicWithInt(kTopicName, ++sent_messages);
+  }
+  while (last_processed_message.load() != sent_messages) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  consumer.Stop();
+  EXPECT_TRUE(processed_in_order) << "The second stages of the batches weren't run in order";
+}
+
+TEST_F(ConsumerTest, PipelinedConsumptionRewindsFailedBatch) {
+  auto info = CreateDefaultConsumerInfo();
+  info.batch_size = 1;
+  info.pipeline_depth = 2;
+  std::mutex processed_lock;
+  std::vector<int> processed;
+  std::atomic<bool> fail_next{false};
+  std::atomic<int> failed_message{0};
+  const PipelinedConsumerFunction consumer_function = [&](const std::vector<Message> &messages) {
+    EXPECT_EQ(messages.size(), 1);
+    return std::function<void()>{[&, value = SpanToInt(messages.back().Payload())] {
+      if (fail_next.exchange(false)) {
+        failed_message = value;
+        throw std::runtime_error("Second stage failed");
+      }
+      std::lock_guard guard{processed_lock};
+      processed.push_back(value);
+    }};
+  };
+  const auto is_processed = [&](const int value) {
+    std::lock_guard guard{processed_lock};
+    return std::find(processed.begin(), processed.end(), value) != processed.end();
+  };
+  const auto wait_for = [](const auto &condition) {
+    static constexpr auto kMaxWaitTime = std::chrono::seconds(10);
+    const auto start = std::chrono::steady_clock::now();
+    while (!condition() && std::chrono::steady_clock::now() - start < kMaxWaitTime) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return condition();
+  };
+
+  Consumer consumer{std::move(info), consumer_function};
+  consumer.Start();
+  ASSERT_TRUE(consumer.IsRunning());
+
+  int sent_messages{1};
+  SeedTopicWithInt(kTopicName, sent_messages);
+  while (!is_processed(sent_messages)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    SeedTopicWithInt(kTopicName, ++sent_messages);
+  }
+  ASSERT_TRUE(wait_for([&] { return is_processed(sent_messages); }));
+
+  // The consumer stops when the second stage of a batch fails, but the failed batch isn't lost.
+  fail_next = true;
+  static constexpr auto kMessageCount = 5;
+  const auto first_failing_message = sent_messages + 1;
+  for (auto i = 0; i < kMessageCount; ++i) {
+    SeedTopicWithInt(kTopicName, ++sent_messages);
+  }
+  ASSERT_TRUE(wait_for([&] { return !consumer.IsRunning(); }));
+  EXPECT_EQ(failed_message, first_failing_message);
+  EXPECT_FALSE(is_processed(first_failing_message));
+
+  consumer.Start();
+  ASSERT_TRUE(wait_for([&] { return is_processed(sent_messages); }));
+  consumer.Stop();
+
+  std::lock_guard guard{processed_lock};
+  const auto first_retried = std::find(processed.begin(), processed.end(), first_failing_message);
+  ASSERT_NE(first_retried, processed.end());
+  std::vector<int> expected(kMessageCount);
+  std::iota(expected.begin(), expected.end(), first_failing_message);
+  EXPECT_EQ(std::vector<int>(first_retried, processed.end()), expected);
+}
+
+TEST_F(ConsumerTest, ParallelConsumptionCommitsOnlySuccessfulParts) {
+  static const std::string kPartitionedTopicName{"PartitionedTopic"};
+  static constexpr int32_t kPartitionCount{2};
+  static constexpr int32_t kFailingPartition{1};
+  cluster.CreateTopic(kPartitionedTopicName, kPartitionCount);
+
+  auto info = CreateDefaultConsumerInfo();
+  info.topics = {kPartitionedTopicName};
+  info.parallelism = kPartitionCount;
+  // Long enough to receive the messages of both partitions in the same batch.
+  info.batch_interval = std::chrono::milliseconds{1000};
+  const auto consumer_group = info.consumer_group;
+
+  struct ProcessedMessage {
+    int value;
+    int64_t offset;
+  };
+  std::mutex processed_lock;
+  std::map<int32_t, std::vector<ProcessedMessage>> processed;
+  std::atomic<bool> fail{false};
+  std::atomic<int64_t> failed_offset{-1};
+  const auto consumer_function = [&](const std::vector<Message> &messages) {
+    // All messages of a partition are in the same part.
+    const auto partition = messages.front().Partition();
+    for (const auto &message : messages) {
+      EXPECT_EQ(message.Partition(), partition);
+    }
+    if (partition == kFailingPartition && fail) {
+      failed_offset = messages.front().Offset();
+      throw std::runtime_error("Processing the part failed");
+    }
+    std::lock_guard guard{processed_lock};
+    for (const auto &message : messages) {
+      processed[partition].push_back({SpanToInt(message.Payload()), message.Offset()});
+    }
+  };
+  const auto last_processed = [&](const int32_t partition) -> std::optional<ProcessedMessage> {
+    std::lock_guard guard{processed_lock};
+    const auto &messages = processed[partition];
+    if (messages.empty()) return std::nullopt;
+    return messages.back();
+  };
+  const auto wait_for = [](const auto &condition) {
+    static constexpr auto kMaxWaitTime = std::chrono::seconds(10);
+    const auto start = std::chrono::steady_clock::now();
+    while (!condition() && std::chrono::steady_clock::now() - start < kMaxWaitTime) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return condition();
+  };
+
+  Consumer consumer{std::move(info), consumer_function};
+  consumer.Start();
+  ASSERT_TRUE(consumer.IsRunning());
+
+  // Wait until the consumer receives messages from both partitions.
+  int sent_messages{0};
+  const auto seed_partitions = [&] {
+    for (int32_t partition = 0; partition < kPartitionCount; ++partition) {
+      SeedTopicWithInt(kPartitionedTopicName, ++sent_messages, partition);
+    }
+  };
+  seed_partitions();
+  const auto last_sent_is_processed = [&] {
+    for (int32_t partition = 0; partition < kPartitionCount; ++partition) {
+      const auto message = last_processed(partition);
+      if (!message || message->value != sent_messages - kPartitionCount + 1 + partition) return false;
+    }
+    return true;
+  };
+  static constexpr auto kMaxSeedingTime = std::chrono::seconds(30);
+  const auto seeding_start = std::chrono::steady_clock::now();
+  while (!last_sent_is_processed()) {
+    ASSERT_LT(std::chrono::steady_clock::now() - seeding_start, kMaxSeedingTime)
+        << "The consumer didn't receive the messages of both partitions";
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    if (!last_processed(0) || !last_processed(1)) {
+      seed_partitions();
+    }
+  }
+
+  // The part of the failing partition throws, but the other part of the batch is processed and committed.
+  fail = true;
+  seed_partitions();
+  ASSERT_TRUE(wait_for([&] { return !consumer.IsRunning(); }));
+
+  const auto processed_message = last_processed(0);
+  ASSERT_TRUE(processed_message);
+  EXPECT_EQ(processed_message->value, sent_messages - 1);
+  const auto last_successful_message = last_processed(kFailingPartition);
+  ASSERT_TRUE(last_successful_message);
+  EXPECT_EQ(last_successful_message->value, sent_messages - kPartitionCount);
+  EXPECT_EQ(failed_offset, last_successful_message->offset + 1);
+
+  // The offset of the failed partition stays at the first message of the failed part, so it is consumed again.
+  const auto offsets = CommittedOffsets(consumer_group, kPartitionedTopicName, kPartitionCount);
+  ASSERT_EQ(offsets.size(), static_cast<size_t>(kPartitionCount));
+  EXPECT_EQ(offsets[0], processed_message->offset + 1);
+  EXPECT_EQ(offsets[kFailingPartition], failed_offset);
+
+  // Only the messages of the failed part are consumed again.
+  fail = false;
+  consumer.Start();
+  ASSERT_TRUE(wait_for([&] {
+    const auto message = last_processed(kFailingPartition);
+    return message && message->value == sent_messages;
+  }));
+  consumer.Stop();
+  std::lock_guard guard{processed_lock};
+  EXPECT_EQ(processed[0].back().value, sent_messages - 1);
+  EXPECT_EQ(processed[kFailingPartition].back().offset, failed_offset);
+}
+
 TEST_F(ConsumerTest, DISABLED_StartsFromPreviousOffset) {
   static constexpr auto kBatchSize = 1;
   auto info = CreateDefaultConsumerInfo();
@@ -10,8 +10,10 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <filesystem>
+#include <thread>
 
 #include "communication/bolt/v1/value.hpp"
 #include "communication/result_stream_faker.hpp"
@@ -55,6 +57,15 @@ struct InterpreterFaker {
     return std::make_pair(std::move(stream), qid);
   }
 
+  auto PrepareBatch(const std::string &query,
+                    const std::vector<std::map<std::string, memgraph::storage::PropertyValue>> &params_batch) {
+    ResultStreamFaker stream(interpreter_context.db);
+
+    const auto [header, _, qid] = interpreter.PrepareBatch(query, params_batch, nullptr);
+    stream.Header(header);
+    return std::make_pair(std::move(stream), qid);
+  }
+
   void Pull(ResultStreamFaker *stream, std::optional<int> n = {}, std::optional<int> qid = {}) {
     const auto summary = interpreter.Pull(stream, n, qid);
     stream->Summary(summary);
@@ -96,6 +107,11 @@ class InterpreterTest : public ::testing::Test {
     return default_interpreter.Prepare(query, params);
   }
 
+  auto PrepareBatch(const std::string &query,
+                    const std::vector<std::map<std::string, memgraph::storage::PropertyValue>> &params_batch) {
+    return default_interpreter.PrepareBatch(query, params_batch);
+  }
+
   void Pull(ResultStreamFaker *stream, std::optional<int> n = {}, std::optional<int> qid = {}) {
     default_interpreter.Pull(stream, n, qid);
   }
@@ -236,6 +252,64 @@ TEST_F(InterpreterTest, Parameters) {
   }
 }
 
+TEST_F(InterpreterTest, PrepareBatch) {
+  const auto params = [](const int64_t id) {
+    return std::map<std::string, memgraph::storage::PropertyValue>{{"id", memgraph::storage::PropertyValue(id)}};
+  };
+  const std::string query{"MERGE (n:Node {id: $id}) RETURN n.id AS id"};
+
+  // Batches are supported only in explicit transactions.
+  ASSERT_THROW(PrepareBatch(query, {params(1)}), memgraph::query::ExplicitTransactionUsageException);
+
+  Interpret("BEGIN");
+  {
+    auto [stream, qid] = PrepareBatch(query, {params(1), params(2), params(1), params(3)});
+    ASSERT_EQ(stream.GetHeader().size(), 1U);
+    EXPECT_EQ(stream.GetHeader()[0], "id");
+    Pull(&stream, 1, qid);
+    ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+    ASSERT_EQ(stream.GetResults().size(), 1U);
+    Pull(&stream, {}, qid);
+    ASSERT_FALSE(stream.GetSummary().at("has_more").ValueBool());
+    ASSERT_EQ(stream.GetResults().size(), 4U);
+    const std::array expected_ids{1, 2, 1, 3};
+    for (size_t i = 0; i < expected_ids.size(); ++i) {
+      ASSERT_EQ(stream.GetResults()[i][0].ValueInt(), expected_ids[i]);
+    }
+    // Every execution sees the changes of the previous ones, so the repeated id is merged.
+    ASSERT_EQ(stream.GetSummary().at("stats").ValueMap().at("nodes-created").ValueInt(), 3);
+  }
+  // A missing parameter in any of the parameter sets fails the whole batch.
+  ASSERT_THROW(PrepareBatch(query, {params(4), {}}), memgraph::query::UnprovidedParameterError);
+  ASSERT_THROW(PrepareBatch("SHOW INDEX INFO", {{}, {}}), memgraph::query::QueryException);
+  Interpret("ROLLBACK");
+
+  Interpret("BEGIN");
+  {
+    auto [stream, qid] = PrepareBatch("CREATE (n:Node {id: $id})", {params(1), params(2)});
+    Pull(&stream, {}, qid);
+    ASSERT_EQ(stream.GetSummary().at("stats").ValueMap().at("nodes-created").ValueInt(), 2);
+  }
+  {
+    // The cursors are reset between the parameter sets, so no state is carried
+    // over from the previous ones.
+    auto [stream, qid] = PrepareBatch("UNWIND range(1, $id) AS x WITH x ORDER BY x DESC RETURN count(x), max(x)",
+                                      {params(2), params(3), params(1)});
+    Pull(&stream, {}, qid);
+    ASSERT_EQ(stream.GetResults().size(), 3U);
+    const std::array expected_counts{2, 3, 1};
+    for (size_t i = 0; i < expected_counts.size(); ++i) {
+      ASSERT_EQ(stream.GetResults()[i][0].ValueInt(), expected_counts[i]);
+      ASSERT_EQ(stream.GetResults()[i][1].ValueInt(), expected_counts[i]);
+    }
+  }
+  Interpret("COMMIT");
+
+  auto stream = Interpret("MATCH (n:Node) RETURN count(n)");
+  ASSERT_EQ(stream.GetResults().size(), 1U);
+  ASSERT_EQ(stream.GetResults()[0][0].ValueInt(), 2);
+}
+
 // Run CREATE/MATCH/MERGE queries with property map
 TEST_F(InterpreterTest, ParametersAsPropertyMap) {
   {
@@ -1466,6 +1540,54 @@ TEST_F(InterpreterTest, TriggerInfoNotifications) {
   }
 }
 
+// Every trigger sees the transactions in their commit order, even though
+// different triggers are executed by different threads and the transactions
+// are coalesced and wait for the threads to catch up.
+TEST(AfterCommitTriggerPoolTest, PerTriggerOrdering) {
+  static constexpr int kTriggers = 8;
+  static constexpr int kTransactions = 100;
+  const auto data_directory = std::filesystem::temp_directory_path() / "MG_tests_unit_interpreter_triggers";
+  std::filesystem::remove_all(data_directory);
+  {
+    memgraph::storage::Storage db;
+    memgraph::query::InterpreterConfig config{};
+    config.after_commit_trigger_threads = 4;
+    config.after_commit_trigger_max_coalesced_transactions = 4;
+    config.after_commit_trigger_queue_size = 2;
+    InterpreterFaker interpreter{&db, config, data_directory};
+
+    for (int i = 0; i < kTriggers; ++i) {
+      interpreter.Interpret(
+          fmt::format("CREATE TRIGGER trigger{0} ON () CREATE AFTER COMMIT EXECUTE UNWIND createdVertices AS v "
+                      "WITH v WHERE v:Event CREATE (:Log {{trigger: {0}, seq: v.seq}})",
+                      i));
+    }
+    for (int i = 0; i < kTransactions; ++i) {
+      interpreter.Interpret("CREATE (:Event {seq: $seq})", {{"seq", memgraph::storage::PropertyValue(i)}});
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (true) {
+      auto stream = interpreter.Interpret("MATCH (l:Log) RETURN count(l)");
+      if (stream.GetResults()[0][0].ValueInt() == kTriggers * kTransactions) {
+        break;
+      }
+      ASSERT_LT(std::chrono::steady_clock::now(), deadline) << "The triggers weren't executed in time";
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    for (int i = 0; i < kTriggers; ++i) {
+      auto stream = interpreter.Interpret("MATCH (l:Log {trigger: $trigger}) RETURN l.seq ORDER BY id(l)",
+                                          {{"trigger", memgraph::storage::PropertyValue(i)}});
+      ASSERT_EQ(stream.GetResults().size(), kTransactions);
+      for (int seq = 0; seq < kTransactions; ++seq) {
+        ASSERT_EQ(stream.GetResults()[seq][0].ValueInt(), seq) << "trigger" << i;
+      }
+    }
+  }
+  std::filesystem::remove_all(data_directory);
+}
+
 TEST_F(InterpreterTest, LoadCsvClauseNotification) {
   auto dir_manager = TmpDirManager("csv_directory");
   const auto csv_path = dir_manager.Path() / "file.csv";
@@ -68,8 +68,7 @@ KafkaClusterMock::KafkaClusterMock(const std::vector<std::string> &topics) {
 
 std::string KafkaClusterMock::Bootstraps() const { return rd_kafka_mock_cluster_bootstraps(cluster_.get()); };
 
-void KafkaClusterMock::CreateTopic(const std::string &topic_name) {
-  static constexpr auto partition_count = 1;
+void KafkaClusterMock::CreateTopic(const std::string &topic_name, const int partition_count) {
   static constexpr auto replication_factor = 1;
   rd_kafka_resp_err_t topic_err =
       rd_kafka_mock_topic_create(cluster_.get(), topic_name.c_str(), partition_count, replication_factor);
@@ -78,11 +77,12 @@ void KafkaClusterMock::CreateTopic(const std::string &topic_name) {
   }
 }
 
-void KafkaClusterMock::SeedTopic(const std::string &topic_name, std::string_view message) {
-  SeedTopic(topic_name, std::span{message.data(), message.size()});
+void KafkaClusterMock::SeedTopic(const std::string &topic_name, std::string_view message, const int32_t partition) {
+  SeedTopic(topic_name, std::span{message.data(), message.size()}, partition);
 }
 
-void KafkaClusterMock::SeedTopic(const std::string &topic_name, std::span<const char> message) {
+void KafkaClusterMock::SeedTopic(const std::string &topic_name, std::span<const char> message,
+                                 const int32_t partition) {
   char errstr[256] = {'\0'};
   std::string bootstraps_servers = Bootstraps();
 
@@ -111,9 +111,8 @@ void KafkaClusterMock::SeedTopic(const std::string &topic_name, std::span<const
   }
 
   int remains = 1;
-  if (rd_kafka_produce(rkt, RD_KAFKA_PARTITION_UA, RD_KAFKA_MSG_F_COPY,
-                       static_cast<void *>(const_cast<char *>(message.data())), message.size(), nullptr, 0,
-                       &remains) == -1) {
+  if (rd_kafka_produce(rkt, partition, RD_KAFKA_MSG_F_COPY, static_cast<void *>(const_cast<char *>(message.data())),
+                       message.size(), nullptr, 0, &remains) == -1) {
     throw std::runtime_error("Failed to produce a message on " + topic_name + " to seed it");
   }
 
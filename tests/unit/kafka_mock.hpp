@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <span>
 #include <string>
@@ -39,9 +40,10 @@ class KafkaClusterMock {
   explicit KafkaClusterMock(const std::vector<std::string> &topics);
 
   std::string Bootstraps() const;
-  void CreateTopic(const std::string &topic_name);
-  void SeedTopic(const std::string &topic_name, std::span<const char> message);
-  void SeedTopic(const std::string &topic_name, std::string_view message);
+  void CreateTopic(const std::string &topic_name, int partition_count = 1);
+  void SeedTopic(const std::string &topic_name, std::span<const char> message,
+                 int32_t partition = RD_KAFKA_PARTITION_UA);
+  void SeedTopic(const std::string &topic_name, std::string_view message, int32_t partition = RD_KAFKA_PARTITION_UA);
 
  private:
   RdKafkaUniquePtr rk_{nullptr};
@@ -1040,6 +1040,88 @@ TEST_F(ExpressionEvaluatorPropertyLookup, Vertex) {
   EXPECT_TRUE(Value(prop_height).IsNull());
 }
 
+TEST_F(ExpressionEvaluatorPropertyLookup, VertexPrefetch) {
+  auto v1 = dba.InsertVertex();
+  ASSERT_TRUE(v1.SetProperty(prop_age.second, memgraph::storage::PropertyValue(10)).HasValue());
+  ASSERT_TRUE(v1.SetProperty(prop_height.second, memgraph::storage::PropertyValue(20)).HasValue());
+  dba.AdvanceCommand();
+  frame[symbol] = TypedValue(v1);
+
+  auto *age = storage.Create<PropertyLookup>(identifier, storage.GetPropertyIx(prop_age.first));
+  auto *height = storage.Create<PropertyLookup>(identifier, storage.GetPropertyIx(prop_height.first));
+  PropertyPrefetch prefetch({age, storage.Create<AdditionOperator>(height, age)}, symbol_table);
+  ASSERT_FALSE(prefetch.empty());
+  ctx.properties = NamesToProperties(storage.properties_, &dba);
+  prefetch.Fetch(frame, ctx, memgraph::storage::View::OLD);
+  eval.SetPropertyPrefetch(&prefetch);
+
+  // Changes made after the fetch aren't seen, which shows the fetched values
+  // are used.
+  ASSERT_TRUE(v1.SetProperty(prop_age.second, memgraph::storage::PropertyValue(11)).HasValue());
+  dba.AdvanceCommand();
+  EXPECT_EQ(Value(prop_age).ValueInt(), 10);
+  EXPECT_EQ(Value(prop_height).ValueInt(), 20);
+
+  // A different vertex bound to the symbol is looked up on its own.
+  auto v2 = dba.InsertVertex();
+  ASSERT_TRUE(v2.SetProperty(prop_age.second, memgraph::storage::PropertyValue(30)).HasValue());
+  dba.AdvanceCommand();
+  frame[symbol] = TypedValue(v2);
+  EXPECT_EQ(Value(prop_age).ValueInt(), 30);
+  EXPECT_TRUE(Value(prop_height).IsNull());
+
+  // A single property of a symbol isn't prefetched.
+  EXPECT_TRUE(PropertyPrefetch({age, age}, symbol_table).empty());
+}
+
+TEST(ExpressionEvaluatorDictionary, EqualToEncodedString) {
+  memgraph::storage::Config config;
+  config.dictionary.properties = {"status"};
+  memgraph::storage::Storage db{config};
+  auto storage_dba = db.Access();
+  DbAccessor dba{&storage_dba};
+  const auto status = dba.NameToProperty("status");
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+  Frame frame{1};
+  EvaluationContext ctx;
+  ExpressionEvaluator eval{&frame, symbol_table, ctx, &dba, memgraph::storage::View::OLD};
+  auto *identifier = storage.Create<Identifier>("n");
+  const auto symbol = symbol_table.CreateSymbol("n", true);
+  identifier->MapTo(symbol);
+  auto *lookup = storage.Create<PropertyLookup>(identifier, storage.GetPropertyIx("status"));
+  ctx.properties = NamesToProperties(storage.properties_, &dba);
+  const auto equal = [&](const TypedValue &value, const char *text) {
+    frame[symbol] = value;
+    auto lhs = storage.Create<EqualOperator>(lookup, storage.Create<PrimitiveLiteral>(text));
+    auto rhs = storage.Create<EqualOperator>(storage.Create<PrimitiveLiteral>(text), lookup);
+    auto result = lhs->Accept(eval);
+    EXPECT_TRUE(TypedValue::BoolEqual{}(result, rhs->Accept(eval))) << text;
+    return result;
+  };
+
+  auto active = dba.InsertVertex();
+  ASSERT_TRUE(active.SetProperty(status, memgraph::storage::PropertyValue("active")).HasValue());
+  auto number = dba.InsertVertex();
+  ASSERT_TRUE(number.SetProperty(status, memgraph::storage::PropertyValue(5)).HasValue());
+  auto missing = dba.InsertVertex();
+  dba.AdvanceCommand();
+
+  EXPECT_TRUE(equal(TypedValue(active), "active").ValueBool());
+  EXPECT_FALSE(equal(TypedValue(active), "inactive").ValueBool());
+  EXPECT_FALSE(equal(TypedValue(active), "never stored").ValueBool());
+  EXPECT_FALSE(equal(TypedValue(number), "5").ValueBool());
+  EXPECT_TRUE(equal(TypedValue(missing), "active").IsNull());
+
+  // The compared version is the one seen by the evaluator.
+  ASSERT_TRUE(active.SetProperty(status, memgraph::storage::PropertyValue("inactive")).HasValue());
+  EXPECT_TRUE(equal(TypedValue(active), "active").ValueBool());
+  dba.AdvanceCommand();
+  EXPECT_FALSE(equal(TypedValue(active), "active").ValueBool());
+  EXPECT_TRUE(equal(TypedValue(active), "inactive").ValueBool());
+}
+
 TEST_F(ExpressionEvaluatorPropertyLookup, Duration) {
   const memgraph::utils::Duration dur({10, 1, 30, 2, 22, 45});
   frame[symbol] = TypedValue(dur);
@@ -0,0 +1,207 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "integrations/kafka/consumer.hpp"
+#include "mg_procedure.h"
+#include "query/procedure/mg_procedure_impl.hpp"
+#include "utils/memory.hpp"
+
+// Entry point of the JSON transformations module, which is linked into the test.
+extern "C" int mgp_init_module(struct mgp_module *module, struct mgp_memory *memory);
+
+namespace {
+
+constexpr std::string_view kTopicName{"Topic"};
+
+/// Kafka message with the given payload, see the mocked message in
+/// mgp_kafka_c_api.cpp. Only the members read through c_ptr() are set.
+class MockedRdKafkaMessage : public RdKafka::Message {
+ public:
+  explicit MockedRdKafkaMessage(std::string payload) : payload_(std::move(payload)) {
+    message_.err = rd_kafka_resp_err_t::RD_KAFKA_RESP_ERR__BEGIN;
+    message_.key = nullptr;
+    message_.key_len = 0;
+    message_.offset = 0;
+    message_.payload = static_cast<void *>(payload_.data());
+    message_.len = payload_.size();
+    rd_kafka_ = rd_kafka_new(rd_kafka_type_t::RD_KAFKA_CONSUMER, nullptr, nullptr, 0);
+    message_.rkt = rd_kafka_topic_new(rd_kafka_, kTopicName.data(), nullptr);
+  }
+
+  ~MockedRdKafkaMessage() override {
+    rd_kafka_destroy(rd_kafka_);
+    rd_kafka_topic_destroy(message_.rkt);
+  }
+
+  rd_kafka_message_s *c_ptr() override { return &message_; }
+
+  RdKafka::ErrorCode err() const override { return RdKafka::ErrorCode::ERR_NO_ERROR; }
+
+  [[noreturn]] std::string errstr() const override { ThrowIllegalCallError(); }
+  [[noreturn]] RdKafka::Topic *topic() const override { ThrowIllegalCallError(); }
+  [[noreturn]] std::string topic_name() const override { ThrowIllegalCallError(); }
+  [[noreturn]] int32_t partition() const override { ThrowIllegalCallError(); }
+  [[noreturn]] void *payload() const override { ThrowIllegalCallError(); }
+  [[noreturn]] size_t len() const override { ThrowIllegalCallError(); }
+  [[noreturn]] const std::string *key() const override { ThrowIllegalCallError(); }
+  [[noreturn]] const void *key_pointer() const override { ThrowIllegalCallError(); }
+  [[noreturn]] size_t key_len() const override { ThrowIllegalCallError(); }
+  [[noreturn]] int64_t offset() const override { ThrowIllegalCallError(); }
+  [[noreturn]] RdKafka::MessageTimestamp timestamp() const override { ThrowIllegalCallError(); }
+  [[noreturn]] void *msg_opaque() const override { ThrowIllegalCallError(); }
+  [[noreturn]] int64_t latency() const override { ThrowIllegalCallError(); }
+  [[noreturn]] Status status() const override { ThrowIllegalCallError(); }
+  [[noreturn]] RdKafka::Headers *headers() override { ThrowIllegalCallError(); }
+  [[noreturn]] RdKafka::Headers *headers(RdKafka::ErrorCode * /*err*/) override { ThrowIllegalCallError(); }
+  [[noreturn]] int32_t broker_id() const override { ThrowIllegalCallError(); }
+
+ private:
+  [[noreturn]] void ThrowIllegalCallError() const {
+    throw std::logic_error("This function should not have been called");
+  }
+
+  std::string payload_;
+  rd_kafka_t *rd_kafka_;
+  rd_kafka_message_s message_{};
+};
+
+}  // namespace
+
+class JsonToGraphTest : public ::testing::Test {
+ protected:
+  JsonToGraphTest() { EXPECT_EQ(mgp_init_module(&module_, &memory_), 0); }
+
+  /// Runs the transformation on messages with the given payloads. The error of
+  /// the transformation, if any, is left in the result.
+  void Transform(const char *transformation, const std::vector<std::string> &payloads, mgp_result &result,
+                 const std::unordered_map<std::string, std::string> &config = {}) {
+    std::vector<memgraph::integrations::kafka::Message> kafka_messages;
+    kafka_messages.reserve(payloads.size());
+    for (const auto &payload : payloads) {
+      kafka_messages.emplace_back(std::make_unique<MockedRdKafkaMessage>(payload));
+    }
+    mgp_messages messages{mgp_messages::storage_type{memgraph::utils::NewDeleteResource()}};
+    std::transform(kafka_messages.begin(), kafka_messages.end(), std::back_inserter(messages.messages),
+                   [](const auto &message) { return mgp_message{message}; });
+    for (const auto &[key, value] : config) {
+      messages.transformation_config.items.emplace(key.c_str(),
+                                                    mgp_value(value.c_str(), memgraph::utils::NewDeleteResource()));
+    }
+
+    const auto &trans = module_.transformations.at(transformation);
+    result.signature = &trans.results;
+    trans.cb(&messages, nullptr, &result, &memory_);
+  }
+
+  static std::string_view Query(const mgp_result &result, size_t row) {
+    return result.rows[row].values.at("query").ValueString();
+  }
+
+  static const auto &Nodes(const mgp_result &result, size_t row) {
+    return result.rows[row].values.at("parameters").ValueMap().at("nodes").ValueList();
+  }
+
+  mgp_memory memory_{memgraph::utils::NewDeleteResource()};
+  mgp_module module_{memgraph::utils::NewDeleteResource()};
+};
+
+TEST_F(JsonToGraphTest, GroupsNodesByLabel) {
+  mgp_result result{nullptr, memgraph::utils::NewDeleteResource()};
+  Transform("create_nodes", {R"({"$label": "Person", "name": "Alice"})", R"([{"name": "Bob"}, {"name": "Carol"}])"},
+            result);
+  ASSERT_FALSE(result.error_msg);
+  ASSERT_EQ(result.rows.size(), 2);
+  // The labels are sorted, and nodes without one are labeled with the topic.
+  EXPECT_EQ(Query(result, 0), "UNWIND $nodes AS properties CREATE (n:`Person`) SET n += properties");
+  ASSERT_EQ(Nodes(result, 0).size(), 1);
+  EXPECT_EQ(Nodes(result, 0)[0].ValueMap().at("name").ValueString(), "Alice");
+  EXPECT_FALSE(Nodes(result, 0)[0].ValueMap().contains("$label"));
+  EXPECT_EQ(Query(result, 1), "UNWIND $nodes AS properties CREATE (n:`Topic`) SET n += properties");
+  EXPECT_EQ(Nodes(result, 1).size(), 2);
+}
+
+TEST_F(JsonToGraphTest, NonObjectPayloads) {
+  for (const auto *payload : {"1", R"("node")", "null", "[1, 2]", R"([{"name": "Alice"}, "Bob"])"}) {
+    mgp_result result{nullptr, memgraph::utils::NewDeleteResource()};
+    Transform("create_nodes", {payload}, result);
+    ASSERT_TRUE(result.error_msg) << payload;
+    EXPECT_EQ(*result.error_msg, "Every node must be represented by a JSON object") << payload;
+    EXPECT_TRUE(result.rows.empty()) << payload;
+  }
+
+  mgp_result result{nullptr, memgraph::utils::NewDeleteResource()};
+  Transform("create_nodes", {"{"}, result);
+  ASSERT_TRUE(result.error_msg);
+  EXPECT_TRUE(result.error_msg->starts_with("Invalid JSON message"));
+}
+
+TEST_F(JsonToGraphTest, MissingId) {
+  {
+    mgp_result result{nullptr, memgraph::utils::NewDeleteResource()};
+    Transform("merge_nodes", {R"({"id": 1})", R"({"name": "Alice"})"}, result);
+    ASSERT_TRUE(result.error_msg);
+    EXPECT_EQ(*result.error_msg, "Every merged node must have the id field 'id'");
+    EXPECT_TRUE(result.rows.empty());
+  }
+  {
+    // Created nodes don't need an id.
+    mgp_result result{nullptr, memgraph::utils::NewDeleteResource()};
+    Transform("create_nodes", {R"({"name": "Alice"})"}, result);
+    EXPECT_FALSE(result.error_msg);
+    EXPECT_EQ(result.rows.size(), 1);
+  }
+}
+
+TEST_F(JsonToGraphTest, BacktickEscaping) {
+  mgp_result result{nullptr, memgraph::utils::NewDeleteResource()};
+  Transform("merge_nodes", {R"({"$label": "We`ird`", "my`id": 1})"}, result, {{"id_field", "my`id"}});
+  ASSERT_FALSE(result.error_msg);
+  ASSERT_EQ(result.rows.size(), 1);
+  EXPECT_EQ(Query(result, 0),
+            "UNWIND $nodes AS properties MERGE (n:`We``ird``` {`my``id`: properties.`my``id`}) SET n += properties");
+}
+
+TEST_F(JsonToGraphTest, FieldMapping) {
+  mgp_result result{nullptr, memgraph::utils::NewDeleteResource()};
+  Transform("merge_nodes", {R"({"type": "Person", "key": 7, "full_name": "Alice", "$label": "kept"})"}, result,
+            {{"label_field", "type"}, {"id_field", "key"}, {"property.key", "uuid"}, {"property.full_name", "name"}});
+  ASSERT_FALSE(result.error_msg);
+  ASSERT_EQ(result.rows.size(), 1);
+  EXPECT_EQ(Query(result, 0),
+            "UNWIND $nodes AS properties MERGE (n:`Person` {`uuid`: properties.`uuid`}) SET n += properties");
+  ASSERT_EQ(Nodes(result, 0).size(), 1);
+  const auto &properties = Nodes(result, 0)[0].ValueMap();
+  EXPECT_EQ(properties.size(), 3);
+  EXPECT_EQ(properties.at("uuid").ValueInt(), 7);
+  EXPECT_EQ(properties.at("name").ValueString(), "Alice");
+  // The default label field is an ordinary field once another one is used.
+  EXPECT_EQ(properties.at("$label").ValueString(), "kept");
+}
+
+TEST_F(JsonToGraphTest, InvalidFieldMapping) {
+  for (const auto &[key, value] :
+       std::vector<std::pair<std::string, std::string>>{{"labels", "type"}, {"id_field", ""}}) {
+    mgp_result result{nullptr, memgraph::utils::NewDeleteResource()};
+    Transform("create_nodes", {R"({"name": "Alice"})"}, result, {{key, value}});
+    EXPECT_TRUE(result.error_msg) << key;
+    EXPECT_TRUE(result.rows.empty()) << key;
+  }
+}
@@ -10,8 +10,11 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <array>
+#include <filesystem>
 #include <iterator>
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "gmock/gmock.h"
@@ -21,6 +24,8 @@
 #include "query/exceptions.hpp"
 #include "query/plan/operator.hpp"
 #include "query_plan_common.hpp"
+#include "utils/file.hpp"
+#include "utils/thread_pool.hpp"
 
 using namespace memgraph::query;
 using namespace memgraph::query::plan;
@@ -350,6 +355,187 @@ TEST(QueryPlan, AggregateGroupByValues) {
                                   TypedValue::BoolEqual{}));
 }
 
+TEST(QueryPlan, AggregateGroupBySingleKey) {
+  // Groups keyed by integers, strings and nulls are kept in the open
+  // addressing table. A double key moves them all to the generic map, where
+  // 3.0 falls into the same group as 3. Both aggregating on the query thread
+  // and on the workers must produce the same groups.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  auto prop = dba.NameToProperty("prop");
+  auto value = dba.NameToProperty("value");
+  const int kGroups = 50;
+  const int kVertexCount = 20000;
+  for (int i = 0; i < kVertexCount; ++i) {
+    auto vertex = dba.InsertVertex();
+    const auto group = i % kGroups;
+    if (group % 5 == 1) {
+      ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(std::to_string(group))).HasValue());
+    } else if (group != 0) {
+      ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(group)).HasValue());
+    }
+    ASSERT_TRUE(vertex.SetProperty(value, memgraph::storage::PropertyValue(1)).HasValue());
+  }
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), prop);
+  auto n_v = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), value);
+  auto produce = MakeAggregationProduce(n.op_, symbol_table, storage, {nullptr, n_v},
+                                        {Aggregation::Op::COUNT, Aggregation::Op::SUM}, {n_p}, {}, false);
+
+  memgraph::utils::ThreadPool worker_pool(4);
+  const std::array<memgraph::utils::ThreadPool *, 2> pools{nullptr, &worker_pool};
+  auto check = [&](int expected_groups, memgraph::utils::ThreadPool *pool) {
+    auto context = MakeContext(storage, symbol_table, &dba);
+    context.aggregation_worker_pool = pool;
+    auto results = CollectProduce(*produce, &context);
+    ASSERT_EQ(results.size(), static_cast<size_t>(expected_groups));
+    int64_t total = 0;
+    for (const auto &row : results) {
+      ASSERT_EQ(row.size(), 3);
+      EXPECT_EQ(row[0].ValueInt(), row[1].ValueInt());
+      total += row[0].ValueInt();
+    }
+    EXPECT_EQ(total, kVertexCount);
+  };
+
+  for (auto *pool : pools) {
+    dba.AdvanceCommand();
+    check(kGroups, pool);
+  }
+
+  ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(3.0)).HasValue());
+  ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(3.5)).HasValue());
+  for (auto *pool : pools) {
+    dba.AdvanceCommand();
+    auto context = MakeContext(storage, symbol_table, &dba);
+    context.aggregation_worker_pool = pool;
+    auto results = CollectProduce(*produce, &context);
+    ASSERT_EQ(results.size(), static_cast<size_t>(kGroups + 1));
+    for (const auto &row : results) {
+      if (TypedValue::BoolEqual{}(row[2], TypedValue(3))) {
+        EXPECT_EQ(row[0].ValueInt(), kVertexCount / kGroups + 1);
+      }
+    }
+  }
+
+  // The groups aggregated on the workers are counted against the query
+  // memory limit, and the groups that don't fit in it are spilled.
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_test_unit_query_plan_aggregate_workers";
+  memgraph::utils::DeleteDir(spill_directory);
+  dba.AdvanceCommand();
+  auto context = MakeContext(storage, symbol_table, &dba);
+  context.aggregation_worker_pool = &worker_pool;
+  memgraph::utils::MemoryLimit memory_limit(1024);
+  context.memory_limit = &memory_limit;
+  context.spill_directory = spill_directory;
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), static_cast<size_t>(kGroups + 1));
+  int64_t total = 0;
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 3);
+    total += row[0].ValueInt();
+  }
+  EXPECT_EQ(total, kVertexCount + 2);
+  EXPECT_EQ(memory_limit.GetAllocatedBytes(), 0);
+  memgraph::utils::DeleteDir(spill_directory);
+}
+
+TEST(QueryPlan, AggregateSpilled) {
+  // With a tiny spill memory limit most groups are aggregated from the
+  // spilled partitions, which must still produce every group exactly once.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  auto prop = dba.NameToProperty("prop");
+  const int kGroups = 500;
+  const int kVertexCount = 2000;
+  for (int i = 0; i < kVertexCount; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(i % kGroups)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), prop);
+  auto produce = MakeAggregationProduce(n.op_, symbol_table, storage, {nullptr, IDENT("n")->MapTo(n.sym_)},
+                                        {Aggregation::Op::COUNT, Aggregation::Op::COLLECT_LIST}, {n_p}, {}, false);
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_test_unit_query_plan_aggregate_spill";
+  memgraph::utils::DeleteDir(spill_directory);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  memgraph::utils::MemoryLimit memory_limit(4096);
+  context.memory_limit = &memory_limit;
+  context.spill_directory = spill_directory;
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), kGroups);
+  std::set<int64_t> groups;
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 3);
+    EXPECT_EQ(row[0].ValueInt(), kVertexCount / kGroups);
+    ASSERT_EQ(row[1].ValueList().size(), kVertexCount / kGroups);
+    for (const auto &vertex : row[1].ValueList()) {
+      EXPECT_EQ(vertex.ValueVertex().GetProperty(memgraph::storage::View::OLD, prop)->ValueInt(), row[2].ValueInt());
+    }
+    groups.insert(row[2].ValueInt());
+  }
+  EXPECT_EQ(groups.size(), kGroups);
+  // spill files are removed with the cursor
+  EXPECT_TRUE(!std::filesystem::exists(spill_directory) || std::filesystem::is_empty(spill_directory));
+  memgraph::utils::DeleteDir(spill_directory);
+}
+
+TEST(QueryPlan, AggregatePropertyColumn) {
+  // Aggregations of a property over all vertices with a label are computed
+  // from the property column and must match the aggregation of the scan.
+  memgraph::storage::Storage db;
+  const auto label = db.NameToLabel("Sensor");
+  const auto prop = db.NameToProperty("value");
+  ASSERT_FALSE(db.CreateIndex(label).HasError());
+  ASSERT_TRUE(db.CreatePropertyColumn(label, prop));
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+
+  for (int i = 0; i < 100; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  auto with_double = dba.InsertVertex();
+  ASSERT_TRUE(with_double.AddLabel(label).HasValue());
+  ASSERT_TRUE(with_double.SetProperty(prop, memgraph::storage::PropertyValue(0.5)).HasValue());
+  ASSERT_TRUE(dba.InsertVertex().AddLabel(label).HasValue());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(1000)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  AstStorage storage;
+  SymbolTable symbol_table;
+  auto n = MakeScanAllByLabel(storage, symbol_table, "n", label);
+  auto n_p = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), prop);
+  auto produce = MakeAggregationProduce(n.op_, symbol_table, storage, {nullptr, n_p, n_p, n_p, n_p, n_p},
+                                        {Aggregation::Op::COUNT, Aggregation::Op::COUNT, Aggregation::Op::SUM,
+                                         Aggregation::Op::AVG, Aggregation::Op::MIN, Aggregation::Op::MAX},
+                                        {}, {}, false);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 1);
+  ASSERT_EQ(results[0].size(), 6);
+  EXPECT_EQ(results[0][0].ValueInt(), 102);
+  EXPECT_EQ(results[0][1].ValueInt(), 101);
+  EXPECT_DOUBLE_EQ(results[0][2].ValueDouble(), 4950.5);
+  EXPECT_DOUBLE_EQ(results[0][3].ValueDouble(), 4950.5 / 101);
+  EXPECT_EQ(results[0][4].ValueInt(), 0);
+  EXPECT_EQ(results[0][5].ValueInt(), 99);
+}
+
 TEST(QueryPlan, AggregateMultipleGroupBy) {
   // in this test we have 3 different properties that have different values
   // for different records and assert that we get the correct combination
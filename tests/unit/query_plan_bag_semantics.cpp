@@ -15,6 +15,7 @@
 //
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <memory>
 #include <vector>
@@ -24,9 +25,12 @@
 
 #include "query/context.hpp"
 #include "query/exceptions.hpp"
+#include "query/graph.hpp"
 #include "query/plan/operator.hpp"
+#include "query/plan/spill.hpp"
 
 #include "query_plan_common.hpp"
+#include "utils/file.hpp"
 
 using namespace memgraph::query;
 using namespace memgraph::query::plan;
@@ -246,6 +250,124 @@ TEST(QueryPlan, OrderByMultiple) {
   }
 }
 
+TEST(QueryPlan, OrderBySpilled) {
+  // With a tiny spill memory limit the input is sorted in many runs on disk,
+  // which are merged back in order.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  auto prop = dba.NameToProperty("prop");
+  const int kVertexCount = 1000;
+  std::vector<int> values;
+  for (int i = 0; i < kVertexCount; ++i) values.push_back(i);
+  std::random_shuffle(values.begin(), values.end());
+  for (auto value : values) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(value)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  auto n = MakeScanAll(storage, symbol_table, "n");
+  auto n_p = PROPERTY_LOOKUP(IDENT("n")->MapTo(n.sym_), prop);
+  auto order_by = std::make_shared<plan::OrderBy>(n.op_, std::vector<SortItem>{{Ordering::DESC, n_p}},
+                                                  std::vector<Symbol>{n.sym_});
+  auto n_ne = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("named_n", true));
+  auto n_p_ne = NEXPR("n.p", n_p)->MapTo(symbol_table.CreateSymbol("n.p", true));
+  auto produce = MakeProduce(order_by, n_ne, n_p_ne);
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_test_unit_query_plan_order_by_spill";
+  memgraph::utils::DeleteDir(spill_directory);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  memgraph::utils::MemoryLimit memory_limit(4096);
+  context.memory_limit = &memory_limit;
+  context.spill_directory = spill_directory;
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), kVertexCount);
+  for (int j = 0; j < kVertexCount; ++j) {
+    EXPECT_EQ(results[j][1].ValueInt(), kVertexCount - 1 - j);
+    EXPECT_EQ(results[j][0].ValueVertex().GetProperty(memgraph::storage::View::OLD, prop)->ValueInt(),
+              kVertexCount - 1 - j);
+  }
+  EXPECT_TRUE(!std::filesystem::exists(spill_directory) || std::filesystem::is_empty(spill_directory));
+  memgraph::utils::DeleteDir(spill_directory);
+}
+
+TEST(QueryPlan, DistinctSpilled) {
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+  AstStorage storage;
+  SymbolTable symbol_table;
+
+  // UNWIND [0, 1, ..., 499, 0, 1, ..., 499, ...] AS x RETURN DISTINCT x
+  const int kDistinct = 500;
+  std::vector<memgraph::storage::PropertyValue> list;
+  for (int i = 0; i < 4 * kDistinct; ++i) list.emplace_back(i % kDistinct);
+  auto x = symbol_table.CreateSymbol("x", true);
+  auto unwind = std::make_shared<plan::Unwind>(nullptr, storage.Create<PrimitiveLiteral>(list), x);
+  auto x_ne = NEXPR("x", IDENT("x")->MapTo(x))->MapTo(symbol_table.CreateSymbol("x_ne", true));
+  auto produce = MakeProduce(unwind, x_ne);
+  auto distinct = std::make_shared<plan::Distinct>(produce, std::vector<Symbol>{symbol_table.at(*x_ne)});
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_test_unit_query_plan_distinct_spill";
+  memgraph::utils::DeleteDir(spill_directory);
+  auto context = MakeContext(storage, symbol_table, &dba);
+  // The memory the rest of the query allocated under the limit leaves only
+  // 1 KiB for the rows seen by the distinct.
+  memgraph::utils::MemoryLimit memory_limit(1024 * 1024);
+  ASSERT_TRUE(memory_limit.Take(1024 * 1024 - 1024));
+  context.memory_limit = &memory_limit;
+  context.spill_directory = spill_directory;
+  Frame frame(symbol_table.max_position());
+  auto cursor = distinct->MakeCursor(memgraph::utils::NewDeleteResource());
+  std::vector<int64_t> results;
+  while (cursor->Pull(frame, context)) results.push_back(frame[symbol_table.at(*x_ne)].ValueInt());
+  std::sort(results.begin(), results.end());
+  ASSERT_EQ(results.size(), kDistinct);
+  for (int i = 0; i < kDistinct; ++i) EXPECT_EQ(results[i], i);
+  EXPECT_TRUE(std::filesystem::exists(spill_directory));
+  cursor = nullptr;
+  memgraph::utils::DeleteDir(spill_directory);
+}
+
+TEST(QueryPlan, SpillFileGraphValues) {
+  // Edges, paths and graphs are spilled by the Gids of their elements.
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+  auto from = dba.InsertVertex();
+  auto to = dba.InsertVertex();
+  auto edge = dba.InsertEdge(&from, &to, dba.NameToEdgeType("Edge"));
+  ASSERT_TRUE(edge.HasValue());
+  dba.AdvanceCommand();
+
+  memgraph::query::Path path(from);
+  path.Expand(*edge);
+  path.Expand(to);
+  memgraph::query::Graph graph(memgraph::utils::NewDeleteResource());
+  graph.Expand(path);
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_test_unit_query_plan_spill_file";
+  memgraph::utils::DeleteDir(spill_directory);
+  {
+    plan::SpillFile file(spill_directory);
+    file.Write(std::vector<TypedValue>{TypedValue(*edge), TypedValue(path),
+                                       TypedValue(memgraph::query::Graph(graph, memgraph::utils::NewDeleteResource()))});
+    file.StartReading();
+    memgraph::utils::pmr::vector<TypedValue> row(memgraph::utils::NewDeleteResource());
+    ASSERT_TRUE(file.Read(&row, &dba));
+    ASSERT_EQ(row.size(), 3);
+    EXPECT_EQ(row[0].ValueEdge(), *edge);
+    EXPECT_EQ(row[1].ValuePath(), path);
+    EXPECT_EQ(row[2].ValueGraph().vertices(), graph.vertices());
+    EXPECT_EQ(row[2].ValueGraph().edges(), graph.edges());
+    EXPECT_FALSE(file.Read(&row, &dba));
+  }
+  memgraph::utils::DeleteDir(spill_directory);
+}
+
 TEST(QueryPlan, OrderByExceptions) {
   memgraph::storage::Storage db;
   auto storage_dba = db.Access();
@@ -14,6 +14,7 @@
 #include <iterator>
 #include <memory>
 #include <optional>
+#include <set>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -1988,6 +1989,45 @@ TEST_F(QueryPlanExpandWeightedShortestPath, ExistingNode) {
   }
 }
 
+TEST_F(QueryPlanExpandWeightedShortestPath, ExistingNodeBidirectional) {
+  // Without an upper bound, the path between two bound vertices is found by
+  // expanding from both of them.
+  auto ExpandToNode = [this](int sink_id, Expression *where) {
+    auto sink = MakeScanAll(storage, symbol_table, "sink");
+    sink.op_ = std::make_shared<Filter>(sink.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                        EQ(PROPERTY_LOOKUP(sink.node_->identifier_, prop), LITERAL(sink_id)));
+    return ExpandWShortest(EdgeAtom::Direction::OUT, std::nullopt, where, 0, &sink);
+  };
+
+  {
+    auto results = ExpandToNode(4, LITERAL(true));
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(GetProp(results[0].vertex), 4);
+    EXPECT_EQ(results[0].total_weight, 9);
+    ASSERT_EQ(results[0].path.size(), 3);
+    EXPECT_EQ(results[0].path[0], e.at({0, 2}));
+    EXPECT_EQ(results[0].path[1], e.at({2, 3}));
+    EXPECT_EQ(results[0].path[2], e.at({3, 4}));
+  }
+  {
+    auto results = ExpandToNode(4, PropNe(filter_node, 2));
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0].total_weight, 10);
+    ASSERT_EQ(results[0].path.size(), 2);
+    EXPECT_EQ(results[0].path[0], e.at({0, 1}));
+    EXPECT_EQ(results[0].path[1], e.at({1, 4}));
+  }
+  {
+    auto results = ExpandToNode(4, PropNe(filter_node, 4));
+    EXPECT_EQ(results.size(), 0);
+  }
+  {
+    // Paths to the starting vertex itself are never returned.
+    auto results = ExpandToNode(0, LITERAL(true));
+    EXPECT_EQ(results.size(), 0);
+  }
+}
+
 TEST_F(QueryPlanExpandWeightedShortestPath, UpperBound) {
   {
     auto results = ExpandWShortest(EdgeAtom::Direction::BOTH, std::nullopt, LITERAL(true));
@@ -2057,6 +2097,22 @@ TEST_F(QueryPlanExpandWeightedShortestPath, NonNumericWeight) {
   EXPECT_THROW(ExpandWShortest(EdgeAtom::Direction::BOTH, 1000, LITERAL(true)), QueryRuntimeException);
 }
 
+TEST_F(QueryPlanExpandWeightedShortestPath, MixedWeightTypesBidirectional) {
+  // A Duration weight on a path whose other weights are numeric must be rejected
+  // by the search between two bound vertices as well.
+  ASSERT_TRUE(e.at({0, 2})
+                  .SetProperty(prop.second, memgraph::storage::PropertyValue(memgraph::storage::TemporalData(
+                                                memgraph::storage::TemporalType::Duration, 3)))
+                  .HasValue());
+  dba.AdvanceCommand();
+
+  auto sink = MakeScanAll(storage, symbol_table, "sink");
+  sink.op_ = std::make_shared<Filter>(sink.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                      EQ(PROPERTY_LOOKUP(sink.node_->identifier_, prop), LITERAL(4)));
+  EXPECT_THROW(ExpandWShortest(EdgeAtom::Direction::OUT, std::nullopt, LITERAL(true), 0, &sink),
+               QueryRuntimeException);
+}
+
 TEST_F(QueryPlanExpandWeightedShortestPath, NegativeWeight) {
   auto new_vertex = dba.InsertVertex();
   ASSERT_TRUE(new_vertex.SetProperty(prop.second, memgraph::storage::PropertyValue(5)).HasValue());
@@ -2541,6 +2597,35 @@ TEST_F(QueryPlanExpandAllShortestPaths, MultiEdge) {
   EXPECT_EQ(results[5].total_weight, 9);
 }
 
+// Uses graph from Basic test, with double edge 2->-3 and 3->-4
+TEST_F(QueryPlanExpandAllShortestPaths, ExistingNodeBidirectional) {
+  auto edge = dba.InsertEdge(&v[2], &v[3], edge_type);
+  ASSERT_TRUE(edge.HasValue());
+  ASSERT_TRUE(edge->SetProperty(prop.second, memgraph::storage::PropertyValue(3)).HasValue());
+  auto edge2 = dba.InsertEdge(&v[3], &v[4], edge_type);
+  ASSERT_TRUE(edge2.HasValue());
+  ASSERT_TRUE(edge2->SetProperty(prop.second, memgraph::storage::PropertyValue(3)).HasValue());
+  dba.AdvanceCommand();
+
+  // Without an upper bound, paths between two bound vertices are found by
+  // expanding from both of them.
+  auto sink = MakeScanAll(storage, symbol_table, "sink");
+  sink.op_ = std::make_shared<Filter>(sink.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                      EQ(PROPERTY_LOOKUP(sink.node_->identifier_, prop), LITERAL(4)));
+  auto results = ExpandAllShortest(EdgeAtom::Direction::OUT, std::nullopt, LITERAL(true), 0, &sink);
+  ASSERT_EQ(results.size(), 4);
+  std::set<std::pair<memgraph::storage::Gid, memgraph::storage::Gid>> middle_edges;
+  for (const auto &result : results) {
+    EXPECT_EQ(GetProp(result.vertex), 4);
+    EXPECT_EQ(result.total_weight, 9);
+    ASSERT_EQ(result.path.size(), 3);
+    EXPECT_EQ(result.path[0], e.at({0, 2}));
+    middle_edges.emplace(result.path[1].Gid(), result.path[2].Gid());
+  }
+  // Each combination of the parallel edges is a separate path.
+  EXPECT_EQ(middle_edges.size(), 4);
+}
+
 #ifdef MG_ENTERPRISE
 TEST_F(QueryPlanExpandAllShortestPaths, BasicWithFineGrainedFiltering) {
   // All edge_types and labels allowed
@@ -142,3 +142,44 @@ TEST(Module, ReadWriteProcedures) {
                                    memgraph::utils::NewDeleteResource()};
   EXPECT_FALSE(read_proc_with_function.info.is_write);
 }
+
+static void *DummyBatchInit(mgp_list *, mgp_graph *, mgp_result *, mgp_memory *) { return nullptr; }
+static void DummyBatchCallback(void *, mgp_graph *, mgp_result *, mgp_memory *) {}
+static void DummyBatchCleanup(void *, mgp_memory *) {}
+
+TEST(Module, BatchProcedures) {
+  mgp_module module(memgraph::utils::NewDeleteResource());
+  mgp_proc *proc{nullptr};
+  EXPECT_EQ(mgp_module_add_batch_read_procedure(&module, "dashes-not-supported", DummyBatchInit, DummyBatchCallback,
+                                                DummyBatchCleanup, &proc),
+            mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(
+      mgp_module_add_batch_read_procedure(&module, "no_init", nullptr, DummyBatchCallback, DummyBatchCleanup, &proc),
+      mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(mgp_module_add_batch_read_procedure(&module, "no_callback", DummyBatchInit, nullptr, DummyBatchCleanup,
+                                                &proc),
+            mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(
+      mgp_module_add_batch_read_procedure(&module, "no_cleanup", DummyBatchInit, DummyBatchCallback, nullptr, &proc),
+      mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+  EXPECT_TRUE(module.procedures.empty());
+
+  auto *read_proc = EXPECT_MGP_NO_ERROR(mgp_proc *, mgp_module_add_batch_read_procedure, &module, "read",
+                                        DummyBatchInit, DummyBatchCallback, DummyBatchCleanup);
+  EXPECT_FALSE(read_proc->info.is_write);
+  EXPECT_TRUE(read_proc->batch);
+  EXPECT_FALSE(read_proc->cb);
+  auto *write_proc = EXPECT_MGP_NO_ERROR(mgp_proc *, mgp_module_add_batch_write_procedure, &module, "write",
+                                         DummyBatchInit, DummyBatchCallback, DummyBatchCleanup);
+  EXPECT_TRUE(write_proc->info.is_write);
+  EXPECT_TRUE(write_proc->batch);
+  EXPECT_EQ(mgp_module_add_batch_read_procedure(&module, "read", DummyBatchInit, DummyBatchCallback, DummyBatchCleanup,
+                                                &proc),
+            mgp_error::MGP_ERROR_LOGIC_ERROR);
+
+  EXPECT_EQ(mgp_proc_add_arg(read_proc, "arg1", EXPECT_MGP_NO_ERROR(mgp_type *, mgp_type_number)),
+            mgp_error::MGP_ERROR_NO_ERROR);
+  EXPECT_EQ(mgp_proc_add_result(read_proc, "res1", EXPECT_MGP_NO_ERROR(mgp_type *, mgp_type_number)),
+            mgp_error::MGP_ERROR_NO_ERROR);
+  CheckSignature(read_proc, "read(arg1 :: NUMBER) :: (res1 :: NUMBER)");
+}
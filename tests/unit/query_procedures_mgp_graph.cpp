@@ -10,6 +10,8 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <iterator>
 #include <list>
 #include <memory>
@@ -20,7 +22,9 @@
 
 #include "mg_procedure.h"
 #include "query/db_accessor.hpp"
+#include "query/exceptions.hpp"
 #include "query/plan/operator.hpp"
+#include "query/procedure/graph_projection.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
@@ -30,6 +34,8 @@
 #include "storage_test_utils.hpp"
 #include "test_utils.hpp"
 #include "utils/memory.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/variant_helpers.hpp"
 
 #define EXPECT_SUCCESS(...) EXPECT_EQ(__VA_ARGS__, mgp_error::MGP_ERROR_NO_ERROR)
@@ -210,6 +216,166 @@ TEST_F(MgpGraphTest, DetachDeleteVertex) {
   EXPECT_EQ(CountVertices(read_uncommited_accessor, memgraph::storage::View::NEW), 1);
 }
 
+TEST_F(MgpGraphTest, GraphProjection) {
+  std::array<memgraph::storage::Gid, 3> vertex_ids{};
+  {
+    auto &accessor = CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    const auto label = accessor.NameToLabel("Label");
+    std::vector<memgraph::query::VertexAccessor> vertices;
+    for (auto i = 0; i < 3; ++i) {
+      vertices.push_back(accessor.InsertVertex());
+      vertex_ids[i] = vertices.back().Gid();
+      // The last vertex isn't projected.
+      if (i < 2) ASSERT_TRUE(vertices.back().AddLabel(label).HasValue());
+    }
+    ASSERT_TRUE(
+        vertices[1].SetProperty(accessor.NameToProperty("rank"), memgraph::storage::PropertyValue(0.5)).HasValue());
+    const auto projected_type = accessor.NameToEdgeType("PROJECTED");
+    auto edge = accessor.InsertEdge(&vertices[0], &vertices[1], projected_type);
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_TRUE(edge->SetProperty(accessor.NameToProperty("weight"), memgraph::storage::PropertyValue(2)).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[1], &vertices[0], projected_type).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[0], &vertices[2], projected_type).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[0], &vertices[1], accessor.NameToEdgeType("OTHER")).HasValue());
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  mgp_graph graph = CreateGraph();
+  const auto owner = memgraph::query::procedure::GetGraphProjectionOwner(graph);
+  {
+    auto &accessor = CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    const memgraph::query::procedure::GraphProjection::Spec spec{
+        .labels = {"Label"}, .edge_types = {"PROJECTED"}, .weight_property = "weight", .vertex_properties = {"rank"}};
+    memgraph::query::procedure::gGraphProjections.Set(
+        owner, "projection",
+        std::make_shared<const memgraph::query::procedure::GraphProjection>(
+            memgraph::query::procedure::GraphProjection::Build(&accessor, memgraph::storage::View::OLD, spec)));
+  }
+  memgraph::utils::OnScopeExit drop_projection{
+      [&owner] { static_cast<void>(memgraph::query::procedure::gGraphProjections.Drop(owner, "projection")); }};
+
+  // Projections are only visible to the user who projected the graph.
+  auto other_owner = owner;
+  other_owner.user = "other";
+  EXPECT_EQ(memgraph::query::procedure::gGraphProjections.Get(other_owner, "projection"), nullptr);
+  EXPECT_TRUE(memgraph::query::procedure::gGraphProjections.List(other_owner).empty());
+
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(mgp_graph_projection *, mgp_graph_get_projection, &graph, "missing", &memory),
+            nullptr);
+  std::unique_ptr<mgp_graph_projection, void (*)(mgp_graph_projection *)> projection{
+      EXPECT_MGP_NO_ERROR(mgp_graph_projection *, mgp_graph_get_projection, &graph, "projection", &memory),
+      mgp_graph_projection_destroy};
+  ASSERT_NE(projection, nullptr);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_projection_vertex_count, projection.get()), 2);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_projection_edge_count, projection.get()), 2);
+  EXPECT_NE(EXPECT_MGP_NO_ERROR(int, mgp_graph_projection_has_weights, projection.get()), 0);
+
+  for (size_t ordinal = 0; ordinal < 2; ++ordinal) {
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(mgp_vertex_id, mgp_graph_projection_vertex_id, projection.get(), ordinal).as_int,
+              vertex_ids[ordinal].AsInt());
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_projection_vertex_ordinal, projection.get(),
+                                  mgp_vertex_id{vertex_ids[ordinal].AsInt()}),
+              ordinal);
+    const uint64_t *out_neighbors{nullptr};
+    size_t out_count{0};
+    EXPECT_SUCCESS(mgp_graph_projection_out_neighbors(projection.get(), ordinal, &out_neighbors, &out_count));
+    ASSERT_EQ(out_count, 1);
+    EXPECT_EQ(out_neighbors[0], 1 - ordinal);
+    const uint64_t *in_neighbors{nullptr};
+    size_t in_count{0};
+    EXPECT_SUCCESS(mgp_graph_projection_in_neighbors(projection.get(), ordinal, &in_neighbors, &in_count));
+    ASSERT_EQ(in_count, 1);
+    EXPECT_EQ(in_neighbors[0], 1 - ordinal);
+  }
+  const auto *out_weights =
+      EXPECT_MGP_NO_ERROR(const double *, mgp_graph_projection_out_weights, projection.get(), size_t{0});
+  ASSERT_NE(out_weights, nullptr);
+  EXPECT_EQ(out_weights[0], 2.0);
+  const auto *in_weights =
+      EXPECT_MGP_NO_ERROR(const double *, mgp_graph_projection_in_weights, projection.get(), size_t{0});
+  ASSERT_NE(in_weights, nullptr);
+  EXPECT_EQ(in_weights[0], 1.0);
+
+  const auto *ranks = EXPECT_MGP_NO_ERROR(const double *, mgp_graph_projection_vertex_property, projection.get(), "rank");
+  ASSERT_NE(ranks, nullptr);
+  EXPECT_TRUE(std::isnan(ranks[0]));
+  EXPECT_EQ(ranks[1], 0.5);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(const double *, mgp_graph_projection_vertex_property, projection.get(), "weight"),
+            nullptr);
+
+  size_t ordinal{0};
+  EXPECT_EQ(mgp_graph_projection_vertex_ordinal(projection.get(), mgp_vertex_id{vertex_ids[2].AsInt()}, &ordinal),
+            mgp_error::MGP_ERROR_OUT_OF_RANGE);
+  const uint64_t *neighbors{nullptr};
+  size_t count{0};
+  EXPECT_EQ(mgp_graph_projection_out_neighbors(projection.get(), 2, &neighbors, &count),
+            mgp_error::MGP_ERROR_OUT_OF_RANGE);
+
+  // A dropped projection stays valid for the procedures which got it.
+  EXPECT_TRUE(memgraph::query::procedure::gGraphProjections.Drop(owner, "projection"));
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(mgp_graph_projection *, mgp_graph_get_projection, &graph, "projection", &memory),
+            nullptr);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_projection_vertex_count, projection.get()), 2);
+}
+
+TEST_F(MgpGraphTest, GraphProjectionsEvictLeastRecentlyUsed) {
+  {
+    auto &accessor = CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    for (auto i = 0; i < 100; ++i) accessor.InsertVertex();
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  auto &accessor = CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+  const auto projection = std::make_shared<const memgraph::query::procedure::GraphProjection>(
+      memgraph::query::procedure::GraphProjection::Build(&accessor, memgraph::storage::View::OLD, {}));
+  const auto bytes = projection->GetAllocatedBytes();
+
+  memgraph::query::procedure::GraphProjections projections;
+  projections.SetMemoryLimit(2 * bytes);
+  const memgraph::query::procedure::GraphProjections::Owner owner{.storage = "storage", .user = "user"};
+  const memgraph::query::procedure::GraphProjections::Owner other_owner{.storage = "storage", .user = "other"};
+  projections.Set(owner, "first", projection);
+  projections.Set(other_owner, "second", projection);
+  EXPECT_EQ(projections.GetAllocatedBytes(), 2 * bytes);
+
+  // Using the first projection makes the second one the least recently used,
+  // even though it belongs to another user.
+  EXPECT_NE(projections.Get(owner, "first"), nullptr);
+  projections.Set(owner, "third", projection);
+  EXPECT_EQ(projections.GetAllocatedBytes(), 2 * bytes);
+  EXPECT_NE(projections.Get(owner, "first"), nullptr);
+  EXPECT_EQ(projections.Get(other_owner, "second"), nullptr);
+  EXPECT_NE(projections.Get(owner, "third"), nullptr);
+
+  // Replacing a projection doesn't evict others.
+  projections.Set(owner, "first", projection);
+  EXPECT_EQ(projections.List(owner).size(), 2);
+
+  // A projection which alone exceeds the limit isn't cached.
+  projections.SetMemoryLimit(bytes - 1);
+  EXPECT_THROW(projections.Set(owner, "fourth", projection), memgraph::query::QueryRuntimeException);
+  EXPECT_EQ(projections.Get(owner, "fourth"), nullptr);
+  EXPECT_EQ(projections.List(owner).size(), 2);
+}
+
+TEST_F(MgpGraphTest, GraphProjectionsDropStorage) {
+  auto &accessor = CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+  const auto projection = std::make_shared<const memgraph::query::procedure::GraphProjection>(
+      memgraph::query::procedure::GraphProjection::Build(&accessor, memgraph::storage::View::OLD, {}));
+
+  memgraph::query::procedure::GraphProjections projections;
+  const memgraph::query::procedure::GraphProjections::Owner owner{.storage = "dropped", .user = "user"};
+  const memgraph::query::procedure::GraphProjections::Owner other_user{.storage = "dropped", .user = "other"};
+  const memgraph::query::procedure::GraphProjections::Owner other_storage{.storage = "kept", .user = "user"};
+  projections.Set(owner, "projection", projection);
+  projections.Set(other_user, "projection", projection);
+  projections.Set(other_storage, "projection", projection);
+
+  projections.DropStorage("dropped");
+  EXPECT_EQ(projections.Get(owner, "projection"), nullptr);
+  EXPECT_EQ(projections.Get(other_user, "projection"), nullptr);
+  EXPECT_NE(projections.Get(other_storage, "projection"), nullptr);
+  EXPECT_EQ(projections.GetAllocatedBytes(), projection->GetAllocatedBytes());
+}
+
 TEST_F(MgpGraphTest, CreateDeleteWithImmutableGraph) {
   memgraph::storage::Gid vertex_id{};
   {
@@ -262,6 +428,157 @@ TEST_F(MgpGraphTest, VerticesIterator) {
   }
 }
 
+TEST_F(MgpGraphTest, VertexOrdinals) {
+  const auto vertex_ids = CreateEdge();
+  mgp_graph graph = CreateGraph();
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_vertex_ordinal_count, &graph), 2);
+  std::vector<bool> seen(2, false);
+  for (const auto vertex_id : vertex_ids) {
+    MgpVertexPtr vertex{
+        EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_graph_get_vertex_by_id, &graph, mgp_vertex_id{vertex_id.AsInt()}, &memory)};
+    ASSERT_NE(vertex, nullptr);
+    const auto ordinal = EXPECT_MGP_NO_ERROR(size_t, mgp_vertex_get_ordinal, vertex.get());
+    ASSERT_LT(ordinal, 2);
+    EXPECT_FALSE(seen[ordinal]);
+    seen[ordinal] = true;
+    MgpVertexPtr vertex_by_ordinal{
+        EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_graph_get_vertex_by_ordinal, &graph, ordinal, &memory)};
+    ASSERT_NE(vertex_by_ordinal, nullptr);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(mgp_vertex_id, mgp_vertex_get_id, vertex_by_ordinal.get()).as_int,
+              vertex_id.AsInt());
+  }
+  mgp_vertex *vertex_out_of_range{nullptr};
+  EXPECT_EQ(mgp_graph_get_vertex_by_ordinal(&graph, 2, &memory, &vertex_out_of_range),
+            mgp_error::MGP_ERROR_OUT_OF_RANGE);
+
+  // Vertices created after the numbering don't have an ordinal.
+  MgpVertexPtr new_vertex{EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_graph_create_vertex, &graph, &memory)};
+  ASSERT_NE(new_vertex, nullptr);
+  size_t new_ordinal{0};
+  EXPECT_EQ(mgp_vertex_get_ordinal(new_vertex.get(), &new_ordinal), mgp_error::MGP_ERROR_OUT_OF_RANGE);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_vertex_ordinal_count, &graph), 2);
+}
+
+TEST_F(MgpGraphTest, ParallelForVertices) {
+  memgraph::utils::ThreadPool worker_pool(4);
+  ctx_->procedure_worker_pool = &worker_pool;
+  static constexpr size_t kVertexCount = 1000;
+  {
+    auto accessor = CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    for (size_t i = 0; i < kVertexCount; ++i) {
+      accessor.InsertVertex();
+    }
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  mgp_graph graph = CreateGraph();
+  const auto worker_count = EXPECT_MGP_NO_ERROR(size_t, mgp_graph_parallel_worker_count, &graph);
+  EXPECT_EQ(worker_count, 4);
+
+  struct Data {
+    size_t worker_count;
+    std::vector<std::atomic<int>> visits = std::vector<std::atomic<int>>(kVertexCount);
+    std::atomic<bool> failed{false};
+  };
+  Data data{.worker_count = worker_count};
+  const auto visit = [](mgp_graph *graph, size_t worker, size_t begin, size_t end, mgp_memory *memory,
+                        void *raw_data) {
+    auto &data = *static_cast<Data *>(raw_data);
+    int is_mutable{1};
+    size_t nested_worker_count{0};
+    if (worker >= data.worker_count || begin >= end || end - begin > 7 ||
+        mgp_graph_is_mutable(graph, &is_mutable) != mgp_error::MGP_ERROR_NO_ERROR || is_mutable != 0 ||
+        mgp_graph_parallel_worker_count(graph, &nested_worker_count) != mgp_error::MGP_ERROR_NO_ERROR ||
+        nested_worker_count != 1) {
+      data.failed = true;
+    }
+    for (auto ordinal = begin; ordinal < end; ++ordinal) {
+      mgp_vertex *vertex{nullptr};
+      size_t vertex_ordinal{0};
+      if (mgp_graph_get_vertex_by_ordinal(graph, ordinal, memory, &vertex) != mgp_error::MGP_ERROR_NO_ERROR ||
+          mgp_vertex_get_ordinal(vertex, &vertex_ordinal) != mgp_error::MGP_ERROR_NO_ERROR ||
+          vertex_ordinal != ordinal) {
+        data.failed = true;
+      }
+      mgp_vertex_destroy(vertex);
+      ++data.visits[ordinal];
+    }
+    return mgp_error::MGP_ERROR_NO_ERROR;
+  };
+  EXPECT_EQ(mgp_graph_parallel_for_vertices(&graph, 7, visit, &data), mgp_error::MGP_ERROR_NO_ERROR);
+  EXPECT_FALSE(data.failed);
+  EXPECT_TRUE(std::all_of(data.visits.begin(), data.visits.end(), [](const auto &visits) { return visits == 1; }));
+  EXPECT_EQ(mgp_graph_parallel_for_vertices(&graph, 0, visit, &data), mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+
+  // Workers can't modify the graph, and the first error of a callback stops
+  // the processing.
+  const auto create_vertex = [](mgp_graph *graph, size_t /*worker*/, size_t /*begin*/, size_t /*end*/,
+                                mgp_memory *memory, void * /*data*/) {
+    mgp_vertex *vertex{nullptr};
+    return mgp_graph_create_vertex(graph, memory, &vertex);
+  };
+  EXPECT_EQ(mgp_graph_parallel_for_vertices(&graph, 7, create_vertex, nullptr),
+            mgp_error::MGP_ERROR_IMMUTABLE_OBJECT);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(int, mgp_graph_is_mutable, &graph), 1);
+
+  // The memory of the workers is counted against the query memory limit.
+  memgraph::utils::MemoryLimit memory_limit(64);
+  ctx_->memory_limit = &memory_limit;
+  const auto get_vertex = [](mgp_graph *graph, size_t /*worker*/, size_t begin, size_t /*end*/, mgp_memory *memory,
+                             void * /*data*/) {
+    mgp_vertex *vertex{nullptr};
+    const auto error = mgp_graph_get_vertex_by_ordinal(graph, begin, memory, &vertex);
+    mgp_vertex_destroy(vertex);
+    return error;
+  };
+  EXPECT_EQ(mgp_graph_parallel_for_vertices(&graph, 7, get_vertex, nullptr),
+            mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE);
+  EXPECT_EQ(memory_limit.GetAllocatedBytes(), 0);
+  ctx_->memory_limit = nullptr;
+
+  // And against the memory limit of the procedure.
+  memgraph::utils::MemoryLimit procedure_memory_limit(64);
+  graph.procedure_memory_limit = &procedure_memory_limit;
+  EXPECT_EQ(mgp_graph_parallel_for_vertices(&graph, 7, get_vertex, nullptr),
+            mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE);
+  EXPECT_EQ(procedure_memory_limit.GetAllocatedBytes(), 0);
+  graph.procedure_memory_limit = nullptr;
+  EXPECT_EQ(mgp_graph_parallel_for_vertices(&graph, 7, get_vertex, nullptr), mgp_error::MGP_ERROR_NO_ERROR);
+}
+
+TEST_F(MgpGraphTest, ParallelFor) {
+  memgraph::utils::ThreadPool worker_pool(4);
+  ctx_->procedure_worker_pool = &worker_pool;
+  static constexpr size_t kSize = 1000;
+  mgp_graph graph = CreateGraph();
+
+  struct Data {
+    size_t max_workers;
+    std::vector<std::atomic<int>> visits = std::vector<std::atomic<int>>(kSize);
+    std::atomic<bool> failed{false};
+  };
+  const auto visit = [](size_t worker, size_t begin, size_t end, void *raw_data) {
+    auto &data = *static_cast<Data *>(raw_data);
+    if (worker >= data.max_workers || begin >= end || end - begin > 7) data.failed = true;
+    for (auto i = begin; i < end; ++i) ++data.visits[i];
+    return mgp_error::MGP_ERROR_NO_ERROR;
+  };
+  // The number of workers is limited by the pool and by the caller.
+  for (const size_t max_workers : {0, 2}) {
+    Data data{.max_workers = max_workers == 0 ? 4 : max_workers};
+    EXPECT_EQ(mgp_graph_parallel_for(&graph, kSize, 7, max_workers, visit, &data), mgp_error::MGP_ERROR_NO_ERROR);
+    EXPECT_FALSE(data.failed);
+    EXPECT_TRUE(std::all_of(data.visits.begin(), data.visits.end(), [](const auto &visits) { return visits == 1; }));
+  }
+  Data data{.max_workers = 4};
+  EXPECT_EQ(mgp_graph_parallel_for(&graph, kSize, 0, 0, visit, &data), mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+
+  // The first error of a callback stops the processing.
+  const auto fail = [](size_t /*worker*/, size_t /*begin*/, size_t /*end*/, void * /*data*/) {
+    return mgp_error::MGP_ERROR_OUT_OF_RANGE;
+  };
+  EXPECT_EQ(mgp_graph_parallel_for(&graph, kSize, 7, 0, fail, nullptr), mgp_error::MGP_ERROR_OUT_OF_RANGE);
+}
+
 TEST_F(MgpGraphTest, VertexIsMutable) {
   auto graph = CreateGraph(memgraph::storage::View::NEW);
   MgpVertexPtr vertex{EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_graph_create_vertex, &graph, &memory)};
@@ -91,6 +91,8 @@ class StreamsTest : public ::testing::Test {
         stream_data->stream_source->ReadLock()->Info(check_data.info.common_info.transformation_name);
     EXPECT_TRUE(
         std::equal(check_data.info.configs.begin(), check_data.info.configs.end(), stream_info.configs.begin()));
+    EXPECT_EQ(check_data.info.parallelism, stream_info.parallelism);
+    EXPECT_EQ(check_data.info.pipeline_depth, stream_info.pipeline_depth);
   }
 
   void StartStream(StreamCheckData &check_data) {
@@ -197,6 +199,12 @@ TEST_F(StreamsTest, RestoreStreams) {
     if (i > 0) {
       stream_info.common_info.batch_interval = std::chrono::milliseconds((i + 1) * 10);
       stream_info.common_info.batch_size = 1000 + i;
+      // Pipelining cannot be combined with parallel consumption
+      if (i % 2 == 0) {
+        stream_info.parallelism = i + 1;
+      } else {
+        stream_info.pipeline_depth = i;
+      }
       stream_check_data.owner = std::string{"owner"} + iteration_postfix;
 
       // These are just random numbers to make the CONFIGS and CREDENTIALS map vary between consumers:
@@ -358,6 +358,167 @@ TEST_F(TriggerContextTest, ReturnCreateOnlyEvent) {
   CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::UPDATED_OBJECTS, 0, dba);
 }
 
+// Coalesced trigger contexts contain the events of all of the merged transactions.
+TEST_F(TriggerContextTest, MergeTriggerContexts) {
+  memgraph::query::TriggerContext trigger_context;
+  memgraph::storage::Gid first_vertex_gid;
+  {
+    memgraph::query::TriggerContextCollector trigger_context_collector{kAllEventTypes};
+    memgraph::query::DbAccessor dba{&StartTransaction()};
+    auto vertex = dba.InsertVertex();
+    first_vertex_gid = vertex.Gid();
+    trigger_context_collector.RegisterCreatedObject(vertex);
+    ASSERT_FALSE(dba.Commit().HasError());
+    trigger_context = std::move(trigger_context_collector).TransformToTriggerContext();
+  }
+  {
+    memgraph::query::TriggerContextCollector trigger_context_collector{kAllEventTypes};
+    memgraph::query::DbAccessor dba{&StartTransaction()};
+    auto maybe_vertex = dba.FindVertex(first_vertex_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(maybe_vertex);
+    ASSERT_TRUE(maybe_vertex->AddLabel(dba.NameToLabel("LABEL")).HasValue());
+    trigger_context_collector.RegisterSetVertexLabel(*maybe_vertex, dba.NameToLabel("LABEL"));
+    trigger_context_collector.RegisterCreatedObject(dba.InsertVertex());
+    ASSERT_FALSE(dba.Commit().HasError());
+    trigger_context.Merge(std::move(trigger_context_collector).TransformToTriggerContext());
+  }
+
+  memgraph::query::DbAccessor dba{&StartTransaction()};
+  trigger_context.AdaptForAccessor(&dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 2, dba);
+  CheckLabelList(trigger_context, memgraph::query::TriggerIdentifierTag::SET_VERTEX_LABELS, 1, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::UPDATED_VERTICES, 1, dba);
+}
+
+// TriggerContextCollector should register only the objects and the changes which are in the scope of some event
+TEST_F(TriggerContextTest, ScopedCollection) {
+  memgraph::query::DbAccessor dba{&StartTransaction()};
+  const auto order_label = dba.NameToLabel("Order");
+  const auto status_property = dba.NameToProperty("status");
+  const auto total_property = dba.NameToProperty("total");
+  const auto pays_edge_type = dba.NameToEdgeType("PAYS");
+
+  auto order = dba.InsertVertex();
+  ASSERT_TRUE(order.AddLabel(order_label).HasValue());
+  auto customer = dba.InsertVertex();
+  auto maybe_pays_edge = dba.InsertEdge(&customer, &order, pays_edge_type);
+  ASSERT_TRUE(maybe_pays_edge.HasValue());
+  auto maybe_knows_edge = dba.InsertEdge(&customer, &order, dba.NameToEdgeType("KNOWS"));
+  ASSERT_TRUE(maybe_knows_edge.HasValue());
+  dba.AdvanceCommand();
+
+  memgraph::query::TriggerContextCollector collector{std::vector<memgraph::query::ScopedTriggerEvent>{
+      {memgraph::query::TriggerEventType::VERTEX_CREATE, memgraph::query::TriggerScope{.label = order_label}},
+      {memgraph::query::TriggerEventType::VERTEX_UPDATE,
+       memgraph::query::TriggerScope{.label = order_label, .properties = {status_property}}},
+      {memgraph::query::TriggerEventType::EDGE_DELETE, memgraph::query::TriggerScope{.edge_type = pays_edge_type}}}};
+
+  auto created_order = dba.InsertVertex();
+  ASSERT_TRUE(created_order.AddLabel(order_label).HasValue());
+  collector.RegisterCreatedObject(created_order);
+  collector.RegisterCreatedObject(dba.InsertVertex());
+
+  collector.RegisterSetObjectProperty(order, status_property, memgraph::query::TypedValue{},
+                                      memgraph::query::TypedValue{"paid"});
+  collector.RegisterSetObjectProperty(order, total_property, memgraph::query::TypedValue{},
+                                      memgraph::query::TypedValue{10});
+  collector.RegisterSetObjectProperty(customer, status_property, memgraph::query::TypedValue{},
+                                      memgraph::query::TypedValue{"active"});
+  ASSERT_TRUE(order.AddLabel(dba.NameToLabel("Paid")).HasValue());
+  collector.RegisterSetVertexLabel(order, dba.NameToLabel("Paid"));
+
+  collector.RegisterDeletedObject(dba.RemoveEdge(&maybe_pays_edge.GetValue()).GetValue().value());
+  collector.RegisterDeletedObject(dba.RemoveEdge(&maybe_knows_edge.GetValue()).GetValue().value());
+  dba.AdvanceCommand();
+
+  const auto trigger_context = std::move(collector).TransformToTriggerContext();
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 1, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::SET_VERTEX_PROPERTIES, 1, dba);
+  CheckLabelList(trigger_context, memgraph::query::TriggerIdentifierTag::SET_VERTEX_LABELS, 0, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::DELETED_EDGES, 1, dba);
+}
+
+// A scoped trigger should see only the objects from its scope, even if the context
+// was collected for the other triggers as well
+TEST_F(TriggerContextTest, RestrictedToScope) {
+  memgraph::query::DbAccessor dba{&StartTransaction()};
+  const auto order_label = dba.NameToLabel("Order");
+
+  memgraph::query::TriggerContextCollector collector{kAllEventTypes};
+  auto order = dba.InsertVertex();
+  ASSERT_TRUE(order.AddLabel(order_label).HasValue());
+  collector.RegisterCreatedObject(order);
+  collector.RegisterCreatedObject(dba.InsertVertex());
+  dba.AdvanceCommand();
+
+  auto trigger_context = std::move(collector).TransformToTriggerContext();
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 2, dba);
+  const auto order_context = trigger_context.RestrictedToScope(memgraph::query::TriggerScope{.label = order_label});
+  CheckTypedValueSize(order_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 1, dba);
+  ASSERT_TRUE(order_context.ShouldEventTrigger(memgraph::query::TriggerEventType::VERTEX_CREATE));
+  const auto customer_context =
+      trigger_context.RestrictedToScope(memgraph::query::TriggerScope{.label = dba.NameToLabel("Customer")});
+  ASSERT_FALSE(customer_context.ShouldEventTrigger(memgraph::query::TriggerEventType::VERTEX_CREATE));
+  // The original context is left intact
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 2, dba);
+}
+
+// The created objects are filtered by the scope when they are registered, a created vertex gets into the scope
+// when it gets the label later in the transaction, and the changes of the objects out of the scope are still
+// eliminated because they were created in the same transaction
+TEST_F(TriggerContextTest, ScopedCreatedObjects) {
+  memgraph::query::DbAccessor dba{&StartTransaction()};
+  const auto order_label = dba.NameToLabel("Order");
+  const auto pays_edge_type = dba.NameToEdgeType("PAYS");
+  const auto status_property = dba.NameToProperty("status");
+
+  memgraph::query::TriggerContextCollector collector{std::vector<memgraph::query::ScopedTriggerEvent>{
+      {memgraph::query::TriggerEventType::VERTEX_CREATE, memgraph::query::TriggerScope{.label = order_label}},
+      {memgraph::query::TriggerEventType::EDGE_CREATE, memgraph::query::TriggerScope{.edge_type = pays_edge_type}},
+      {memgraph::query::TriggerEventType::UPDATE, std::nullopt}}};
+
+  auto customer = dba.InsertVertex();
+  collector.RegisterCreatedObject(customer);
+  auto later_order = dba.InsertVertex();
+  collector.RegisterCreatedObject(later_order);
+  ASSERT_TRUE(later_order.AddLabel(order_label).HasValue());
+  collector.RegisterSetVertexLabel(later_order, order_label);
+
+  auto maybe_pays_edge = dba.InsertEdge(&customer, &later_order, pays_edge_type);
+  ASSERT_TRUE(maybe_pays_edge.HasValue());
+  collector.RegisterCreatedObject(*maybe_pays_edge);
+  auto maybe_knows_edge = dba.InsertEdge(&customer, &later_order, dba.NameToEdgeType("KNOWS"));
+  ASSERT_TRUE(maybe_knows_edge.HasValue());
+  collector.RegisterCreatedObject(*maybe_knows_edge);
+
+  collector.RegisterSetObjectProperty(customer, status_property, memgraph::query::TypedValue{},
+                                      memgraph::query::TypedValue{"active"});
+  collector.RegisterSetObjectProperty(*maybe_knows_edge, status_property, memgraph::query::TypedValue{},
+                                      memgraph::query::TypedValue{"active"});
+  dba.AdvanceCommand();
+
+  const auto trigger_context = std::move(collector).TransformToTriggerContext();
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 1, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_EDGES, 1, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::SET_VERTEX_PROPERTIES, 0, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::SET_EDGE_PROPERTIES, 0, dba);
+  CheckLabelList(trigger_context, memgraph::query::TriggerIdentifierTag::SET_VERTEX_LABELS, 0, dba);
+}
+
+// After registering max_objects objects, TriggerContextCollector should ignore the rest of them
+TEST_F(TriggerContextTest, MaxObjects) {
+  memgraph::query::DbAccessor dba{&StartTransaction()};
+  memgraph::query::TriggerContextCollector collector{
+      std::vector<memgraph::query::ScopedTriggerEvent>{{memgraph::query::TriggerEventType::ANY, std::nullopt}}, 2};
+  for (size_t i = 0; i < 3; ++i) {
+    collector.RegisterCreatedObject(dba.InsertVertex());
+  }
+  dba.AdvanceCommand();
+
+  const auto trigger_context = std::move(collector).TransformToTriggerContext();
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 2, dba);
+}
+
 namespace {
 void EXPECT_PROP_TRUE(const memgraph::query::TypedValue &a) {
   EXPECT_TRUE(a.type() == memgraph::query::TypedValue::Type::Bool && a.ValueBool());
@@ -988,6 +1149,42 @@ TEST_F(TriggerStoreTest, Restore) {
   check_empty();
 }
 
+TEST_F(TriggerStoreTest, RestoreScope) {
+  std::optional<memgraph::query::TriggerStore> store;
+  store.emplace(testing_directory);
+  store->AddTrigger("trigger", "RETURN 1", {}, memgraph::query::TriggerEventType::VERTEX_UPDATE,
+                    memgraph::query::TriggerPhase::AFTER_COMMIT, &ast_cache, &*dba,
+                    memgraph::query::InterpreterConfig::Query{}, std::nullopt, &auth_checker,
+                    memgraph::query::TriggerScopeInfo{"Order", {"status", "total"}});
+
+  const auto check_scope = [&] {
+    const auto trigger_info = store->GetTriggerInfo();
+    ASSERT_EQ(trigger_info.size(), 1);
+    ASSERT_TRUE(trigger_info[0].scope_info.has_value());
+    ASSERT_EQ(memgraph::query::TriggerScopeInfoToString(*trigger_info[0].scope_info), ":Order(status, total)");
+
+    const auto events = store->GetScopedEvents();
+    ASSERT_EQ(events.size(), 1);
+    ASSERT_TRUE(events[0].scope.has_value());
+    ASSERT_EQ(events[0].scope->label, dba->NameToLabel("Order"));
+    ASSERT_FALSE(events[0].scope->edge_type.has_value());
+    ASSERT_EQ(events[0].scope->properties.size(), 2);
+  };
+
+  check_scope();
+
+  // recreate trigger store, this should reload the scope from the disk
+  store.emplace(testing_directory);
+  store->RestoreTriggers(&ast_cache, &*dba, memgraph::query::InterpreterConfig::Query{}, &auth_checker);
+  check_scope();
+
+  ASSERT_THROW(store->AddTrigger("create_trigger", "RETURN 1", {}, memgraph::query::TriggerEventType::CREATE,
+                                 memgraph::query::TriggerPhase::AFTER_COMMIT, &ast_cache, &*dba,
+                                 memgraph::query::InterpreterConfig::Query{}, std::nullopt, &auth_checker,
+                                 memgraph::query::TriggerScopeInfo{"Order", {}}),
+               memgraph::utils::BasicException);
+}
+
 TEST_F(TriggerStoreTest, AddTrigger) {
   memgraph::query::TriggerStore store{testing_directory};
 
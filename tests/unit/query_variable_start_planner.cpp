@@ -10,6 +10,8 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <optional>
+#include <string>
 #include <variant>
 
 #include "gtest/gtest.h"
@@ -330,4 +332,87 @@ TEST(TestVariableStartPlanner, MatchBfs) {
   CheckPlansProduce(2, query, storage, &dba, [&](const auto &results) { AssertRows(results, {{r1_list}}, dba); });
 }
 
+TEST(TestVariableStartPlanner, MatchLongPatternReturn) {
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+  // Make a graph (v0) -[:r]-> (v1) -[:r]-> ... -[:r]-> (v7), which is long
+  // enough for expansions to be ordered by their estimated cost.
+  std::vector<memgraph::query::VertexAccessor> vertices;
+  for (int i = 0; i < 8; ++i) {
+    vertices.push_back(dba.InsertVertex());
+  }
+  for (int i = 0; i < 7; ++i) {
+    ASSERT_TRUE(dba.InsertEdge(&vertices[i], &vertices[i + 1], dba.NameToEdgeType("r")).HasValue());
+  }
+  dba.AdvanceCommand();
+  // Test MATCH (n0) -[r0]-> (n1) -[r1]-> ... -[r6]-> (n7) RETURN n0, n7
+  AstStorage storage;
+  std::vector<memgraph::query::PatternAtom *> atoms{NODE("n0")};
+  for (int i = 0; i < 7; ++i) {
+    atoms.push_back(EDGE("r" + std::to_string(i), Direction::OUT));
+    atoms.push_back(NODE("n" + std::to_string(i + 1)));
+  }
+  auto *pattern = memgraph::query::test_common::GetPattern(storage, atoms);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(pattern), RETURN("n0", "n7")));
+  // Each of the 8 nodes can be the starting node.
+  CheckPlansProduce(8, query, storage, &dba, [&](const auto &results) {
+    AssertRows(results, {{TypedValue(vertices.front()), TypedValue(vertices.back())}}, dba);
+  });
+}
+
+TEST(TestVariableStartPlanner, MatchLongPatternExpansionOrder) {
+  memgraph::storage::Storage db;
+  auto storage_dba = db.Access();
+  memgraph::query::DbAccessor dba(&storage_dba);
+  auto id = dba.NameToProperty("id");
+  // Test MATCH (c) -[r0]-> (a0), ..., (c) -[r5]-> (a5) WHERE a5.id = 1 RETURN c
+  AstStorage storage;
+  std::vector<memgraph::query::Pattern *> patterns;
+  for (int i = 0; i < 6; ++i) {
+    patterns.push_back(
+        PATTERN(NODE("c"), EDGE("r" + std::to_string(i), Direction::OUT), NODE("a" + std::to_string(i))));
+  }
+  auto *match = memgraph::query::test_common::GetWithPatterns(storage.Create<memgraph::query::Match>(), patterns);
+  auto *query = QUERY(SINGLE_QUERY(match, WHERE(EQ(PROPERTY_LOOKUP("a5", id), LITERAL(1))), RETURN("c")));
+
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planning_context = MakePlanningContext(&storage, &symbol_table, query, &dba);
+  auto query_parts = CollectQueryParts(symbol_table, storage, query);
+  ASSERT_FALSE(query_parts.query_parts.empty());
+  auto single_query_parts = query_parts.query_parts.at(0).single_query_parts;
+  auto plans = MakeLogicalPlanForSingleQuery<VariableStartPlanner>(single_query_parts, &planning_context);
+
+  // Collect the operators of each plan, starting from the scan.
+  bool checked_plan_from_c = false;
+  for (const auto &plan : plans) {
+    std::vector<LogicalOperator *> operators;
+    for (auto *op = plan.get(); op && !dynamic_cast<Once *>(op); op = op->input().get()) {
+      operators.push_back(op);
+    }
+    std::reverse(operators.begin(), operators.end());
+    auto *scan = dynamic_cast<ScanAll *>(operators.front());
+    if (!scan || scan->output_symbol_.name() != "c") continue;
+    checked_plan_from_c = true;
+
+    // Expanding to `a5` first makes the filter applicable right away, which
+    // gives the smallest estimated intermediate results.
+    std::vector<std::string> expanded_nodes;
+    std::optional<size_t> filter_position;
+    for (auto *op : operators) {
+      if (auto *expand = dynamic_cast<Expand *>(op)) {
+        expanded_nodes.push_back(expand->common_.node_symbol.name());
+      } else if (dynamic_cast<Filter *>(op) && !filter_position) {
+        filter_position = expanded_nodes.size();
+      }
+    }
+    ASSERT_EQ(expanded_nodes.size(), 6);
+    EXPECT_EQ(expanded_nodes.front(), "a5");
+    // The filter is placed right after the first expansion, before any other expansion.
+    ASSERT_TRUE(filter_position);
+    EXPECT_EQ(*filter_position, 1);
+  }
+  EXPECT_TRUE(checked_plan_from_c);
+}
+
 }  // namespace
@@ -854,3 +854,75 @@ TEST(SkipList, EstimateAverageNumberOfEquals5) {
     ASSERT_EQ(count, kMaxElements);
   }
 }
+
+TEST(SkipList, Partition) {
+  memgraph::utils::SkipList<int64_t> list;
+
+  {
+    auto acc = list.access();
+    auto ranges = acc.partition(4);
+    ASSERT_EQ(ranges.size(), 1);
+    ASSERT_EQ(ranges[0], acc.end());
+  }
+
+  const int64_t kMaxElements = 100000;
+  {
+    auto acc = list.access();
+    for (int64_t i = 0; i < kMaxElements; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+  }
+
+  for (uint64_t num_ranges : {1, 2, 3, 8, 100}) {
+    auto acc = list.access();
+    auto ranges = acc.partition(num_ranges);
+    ASSERT_GE(ranges.size(), 1);
+    ASSERT_LE(ranges.size(), num_ranges);
+    // The ranges are consecutive and together cover the whole list.
+    int64_t expected = 0;
+    for (auto it : ranges) {
+      ASSERT_EQ(*it, expected);
+      uint64_t range_size = 0;
+      for (; it != acc.end(); ++it) {
+        ASSERT_EQ(*it, expected);
+        ++expected;
+        ++range_size;
+      }
+      ASSERT_GT(range_size, 0);
+      // The ranges are only approximately equal, but none of them should be
+      // completely off.
+      if (ranges.size() > 1) {
+        ASSERT_LT(range_size, 3 * kMaxElements / ranges.size());
+      }
+    }
+    ASSERT_EQ(expected, kMaxElements);
+  }
+
+  {
+    // Iterating a range stops at the next range even if its first item was
+    // removed.
+    auto acc = list.access();
+    auto ranges = acc.partition(2);
+    ASSERT_EQ(ranges.size(), 2);
+    const int64_t split = *ranges[1];
+    ASSERT_TRUE(acc.remove(split));
+    int64_t last = -1;
+    for (auto it = ranges[0]; it != acc.end(); ++it) last = *it;
+    ASSERT_EQ(last, split - 1);
+    ASSERT_TRUE(acc.insert(split).second);
+  }
+
+  {
+    // Only the items from the lower bound on are partitioned.
+    auto acc = list.access();
+    auto ranges = acc.partition(4, std::optional{memgraph::utils::MakeBoundInclusive<int64_t>(50000)},
+                                std::optional{memgraph::utils::MakeBoundExclusive<int64_t>(60000)});
+    ASSERT_GE(ranges.size(), 1);
+    ASSERT_LE(ranges.size(), 4);
+    ASSERT_EQ(*ranges[0], 50000);
+    for (size_t i = 1; i < ranges.size(); ++i) {
+      ASSERT_LT(*ranges[i - 1], *ranges[i]);
+      ASSERT_LT(*ranges[i], 60000);
+    }
+  }
+}
@@ -12,6 +12,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <limits>
 
 #include "storage/v2/property_value.hpp"
@@ -2194,6 +2195,56 @@ TEST(StorageV2, VertexPropertyClear) {
   }
 }
 
+TEST(StorageV2, VertexGetProperties) {
+  memgraph::storage::Storage store;
+  memgraph::storage::Gid gid;
+  memgraph::storage::PropertyId property1, property2, property3;
+
+  {
+    auto acc = store.Access();
+    auto vertex = acc.CreateVertex();
+    gid = vertex.Gid();
+    property1 = acc.NameToProperty("property1");
+    property2 = acc.NameToProperty("property2");
+    property3 = acc.NameToProperty("property3");
+    ASSERT_TRUE(vertex.SetProperty(property1, memgraph::storage::PropertyValue(1))->IsNull());
+    ASSERT_TRUE(vertex.SetProperty(property3, memgraph::storage::PropertyValue("three"))->IsNull());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  std::vector<memgraph::storage::PropertyId> properties{property1, property2, property3};
+  std::sort(properties.begin(), properties.end());
+  auto check = [&](const memgraph::storage::VertexAccessor &vertex, memgraph::storage::View view) {
+    auto values = vertex.GetProperties(properties, view);
+    ASSERT_TRUE(values.HasValue());
+    ASSERT_EQ(values->size(), properties.size());
+    for (size_t i = 0; i < properties.size(); ++i) {
+      ASSERT_EQ((*values)[i], *vertex.GetProperty(properties[i], view));
+    }
+  };
+
+  {
+    auto acc = store.Access();
+    auto vertex = acc.FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    check(*vertex, memgraph::storage::View::OLD);
+
+    // Uncommitted changes are only visible in the NEW view.
+    ASSERT_FALSE(vertex->SetProperty(property1, memgraph::storage::PropertyValue(10))->IsNull());
+    ASSERT_TRUE(vertex->SetProperty(property2, memgraph::storage::PropertyValue(2.5))->IsNull());
+    ASSERT_FALSE(vertex->SetProperty(property3, memgraph::storage::PropertyValue())->IsNull());
+    check(*vertex, memgraph::storage::View::OLD);
+    check(*vertex, memgraph::storage::View::NEW);
+    ASSERT_EQ((*vertex->GetProperty(property1, memgraph::storage::View::NEW)).ValueInt(), 10);
+
+    ASSERT_TRUE(acc.DeleteVertex(&*vertex).GetValue());
+    check(*vertex, memgraph::storage::View::OLD);
+    ASSERT_EQ(vertex->GetProperties(properties, memgraph::storage::View::NEW).GetError(),
+              memgraph::storage::Error::DELETED_OBJECT);
+    acc.Abort();
+  }
+}
+
 TEST(StorageV2, VertexNonexistentLabelPropertyEdgeAPI) {
   memgraph::storage::Storage store;
 
@@ -2593,3 +2644,87 @@ TEST(StorageV2, DeletedVertexAccessor) {
     ASSERT_EQ(property_value, *maybe_property);
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2, VertexOrdinalsSharedBetweenTransactions) {
+  memgraph::storage::Storage store;
+  {
+    auto acc = store.Access();
+    acc.CreateVertex();
+    acc.CreateVertex();
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  auto first = store.Access();
+  const auto first_ordinals = first.GetVertexOrdinals(memgraph::storage::View::OLD);
+  EXPECT_EQ(first_ordinals.size(), 2);
+  {
+    // Transactions which see the same vertices share the numbering.
+    auto acc = store.Access();
+    EXPECT_EQ(&acc.GetVertexOrdinals(memgraph::storage::View::OLD).numbering(), &first_ordinals.numbering());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  memgraph::storage::Gid gid;
+  {
+    // A transaction with its own vertices gets its own numbering.
+    auto acc = store.Access();
+    gid = acc.CreateVertex().Gid();
+    const auto ordinals = acc.GetVertexOrdinals(memgraph::storage::View::NEW);
+    EXPECT_NE(&ordinals.numbering(), &first_ordinals.numbering());
+    EXPECT_EQ(ordinals.size(), 3);
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    // The numbering isn't shared with transactions that see the new vertex.
+    auto acc = store.Access();
+    const auto ordinals = acc.GetVertexOrdinals(memgraph::storage::View::OLD);
+    EXPECT_NE(&ordinals.numbering(), &first_ordinals.numbering());
+    EXPECT_EQ(ordinals.size(), 3);
+    ASSERT_TRUE(ordinals.Ordinal(gid));
+    EXPECT_EQ(ordinals.Vertex(*ordinals.Ordinal(gid)).Gid(), gid);
+    auto vertex = acc.FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(acc.DeleteVertex(&*vertex).HasError());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    auto acc = store.Access();
+    const auto ordinals = acc.GetVertexOrdinals(memgraph::storage::View::OLD);
+    EXPECT_EQ(ordinals.size(), 2);
+    EXPECT_FALSE(ordinals.Ordinal(gid));
+  }
+  // Transactions that started earlier still see their vertices.
+  EXPECT_EQ(first.GetVertexOrdinals(memgraph::storage::View::OLD).size(), 2);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2, VertexOrdinalsBuiltInParallel) {
+  memgraph::storage::Storage store;
+  std::vector<memgraph::storage::Gid> gids;
+  {
+    auto acc = store.Access();
+    for (int i = 0; i < 10000; ++i) gids.push_back(acc.CreateVertex().Gid());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    // A deleted vertex isn't numbered.
+    auto acc = store.Access();
+    auto vertex = acc.FindVertex(gids[5000], memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(acc.DeleteVertex(&*vertex).HasError());
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  memgraph::utils::ThreadPool pool{3};
+  auto acc = store.Access();
+  const auto ordinals = acc.GetVertexOrdinals(memgraph::storage::View::OLD, &pool);
+  ASSERT_EQ(ordinals.size(), gids.size() - 1);
+  // The parts are numbered in order, so the ordinals follow the Gids.
+  for (uint64_t ordinal = 0; ordinal < ordinals.size(); ++ordinal) {
+    const auto gid = gids[ordinal < 5000 ? ordinal : ordinal + 1];
+    ASSERT_EQ(ordinals.Vertex(ordinal).Gid(), gid);
+    ASSERT_EQ(ordinals.Ordinal(gid), ordinal);
+  }
+  EXPECT_FALSE(ordinals.Ordinal(gids[5000]));
+}
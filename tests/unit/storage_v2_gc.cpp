@@ -198,3 +198,183 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// Collections with more deltas than the step limit are done in several steps,
+// which must leave the storage and the indices in the same state as a single
+// step would.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, IncrementalSteps) {
+  memgraph::storage::Storage storage(memgraph::storage::Config{
+      .gc = {.type = memgraph::storage::Config::Gc::Type::NONE, .max_deltas_per_step = 7, .parallel_workers = 3}});
+
+  ASSERT_FALSE(storage.CreateIndex(storage.NameToLabel("label")).HasError());
+
+  std::vector<memgraph::storage::Gid> vertices;
+  {
+    auto acc = storage.Access();
+    for (int64_t i = 0; i < 1000; ++i) {
+      auto vertex = acc.CreateVertex();
+      vertices.push_back(vertex.Gid());
+      ASSERT_TRUE(*vertex.AddLabel(acc.NameToLabel("label")));
+      ASSERT_FALSE(vertex.SetProperty(acc.NameToProperty("id"), memgraph::storage::PropertyValue(i)).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    auto acc = storage.Access();
+    for (uint64_t i = 0; i < vertices.size(); i += 2) {
+      auto vertex = acc.FindVertex(vertices[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex.has_value());
+      ASSERT_FALSE(acc.DeleteVertex(&*vertex).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  {
+    // A forced collection can't take the main lock while an accessor is
+    // active, so it does a regular collection in steps instead. The deleted
+    // vertices are freed by the second collection, once no transaction can
+    // see them.
+    auto acc = storage.Access();
+    storage.FreeMemory();
+    EXPECT_GT(storage.GetGcInfo().last_steps, 1);
+  }
+  storage.FreeMemory();
+
+  auto gc_info = storage.GetGcInfo();
+  EXPECT_GE(gc_info.unlinked_deltas, 3500);
+  EXPECT_GT(gc_info.steps, gc_info.runs);
+  EXPECT_EQ(storage.GetInfo().vertex_count, 500);
+
+  auto acc = storage.Access();
+  int64_t count = 0;
+  for (auto vertex : acc.Vertices(acc.NameToLabel("label"), memgraph::storage::View::OLD)) {
+    auto id = vertex.GetProperty(acc.NameToProperty("id"), memgraph::storage::View::OLD);
+    ASSERT_TRUE(id.HasValue());
+    EXPECT_EQ(id->ValueInt() % 2, 1);
+    ++count;
+  }
+  EXPECT_EQ(count, 500);
+}
+
+// The index cleanup is split into steps as well, so a large index doesn't
+// hold the main lock for a whole traversal even when there are few deltas.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, IncrementalIndexCleanup) {
+  memgraph::storage::Storage storage(memgraph::storage::Config{
+      .gc = {.type = memgraph::storage::Config::Gc::Type::NONE, .max_deltas_per_step = 10, .parallel_workers = 3}});
+  const auto label = storage.NameToLabel("label");
+  const auto property = storage.NameToProperty("id");
+  ASSERT_FALSE(storage.CreateIndex(label).HasError());
+  ASSERT_FALSE(storage.CreateIndex(label, property).HasError());
+
+  constexpr int64_t kVertexCount = 1000;
+  std::vector<memgraph::storage::Gid> vertices;
+  {
+    auto acc = storage.Access();
+    for (int64_t i = 0; i < kVertexCount; ++i) {
+      auto vertex = acc.CreateVertex();
+      vertices.push_back(vertex.Gid());
+      ASSERT_TRUE(*vertex.AddLabel(label));
+      ASSERT_FALSE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  storage.FreeMemory();
+
+  // Only the first and the last vertex are deleted, so there are few deltas
+  // but all of the index entries have to be checked.
+  {
+    auto acc = storage.Access();
+    for (const auto gid : {vertices.front(), vertices.back()}) {
+      auto vertex = acc.FindVertex(gid, memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex.has_value());
+      ASSERT_FALSE(acc.DeleteVertex(&*vertex).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    auto acc = storage.Access();
+    storage.FreeMemory();
+    EXPECT_GT(storage.GetGcInfo().last_steps, 2 * kVertexCount / 10 / 2);
+    EXPECT_EQ(acc.ApproximateVertexCount(label), kVertexCount - 2);
+    EXPECT_EQ(acc.ApproximateVertexCount(label, property), kVertexCount - 2);
+  }
+  storage.FreeMemory();
+  EXPECT_EQ(storage.GetInfo().vertex_count, kVertexCount - 2);
+
+  auto acc = storage.Access();
+  int64_t count = 0;
+  for (auto vertex : acc.Vertices(label, property, memgraph::storage::View::OLD)) {
+    auto id = vertex.GetProperty(property, memgraph::storage::View::OLD);
+    ASSERT_TRUE(id.HasValue());
+    EXPECT_NE(id->ValueInt(), 0);
+    EXPECT_NE(id->ValueInt(), kVertexCount - 1);
+    ++count;
+  }
+  EXPECT_EQ(count, kVertexCount - 2);
+}
+
+// Large indices are partitioned between the GC workers. The obsolete entries
+// must be removed no matter which part they end up in, including the older
+// entries of a vertex whose newer entry begins the next part.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, PartitionedIndexCleanup) {
+  memgraph::storage::Storage storage(
+      memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE, .parallel_workers = 4}});
+  const auto label = storage.NameToLabel("label");
+  const auto property = storage.NameToProperty("id");
+  ASSERT_FALSE(storage.CreateIndex(label).HasError());
+  ASSERT_FALSE(storage.CreateIndex(label, property).HasError());
+
+  constexpr int64_t kVertexCount = 40000;
+  std::vector<memgraph::storage::Gid> vertices;
+  {
+    auto acc = storage.Access();
+    for (int64_t i = 0; i < kVertexCount; ++i) {
+      auto vertex = acc.CreateVertex();
+      vertices.push_back(vertex.Gid());
+      ASSERT_TRUE(*vertex.AddLabel(label));
+      ASSERT_FALSE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc.Vertices(memgraph::storage::View::OLD)) {
+      ASSERT_TRUE(*vertex.RemoveLabel(label));
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    // The even vertices get a second label index entry next to the first one
+    // and a second label-property index entry with the new value.
+    auto acc = storage.Access();
+    for (size_t i = 0; i < vertices.size(); i += 2) {
+      auto vertex = acc.FindVertex(vertices[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex.has_value());
+      ASSERT_TRUE(*vertex->AddLabel(label));
+      ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(-1)).HasError());
+    }
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+  {
+    auto acc = storage.Access();
+    EXPECT_EQ(acc.ApproximateVertexCount(label), kVertexCount * 3 / 2);
+    EXPECT_EQ(acc.ApproximateVertexCount(label, property), kVertexCount * 2);
+  }
+
+  storage.FreeMemory();
+
+  auto acc = storage.Access();
+  EXPECT_EQ(acc.ApproximateVertexCount(label), kVertexCount / 2);
+  EXPECT_EQ(acc.ApproximateVertexCount(label, property), kVertexCount / 2);
+  int64_t count = 0;
+  for (auto vertex : acc.Vertices(label, property, memgraph::storage::View::OLD)) {
+    auto id = vertex.GetProperty(property, memgraph::storage::View::OLD);
+    ASSERT_TRUE(id.HasValue());
+    EXPECT_EQ(id->ValueInt(), -1);
+    ++count;
+  }
+  EXPECT_EQ(count, kVertexCount / 2);
+}
@@ -830,3 +830,214 @@ TEST_F(IndexTest, LabelPropertyIndexMixedIteration) {
   // Iteration without any bounds should return all items of the index.
   verify(std::nullopt, std::nullopt, values);
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, PropertyColumnSummary) {
+  EXPECT_TRUE(storage.CreatePropertyColumn(label1, prop_val));
+  EXPECT_FALSE(storage.CreatePropertyColumn(label1, prop_val));
+  EXPECT_EQ(storage.ListAllPropertyColumns(), (std::vector<std::pair<LabelId, PropertyId>>{{label1, prop_val}}));
+
+  {
+    auto acc = storage.Access();
+    for (int64_t i = 0; i < 10; ++i) {
+      auto vertex = CreateVertex(&acc);
+      ASSERT_NO_ERROR(vertex.AddLabel(i % 2 == 0 ? label1 : label2));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i)));
+    }
+    auto without_value = CreateVertex(&acc);
+    ASSERT_NO_ERROR(without_value.AddLabel(label1));
+    ASSERT_FALSE(acc.Commit().HasError());
+  }
+
+  auto acc1 = storage.Access();
+  auto summary = acc1.SummarizePropertyColumn(label1, prop_val, View::OLD);
+  ASSERT_TRUE(summary);
+  EXPECT_EQ(summary->vertex_count, 6);
+  EXPECT_EQ(summary->value_count, 5);
+  EXPECT_EQ(summary->int_sum, 0 + 2 + 4 + 6 + 8);
+  EXPECT_EQ(summary->int_min, 0);
+  EXPECT_EQ(summary->int_max, 8);
+  EXPECT_EQ(summary->double_count, 0);
+  EXPECT_FALSE(acc1.SummarizePropertyColumn(label2, prop_val, View::OLD));
+
+  {
+    auto acc2 = storage.Access();
+    for (auto vertex : acc2.Vertices(View::OLD)) {
+      auto id = vertex.GetProperty(prop_id, View::OLD)->ValueInt();
+      if (id == 0) ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(2.5)));
+      if (id == 2) ASSERT_NO_ERROR(vertex.RemoveLabel(label1));
+      if (id == 3) ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      if (id == 4) ASSERT_NO_ERROR(acc2.DeleteVertex(&vertex));
+    }
+    summary = acc2.SummarizePropertyColumn(label1, prop_val, View::NEW);
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->vertex_count, 5);
+    EXPECT_EQ(summary->int_sum, 3 + 6 + 8);
+    EXPECT_EQ(summary->double_count, 1);
+    EXPECT_EQ(summary->double_sum, 2.5);
+
+    // The changes aren't visible to the older transaction.
+    summary = acc1.SummarizePropertyColumn(label1, prop_val, View::OLD);
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->vertex_count, 6);
+    EXPECT_EQ(summary->int_sum, 0 + 2 + 4 + 6 + 8);
+    ASSERT_FALSE(acc2.Commit().HasError());
+  }
+
+  {
+    // Values which aren't numbers can't be summarized. The column is restored
+    // when the change is aborted.
+    auto acc3 = storage.Access();
+    for (auto vertex : acc3.Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue("string")));
+    }
+    EXPECT_FALSE(acc3.SummarizePropertyColumn(label1, prop_val, View::NEW));
+    acc3.Abort();
+  }
+
+  acc1.Abort();
+  {
+    auto acc4 = storage.Access();
+    summary = acc4.SummarizePropertyColumn(label1, prop_val, View::OLD);
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->vertex_count, 5);
+    EXPECT_EQ(summary->value_count, 4);
+    EXPECT_EQ(summary->int_sum, 3 + 6 + 8);
+    EXPECT_EQ(summary->double_sum, 2.5);
+  }
+
+  {
+    // Once the garbage collector removed the deltas, the committed values are
+    // read without the deltas, until they're changed again.
+    storage.FreeMemory();
+    auto acc5 = storage.Access();
+    summary = acc5.SummarizePropertyColumn(label1, prop_val, View::OLD);
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->vertex_count, 5);
+    EXPECT_EQ(summary->int_sum, 3 + 6 + 8);
+
+    auto acc6 = storage.Access();
+    for (auto vertex : acc6.Vertices(View::OLD)) {
+      auto id = vertex.GetProperty(prop_id, View::OLD)->ValueInt();
+      if (id == 3) ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(30)));
+      if (id == 6) ASSERT_NO_ERROR(vertex.RemoveLabel(label1));
+      if (id == 8) ASSERT_NO_ERROR(acc6.DeleteVertex(&vertex));
+    }
+    ASSERT_FALSE(acc6.Commit().HasError());
+
+    summary = acc5.SummarizePropertyColumn(label1, prop_val, View::OLD);
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->vertex_count, 5);
+    EXPECT_EQ(summary->int_sum, 3 + 6 + 8);
+    auto acc7 = storage.Access();
+    summary = acc7.SummarizePropertyColumn(label1, prop_val, View::OLD);
+    ASSERT_TRUE(summary);
+    EXPECT_EQ(summary->vertex_count, 3);
+    EXPECT_EQ(summary->int_sum, 30);
+    EXPECT_EQ(summary->double_sum, 2.5);
+  }
+  EXPECT_TRUE(storage.DropPropertyColumn(label1, prop_val));
+  EXPECT_FALSE(storage.DropPropertyColumn(label1, prop_val));
+  EXPECT_TRUE(storage.ListAllPropertyColumns().empty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(IndexTest, PartitionVertices) {
+  EXPECT_FALSE(storage.CreateIndex(label1).HasError());
+  EXPECT_FALSE(storage.CreateIndex(label1, prop_val).HasError());
+
+  const int kNumVertices = 10000;
+  std::vector<int64_t> all_ids;
+  std::vector<int64_t> label1_ids;
+  std::vector<int64_t> value_ids;
+  {
+    auto acc = storage.Access();
+    for (int i = 0; i < kNumVertices; ++i) {
+      auto vertex = CreateVertex(&acc);
+      all_ids.push_back(i);
+      if (i % 3 != 0) continue;
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i % 7)));
+      label1_ids.push_back(i);
+      if (i % 7 >= 2 && i % 7 < 5) value_ids.push_back(i);
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+  // Vertices get multiple index entries when they are updated, which mustn't
+  // be yielded more than once when they end up in different parts.
+  for (int update = 0; update < 3; ++update) {
+    auto acc = storage.Access();
+    for (auto vertex : acc.Vertices(label1, View::OLD)) {
+      ASSERT_NO_ERROR(vertex.RemoveLabel(label1));
+      ASSERT_NO_ERROR(vertex.AddLabel(label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, *vertex.GetProperty(prop_val, View::OLD)));
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  auto get_ids = [this](std::vector<VerticesIterable> parts) {
+    std::vector<int64_t> ids;
+    for (auto &part : parts) {
+      auto part_ids = GetIds(std::move(part));
+      ids.insert(ids.end(), part_ids.begin(), part_ids.end());
+    }
+    return ids;
+  };
+
+  auto acc = storage.Access();
+  for (uint64_t num_parts : {1, 2, 5, 64}) {
+    auto parts = acc.PartitionVertices(View::OLD, num_parts);
+    EXPECT_LE(parts.size(), num_parts);
+    EXPECT_THAT(get_ids(std::move(parts)), testing::UnorderedElementsAreArray(all_ids));
+
+    parts = acc.PartitionVertices(label1, View::OLD, num_parts);
+    EXPECT_LE(parts.size(), num_parts);
+    EXPECT_THAT(get_ids(std::move(parts)), testing::UnorderedElementsAreArray(label1_ids));
+
+    parts = acc.PartitionVertices(label1, prop_val, std::nullopt, std::nullopt, View::OLD, num_parts);
+    EXPECT_LE(parts.size(), num_parts);
+    EXPECT_THAT(get_ids(std::move(parts)), testing::UnorderedElementsAreArray(label1_ids));
+
+    parts = acc.PartitionVertices(label1, prop_val, memgraph::utils::MakeBoundInclusive(PropertyValue(2)),
+                                  memgraph::utils::MakeBoundExclusive(PropertyValue(5)), View::OLD, num_parts);
+    EXPECT_LE(parts.size(), num_parts);
+    EXPECT_THAT(get_ids(std::move(parts)), testing::UnorderedElementsAreArray(value_ids));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(IndexBuildTest, CreateIndexInParallel) {
+  // The indices are built on the workers of the GC.
+  Storage storage({.gc = {.type = Config::Gc::Type::NONE, .parallel_workers = 4}});
+  std::vector<Gid> labeled;
+  std::vector<Gid> with_value;
+  LabelId label;
+  PropertyId property;
+  {
+    auto acc = storage.Access();
+    label = acc.NameToLabel("label");
+    property = acc.NameToProperty("property");
+    for (int i = 0; i < 10000; ++i) {
+      auto vertex = acc.CreateVertex();
+      if (i % 3 == 0) continue;
+      ASSERT_NO_ERROR(vertex.AddLabel(label));
+      labeled.push_back(vertex.Gid());
+      if (i % 2 == 0) continue;
+      ASSERT_NO_ERROR(vertex.SetProperty(property, PropertyValue(i)));
+      with_value.push_back(vertex.Gid());
+    }
+    ASSERT_NO_ERROR(acc.Commit());
+  }
+
+  ASSERT_FALSE(storage.CreateIndex(label).HasError());
+  ASSERT_FALSE(storage.CreateIndex(label, property).HasError());
+
+  auto get_gids = [](VerticesIterable vertices) {
+    std::vector<Gid> gids;
+    for (auto vertex : vertices) gids.push_back(vertex.Gid());
+    return gids;
+  };
+  auto acc = storage.Access();
+  EXPECT_THAT(get_gids(acc.Vertices(label, View::OLD)), testing::UnorderedElementsAreArray(labeled));
+  EXPECT_THAT(get_gids(acc.Vertices(label, property, View::OLD)), testing::UnorderedElementsAreArray(with_value));
+}
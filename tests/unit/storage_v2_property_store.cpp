@@ -13,9 +13,12 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <map>
+#include <random>
 
 #include "storage/v2/property_store.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 
 using testing::UnorderedElementsAre;
@@ -56,12 +59,12 @@ const memgraph::storage::PropertyValue kSampleValues[] = {
 
 void TestIsPropertyEqual(const memgraph::storage::PropertyStore &store, memgraph::storage::PropertyId property,
                          const memgraph::storage::PropertyValue &value) {
-  ASSERT_TRUE(store.IsPropertyEqual(property, value));
+  ASSERT_TRUE(store.IsPropertyEqual(property, value, nullptr));
   for (const auto &sample : kSampleValues) {
     if (sample == value) {
-      ASSERT_TRUE(store.IsPropertyEqual(property, sample));
+      ASSERT_TRUE(store.IsPropertyEqual(property, sample, nullptr));
     } else {
-      ASSERT_FALSE(store.IsPropertyEqual(property, sample));
+      ASSERT_FALSE(store.IsPropertyEqual(property, sample, nullptr));
     }
   }
 }
@@ -70,17 +73,17 @@ TEST(PropertyStore, Simple) {
   memgraph::storage::PropertyStore props;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   auto value = memgraph::storage::PropertyValue(42);
-  ASSERT_TRUE(props.SetProperty(prop, value));
-  ASSERT_EQ(props.GetProperty(prop), value);
+  ASSERT_TRUE(props.SetProperty(prop, value, nullptr));
+  ASSERT_EQ(props.GetProperty(prop, nullptr), value);
   ASSERT_TRUE(props.HasProperty(prop));
   TestIsPropertyEqual(props, prop, value);
-  ASSERT_THAT(props.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+  ASSERT_THAT(props.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
 
-  ASSERT_FALSE(props.SetProperty(prop, memgraph::storage::PropertyValue()));
-  ASSERT_TRUE(props.GetProperty(prop).IsNull());
+  ASSERT_FALSE(props.SetProperty(prop, memgraph::storage::PropertyValue(), nullptr));
+  ASSERT_TRUE(props.GetProperty(prop, nullptr).IsNull());
   ASSERT_FALSE(props.HasProperty(prop));
   TestIsPropertyEqual(props, prop, memgraph::storage::PropertyValue());
-  ASSERT_EQ(props.Properties().size(), 0);
+  ASSERT_EQ(props.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, SimpleLarge) {
@@ -88,165 +91,165 @@ TEST(PropertyStore, SimpleLarge) {
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   {
     auto value = memgraph::storage::PropertyValue(std::string(10000, 'a'));
-    ASSERT_TRUE(props.SetProperty(prop, value));
-    ASSERT_EQ(props.GetProperty(prop), value);
+    ASSERT_TRUE(props.SetProperty(prop, value, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), value);
     ASSERT_TRUE(props.HasProperty(prop));
     TestIsPropertyEqual(props, prop, value);
-    ASSERT_THAT(props.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+    ASSERT_THAT(props.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   }
   {
     auto value =
         memgraph::storage::PropertyValue(memgraph::storage::TemporalData(memgraph::storage::TemporalType::Date, 23));
-    ASSERT_FALSE(props.SetProperty(prop, value));
-    ASSERT_EQ(props.GetProperty(prop), value);
+    ASSERT_FALSE(props.SetProperty(prop, value, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), value);
     ASSERT_TRUE(props.HasProperty(prop));
     TestIsPropertyEqual(props, prop, value);
-    ASSERT_THAT(props.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+    ASSERT_THAT(props.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   }
 
-  ASSERT_FALSE(props.SetProperty(prop, memgraph::storage::PropertyValue()));
-  ASSERT_TRUE(props.GetProperty(prop).IsNull());
+  ASSERT_FALSE(props.SetProperty(prop, memgraph::storage::PropertyValue(), nullptr));
+  ASSERT_TRUE(props.GetProperty(prop, nullptr).IsNull());
   ASSERT_FALSE(props.HasProperty(prop));
   TestIsPropertyEqual(props, prop, memgraph::storage::PropertyValue());
-  ASSERT_EQ(props.Properties().size(), 0);
+  ASSERT_EQ(props.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, EmptySetToNull) {
   memgraph::storage::PropertyStore props;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
-  ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue()));
-  ASSERT_TRUE(props.GetProperty(prop).IsNull());
+  ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue(), nullptr));
+  ASSERT_TRUE(props.GetProperty(prop, nullptr).IsNull());
   ASSERT_FALSE(props.HasProperty(prop));
   TestIsPropertyEqual(props, prop, memgraph::storage::PropertyValue());
-  ASSERT_EQ(props.Properties().size(), 0);
+  ASSERT_EQ(props.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, Clear) {
   memgraph::storage::PropertyStore props;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   auto value = memgraph::storage::PropertyValue(42);
-  ASSERT_TRUE(props.SetProperty(prop, value));
-  ASSERT_EQ(props.GetProperty(prop), value);
+  ASSERT_TRUE(props.SetProperty(prop, value, nullptr));
+  ASSERT_EQ(props.GetProperty(prop, nullptr), value);
   ASSERT_TRUE(props.HasProperty(prop));
   TestIsPropertyEqual(props, prop, value);
-  ASSERT_THAT(props.Properties(), UnorderedElementsAre(std::pair(prop, value)));
-  ASSERT_TRUE(props.ClearProperties());
-  ASSERT_TRUE(props.GetProperty(prop).IsNull());
+  ASSERT_THAT(props.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
+  ASSERT_TRUE(props.ClearProperties(nullptr));
+  ASSERT_TRUE(props.GetProperty(prop, nullptr).IsNull());
   ASSERT_FALSE(props.HasProperty(prop));
   TestIsPropertyEqual(props, prop, memgraph::storage::PropertyValue());
-  ASSERT_EQ(props.Properties().size(), 0);
+  ASSERT_EQ(props.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, EmptyClear) {
   memgraph::storage::PropertyStore props;
-  ASSERT_FALSE(props.ClearProperties());
-  ASSERT_EQ(props.Properties().size(), 0);
+  ASSERT_FALSE(props.ClearProperties(nullptr));
+  ASSERT_EQ(props.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, MoveConstruct) {
   memgraph::storage::PropertyStore props1;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   auto value = memgraph::storage::PropertyValue(42);
-  ASSERT_TRUE(props1.SetProperty(prop, value));
-  ASSERT_EQ(props1.GetProperty(prop), value);
+  ASSERT_TRUE(props1.SetProperty(prop, value, nullptr));
+  ASSERT_EQ(props1.GetProperty(prop, nullptr), value);
   ASSERT_TRUE(props1.HasProperty(prop));
   TestIsPropertyEqual(props1, prop, value);
-  ASSERT_THAT(props1.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+  ASSERT_THAT(props1.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   {
     memgraph::storage::PropertyStore props2(std::move(props1));
-    ASSERT_EQ(props2.GetProperty(prop), value);
+    ASSERT_EQ(props2.GetProperty(prop, nullptr), value);
     ASSERT_TRUE(props2.HasProperty(prop));
     TestIsPropertyEqual(props2, prop, value);
-    ASSERT_THAT(props2.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+    ASSERT_THAT(props2.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   }
   // NOLINTNEXTLINE(bugprone-use-after-move,clang-analyzer-cplusplus.Move,hicpp-invalid-access-moved)
-  ASSERT_TRUE(props1.GetProperty(prop).IsNull());
+  ASSERT_TRUE(props1.GetProperty(prop, nullptr).IsNull());
   ASSERT_FALSE(props1.HasProperty(prop));
   TestIsPropertyEqual(props1, prop, memgraph::storage::PropertyValue());
-  ASSERT_EQ(props1.Properties().size(), 0);
+  ASSERT_EQ(props1.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, MoveConstructLarge) {
   memgraph::storage::PropertyStore props1;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   auto value = memgraph::storage::PropertyValue(std::string(10000, 'a'));
-  ASSERT_TRUE(props1.SetProperty(prop, value));
-  ASSERT_EQ(props1.GetProperty(prop), value);
+  ASSERT_TRUE(props1.SetProperty(prop, value, nullptr));
+  ASSERT_EQ(props1.GetProperty(prop, nullptr), value);
   ASSERT_TRUE(props1.HasProperty(prop));
   TestIsPropertyEqual(props1, prop, value);
-  ASSERT_THAT(props1.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+  ASSERT_THAT(props1.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   {
     memgraph::storage::PropertyStore props2(std::move(props1));
-    ASSERT_EQ(props2.GetProperty(prop), value);
+    ASSERT_EQ(props2.GetProperty(prop, nullptr), value);
     ASSERT_TRUE(props2.HasProperty(prop));
     TestIsPropertyEqual(props2, prop, value);
-    ASSERT_THAT(props2.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+    ASSERT_THAT(props2.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   }
   // NOLINTNEXTLINE(bugprone-use-after-move,clang-analyzer-cplusplus.Move,hicpp-invalid-access-moved)
-  ASSERT_TRUE(props1.GetProperty(prop).IsNull());
+  ASSERT_TRUE(props1.GetProperty(prop, nullptr).IsNull());
   ASSERT_FALSE(props1.HasProperty(prop));
   TestIsPropertyEqual(props1, prop, memgraph::storage::PropertyValue());
-  ASSERT_EQ(props1.Properties().size(), 0);
+  ASSERT_EQ(props1.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, MoveAssign) {
   memgraph::storage::PropertyStore props1;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   auto value = memgraph::storage::PropertyValue(42);
-  ASSERT_TRUE(props1.SetProperty(prop, value));
-  ASSERT_EQ(props1.GetProperty(prop), value);
+  ASSERT_TRUE(props1.SetProperty(prop, value, nullptr));
+  ASSERT_EQ(props1.GetProperty(prop, nullptr), value);
   ASSERT_TRUE(props1.HasProperty(prop));
   TestIsPropertyEqual(props1, prop, value);
-  ASSERT_THAT(props1.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+  ASSERT_THAT(props1.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   {
     auto value2 = memgraph::storage::PropertyValue(68);
     memgraph::storage::PropertyStore props2;
-    ASSERT_TRUE(props2.SetProperty(prop, value2));
-    ASSERT_EQ(props2.GetProperty(prop), value2);
+    ASSERT_TRUE(props2.SetProperty(prop, value2, nullptr));
+    ASSERT_EQ(props2.GetProperty(prop, nullptr), value2);
     ASSERT_TRUE(props2.HasProperty(prop));
     TestIsPropertyEqual(props2, prop, value2);
-    ASSERT_THAT(props2.Properties(), UnorderedElementsAre(std::pair(prop, value2)));
+    ASSERT_THAT(props2.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value2)));
     props2 = std::move(props1);
-    ASSERT_EQ(props2.GetProperty(prop), value);
+    ASSERT_EQ(props2.GetProperty(prop, nullptr), value);
     ASSERT_TRUE(props2.HasProperty(prop));
     TestIsPropertyEqual(props2, prop, value);
-    ASSERT_THAT(props2.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+    ASSERT_THAT(props2.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   }
   // NOLINTNEXTLINE(bugprone-use-after-move,clang-analyzer-cplusplus.Move,hicpp-invalid-access-moved)
-  ASSERT_TRUE(props1.GetProperty(prop).IsNull());
+  ASSERT_TRUE(props1.GetProperty(prop, nullptr).IsNull());
   ASSERT_FALSE(props1.HasProperty(prop));
   TestIsPropertyEqual(props1, prop, memgraph::storage::PropertyValue());
-  ASSERT_EQ(props1.Properties().size(), 0);
+  ASSERT_EQ(props1.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, MoveAssignLarge) {
   memgraph::storage::PropertyStore props1;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   auto value = memgraph::storage::PropertyValue(std::string(10000, 'a'));
-  ASSERT_TRUE(props1.SetProperty(prop, value));
-  ASSERT_EQ(props1.GetProperty(prop), value);
+  ASSERT_TRUE(props1.SetProperty(prop, value, nullptr));
+  ASSERT_EQ(props1.GetProperty(prop, nullptr), value);
   ASSERT_TRUE(props1.HasProperty(prop));
   TestIsPropertyEqual(props1, prop, value);
-  ASSERT_THAT(props1.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+  ASSERT_THAT(props1.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   {
     auto value2 = memgraph::storage::PropertyValue(std::string(10000, 'b'));
     memgraph::storage::PropertyStore props2;
-    ASSERT_TRUE(props2.SetProperty(prop, value2));
-    ASSERT_EQ(props2.GetProperty(prop), value2);
+    ASSERT_TRUE(props2.SetProperty(prop, value2, nullptr));
+    ASSERT_EQ(props2.GetProperty(prop, nullptr), value2);
     ASSERT_TRUE(props2.HasProperty(prop));
     TestIsPropertyEqual(props2, prop, value2);
-    ASSERT_THAT(props2.Properties(), UnorderedElementsAre(std::pair(prop, value2)));
+    ASSERT_THAT(props2.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value2)));
     props2 = std::move(props1);
-    ASSERT_EQ(props2.GetProperty(prop), value);
+    ASSERT_EQ(props2.GetProperty(prop, nullptr), value);
     ASSERT_TRUE(props2.HasProperty(prop));
     TestIsPropertyEqual(props2, prop, value);
-    ASSERT_THAT(props2.Properties(), UnorderedElementsAre(std::pair(prop, value)));
+    ASSERT_THAT(props2.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
   }
   // NOLINTNEXTLINE(bugprone-use-after-move,clang-analyzer-cplusplus.Move,hicpp-invalid-access-moved)
-  ASSERT_TRUE(props1.GetProperty(prop).IsNull());
+  ASSERT_TRUE(props1.GetProperty(prop, nullptr).IsNull());
   ASSERT_FALSE(props1.HasProperty(prop));
   TestIsPropertyEqual(props1, prop, memgraph::storage::PropertyValue());
-  ASSERT_EQ(props1.Properties().size(), 0);
+  ASSERT_EQ(props1.Properties(nullptr).size(), 0);
 }
 
 TEST(PropertyStore, EmptySet) {
@@ -265,26 +268,26 @@ TEST(PropertyStore, EmptySet) {
   for (const auto &value : data) {
     memgraph::storage::PropertyStore props;
 
-    ASSERT_TRUE(props.SetProperty(prop, value));
-    ASSERT_EQ(props.GetProperty(prop), value);
+    ASSERT_TRUE(props.SetProperty(prop, value, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), value);
     ASSERT_TRUE(props.HasProperty(prop));
     TestIsPropertyEqual(props, prop, value);
-    ASSERT_THAT(props.Properties(), UnorderedElementsAre(std::pair(prop, value)));
-    ASSERT_FALSE(props.SetProperty(prop, value));
-    ASSERT_EQ(props.GetProperty(prop), value);
+    ASSERT_THAT(props.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
+    ASSERT_FALSE(props.SetProperty(prop, value, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), value);
     ASSERT_TRUE(props.HasProperty(prop));
     TestIsPropertyEqual(props, prop, value);
-    ASSERT_THAT(props.Properties(), UnorderedElementsAre(std::pair(prop, value)));
-    ASSERT_FALSE(props.SetProperty(prop, memgraph::storage::PropertyValue()));
-    ASSERT_TRUE(props.GetProperty(prop).IsNull());
+    ASSERT_THAT(props.Properties(nullptr), UnorderedElementsAre(std::pair(prop, value)));
+    ASSERT_FALSE(props.SetProperty(prop, memgraph::storage::PropertyValue(), nullptr));
+    ASSERT_TRUE(props.GetProperty(prop, nullptr).IsNull());
     ASSERT_FALSE(props.HasProperty(prop));
     TestIsPropertyEqual(props, prop, memgraph::storage::PropertyValue());
-    ASSERT_EQ(props.Properties().size(), 0);
-    ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue()));
-    ASSERT_TRUE(props.GetProperty(prop).IsNull());
+    ASSERT_EQ(props.Properties(nullptr).size(), 0);
+    ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue(), nullptr));
+    ASSERT_TRUE(props.GetProperty(prop, nullptr).IsNull());
     ASSERT_FALSE(props.HasProperty(prop));
     TestIsPropertyEqual(props, prop, memgraph::storage::PropertyValue());
-    ASSERT_EQ(props.Properties().size(), 0);
+    ASSERT_EQ(props.Properties(nullptr).size(), 0);
   }
 }
 
@@ -314,18 +317,18 @@ TEST(PropertyStore, FullSet) {
   memgraph::storage::PropertyStore props;
   for (const auto &target : data) {
     for (const auto &item : data) {
-      ASSERT_TRUE(props.SetProperty(item.first, item.second));
+      ASSERT_TRUE(props.SetProperty(item.first, item.second, nullptr));
     }
 
     for (size_t i = 0; i < alt.size(); ++i) {
       if (i == 1) {
-        ASSERT_TRUE(props.SetProperty(target.first, alt[i]));
+        ASSERT_TRUE(props.SetProperty(target.first, alt[i], nullptr));
       } else {
-        ASSERT_FALSE(props.SetProperty(target.first, alt[i]));
+        ASSERT_FALSE(props.SetProperty(target.first, alt[i], nullptr));
       }
       for (const auto &item : data) {
         if (item.first == target.first) {
-          ASSERT_EQ(props.GetProperty(item.first), alt[i]);
+          ASSERT_EQ(props.GetProperty(item.first, nullptr), alt[i]);
           if (alt[i].IsNull()) {
             ASSERT_FALSE(props.HasProperty(item.first));
           } else {
@@ -333,7 +336,7 @@ TEST(PropertyStore, FullSet) {
           }
           TestIsPropertyEqual(props, item.first, alt[i]);
         } else {
-          ASSERT_EQ(props.GetProperty(item.first), item.second);
+          ASSERT_EQ(props.GetProperty(item.first, nullptr), item.second);
           ASSERT_TRUE(props.HasProperty(item.first));
           TestIsPropertyEqual(props, item.first, item.second);
         }
@@ -344,14 +347,14 @@ TEST(PropertyStore, FullSet) {
       } else {
         current[target.first] = alt[i];
       }
-      ASSERT_EQ(props.Properties(), current);
+      ASSERT_EQ(props.Properties(nullptr), current);
     }
 
     for (ssize_t i = alt.size() - 1; i >= 0; --i) {
-      ASSERT_FALSE(props.SetProperty(target.first, alt[i]));
+      ASSERT_FALSE(props.SetProperty(target.first, alt[i], nullptr));
       for (const auto &item : data) {
         if (item.first == target.first) {
-          ASSERT_EQ(props.GetProperty(item.first), alt[i]);
+          ASSERT_EQ(props.GetProperty(item.first, nullptr), alt[i]);
           if (alt[i].IsNull()) {
             ASSERT_FALSE(props.HasProperty(item.first));
           } else {
@@ -359,7 +362,7 @@ TEST(PropertyStore, FullSet) {
           }
           TestIsPropertyEqual(props, item.first, alt[i]);
         } else {
-          ASSERT_EQ(props.GetProperty(item.first), item.second);
+          ASSERT_EQ(props.GetProperty(item.first, nullptr), item.second);
           ASSERT_TRUE(props.HasProperty(item.first));
           TestIsPropertyEqual(props, item.first, item.second);
         }
@@ -370,18 +373,18 @@ TEST(PropertyStore, FullSet) {
       } else {
         current[target.first] = alt[i];
       }
-      ASSERT_EQ(props.Properties(), current);
+      ASSERT_EQ(props.Properties(nullptr), current);
     }
 
-    ASSERT_TRUE(props.SetProperty(target.first, target.second));
-    ASSERT_EQ(props.GetProperty(target.first), target.second);
+    ASSERT_TRUE(props.SetProperty(target.first, target.second, nullptr));
+    ASSERT_EQ(props.GetProperty(target.first, nullptr), target.second);
     ASSERT_TRUE(props.HasProperty(target.first));
     TestIsPropertyEqual(props, target.first, target.second);
 
-    props.ClearProperties();
-    ASSERT_EQ(props.Properties().size(), 0);
+    props.ClearProperties(nullptr);
+    ASSERT_EQ(props.Properties(nullptr).size(), 0);
     for (const auto &item : data) {
-      ASSERT_TRUE(props.GetProperty(item.first).IsNull());
+      ASSERT_TRUE(props.GetProperty(item.first, nullptr).IsNull());
       ASSERT_FALSE(props.HasProperty(item.first));
       TestIsPropertyEqual(props, item.first, memgraph::storage::PropertyValue());
     }
@@ -425,25 +428,25 @@ TEST(PropertyStore, IntEncoding) {
 
   memgraph::storage::PropertyStore props;
   for (const auto &item : data) {
-    ASSERT_TRUE(props.SetProperty(item.first, item.second));
-    ASSERT_EQ(props.GetProperty(item.first), item.second);
+    ASSERT_TRUE(props.SetProperty(item.first, item.second, nullptr));
+    ASSERT_EQ(props.GetProperty(item.first, nullptr), item.second);
     ASSERT_TRUE(props.HasProperty(item.first));
     TestIsPropertyEqual(props, item.first, item.second);
   }
   for (auto it = data.rbegin(); it != data.rend(); ++it) {
     const auto &item = *it;
-    ASSERT_FALSE(props.SetProperty(item.first, item.second));
-    ASSERT_EQ(props.GetProperty(item.first), item.second);
+    ASSERT_FALSE(props.SetProperty(item.first, item.second, nullptr));
+    ASSERT_EQ(props.GetProperty(item.first, nullptr), item.second);
     ASSERT_TRUE(props.HasProperty(item.first));
     TestIsPropertyEqual(props, item.first, item.second);
   }
 
-  ASSERT_EQ(props.Properties(), data);
+  ASSERT_EQ(props.Properties(nullptr), data);
 
-  props.ClearProperties();
-  ASSERT_EQ(props.Properties().size(), 0);
+  props.ClearProperties(nullptr);
+  ASSERT_EQ(props.Properties(nullptr).size(), 0);
   for (const auto &item : data) {
-    ASSERT_TRUE(props.GetProperty(item.first).IsNull());
+    ASSERT_TRUE(props.GetProperty(item.first, nullptr).IsNull());
     ASSERT_FALSE(props.HasProperty(item.first));
     TestIsPropertyEqual(props, item.first, memgraph::storage::PropertyValue());
   }
@@ -453,7 +456,7 @@ TEST(PropertyStore, IsPropertyEqualIntAndDouble) {
   memgraph::storage::PropertyStore props;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
 
-  ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue(42)));
+  ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue(42), nullptr));
 
   std::vector<std::pair<memgraph::storage::PropertyValue, memgraph::storage::PropertyValue>> tests{
       {memgraph::storage::PropertyValue(0), memgraph::storage::PropertyValue(0.0)},
@@ -468,18 +471,18 @@ TEST(PropertyStore, IsPropertyEqualIntAndDouble) {
     ASSERT_EQ(test.first, test.second);
 
     // Test first, second
-    ASSERT_FALSE(props.SetProperty(prop, test.first));
-    ASSERT_EQ(props.GetProperty(prop), test.first);
+    ASSERT_FALSE(props.SetProperty(prop, test.first, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), test.first);
     ASSERT_TRUE(props.HasProperty(prop));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first, nullptr));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second, nullptr));
 
     // Test second, first
-    ASSERT_FALSE(props.SetProperty(prop, test.second));
-    ASSERT_EQ(props.GetProperty(prop), test.second);
+    ASSERT_FALSE(props.SetProperty(prop, test.second, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), test.second);
     ASSERT_TRUE(props.HasProperty(prop));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second, nullptr));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first, nullptr));
 
     // Make both negative
     test.first = memgraph::storage::PropertyValue(test.first.ValueInt() * -1);
@@ -487,18 +490,18 @@ TEST(PropertyStore, IsPropertyEqualIntAndDouble) {
     ASSERT_EQ(test.first, test.second);
 
     // Test -first, -second
-    ASSERT_FALSE(props.SetProperty(prop, test.first));
-    ASSERT_EQ(props.GetProperty(prop), test.first);
+    ASSERT_FALSE(props.SetProperty(prop, test.first, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), test.first);
     ASSERT_TRUE(props.HasProperty(prop));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first, nullptr));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second, nullptr));
 
     // Test -second, -first
-    ASSERT_FALSE(props.SetProperty(prop, test.second));
-    ASSERT_EQ(props.GetProperty(prop), test.second);
+    ASSERT_FALSE(props.SetProperty(prop, test.second, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), test.second);
     ASSERT_TRUE(props.HasProperty(prop));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second, nullptr));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first, nullptr));
   }
 
   // Test equality with values wrapped in lists.
@@ -510,18 +513,18 @@ TEST(PropertyStore, IsPropertyEqualIntAndDouble) {
     ASSERT_EQ(test.first, test.second);
 
     // Test first, second
-    ASSERT_FALSE(props.SetProperty(prop, test.first));
-    ASSERT_EQ(props.GetProperty(prop), test.first);
+    ASSERT_FALSE(props.SetProperty(prop, test.first, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), test.first);
     ASSERT_TRUE(props.HasProperty(prop));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first, nullptr));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second, nullptr));
 
     // Test second, first
-    ASSERT_FALSE(props.SetProperty(prop, test.second));
-    ASSERT_EQ(props.GetProperty(prop), test.second);
+    ASSERT_FALSE(props.SetProperty(prop, test.second, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), test.second);
     ASSERT_TRUE(props.HasProperty(prop));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second, nullptr));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first, nullptr));
 
     // Make both negative
     test.first = memgraph::storage::PropertyValue(std::vector<memgraph::storage::PropertyValue>{
@@ -531,36 +534,36 @@ TEST(PropertyStore, IsPropertyEqualIntAndDouble) {
     ASSERT_EQ(test.first, test.second);
 
     // Test -first, -second
-    ASSERT_FALSE(props.SetProperty(prop, test.first));
-    ASSERT_EQ(props.GetProperty(prop), test.first);
+    ASSERT_FALSE(props.SetProperty(prop, test.first, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), test.first);
     ASSERT_TRUE(props.HasProperty(prop));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first, nullptr));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second, nullptr));
 
     // Test -second, -first
-    ASSERT_FALSE(props.SetProperty(prop, test.second));
-    ASSERT_EQ(props.GetProperty(prop), test.second);
+    ASSERT_FALSE(props.SetProperty(prop, test.second, nullptr));
+    ASSERT_EQ(props.GetProperty(prop, nullptr), test.second);
     ASSERT_TRUE(props.HasProperty(prop));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second));
-    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.second, nullptr));
+    ASSERT_TRUE(props.IsPropertyEqual(prop, test.first, nullptr));
   }
 }
 
 TEST(PropertyStore, IsPropertyEqualString) {
   memgraph::storage::PropertyStore props;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
-  ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue("test")));
-  ASSERT_TRUE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("test")));
+  ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue("test"), nullptr));
+  ASSERT_TRUE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("test"), nullptr));
 
   // Different length.
-  ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("helloworld")));
+  ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("helloworld"), nullptr));
 
   // Same length, different value.
-  ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("asdf")));
+  ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("asdf"), nullptr));
 
   // Shortened and extended.
-  ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("tes")));
-  ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("testt")));
+  ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("tes"), nullptr));
+  ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue("testt"), nullptr));
 }
 
 TEST(PropertyStore, IsPropertyEqualList) {
@@ -568,29 +571,30 @@ TEST(PropertyStore, IsPropertyEqualList) {
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   ASSERT_TRUE(
       props.SetProperty(prop, memgraph::storage::PropertyValue(std::vector<memgraph::storage::PropertyValue>{
-                                  memgraph::storage::PropertyValue(42), memgraph::storage::PropertyValue("test")})));
+                                  memgraph::storage::PropertyValue(42), memgraph::storage::PropertyValue("test")}),
+                        nullptr));
   ASSERT_TRUE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::vector<memgraph::storage::PropertyValue>{
-                memgraph::storage::PropertyValue(42), memgraph::storage::PropertyValue("test")})));
+                memgraph::storage::PropertyValue(42), memgraph::storage::PropertyValue("test")}), nullptr));
 
   // Different length.
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(
-                std::vector<memgraph::storage::PropertyValue>{memgraph::storage::PropertyValue(24)})));
+                std::vector<memgraph::storage::PropertyValue>{memgraph::storage::PropertyValue(24)}), nullptr));
 
   // Same length, different value.
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::vector<memgraph::storage::PropertyValue>{
-                memgraph::storage::PropertyValue(42), memgraph::storage::PropertyValue("asdf")})));
+                memgraph::storage::PropertyValue(42), memgraph::storage::PropertyValue("asdf")}), nullptr));
 
   // Shortened and extended.
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(
-                std::vector<memgraph::storage::PropertyValue>{memgraph::storage::PropertyValue(42)})));
+                std::vector<memgraph::storage::PropertyValue>{memgraph::storage::PropertyValue(42)}), nullptr));
   ASSERT_FALSE(
       props.IsPropertyEqual(prop, memgraph::storage::PropertyValue(std::vector<memgraph::storage::PropertyValue>{
                                       memgraph::storage::PropertyValue(42), memgraph::storage::PropertyValue("test"),
-                                      memgraph::storage::PropertyValue(true)})));
+                                      memgraph::storage::PropertyValue(true)}), nullptr));
 }
 
 TEST(PropertyStore, IsPropertyEqualMap) {
@@ -598,56 +602,61 @@ TEST(PropertyStore, IsPropertyEqualMap) {
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   ASSERT_TRUE(props.SetProperty(
       prop, memgraph::storage::PropertyValue(std::map<std::string, memgraph::storage::PropertyValue>{
-                {"abc", memgraph::storage::PropertyValue(42)}, {"zyx", memgraph::storage::PropertyValue("test")}})));
+                {"abc", memgraph::storage::PropertyValue(42)}, {"zyx", memgraph::storage::PropertyValue("test")}}),
+      nullptr));
   ASSERT_TRUE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::map<std::string, memgraph::storage::PropertyValue>{
-                {"abc", memgraph::storage::PropertyValue(42)}, {"zyx", memgraph::storage::PropertyValue("test")}})));
+                {"abc", memgraph::storage::PropertyValue(42)}, {"zyx", memgraph::storage::PropertyValue("test")}}),
+      nullptr));
 
   // Different length.
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::map<std::string, memgraph::storage::PropertyValue>{
-                {"fgh", memgraph::storage::PropertyValue(24)}})));
+                {"fgh", memgraph::storage::PropertyValue(24)}}), nullptr));
 
   // Same length, different value.
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::map<std::string, memgraph::storage::PropertyValue>{
-                {"abc", memgraph::storage::PropertyValue(42)}, {"zyx", memgraph::storage::PropertyValue("testt")}})));
+                {"abc", memgraph::storage::PropertyValue(42)}, {"zyx", memgraph::storage::PropertyValue("testt")}}),
+      nullptr));
 
   // Same length, different key (different length).
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::map<std::string, memgraph::storage::PropertyValue>{
-                {"abc", memgraph::storage::PropertyValue(42)}, {"zyxw", memgraph::storage::PropertyValue("test")}})));
+                {"abc", memgraph::storage::PropertyValue(42)}, {"zyxw", memgraph::storage::PropertyValue("test")}}),
+      nullptr));
 
   // Same length, different key (same length).
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::map<std::string, memgraph::storage::PropertyValue>{
-                {"abc", memgraph::storage::PropertyValue(42)}, {"zyw", memgraph::storage::PropertyValue("test")}})));
+                {"abc", memgraph::storage::PropertyValue(42)}, {"zyw", memgraph::storage::PropertyValue("test")}}),
+      nullptr));
 
   // Shortened and extended.
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::map<std::string, memgraph::storage::PropertyValue>{
-                {"abc", memgraph::storage::PropertyValue(42)}})));
+                {"abc", memgraph::storage::PropertyValue(42)}}), nullptr));
   ASSERT_FALSE(props.IsPropertyEqual(
       prop, memgraph::storage::PropertyValue(std::map<std::string, memgraph::storage::PropertyValue>{
                 {"abc", memgraph::storage::PropertyValue(42)},
                 {"sdf", memgraph::storage::PropertyValue(true)},
-                {"zyx", memgraph::storage::PropertyValue("test")}})));
+                {"zyx", memgraph::storage::PropertyValue("test")}}), nullptr));
 }
 
 TEST(PropertyStore, IsPropertyEqualTemporalData) {
   memgraph::storage::PropertyStore props;
   auto prop = memgraph::storage::PropertyId::FromInt(42);
   const memgraph::storage::TemporalData temporal{memgraph::storage::TemporalType::Date, 23};
-  ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue(temporal)));
-  ASSERT_TRUE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue(temporal)));
+  ASSERT_TRUE(props.SetProperty(prop, memgraph::storage::PropertyValue(temporal), nullptr));
+  ASSERT_TRUE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue(temporal), nullptr));
 
   // Different type.
   ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue(memgraph::storage::TemporalData{
-                                               memgraph::storage::TemporalType::Duration, 23})));
+                                               memgraph::storage::TemporalType::Duration, 23}), nullptr));
 
   // Same type, different value.
   ASSERT_FALSE(props.IsPropertyEqual(prop, memgraph::storage::PropertyValue(memgraph::storage::TemporalData{
-                                               memgraph::storage::TemporalType::Date, 30})));
+                                               memgraph::storage::TemporalType::Date, 30}), nullptr));
 }
 
 TEST(PropertyStore, SetMultipleProperties) {
@@ -666,9 +675,254 @@ TEST(PropertyStore, SetMultipleProperties) {
       {memgraph::storage::PropertyId::FromInt(6), memgraph::storage::PropertyValue(map)},
       {memgraph::storage::PropertyId::FromInt(7), memgraph::storage::PropertyValue(temporal)}};
 
-  store.InitProperties(data);
+  store.InitProperties(data, nullptr);
 
   for (auto &[key, value] : data) {
-    ASSERT_TRUE(store.IsPropertyEqual(key, value));
+    ASSERT_TRUE(store.IsPropertyEqual(key, value, nullptr));
   }
 }
+
+TEST(PropertyStore, GetProperties) {
+  memgraph::storage::PropertyStore store;
+  std::vector<memgraph::storage::PropertyId> all;
+  for (int i = 1; i <= 20; ++i) {
+    const auto prop = memgraph::storage::PropertyId::FromInt(i * 2);
+    all.push_back(prop);
+    // Mix values stored inline with ones stored in the heap buffer.
+    if (i % 3 == 0) {
+      ASSERT_TRUE(store.SetProperty(prop, memgraph::storage::PropertyValue(std::string(i * 10, 'a')), nullptr));
+    } else {
+      ASSERT_TRUE(store.SetProperty(prop, memgraph::storage::PropertyValue(i), nullptr));
+    }
+  }
+
+  auto values = store.GetProperties(all, nullptr);
+  ASSERT_EQ(values.size(), all.size());
+  for (size_t i = 0; i < all.size(); ++i) ASSERT_EQ(values[i], store.GetProperty(all[i], nullptr));
+
+  // Missing properties are interleaved with, before and after the stored ones.
+  const std::vector<memgraph::storage::PropertyId> some{
+      memgraph::storage::PropertyId::FromInt(1), memgraph::storage::PropertyId::FromInt(6),
+      memgraph::storage::PropertyId::FromInt(7), memgraph::storage::PropertyId::FromInt(12),
+      memgraph::storage::PropertyId::FromInt(40), memgraph::storage::PropertyId::FromInt(41)};
+  values = store.GetProperties(some, nullptr);
+  ASSERT_EQ(values.size(), some.size());
+  ASSERT_TRUE(values[0].IsNull());
+  ASSERT_EQ(values[1], memgraph::storage::PropertyValue(std::string(30, 'a')));
+  ASSERT_TRUE(values[2].IsNull());
+  ASSERT_EQ(values[3], memgraph::storage::PropertyValue(std::string(60, 'a')));
+  ASSERT_EQ(values[4], memgraph::storage::PropertyValue(20));
+  ASSERT_TRUE(values[5].IsNull());
+
+  memgraph::storage::PropertyStore empty;
+  values = empty.GetProperties(some, nullptr);
+  ASSERT_EQ(values.size(), some.size());
+  for (const auto &value : values) ASSERT_TRUE(value.IsNull());
+}
+
+TEST(PropertyStore, ManyProperties) {
+  // Stores with many properties are encoded with a directory. Grow the store
+  // past the threshold and shrink it back, checking it against a map.
+  memgraph::storage::PropertyStore store;
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> expected;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint64_t> prop_dist(0, 99);
+  std::uniform_int_distribution<int> op_dist(0, 9);
+  auto check = [&] {
+    ASSERT_EQ(store.Properties(nullptr), expected);
+    for (uint64_t i = 0; i < 100; ++i) {
+      const auto prop = memgraph::storage::PropertyId::FromUint(i);
+      auto found = expected.find(prop);
+      if (found == expected.end()) {
+        ASSERT_TRUE(store.GetProperty(prop, nullptr).IsNull());
+        ASSERT_FALSE(store.HasProperty(prop));
+        ASSERT_TRUE(store.IsPropertyEqual(prop, memgraph::storage::PropertyValue(), nullptr));
+      } else {
+        ASSERT_EQ(store.GetProperty(prop, nullptr), found->second);
+        ASSERT_TRUE(store.HasProperty(prop));
+        ASSERT_TRUE(store.IsPropertyEqual(prop, found->second, nullptr));
+      }
+    }
+  };
+
+  for (int round = 0; round < 2; ++round) {
+    // Mostly insertions in the first round and mostly removals in the second.
+    for (int i = 0; i < 1000; ++i) {
+      const auto prop = memgraph::storage::PropertyId::FromUint(prop_dist(gen));
+      const auto op = op_dist(gen);
+      if ((round == 0 && op < 2) || (round == 1 && op < 8)) {
+        ASSERT_EQ(store.SetProperty(prop, memgraph::storage::PropertyValue(), nullptr), !expected.contains(prop));
+        expected.erase(prop);
+      } else {
+        // Values of different sizes move the following properties.
+        const auto value = op % 2 == 0 ? memgraph::storage::PropertyValue(static_cast<int64_t>(i) << (op * 4))
+                                       : memgraph::storage::PropertyValue(std::string(op * 3, 'x'));
+        ASSERT_EQ(store.SetProperty(prop, value, nullptr), !expected.contains(prop));
+        expected[prop] = value;
+      }
+      if (i % 50 == 0) check();
+    }
+    check();
+  }
+
+  memgraph::storage::PropertyStore initialized;
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> properties;
+  for (uint64_t i = 0; i < 40; ++i) {
+    properties.emplace(memgraph::storage::PropertyId::FromUint(i * 3),
+                       memgraph::storage::PropertyValue(static_cast<int64_t>(i)));
+  }
+  ASSERT_TRUE(initialized.InitProperties(properties, nullptr));
+  ASSERT_EQ(initialized.Properties(nullptr), properties);
+  ASSERT_EQ(initialized.GetProperty(memgraph::storage::PropertyId::FromUint(39), nullptr),
+            memgraph::storage::PropertyValue(13));
+  ASSERT_TRUE(initialized.GetProperty(memgraph::storage::PropertyId::FromUint(40), nullptr).IsNull());
+  ASSERT_TRUE(initialized.ClearProperties(nullptr));
+  ASSERT_EQ(initialized.Properties(nullptr).size(), 0);
+}
+
+TEST(PropertyStore, ManyPropertiesUpdatedInPlace) {
+  // Buffers with a directory leave some space free, so small changes at the
+  // start, in the middle and at the end of the store are done in place.
+  memgraph::storage::PropertyStore store;
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> expected;
+  for (uint64_t i = 0; i < 40; ++i) {
+    const auto prop = memgraph::storage::PropertyId::FromUint(i * 2 + 2);
+    expected.emplace(prop, memgraph::storage::PropertyValue(static_cast<int64_t>(i)));
+  }
+  ASSERT_TRUE(store.InitProperties(expected, nullptr));
+  auto check = [&] {
+    ASSERT_EQ(store.Properties(nullptr), expected);
+    for (uint64_t i = 0; i < 90; ++i) {
+      const auto prop = memgraph::storage::PropertyId::FromUint(i);
+      auto found = expected.find(prop);
+      ASSERT_EQ(store.GetProperty(prop, nullptr),
+                found == expected.end() ? memgraph::storage::PropertyValue() : found->second);
+    }
+  };
+
+  for (uint64_t id : {0, 1, 41, 81, 85}) {
+    // New properties before, between and after the existing ones.
+    const auto prop = memgraph::storage::PropertyId::FromUint(id);
+    const memgraph::storage::PropertyValue value(static_cast<int64_t>(id) << 20);
+    ASSERT_TRUE(store.SetProperty(prop, value, nullptr));
+    expected[prop] = value;
+    check();
+  }
+  for (uint64_t id : {0, 40, 85}) {
+    // Larger and smaller values of existing properties.
+    const auto prop = memgraph::storage::PropertyId::FromUint(id);
+    for (const auto &value : {memgraph::storage::PropertyValue("abc"), memgraph::storage::PropertyValue(1.5),
+                              memgraph::storage::PropertyValue(false)}) {
+      ASSERT_FALSE(store.SetProperty(prop, value, nullptr));
+      expected[prop] = value;
+      check();
+    }
+  }
+  for (uint64_t id : {0, 1, 40, 85, 80}) {
+    // Removals of the first, a middle and the last property.
+    const auto prop = memgraph::storage::PropertyId::FromUint(id);
+    ASSERT_FALSE(store.SetProperty(prop, memgraph::storage::PropertyValue(), nullptr));
+    expected.erase(prop);
+    check();
+  }
+  while (!expected.empty()) {
+    // Shrinks back to the encoding without a directory.
+    ASSERT_FALSE(store.SetProperty(expected.begin()->first, memgraph::storage::PropertyValue(), nullptr));
+    expected.erase(expected.begin());
+    check();
+  }
+}
+
+TEST(PropertyStore, DictionaryEncodedStrings) {
+  memgraph::storage::StringDictionary dictionary;
+  const auto country = memgraph::storage::PropertyId::FromUint(200);
+  const auto status = memgraph::storage::PropertyId::FromUint(201);
+  const auto other = memgraph::storage::PropertyId::FromUint(202);
+  dictionary.EncodeProperty(country);
+  dictionary.EncodeProperty(status);
+  ASSERT_EQ(dictionary.size(), 0);
+
+  {
+    std::vector<memgraph::storage::PropertyStore> stores(100);
+    for (size_t i = 0; i < stores.size(); ++i) {
+      ASSERT_TRUE(
+          stores[i].SetProperty(country, memgraph::storage::PropertyValue(i % 2 == 0 ? "HR" : "DE"), &dictionary));
+      ASSERT_TRUE(stores[i].SetProperty(other, memgraph::storage::PropertyValue("HR"), &dictionary));
+    }
+    // Only the two strings of the encoded property are in the dictionary.
+    ASSERT_EQ(dictionary.size(), 2);
+    ASSERT_EQ(stores[0].GetProperty(country, &dictionary), memgraph::storage::PropertyValue("HR"));
+    ASSERT_EQ(stores[1].GetProperty(country, &dictionary), memgraph::storage::PropertyValue("DE"));
+    ASSERT_TRUE(stores[0].IsPropertyEqual(country, memgraph::storage::PropertyValue("HR"), &dictionary));
+    ASSERT_FALSE(stores[0].IsPropertyEqual(country, memgraph::storage::PropertyValue("DE"), &dictionary));
+    ASSERT_FALSE(stores[0].IsPropertyEqual(country, memgraph::storage::PropertyValue("SI"), &dictionary));
+    ASSERT_FALSE(stores[0].IsPropertyEqual(country, memgraph::storage::PropertyValue(1), &dictionary));
+    ASSERT_FALSE(stores[0].IsPropertyEqual(country, memgraph::storage::PropertyValue(), &dictionary));
+    ASSERT_THAT(stores[1].Properties(&dictionary),
+                UnorderedElementsAre(std::pair(country, memgraph::storage::PropertyValue("DE")),
+                                     std::pair(other, memgraph::storage::PropertyValue("HR"))));
+
+    // Overwriting and removing the values releases their strings.
+    for (size_t i = 1; i < stores.size(); i += 2) {
+      ASSERT_FALSE(stores[i].SetProperty(country, memgraph::storage::PropertyValue("HR"), &dictionary));
+    }
+    ASSERT_EQ(dictionary.size(), 1);
+    // Setting the same string again keeps it in the dictionary.
+    ASSERT_FALSE(stores[0].SetProperty(country, memgraph::storage::PropertyValue("HR"), &dictionary));
+    ASSERT_EQ(dictionary.size(), 1);
+    for (size_t i = 0; i < stores.size() / 2; ++i) {
+      ASSERT_FALSE(stores[i].SetProperty(country, memgraph::storage::PropertyValue(5), &dictionary));
+    }
+    ASSERT_EQ(stores[0].GetProperty(country, &dictionary), memgraph::storage::PropertyValue(5));
+    ASSERT_EQ(dictionary.size(), 1);
+    for (size_t i = stores.size() / 2; i < stores.size(); i += 2) {
+      ASSERT_FALSE(stores[i].SetProperty(country, memgraph::storage::PropertyValue(), &dictionary));
+    }
+    ASSERT_EQ(dictionary.size(), 1);
+
+    ASSERT_TRUE(stores[stores.size() - 1].ClearProperties(&dictionary));
+    ASSERT_TRUE(stores[stores.size() - 1].InitProperties(
+        {{country, memgraph::storage::PropertyValue("SI")}, {status, memgraph::storage::PropertyValue("active")}},
+        &dictionary));
+    ASSERT_EQ(stores[stores.size() - 1].GetProperty(status, &dictionary), memgraph::storage::PropertyValue("active"));
+    ASSERT_EQ(dictionary.size(), 3);
+    // Moving a store moves its references along with it.
+    ASSERT_TRUE(stores[0].ClearProperties(&dictionary));
+    stores[0] = std::move(stores[stores.size() - 1]);
+    ASSERT_EQ(stores[0].GetProperty(country, &dictionary), memgraph::storage::PropertyValue("SI"));
+    ASSERT_EQ(dictionary.size(), 3);
+
+    // The remaining values are released by clearing the stores.
+    for (auto &store : stores) store.ClearProperties(&dictionary);
+  }
+  ASSERT_EQ(dictionary.size(), 0);
+
+  // Values of stores with a directory are encoded the same way.
+  memgraph::storage::PropertyStore store;
+  for (uint64_t i = 0; i < 30; ++i) {
+    store.SetProperty(memgraph::storage::PropertyId::FromUint(190 + i), memgraph::storage::PropertyValue("active"),
+                      &dictionary);
+  }
+  ASSERT_EQ(dictionary.size(), 1);
+  ASSERT_TRUE(store.IsPropertyEqual(status, memgraph::storage::PropertyValue("active"), &dictionary));
+  ASSERT_FALSE(store.SetProperty(status, memgraph::storage::PropertyValue("inactive"), &dictionary));
+  ASSERT_FALSE(
+      store.SetProperty(country, memgraph::storage::PropertyValue("a much longer string than before"), &dictionary));
+  ASSERT_EQ(store.GetProperty(country, &dictionary),
+            memgraph::storage::PropertyValue("a much longer string than before"));
+  ASSERT_EQ(store.GetProperty(status, &dictionary), memgraph::storage::PropertyValue("inactive"));
+  ASSERT_EQ(store.GetProperty(other, &dictionary), memgraph::storage::PropertyValue("active"));
+  // The value of `country` was the last reference to "active".
+  ASSERT_EQ(dictionary.size(), 2);
+  ASSERT_TRUE(store.ClearProperties(&dictionary));
+  ASSERT_EQ(dictionary.size(), 0);
+
+  // A dictionary only encodes the properties it was told to, so the same
+  // property ids of another storage are stored as plain strings.
+  memgraph::storage::StringDictionary other_dictionary;
+  ASSERT_TRUE(store.SetProperty(country, memgraph::storage::PropertyValue("HR"), &other_dictionary));
+  ASSERT_EQ(other_dictionary.size(), 0);
+  ASSERT_EQ(dictionary.size(), 0);
+  ASSERT_EQ(store.GetProperty(country, nullptr), memgraph::storage::PropertyValue("HR"));
+  ASSERT_TRUE(store.ClearProperties(&other_dictionary));
+}
@@ -0,0 +1,79 @@
+// Copyright 2022 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "storage/v2/undo_buffer.hpp"
+
+using memgraph::storage::Delta;
+using memgraph::storage::PropertyId;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::UndoBuffer;
+
+TEST(UndoBuffer, Empty) {
+  UndoBuffer buffer;
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(buffer.size(), 0);
+  ASSERT_TRUE(buffer.begin() == buffer.end());
+  buffer.clear();
+  ASSERT_TRUE(buffer.empty());
+}
+
+TEST(UndoBuffer, StableAndOrdered) {
+  std::atomic<uint64_t> timestamp{0};
+  UndoBuffer buffer;
+  std::vector<Delta *> deltas;
+  // Enough deltas to fill several blocks of the largest size.
+  const uint64_t count = 5 * UndoBuffer::kMaxBlockSize + 3;
+  for (uint64_t i = 0; i < count; ++i) {
+    if (i % 2 == 0) {
+      deltas.push_back(&buffer.emplace_back(Delta::DeleteObjectTag(), &timestamp, i));
+    } else {
+      // Strings are allocated on the heap, so they are leaked if the deltas
+      // aren't destroyed.
+      deltas.push_back(&buffer.emplace_back(Delta::SetPropertyTag(), PropertyId::FromUint(i),
+                                            PropertyValue(std::string(100, 'x')), &timestamp, i));
+    }
+    deltas.back()->next.store(i == 0 ? nullptr : deltas[i - 1]);
+  }
+  ASSERT_EQ(buffer.size(), count);
+
+  uint64_t i = 0;
+  for (const auto &delta : buffer) {
+    ASSERT_EQ(&delta, deltas[i]);
+    ASSERT_EQ(delta.command_id, i);
+    ASSERT_EQ(delta.action, i % 2 == 0 ? Delta::Action::DELETE_OBJECT : Delta::Action::SET_PROPERTY);
+    ASSERT_EQ(delta.next.load(), i == 0 ? nullptr : deltas[i - 1]);
+    ++i;
+  }
+  ASSERT_EQ(i, count);
+
+  UndoBuffer moved(std::move(buffer));
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_TRUE(buffer.begin() == buffer.end());
+  ASSERT_EQ(moved.size(), count);
+  ASSERT_EQ(&*moved.begin(), deltas[0]);
+
+  buffer = std::move(moved);
+  ASSERT_EQ(buffer.size(), count);
+  buffer.emplace_back(Delta::RecreateObjectTag(), &timestamp, count);
+  ASSERT_EQ(buffer.size(), count + 1);
+
+  buffer.clear();
+  ASSERT_TRUE(buffer.empty());
+  buffer.emplace_back(Delta::RecreateObjectTag(), &timestamp, 0);
+  ASSERT_EQ(buffer.size(), 1);
+  ASSERT_EQ(buffer.begin()->action, Delta::Action::RECREATE_OBJECT);
+}
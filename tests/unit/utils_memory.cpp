@@ -323,6 +323,42 @@ TEST(PoolResource, BlockDeallocation) {
   EXPECT_EQ(test_mem.new_count_, 0U);
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(LimitedMemoryResource, SharedLimit) {
+  memgraph::utils::MemoryLimit limit(1024);
+  memgraph::utils::LimitedMemoryResource first(memgraph::utils::NewDeleteResource(), &limit);
+  memgraph::utils::LimitedMemoryResource second(memgraph::utils::NewDeleteResource(), &limit);
+  auto *ptr = first.Allocate(1000);
+  EXPECT_EQ(second.GetAllocatedBytes(), 1000);
+  EXPECT_THROW(second.Allocate(100), memgraph::utils::BadAlloc);
+  EXPECT_EQ(limit.GetAllocatedBytes(), 1000);
+  first.Deallocate(ptr, 1000);
+  ptr = second.Allocate(1024);
+  EXPECT_EQ(first.GetAllocatedBytes(), 1024);
+  second.Deallocate(ptr, 1024);
+  EXPECT_EQ(limit.GetAllocatedBytes(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(LimitedMemoryResource, SharedLimitOutlivesResource) {
+  memgraph::utils::MemoryLimit limit(1024);
+  {
+    memgraph::utils::MonotonicBufferResource upstream(1024);
+    memgraph::utils::LimitedMemoryResource mem(&upstream, &limit);
+    mem.Allocate(100);
+    mem.Allocate(200);
+    EXPECT_EQ(mem.GetOwnAllocatedBytes(), 300);
+    EXPECT_EQ(limit.GetAllocatedBytes(), 300);
+  }
+  // The bytes which were never deallocated are given back to the limit.
+  EXPECT_EQ(limit.GetAllocatedBytes(), 0);
+
+  memgraph::utils::LimitedMemoryResource unlimited(memgraph::utils::NewDeleteResource(), nullptr);
+  auto *ptr = unlimited.Allocate(2048);
+  EXPECT_EQ(unlimited.GetAllocatedBytes(), 2048);
+  unlimited.Deallocate(ptr, 2048);
+}
+
 class AllocationTrackingMemory final : public memgraph::utils::MemoryResource {
  public:
   std::vector<size_t> allocated_sizes_;
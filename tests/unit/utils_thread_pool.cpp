@@ -13,7 +13,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include <utils/thread_pool.hpp>
 
@@ -38,3 +40,35 @@ TEST(ThreadPool, Basic) {
     ASSERT_EQ(count.load(), adder_count);
   }
 }
+
+TEST(ThreadPool, ParallelForRunsEveryTaskOnce) {
+  memgraph::utils::ThreadPool pool{4};
+  std::vector<std::atomic<int>> runs(1000);
+  memgraph::utils::ParallelFor(&pool, runs.size(), [&](size_t task) { runs[task].fetch_add(1); });
+  for (const auto &task_runs : runs) ASSERT_EQ(task_runs.load(), 1);
+
+  EXPECT_THROW(memgraph::utils::ParallelFor(&pool, 10,
+                                            [](size_t task) {
+                                              if (task == 3) throw std::runtime_error("task failed");
+                                            }),
+               std::runtime_error);
+}
+
+TEST(ThreadPool, ParallelForWithoutFreeWorkers) {
+  // The calling thread runs the tasks no pool thread takes, so neither a busy
+  // nor a shut down pool blocks the call.
+  memgraph::utils::ThreadPool busy_pool{1};
+  std::atomic<bool> release{false};
+  busy_pool.AddTask([&] {
+    while (!release) std::this_thread::sleep_for(1ms);
+  });
+  std::atomic<int> count{0};
+  memgraph::utils::ParallelFor(&busy_pool, 10, [&](size_t /*task*/) { count.fetch_add(1); });
+  EXPECT_EQ(count.load(), 10);
+  release = true;
+
+  memgraph::utils::ThreadPool stopped_pool{2};
+  stopped_pool.Shutdown();
+  memgraph::utils::ParallelFor(&stopped_pool, 10, [&](size_t /*task*/) { count.fetch_add(1); });
+  EXPECT_EQ(count.load(), 20);
+}